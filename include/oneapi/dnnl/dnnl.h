@@ -240,6 +240,56 @@ dnnl_status_t DNNL_API dnnl_primitive_get_cache_blob(
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_primitive_destroy(dnnl_primitive_t primitive);
 
+/// Starts creating a primitive on a library-managed background thread and
+/// returns a future to retrieve it.
+///
+/// The primitive is created as with #dnnl_primitive_create(), including the
+/// primitive cache lookup, with the maximum number of threads of the calling
+/// thread, so it's also placed in the primitive cache.
+///
+/// @note
+///     The primitive descriptor can be destroyed right after the call, but
+///     the engine must outlive the future.
+///
+/// @param future Output primitive future.
+/// @param primitive_desc Primitive descriptor used to create the primitive.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_create_async(
+        dnnl_primitive_future_t *future,
+        const_dnnl_primitive_desc_t primitive_desc);
+
+/// Checks whether creation of a primitive has completed.
+///
+/// @param future Primitive future.
+/// @param is_ready Output value, 1 if the primitive can be retrieved without
+///     blocking and 0 otherwise.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_future_is_ready(
+        const_dnnl_primitive_future_t future, int *is_ready);
+
+/// Waits for creation of a primitive to complete and retrieves it. The
+/// primitive can be retrieved only once.
+///
+/// @param future Primitive future.
+/// @param primitive Output primitive.
+/// @returns #dnnl_success on success, #dnnl_invalid_arguments if the
+///     primitive has been already retrieved, and the status of primitive
+///     creation otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_future_get(
+        dnnl_primitive_future_t future, dnnl_primitive_t *primitive);
+
+/// Destroys a primitive future. The destruction does not wait for creation to
+/// complete, a primitive which has not been retrieved is destroyed once it's
+/// created.
+///
+/// @param future Primitive future to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_future_destroy(
+        dnnl_primitive_future_t future);
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_attributes
@@ -716,6 +766,55 @@ dnnl_status_t DNNL_API dnnl_post_ops_get_params_dw(
         dnnl_data_type_t *dst_data_type, dnnl_dim_t *kernel_size,
         dnnl_dim_t *stride_size, dnnl_dim_t *padding_l_size);
 
+/// Appends a pooling post-op.
+///
+/// This post-op can only be fused with a 2D convolution. The post-ops
+/// appended before it are applied to the convolution output, and the post-ops
+/// appended after it are applied to the pooling output.
+///
+/// The kind of this post-op is #dnnl_pooling.
+///
+/// The number of outputs for primitive with fusion is one. The output spatial
+/// size can be derived as below:
+///
+/// output_height = (output_height_convolution + 2 * padding - kernel)
+///         / stride + 1
+/// output_width = (output_width_convolution + 2 * padding - kernel)
+///         / stride + 1
+///
+/// See @ref dev_guide_attributes_post_ops_pooling for more info.
+///
+/// @param post_ops Post-ops.
+/// @param alg_kind Pooling algorithm kind: #dnnl_pooling_max,
+///     #dnnl_pooling_avg_include_padding, or
+///     #dnnl_pooling_avg_exclude_padding.
+/// @param kernel_size Size of kernel of pooling post-op
+/// @param stride_size Size of stride of pooling post-op
+/// @param padding_l_size Size of left and top paddings of pooling post-op
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise
+dnnl_status_t DNNL_API dnnl_post_ops_append_pooling(dnnl_post_ops_t post_ops,
+        dnnl_alg_kind_t alg_kind, dnnl_dim_t kernel_size,
+        dnnl_dim_t stride_size, dnnl_dim_t padding_l_size);
+
+/// Returns the parameters of a pooling post-op.
+///
+/// @param post_ops Post-ops.
+/// @param index Index of the pooling post-op.
+/// @param alg_kind Output pooling algorithm kind.
+/// @param kernel_size Output size of kernel of pooling post-op
+/// @param stride_size Output size of stride of pooling post-op
+/// @param padding_l_size Output size of left and top paddings of pooling
+///     post-op
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise
+/// @returns #dnnl_invalid_arguments if @p index does not refer to a pooling
+///     post-op.
+dnnl_status_t DNNL_API dnnl_post_ops_get_params_pooling(
+        const_dnnl_post_ops_t post_ops, int index, dnnl_alg_kind_t *alg_kind,
+        dnnl_dim_t *kernel_size, dnnl_dim_t *stride_size,
+        dnnl_dim_t *padding_l_size);
+
 /// Appends a binary post-op.
 ///
 /// This post operation is categorized as #dnnl_binary.
@@ -965,6 +1064,61 @@ dnnl_status_t DNNL_API dnnl_memory_desc_create_with_coo_encoding(
         dnnl_data_type_t data_type, dnnl_dim_t nnz,
         dnnl_data_type_t indices_dt);
 
+/// Creates a memory descriptor for BSR encoding.
+///
+/// The tensor is split into blocks of @p block_dims and only the blocks that
+/// have non-zero entries are stored. The created memory descriptor will
+/// describe a memory object that contains 3 buffers. The buffers have the
+/// following meaning and assigned numbers (index):
+///  - 0: values, stored block by block, each block in the row-major order
+///  - 1: indices of the block columns
+///  - 2: pointers to the first block of each block row
+///
+/// @param memory_desc Output memory descriptor.
+/// @param ndims Number of dimensions
+/// @param dims Array of dimensions. Must be divisible by @p block_dims.
+/// @param data_type Elements data type.
+/// @param nnz Number of non-zero blocks.
+/// @param block_dims Array of dimensions of a block.
+/// @param indices_dt Data type of indices.
+/// @param pointers_dt Data type of pointers.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_desc_create_with_bsr_encoding(
+        dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
+        dnnl_data_type_t data_type, dnnl_dim_t nnz,
+        const dnnl_dims_t block_dims, dnnl_data_type_t indices_dt,
+        dnnl_data_type_t pointers_dt);
+
+/// Creates a memory descriptor for grouped encoding.
+///
+/// The tensor is a stack of @p group_count dense groups that are split along
+/// the dimension @p variable_dim_idx, each group having its own size along
+/// that dimension. The created memory descriptor will describe a memory
+/// object that contains 2 buffers. The buffers have the following meaning
+/// and assigned numbers (index):
+///  - 0: values, stored densely in the row-major order
+///  - 1: offsets, @p group_count + 1 non-decreasing entries where the first
+///       one is 0 and the last one is the size of the tensor along the
+///       dimension @p variable_dim_idx. Group `g` spans the range
+///       [offsets[g], offsets[g + 1]) along that dimension.
+///
+/// @param memory_desc Output memory descriptor.
+/// @param ndims Number of dimensions
+/// @param dims Array of dimensions. The dimension @p variable_dim_idx is the
+///     total size of all groups.
+/// @param data_type Elements data type.
+/// @param variable_dim_idx Index of the dimension whose size varies across
+///     groups. Only 0 is supported.
+/// @param group_count Number of groups.
+/// @param offsets_dt Data type of offsets.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_desc_create_with_grouped_encoding(
+        dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
+        dnnl_data_type_t data_type, int variable_dim_idx,
+        dnnl_dim_t group_count, dnnl_data_type_t offsets_dt);
+
 /// Creates a memory descriptor for packed sparse encoding.
 ///
 /// The created memory descriptor cannot be used to create a memory
@@ -1732,6 +1886,62 @@ dnnl_status_t DNNL_API dnnl_convolution_backward_weights_primitive_desc_create(
         const dnnl_dims_t padding_r, const_dnnl_primitive_desc_t hint_fwd_pd,
         const_dnnl_primitive_attr_t attr);
 
+/// Creates a primitive descriptor for a convolution backward propagation
+/// primitive that computes both the data and the weights gradients.
+///
+/// The primitive reads the diff destination tensor once per minibatch chunk
+/// and computes the data gradient and the weights gradient for the chunk
+/// back to back, which saves memory bandwidth compared to a pair of separate
+/// backward data and weights gradient primitives.
+///
+/// @note
+///     Memory descriptors can be initialized with
+///     #dnnl_format_tag_any or with format_kind set to #dnnl_format_kind_any.
+///
+/// Arrays @p strides, @p dilates, @p padding_l, and @p padding_r contain
+/// values for spatial dimensions only and hence must have the same number of
+/// elements as there are spatial dimensions. The order of values is the same
+/// as in the tensor: depth (for 3D tensors), height (for 3D and 2D tensors),
+/// and width.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind Convolution algorithm. Possible values are
+///     #dnnl_convolution_direct, #dnnl_convolution_winograd,
+///     #dnnl_convolution_auto.
+/// @param src_desc Source memory descriptor.
+/// @param diff_src_desc Diff source memory descriptor.
+/// @param weights_desc Weights memory descriptor.
+/// @param diff_weights_desc Diff weights memory descriptor.
+/// @param diff_bias_desc Diff bias memory descriptor. Passing NULL, a zero
+///     memory descriptor, or a memory descriptor with format_kind set to
+///     #dnnl_format_kind_undef disables the bias term.
+/// @param diff_dst_desc Diff destination memory descriptor.
+/// @param strides Array of strides for spatial dimension.
+/// @param dilates Array of dilations for spatial dimension. A zero value
+///     means no dilation in the corresponding dimension.
+/// @param padding_l Array of padding values for low indices for each spatial
+///     dimension `([[front,] top,] left)`.
+/// @param padding_r Array of padding values for high indices for each spatial
+///     dimension `([[back,] bottom,] right)`. Can be NULL in which case
+///     padding is considered to be symmetrical.
+/// @param hint_fwd_pd Primitive descriptor for a respective forward propagation
+///     primitive.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_convolution_backward_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t diff_src_desc,
+        const_dnnl_memory_desc_t weights_desc,
+        const_dnnl_memory_desc_t diff_weights_desc,
+        const_dnnl_memory_desc_t diff_bias_desc,
+        const_dnnl_memory_desc_t diff_dst_desc, const dnnl_dims_t strides,
+        const dnnl_dims_t dilates, const dnnl_dims_t padding_l,
+        const dnnl_dims_t padding_r, const_dnnl_primitive_desc_t hint_fwd_pd,
+        const_dnnl_primitive_attr_t attr);
+
 /// @} dnnl_api_convolution
 
 /// @addtogroup dnnl_api_deconvolution
@@ -3640,6 +3850,111 @@ dnnl_status_t DNNL_API dnnl_get_primitive_cache_capacity(int *capacity);
 ///     success.
 dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity(int capacity);
 
+/// Returns the number of shards the primitive cache is split into.
+///
+/// @param shards Primitive cache shards number to query. Concurrently
+/// accessing @p shards is safe.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p shards value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_shards(int *shards);
+
+/// Sets the number of shards the primitive cache is split into. Every shard
+/// is locked independently and holds an even part of the cache capacity, so
+/// threads creating different primitives contend less. Least recently used
+/// entries are evicted within a shard.
+///
+/// @param shards Primitive cache shards number to set. Entries already held
+/// by the primitive cache are redistributed between the new shards. If the
+/// @p shards value exceeds the capacity, then the excess shards hold no
+/// entries. Concurrently modifying @p shards is safe.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p shards value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_set_primitive_cache_shards(int shards);
+
+/// Returns the directory used by the library-managed persistent cache.
+///
+/// @param dir Persistent cache directory to query. An empty string is
+///     returned if the persistent cache is disabled. The string is owned by
+///     the library and stays valid until the next call of this function from
+///     the same thread.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p dir value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_persistent_cache_dir(const char **dir);
+
+/// Sets the directory used by the library-managed persistent cache. When the
+/// directory is set, cache blobs of created primitives are stored in it and
+/// used to speed up creation of identical primitives, including those created
+/// by other processes. Blobs produced by a different library version or for a
+/// different device are ignored.
+///
+/// @note
+///     Only primitives supporting cache blobs are affected, which currently
+///     are GPU primitives with the OpenCL runtime. Creation of CPU primitives
+///     doesn't change. See @ref dnnl_primitive_get_cache_blob.
+///
+/// @param dir Persistent cache directory to set. The directory must exist.
+///     Passing NULL or an empty string disables the persistent cache.
+///     Concurrently modifying @p dir is safe.
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_set_persistent_cache_dir(const char *dir);
+
+/// Creates primitives for a set of primitive descriptors in parallel on
+/// library-managed background threads and waits for completion. The
+/// primitives are destroyed right away, so the call only populates the
+/// primitive cache, which should have enough capacity to hold them.
+///
+/// @param n Number of primitive descriptors.
+/// @param primitive_descs Array of @p n primitive descriptors.
+/// @returns #dnnl_success on success and the status of the first failed
+///     primitive creation otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_precompile(
+        int n, const const_dnnl_primitive_desc_t *primitive_descs);
+
+/// Returns the number of packed copies of weights that can be held in the
+/// packed weights cache at the same time.
+///
+/// @param capacity Packed weights cache capacity to query. Concurrently
+/// accessing @p capacity is safe.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p capacity value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_packed_weights_cache_capacity(int *capacity);
+
+/// Sets the number of packed copies of weights that can be held in the
+/// packed weights cache at a time. Primitives that repack weights into an
+/// internal layout on every execution, e.g. matmul with plain weights, store
+/// the packed copy in the cache and reuse it in subsequent executions,
+/// including executions of other primitives consuming the same weights
+/// buffer with the same internal layout.
+///
+/// @warning
+///     The library does not track modifications of weights buffers. The
+///     packed copies of weights must be invalidated with
+///     #dnnl_packed_weights_cache_invalidate() when the weights are changed
+///     or their buffer is freed.
+///
+/// @param capacity Packed weights cache capacity to set. The cache is
+/// disabled by default. If a new @p capacity is less than a number of
+/// entries that the cache already has then the excess entries will be
+/// evicted. Setting the @p capacity to 0 clears the cache and disables it.
+/// Concurrently modifying @p capacity is safe.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p capacity value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_set_packed_weights_cache_capacity(int capacity);
+
+/// Drops packed copies of weights made from a buffer from the packed weights
+/// cache. Copies that are being produced concurrently are not stored in the
+/// cache.
+///
+/// @param handle Weights buffer whose packed copies to drop. Passing NULL
+///     drops all the entries.
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_packed_weights_cache_invalidate(const void *handle);
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_service
@@ -3878,6 +4193,55 @@ dnnl_status_t DNNL_API dnnl_sgemm(char transa, char transb, dnnl_dim_t M,
         dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A, dnnl_dim_t lda,
         const float *B, dnnl_dim_t ldb, float beta, float *C, dnnl_dim_t ldc);
 
+/// Performs a batch of independent single-precision matrix-matrix multiplies.
+///
+/// The operation is defined as:
+///
+/// `C[i] := alpha * op( A[i] ) * op( B[i] ) + beta * C[i]`
+///
+/// for each `i` in `[0, batch_size)`, where
+///  - `op( X ) = X` or `op( X ) = X**T` is the same for the whole batch,
+///  - `alpha` and `beta` are scalars shared by the whole batch, and
+///  - `A[i]`, `B[i]`, and `C[i]` are matrices:
+///     - `op( A[i] )` is an `M[i]xK[i]` matrix,
+///     - `op( B[i] )` is an `K[i]xN[i]` matrix,
+///     - `C[i]` is an `M[i]xN[i]` matrix.
+///
+/// The matrices are assumed to be stored in row-major order (the elements in
+/// each of the matrix rows are contiguous in memory). The problems may have
+/// different sizes and leading dimensions. The function is intended for many
+/// small problems: the problems with the same sizes share a single
+/// just-in-time generated kernel and the batch, rather than each of the
+/// problems, is distributed across the threads.
+///
+/// @note
+///     The matrices C[i] must not overlap.
+///
+/// @param batch_size The number of problems in the batch.
+/// @param transa Transposition flag for matrices A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrices B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M An array of the M dimensions.
+/// @param N An array of the N dimensions.
+/// @param K An array of the K dimensions.
+/// @param alpha The alpha parameter that is used to scale the products of
+///     matrices A and B.
+/// @param A An array of pointers to the A matrices data.
+/// @param lda An array of the leading dimensions for the matrices A.
+/// @param B An array of pointers to the B matrices data.
+/// @param ldb An array of the leading dimensions for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C An array of pointers to the C matrices data.
+/// @param ldc An array of the leading dimensions for the matrices C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_batch(dnnl_dim_t batch_size, char transa,
+        char transb, const dnnl_dim_t *M, const dnnl_dim_t *N,
+        const dnnl_dim_t *K, float alpha, const float *const *A,
+        const dnnl_dim_t *lda, const float *const *B, const dnnl_dim_t *ldb,
+        float beta, float *const *C, const dnnl_dim_t *ldc);
+
 /// Performs integer matrix-matrix multiply on 8-bit unsigned matrix A, 8-bit
 /// signed matrix B, and 32-bit signed resulting matrix C.
 ///
@@ -88,6 +88,13 @@ struct handle_traits<dnnl_primitive_t> {
     }
 };
 
+template <>
+struct handle_traits<dnnl_primitive_future_t> {
+    static dnnl_status_t destructor(dnnl_primitive_future_t p) {
+        return dnnl_primitive_future_destroy(p);
+    }
+};
+
 /// @endcond
 
 /// @} dnnl_api_utils
@@ -952,6 +959,10 @@ struct memory : public handle<dnnl_memory_t> {
         packed = dnnl_packed,
         /// Coordinate Sparse (COO) encoding.
         coo = dnnl_coo,
+        /// Block Compressed Sparse Row (BSR) encoding.
+        bsr = dnnl_bsr,
+        /// Grouped encoding.
+        grouped = dnnl_grouped,
     };
 
     /// Memory format tag specification.
@@ -2925,6 +2936,90 @@ struct memory : public handle<dnnl_memory_t> {
             return desc {md};
         }
 
+        /// Function for creating a memory descriptor for BSR sparse encoding.
+        ///
+        /// The tensor is split into blocks of @p block_dims and only the
+        /// blocks that have non-zero entries are stored. The created memory
+        /// descriptor will describe a memory object that contains 3 buffers.
+        /// The buffers have the following meaning and assigned numbers
+        /// (index):
+        ///  - 0: values, stored block by block, each block in the row-major
+        ///    order
+        ///  - 1: indices of the block columns
+        ///  - 2: pointers to the first block of each block row
+        ///
+        /// @param adims Tensor dimensions. Must be divisible by
+        ///     @p block_dims.
+        /// @param adata_type Data precision/type.
+        /// @param nnz Number of non-zero blocks.
+        /// @param block_dims Block dimensions.
+        /// @param index_dt Data type of indices.
+        /// @param pointer_dt Data type of pointers.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case a
+        ///     zero memory descriptor will be constructed. This flag is
+        ///     optional and defaults to false.
+        /// @sa @ref dev_guide_sparsity
+        static desc bsr(const dims &adims, data_type adata_type, dim nnz,
+                const dims &block_dims, data_type index_dt,
+                data_type pointer_dt, bool allow_empty = false) {
+            validate_dims(adims);
+            validate_container_size(block_dims,
+                    "dimensions of a block do not match the tensor",
+                    (int)adims.size(), (int)adims.size());
+            dnnl_memory_desc_t md = nullptr;
+            dnnl_status_t status = dnnl_memory_desc_create_with_bsr_encoding(
+                    &md, (int)adims.size(), adims.data(),
+                    convert_to_c(adata_type), nnz, block_dims.data(),
+                    convert_to_c(index_dt), convert_to_c(pointer_dt));
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a memory descriptor for BSR sparse "
+                        "encoding");
+            return desc {md};
+        }
+
+        /// Function for creating a memory descriptor for grouped encoding.
+        ///
+        /// The tensor is a stack of @p group_count dense groups that are
+        /// split along the dimension @p variable_dim_idx, each group having
+        /// its own size along that dimension. The created memory descriptor
+        /// will describe a memory object that contains 2 buffers. The
+        /// buffers have the following meaning and assigned numbers (index):
+        ///  - 0: values, stored densely in the row-major order
+        ///  - 1: offsets, @p group_count + 1 non-decreasing entries starting
+        ///    with 0. Group `g` spans the range [offsets[g], offsets[g + 1])
+        ///    along the dimension @p variable_dim_idx.
+        ///
+        /// @param adims Tensor dimensions. The dimension @p variable_dim_idx
+        ///     is the total size of all groups.
+        /// @param adata_type Data precision/type.
+        /// @param variable_dim_idx Index of the dimension whose size varies
+        ///     across groups. Only 0 is supported.
+        /// @param group_count Number of groups.
+        /// @param offsets_dt Data type of offsets.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case a
+        ///     zero memory descriptor will be constructed. This flag is
+        ///     optional and defaults to false.
+        /// @sa @ref dev_guide_sparsity
+        static desc grouped(const dims &adims, data_type adata_type,
+                int variable_dim_idx, dim group_count, data_type offsets_dt,
+                bool allow_empty = false) {
+            validate_dims(adims);
+            dnnl_memory_desc_t md = nullptr;
+            dnnl_status_t status
+                    = dnnl_memory_desc_create_with_grouped_encoding(&md,
+                            (int)adims.size(), adims.data(),
+                            convert_to_c(adata_type), variable_dim_idx,
+                            group_count, convert_to_c(offsets_dt));
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a memory descriptor for grouped "
+                        "encoding");
+            return desc {md};
+        }
+
         /// Function for creating a memory descriptor for packed sparse
         /// encoding.
         ///
@@ -3750,6 +3845,65 @@ struct post_ops : public handle<dnnl_post_ops_t> {
         padding_l_size = c_padding_l_size;
     }
 
+    /// Appends a pooling post-op.
+    ///
+    /// This post-op can only be fused with a 2D convolution. The post-ops
+    /// appended before it are applied to the convolution output, and the
+    /// post-ops appended after it are applied to the pooling output.
+    ///
+    /// The kind of this post-op is #dnnl_pooling.
+    ///
+    /// The number of outputs for primitive remain same as before. The output
+    /// spatial size can be derived as below:
+    ///
+    /// output_height = (output_height_convolution + 2 * padding - kernel)
+    ///         / stride + 1
+    /// output_width = (output_width_convolution + 2 * padding - kernel)
+    ///         / stride + 1
+    ///
+    /// See @ref dev_guide_attributes_post_ops_pooling for more info.
+    ///
+    /// @param aalgorithm Pooling algorithm kind:
+    ///     #dnnl::algorithm::pooling_max,
+    ///     #dnnl::algorithm::pooling_avg_include_padding, or
+    ///     #dnnl::algorithm::pooling_avg_exclude_padding.
+    /// @param kernel_size Size of kernel of pooling post-op
+    /// @param stride_size Size of stride of pooling post-op
+    /// @param padding_l_size Size of left and top paddings of pooling post-op
+    void append_pooling(algorithm aalgorithm, memory::dim kernel_size,
+            memory::dim stride_size, memory::dim padding_l_size) {
+        error::wrap_c_api(
+                dnnl_post_ops_append_pooling(get(), convert_to_c(aalgorithm),
+                        kernel_size, stride_size, padding_l_size),
+                "could not append a pooling post-op");
+    }
+
+    /// Returns the parameters of a pooling post-op.
+    ///
+    /// @param index Index of the pooling post-op.
+    /// @param aalgorithm Output pooling algorithm kind.
+    /// @param kernel_size Output size of kernel of pooling post-op
+    /// @param stride_size Output size of stride of pooling post-op
+    /// @param padding_l_size Output size of left and top paddings of pooling
+    ///     post-op
+    void get_params_pooling(int index, algorithm &aalgorithm,
+            memory::dim &kernel_size, memory::dim &stride_size,
+            memory::dim &padding_l_size) const {
+        dnnl_alg_kind_t c_alg;
+        dnnl_dim_t c_kernel_size;
+        dnnl_dim_t c_stride_size;
+        dnnl_dim_t c_padding_l_size;
+        error::wrap_c_api(dnnl_post_ops_get_params_pooling(get(), index,
+                                  &c_alg, &c_kernel_size, &c_stride_size,
+                                  &c_padding_l_size),
+                "could not get parameters of a pooling post-op");
+
+        aalgorithm = static_cast<dnnl::algorithm>(c_alg);
+        kernel_size = c_kernel_size;
+        stride_size = c_stride_size;
+        padding_l_size = c_padding_l_size;
+    }
+
     /// Appends a binary post-op.
     ///
     /// This post operation is categorized as #dnnl_binary.
@@ -6204,6 +6358,344 @@ struct convolution_backward_weights : public primitive {
         : primitive(pd, cache_blob) {}
 };
 
+/// Convolution backward propagation primitive that computes both the data
+/// and the weights gradients in a single pass over the diff destination.
+struct convolution_backward : public primitive {
+    /// Primitive descriptor for a convolution backward propagation primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a convolution backward
+        ///     propagation primitive with bias.
+        ///
+        /// @note
+        ///     All the memory descriptors may be initialized with the
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// Arrays @p strides, @p padding_l, and @p padding_r contain values
+        /// for spatial dimensions only and hence must have the same number of
+        /// elements as there are spatial dimensions. The order of values is
+        /// the same as in the tensor: depth (for 3D tensors), height (for 3D
+        /// and 2D tensors), and width.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Convolution algorithm. Possible values are
+        ///     #dnnl::algorithm::convolution_direct,
+        ///     #dnnl::algorithm::convolution_winograd, and
+        ///     #dnnl::algorithm::convolution_auto.
+        /// @param src_desc Source memory descriptor.
+        /// @param diff_src_desc Diff source memory descriptor.
+        /// @param weights_desc Weights memory descriptor.
+        /// @param diff_weights_desc Diff weights memory descriptor.
+        /// @param diff_bias_desc Diff bias memory descriptor. Passing zero
+        ///     memory descriptor disables the bias term.
+        /// @param diff_dst_desc Diff destination memory descriptor.
+        /// @param strides Strides for each spatial dimension.
+        /// @param padding_l Vector of padding values for low indices for each
+        ///     spatial dimension `([[front,] top,] left)`.
+        /// @param padding_r Vector of padding values for high indices for
+        ///     each spatial dimension `([[back,] bottom,] right)`.
+        /// @param hint_fwd_pd Primitive descriptor for a convolution
+        ///     forward propagation primitive. It is used as a hint for
+        ///     deciding which memory format to use.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc,
+                const memory::desc &diff_src_desc,
+                const memory::desc &weights_desc,
+                const memory::desc &diff_weights_desc,
+                const memory::desc &diff_bias_desc,
+                const memory::desc &diff_dst_desc, const memory::dims &strides,
+                const memory::dims &padding_l, const memory::dims &padding_r,
+                const convolution_forward::primitive_desc &hint_fwd_pd,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, aalgorithm, src_desc, diff_src_desc,
+                    weights_desc, diff_weights_desc, &diff_bias_desc,
+                    diff_dst_desc, strides, nullptr, padding_l, padding_r,
+                    hint_fwd_pd, attr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a convolution backward
+        ///     propagation primitive without bias.
+        ///
+        /// @note
+        ///     All the memory descriptors may be initialized with the
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// Arrays @p strides, @p padding_l, and @p padding_r contain values
+        /// for spatial dimensions only and hence must have the same number of
+        /// elements as there are spatial dimensions. The order of values is
+        /// the same as in the tensor: depth (for 3D tensors), height (for 3D
+        /// and 2D tensors), and width.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Convolution algorithm. Possible values are
+        ///     #dnnl::algorithm::convolution_direct,
+        ///     #dnnl::algorithm::convolution_winograd, and
+        ///     #dnnl::algorithm::convolution_auto.
+        /// @param src_desc Source memory descriptor.
+        /// @param diff_src_desc Diff source memory descriptor.
+        /// @param weights_desc Weights memory descriptor.
+        /// @param diff_weights_desc Diff weights memory descriptor.
+        /// @param diff_dst_desc Diff destination memory descriptor.
+        /// @param strides Strides for each spatial dimension.
+        /// @param padding_l Vector of padding values for low indices for each
+        ///     spatial dimension `([[front,] top,] left)`.
+        /// @param padding_r Vector of padding values for high indices for
+        ///     each spatial dimension `([[back,] bottom,] right)`.
+        /// @param hint_fwd_pd Primitive descriptor for a convolution
+        ///     forward propagation primitive. It is used as a hint for
+        ///     deciding which memory format to use.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc,
+                const memory::desc &diff_src_desc,
+                const memory::desc &weights_desc,
+                const memory::desc &diff_weights_desc,
+                const memory::desc &diff_dst_desc, const memory::dims &strides,
+                const memory::dims &padding_l, const memory::dims &padding_r,
+                const convolution_forward::primitive_desc &hint_fwd_pd,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, aalgorithm, src_desc, diff_src_desc,
+                    weights_desc, diff_weights_desc, nullptr, diff_dst_desc,
+                    strides, nullptr, padding_l, padding_r, hint_fwd_pd, attr,
+                    allow_empty) {}
+
+        /// Constructs a primitive descriptor for a convolution backward
+        ///     propagation primitive with bias.
+        ///
+        /// @note
+        ///     All the memory descriptors may be initialized with the
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// Arrays @p strides, @p dilates, @p padding_l, and @p padding_r
+        /// contain values for spatial dimensions only and hence must have the
+        /// same number of elements as there are spatial dimensions. The order
+        /// of values is the same as in the tensor: depth (for 3D tensors),
+        /// height (for 3D and 2D tensors), and width.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Convolution algorithm. Possible values are
+        ///     #dnnl::algorithm::convolution_direct,
+        ///     #dnnl::algorithm::convolution_winograd, and
+        ///     #dnnl::algorithm::convolution_auto.
+        /// @param src_desc Source memory descriptor.
+        /// @param diff_src_desc Diff source memory descriptor.
+        /// @param weights_desc Weights memory descriptor.
+        /// @param diff_weights_desc Diff weights memory descriptor.
+        /// @param diff_bias_desc Diff bias memory descriptor. Passing zero
+        ///     memory descriptor disables the bias term.
+        /// @param diff_dst_desc Diff destination memory descriptor.
+        /// @param strides Strides for each spatial dimension.
+        /// @param dilates Dilations for each spatial dimension. A zero value
+        ///     means no dilation in the corresponding dimension.
+        /// @param padding_l Vector of padding values for low indices for each
+        ///     spatial dimension `([[front,] top,] left)`.
+        /// @param padding_r Vector of padding values for high indices for
+        ///     each spatial dimension `([[back,] bottom,] right)`.
+        /// @param hint_fwd_pd Primitive descriptor for a convolution
+        ///     forward propagation primitive. It is used as a hint for
+        ///     deciding which memory format to use.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc,
+                const memory::desc &diff_src_desc,
+                const memory::desc &weights_desc,
+                const memory::desc &diff_weights_desc,
+                const memory::desc &diff_bias_desc,
+                const memory::desc &diff_dst_desc, const memory::dims &strides,
+                const memory::dims &dilates, const memory::dims &padding_l,
+                const memory::dims &padding_r,
+                const convolution_forward::primitive_desc &hint_fwd_pd,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, aalgorithm, src_desc, diff_src_desc,
+                    weights_desc, diff_weights_desc, &diff_bias_desc,
+                    diff_dst_desc, strides, &dilates, padding_l, padding_r,
+                    hint_fwd_pd, attr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a convolution backward
+        ///     propagation primitive without bias.
+        ///
+        /// @note
+        ///     All the memory descriptors may be initialized with the
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// Arrays @p strides, @p dilates, @p padding_l, and @p padding_r
+        /// contain values for spatial dimensions only and hence must have the
+        /// same number of elements as there are spatial dimensions. The order
+        /// of values is the same as in the tensor: depth (for 3D tensors),
+        /// height (for 3D and 2D tensors), and width.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Convolution algorithm. Possible values are
+        ///     #dnnl::algorithm::convolution_direct,
+        ///     #dnnl::algorithm::convolution_winograd, and
+        ///     #dnnl::algorithm::convolution_auto.
+        /// @param src_desc Source memory descriptor.
+        /// @param diff_src_desc Diff source memory descriptor.
+        /// @param weights_desc Weights memory descriptor.
+        /// @param diff_weights_desc Diff weights memory descriptor.
+        /// @param diff_dst_desc Diff destination memory descriptor.
+        /// @param strides Strides for each spatial dimension.
+        /// @param dilates Dilations for each spatial dimension. A zero value
+        ///     means no dilation in the corresponding dimension.
+        /// @param padding_l Vector of padding values for low indices for each
+        ///     spatial dimension `([[front,] top,] left)`.
+        /// @param padding_r Vector of padding values for high indices for
+        ///     each spatial dimension `([[back,] bottom,] right)`.
+        /// @param hint_fwd_pd Primitive descriptor for a convolution
+        ///     forward propagation primitive. It is used as a hint for
+        ///     deciding which memory format to use.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc,
+                const memory::desc &diff_src_desc,
+                const memory::desc &weights_desc,
+                const memory::desc &diff_weights_desc,
+                const memory::desc &diff_dst_desc, const memory::dims &strides,
+                const memory::dims &dilates, const memory::dims &padding_l,
+                const memory::dims &padding_r,
+                const convolution_forward::primitive_desc &hint_fwd_pd,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, aalgorithm, src_desc, diff_src_desc,
+                    weights_desc, diff_weights_desc, nullptr, diff_dst_desc,
+                    strides, &dilates, padding_l, padding_r, hint_fwd_pd, attr,
+                    allow_empty) {}
+
+        /// Constructs a primitive descriptor for a convolution backward
+        /// propagation primitive from a C API primitive descriptor that must
+        /// have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a convolution backward
+        ///     propagation primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::convolution,
+                    dnnl::prop_kind::backward) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::diff_src_desc()const
+        memory::desc diff_src_desc() const { return base::diff_src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const { return base::weights_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::diff_weights_desc()const
+        memory::desc diff_weights_desc() const {
+            return base::diff_weights_desc(0);
+        }
+
+        /// @copydoc dnnl::primitive_desc_base::diff_dst_desc()const
+        memory::desc diff_dst_desc() const { return base::diff_dst_desc(0); }
+
+        /// Returns the diff bias memory descriptor.
+        /// @returns The diff bias memory descriptor.
+        /// @returns A zero memory descriptor of the primitive does not have a
+        ///          diff bias parameter.
+        memory::desc diff_bias_desc() const {
+            return base::diff_weights_desc(1);
+        }
+
+        /// @copydoc dnnl::primitive_desc_base::get_algorithm()const
+        algorithm get_algorithm() const { return base::get_algorithm(); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_prop_kind()const
+        prop_kind get_prop_kind() const { return base::get_prop_kind(); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_strides()const
+        memory::dims get_strides() const { return base::get_strides(); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_dilations()const
+        memory::dims get_dilations() const { return base::get_dilations(); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_padding_l()const
+        memory::dims get_padding_l() const { return base::get_padding_l(); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_padding_r()const
+        memory::dims get_padding_r() const { return base::get_padding_r(); }
+
+    private:
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc,
+                const memory::desc &diff_src_desc,
+                const memory::desc &weights_desc,
+                const memory::desc &diff_weights_desc,
+                const memory::desc *diff_bias_desc,
+                const memory::desc &diff_dst_desc, const memory::dims &strides,
+                const memory::dims *dilates, const memory::dims &padding_l,
+                const memory::dims &padding_r,
+                const convolution_forward::primitive_desc &hint_fwd_pd,
+                const primitive_attr &attr, bool allow_empty) {
+
+            memory::validate_dims(strides, src_desc.get_ndims() - 2);
+            memory::validate_dims(padding_l, src_desc.get_ndims() - 2);
+            memory::validate_dims(padding_r, src_desc.get_ndims() - 2);
+
+            if (dilates)
+                memory::validate_dims(*dilates, src_desc.get_ndims() - 2);
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status
+                    = dnnl_convolution_backward_primitive_desc_create(&pd,
+                            aengine.get(), convert_to_c(aalgorithm),
+                            src_desc.get(), diff_src_desc.get(),
+                            weights_desc.get(), diff_weights_desc.get(),
+                            optional_arg(diff_bias_desc), diff_dst_desc.get(),
+                            &strides[0], optional_arg(dilates), &padding_l[0],
+                            &padding_r[0], hint_fwd_pd.get(), attr.get());
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for "
+                        "the convolution backward propagation primitive. Run "
+                        "workload with environment variable ONEDNN_VERBOSE=all "
+                        "to get additional diagnostic information.");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    convolution_backward() = default;
+
+    /// Constructs a convolution backward propagation primitive.
+    /// @param pd Primitive descriptor for a convolution backward propagation
+    ///     primitive.
+    convolution_backward(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a convolution backward propagation primitive from a cache
+    ///     blob.
+    /// @param pd Primitive descriptor for a convolution backward propagation
+    ///     primitive.
+    /// @param cache_blob Cache blob.
+    convolution_backward(
+            const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
 /// @} dnnl_api_convolution
 //
 /// @addtogroup dnnl_api_deconvolution Deconvolution
@@ -13932,6 +14424,113 @@ inline void set_primitive_cache_capacity(int capacity) {
             "could not set primitive cache capacity");
 }
 
+/// Returns the number of shards the primitive cache is split into.
+inline int get_primitive_cache_shards() {
+    int result = 0;
+    error::wrap_c_api(dnnl_get_primitive_cache_shards(&result),
+            "could not get primitive cache shards");
+    return result;
+}
+
+/// @copydoc dnnl_set_primitive_cache_shards(int shards)
+inline void set_primitive_cache_shards(int shards) {
+    error::wrap_c_api(dnnl_set_primitive_cache_shards(shards),
+            "could not set primitive cache shards");
+}
+
+/// Returns the directory used by the library-managed persistent cache.
+inline std::string get_persistent_cache_dir() {
+    const char *result = nullptr;
+    error::wrap_c_api(dnnl_get_persistent_cache_dir(&result),
+            "could not get persistent cache directory");
+    return result;
+}
+
+/// @copydoc dnnl_set_persistent_cache_dir(const char *dir)
+inline void set_persistent_cache_dir(const std::string &dir) {
+    error::wrap_c_api(dnnl_set_persistent_cache_dir(dir.c_str()),
+            "could not set persistent cache directory");
+}
+
+/// Returns the number of packed copies of weights that can be held in the
+/// packed weights cache at the same time.
+inline int get_packed_weights_cache_capacity() {
+    int result = 0;
+    error::wrap_c_api(dnnl_get_packed_weights_cache_capacity(&result),
+            "could not get packed weights cache capacity");
+    return result;
+}
+
+/// @copydoc dnnl_set_packed_weights_cache_capacity(int capacity)
+inline void set_packed_weights_cache_capacity(int capacity) {
+    error::wrap_c_api(dnnl_set_packed_weights_cache_capacity(capacity),
+            "could not set packed weights cache capacity");
+}
+
+/// @copydoc dnnl_packed_weights_cache_invalidate(const void *handle)
+inline void packed_weights_cache_invalidate(const void *handle = nullptr) {
+    error::wrap_c_api(dnnl_packed_weights_cache_invalidate(handle),
+            "could not invalidate packed weights cache");
+}
+
+/// A primitive being created on a library-managed background thread.
+///
+/// The primitive is created with the maximum number of threads of the thread
+/// constructing the future, so it's also placed in the primitive cache and
+/// creating a primitive for the same primitive descriptor later is cheap.
+struct primitive_future : public handle<dnnl_primitive_future_t> {
+    using handle::handle;
+
+    /// Default constructor. Constructs an empty object.
+    primitive_future() = default;
+
+    /// Starts creating a primitive.
+    ///
+    /// @param pd Primitive descriptor. It can be destroyed right after the
+    ///     call, but its engine must outlive the future.
+    primitive_future(const primitive_desc &pd) {
+        dnnl_primitive_future_t result;
+        error::wrap_c_api(dnnl_primitive_create_async(&result, pd.get()),
+                "could not start creating a primitive");
+        reset(result);
+    }
+
+    /// Returns whether the primitive can be retrieved without blocking.
+    bool is_ready() const {
+        int result = 0;
+        error::wrap_c_api(dnnl_primitive_future_is_ready(get(), &result),
+                "could not query a primitive future");
+        return result != 0;
+    }
+
+    /// Waits for the primitive to be created and returns it. The primitive
+    /// can be retrieved only once.
+    ///
+    /// @returns The created primitive.
+    primitive get_primitive() {
+        dnnl_primitive_t result;
+        error::wrap_c_api(dnnl_primitive_future_get(get(), &result),
+                "could not create a primitive");
+        return primitive(result);
+    }
+};
+
+/// Creates primitives for a set of primitive descriptors in parallel on
+/// library-managed background threads and waits for completion. The
+/// primitives are destroyed right away, so the call only populates the
+/// primitive cache, which should have enough capacity to hold them.
+///
+/// @param pds Primitive descriptors.
+inline void precompile_primitives(const std::vector<primitive_desc> &pds) {
+    std::vector<const_dnnl_primitive_desc_t> c_pds;
+    c_pds.reserve(pds.size());
+    for (const auto &pd : pds)
+        c_pds.push_back(pd.get());
+    error::wrap_c_api(
+            dnnl_primitive_precompile((int)c_pds.size(), c_pds.data()),
+            "could not precompile primitives");
+}
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_blas BLAS functions
@@ -13949,6 +14548,16 @@ inline status sgemm(char transa, char transb, dnnl_dim_t M, dnnl_dim_t N,
             transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc));
 }
 
+/// @copydoc dnnl_sgemm_batch()
+inline status sgemm_batch(dnnl_dim_t batch_size, char transa, char transb,
+        const dnnl_dim_t *M, const dnnl_dim_t *N, const dnnl_dim_t *K,
+        float alpha, const float *const *A, const dnnl_dim_t *lda,
+        const float *const *B, const dnnl_dim_t *ldb, float beta,
+        float *const *C, const dnnl_dim_t *ldc) {
+    return static_cast<status>(dnnl_sgemm_batch(batch_size, transa, transb, M,
+            N, K, alpha, A, lda, B, ldb, beta, C, ldc));
+}
+
 /// @copydoc dnnl_gemm_u8s8s32()
 inline status gemm_u8s8s32(char transa, char transb, char offsetc, dnnl_dim_t M,
         dnnl_dim_t N, dnnl_dim_t K, float alpha, const uint8_t *A,
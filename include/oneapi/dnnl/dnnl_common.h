@@ -101,6 +101,26 @@ dnnl_status_t DNNL_API dnnl_stream_get_engine(
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_stream_wait(dnnl_stream_t stream);
 
+/// Binds threads executing primitives in a CPU stream to the CPUs of the given
+/// NUMA nodes. Thread `i` is bound to the `i`-th CPU of the nodes, taken node
+/// by node, so threads form per-node teams and contiguous work partitions of
+/// a team stay within its node.
+///
+/// @note
+///     The binding takes effect at the next primitive execution and persists
+///     in the threads until they are bound again. For the best performance,
+///     primitives should be created with the maximum number of threads equal
+///     to the number of CPUs of the nodes.
+///
+/// @param stream CPU execution stream.
+/// @param nnodes Number of NUMA nodes. Zero disables the binding.
+/// @param nodes Array of @p nnodes NUMA node indices.
+/// @returns #dnnl_success on success, #dnnl_unimplemented if the binding is
+///     not supported by the threading runtime or the OS, and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_stream_set_cpu_numa_nodes(
+        dnnl_stream_t stream, int nnodes, const int *nodes);
+
 /// Destroys an execution stream.
 ///
 /// @param stream Execution stream to destroy.
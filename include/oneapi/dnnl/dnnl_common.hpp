@@ -369,6 +369,18 @@ struct stream : public handle<dnnl_stream_t> {
                 dnnl_stream_wait(get()), "could not wait on a stream");
         return *this;
     }
+
+    /// Binds threads executing primitives in a CPU stream to the CPUs of the
+    /// given NUMA nodes. An empty list disables the binding.
+    ///
+    /// @param nodes NUMA node indices.
+    /// @returns The stream itself.
+    stream &set_cpu_numa_nodes(const std::vector<int> &nodes) {
+        error::wrap_c_api(dnnl_stream_set_cpu_numa_nodes(get(),
+                                  (int)nodes.size(), nodes.data()),
+                "could not set NUMA nodes of a stream");
+        return *this;
+    }
 };
 
 //NOLINTBEGIN(bugprone-macro-parentheses)
@@ -771,6 +771,69 @@ dnnl_status_t DNNL_API dnnl_graph_set_constant_tensor_cache_capacity(
 dnnl_status_t DNNL_API dnnl_graph_get_constant_tensor_cache_capacity(
         dnnl_engine_kind_t eng_kind, size_t *size);
 
+/// Control the backing store directory for the constant tensor cache that used
+/// for specific engine kind. When the directory is set, cached tensors are
+/// written to files in it, and identical tensors requested later, including
+/// by other processes, are mapped from these files read-only instead of being
+/// computed. Processes mapping the same file share one physical copy of the
+/// tensors. The constant tensor cache capacity still limits the size of the
+/// tensors held by a process.
+///
+/// @param eng_kind The engine kind that the constant tensor cache used for.
+///     Only #dnnl_cpu is supported.
+/// @param dir The backing store directory to set. The directory must exist.
+///     Passing NULL or an empty string disables the backing store.
+/// @returns #dnnl_unimplemented if the backing store is not supported for
+///     the @p eng_kind or on the platform, and #dnnl_success on success.
+dnnl_status_t DNNL_API dnnl_graph_set_constant_tensor_cache_dir(
+        dnnl_engine_kind_t eng_kind, const char *dir);
+
+/// Return the backing store directory of constant tensor cache.
+///
+/// @param eng_kind The engine kind that the constant tensor cache used for.
+/// @param dir The backing store directory to query. An empty string is
+///     returned if the backing store is disabled. The string is owned by the
+///     library and stays valid until the next call of this function from
+///     the same thread.
+/// @returns #dnnl_invalid_arguments if the @p dir is nullptr, and
+///     #dnnl_success on success.
+dnnl_status_t DNNL_API dnnl_graph_get_constant_tensor_cache_dir(
+        dnnl_engine_kind_t eng_kind, const char **dir);
+
+/// Control the eviction policy of the constant tensor cache that used for
+/// specific engine kind. By default, no tensors are evicted and new tensors
+/// are not cached once the capacity is reached.
+///
+/// @param eng_kind The engine kind that the constant tensor cache used for.
+/// @param policy The eviction policy to set.
+/// @returns #dnnl_invalid_arguments if the @p policy value is invalid, and
+///     #dnnl_success on success.
+dnnl_status_t DNNL_API dnnl_graph_set_constant_tensor_cache_eviction_policy(
+        dnnl_engine_kind_t eng_kind,
+        dnnl_graph_constant_tensor_cache_eviction_policy_t policy);
+
+/// Return the eviction policy of the constant tensor cache.
+///
+/// @param eng_kind The engine kind that the constant tensor cache used for.
+/// @param policy The eviction policy to query.
+/// @returns #dnnl_invalid_arguments if the @p policy is nullptr, and
+///     #dnnl_success on success.
+dnnl_status_t DNNL_API dnnl_graph_get_constant_tensor_cache_eviction_policy(
+        dnnl_engine_kind_t eng_kind,
+        dnnl_graph_constant_tensor_cache_eviction_policy_t *policy);
+
+/// Return statistics of the constant tensor cache accumulated since the
+/// library was loaded. If there are multiple devices for an engine kind, the
+/// statistics are summed over all devices.
+///
+/// @param eng_kind The engine kind that the constant tensor cache used for.
+/// @param stats The statistics to query.
+/// @returns #dnnl_invalid_arguments if the @p stats is nullptr, and
+///     #dnnl_success on success.
+dnnl_status_t DNNL_API dnnl_graph_get_constant_tensor_cache_stats(
+        dnnl_engine_kind_t eng_kind,
+        dnnl_graph_constant_tensor_cache_stats_t *stats);
+
 /// @} dnnl_graph_api_constant_tensor_cache
 
 /// @} dnnl_graph_api
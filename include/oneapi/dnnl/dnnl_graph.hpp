@@ -860,6 +860,9 @@ public:
         Wildcard = dnnl_graph_op_wildcard,
         GenIndex = dnnl_graph_op_gen_index,
         GreaterEqual = dnnl_graph_op_greater_equal,
+        PagedCacheLoad = dnnl_graph_op_paged_cache_load,
+        RotaryEmbedding = dnnl_graph_op_rotary_embedding,
+        Gather = dnnl_graph_op_gather,
         // Sentinel
         LastSymbol = dnnl_graph_op_last_symbol,
     };
@@ -1630,6 +1633,89 @@ inline size_t get_constant_tensor_cache_capacity(engine::kind kind) {
     return size;
 }
 
+/// Control the backing store directory for the constant tensor cache that used
+/// for specific engine kind. Cached tensors are written to files in the
+/// directory and mapped read-only by processes requesting identical tensors.
+///
+/// @param kind The engine kind that the constant tensor cache used for.
+/// @param dir The backing store directory to set. An empty string disables the
+///     backing store.
+inline void set_constant_tensor_cache_dir(
+        engine::kind kind, const std::string &dir) {
+    error::wrap_c_api(dnnl_graph_set_constant_tensor_cache_dir(
+                              static_cast<dnnl_engine_kind_t>(kind),
+                              dir.c_str()),
+            "fail to set constant tensor cache directory");
+}
+
+/// Return the backing store directory of constant tensor cache.
+///
+/// @param kind The engine kind that the constant tensor cache used for.
+inline std::string get_constant_tensor_cache_dir(engine::kind kind) {
+    const char *dir = nullptr;
+    error::wrap_c_api(dnnl_graph_get_constant_tensor_cache_dir(
+                              static_cast<dnnl_engine_kind_t>(kind), &dir),
+            "fail to get constant tensor cache directory");
+    return dir;
+}
+
+/// Eviction policy of the constant tensor cache.
+enum class constant_tensor_cache_eviction_policy {
+    /// New tensors are not cached once the capacity is reached.
+    none = dnnl_graph_constant_tensor_cache_eviction_none,
+    /// The least recently used tensors are evicted to cache a new tensor.
+    lru = dnnl_graph_constant_tensor_cache_eviction_lru,
+    /// GreedyDual-Size policy. Tensors with the lowest time needed to compute
+    /// them per byte are evicted first, while recently used tensors are
+    /// retained longer.
+    greedy_dual_size
+    = dnnl_graph_constant_tensor_cache_eviction_greedy_dual_size,
+};
+
+/// Statistics of the constant tensor cache.
+using constant_tensor_cache_stats = dnnl_graph_constant_tensor_cache_stats_t;
+
+/// Control the eviction policy of the constant tensor cache that used for
+/// specific engine kind.
+///
+/// @param kind The engine kind that the constant tensor cache used for.
+/// @param policy The eviction policy to set.
+inline void set_constant_tensor_cache_eviction_policy(
+        engine::kind kind, constant_tensor_cache_eviction_policy policy) {
+    error::wrap_c_api(
+            dnnl_graph_set_constant_tensor_cache_eviction_policy(
+                    static_cast<dnnl_engine_kind_t>(kind),
+                    static_cast<
+                            dnnl_graph_constant_tensor_cache_eviction_policy_t>(
+                            policy)),
+            "fail to set constant tensor cache eviction policy");
+}
+
+/// Return the eviction policy of the constant tensor cache.
+///
+/// @param kind The engine kind that the constant tensor cache used for.
+inline constant_tensor_cache_eviction_policy
+get_constant_tensor_cache_eviction_policy(engine::kind kind) {
+    dnnl_graph_constant_tensor_cache_eviction_policy_t policy;
+    error::wrap_c_api(dnnl_graph_get_constant_tensor_cache_eviction_policy(
+                              static_cast<dnnl_engine_kind_t>(kind), &policy),
+            "fail to get constant tensor cache eviction policy");
+    return static_cast<constant_tensor_cache_eviction_policy>(policy);
+}
+
+/// Return statistics of the constant tensor cache summed over all devices of
+/// the engine kind.
+///
+/// @param kind The engine kind that the constant tensor cache used for.
+inline constant_tensor_cache_stats get_constant_tensor_cache_stats(
+        engine::kind kind) {
+    constant_tensor_cache_stats stats;
+    error::wrap_c_api(dnnl_graph_get_constant_tensor_cache_stats(
+                              static_cast<dnnl_engine_kind_t>(kind), &stats),
+            "fail to get constant tensor cache statistics");
+    return stats;
+}
+
 /// @} dnnl_graph_api_constant_tensor_cache
 
 } // namespace graph
@@ -261,6 +261,9 @@ typedef enum {
     dnnl_graph_op_group_norm,
     dnnl_graph_op_gen_index,
     dnnl_graph_op_greater_equal,
+    dnnl_graph_op_paged_cache_load,
+    dnnl_graph_op_rotary_embedding,
+    dnnl_graph_op_gather,
     dnnl_graph_op_last_symbol,
 } dnnl_graph_op_kind_t;
 
@@ -469,6 +472,37 @@ typedef const struct dnnl_graph_tensor *const_dnnl_graph_tensor_t;
 
 /// @} dnnl_graph_api_tensor
 
+/// @addtogroup dnnl_graph_api_constant_tensor_cache
+/// @{
+
+/// Eviction policy of the constant tensor cache.
+typedef enum {
+    /// New tensors are not cached once the capacity is reached.
+    dnnl_graph_constant_tensor_cache_eviction_none = 0,
+    /// The least recently used tensors are evicted to cache a new tensor.
+    dnnl_graph_constant_tensor_cache_eviction_lru,
+    /// GreedyDual-Size policy. Tensors with the lowest time needed to compute
+    /// them per byte are evicted first, while recently used tensors are
+    /// retained longer.
+    dnnl_graph_constant_tensor_cache_eviction_greedy_dual_size,
+} dnnl_graph_constant_tensor_cache_eviction_policy_t;
+
+/// Statistics of the constant tensor cache.
+typedef struct {
+    /// Number of requests for tensors found in the cache.
+    size_t hits;
+    /// Number of requests for tensors missing in the cache.
+    size_t misses;
+    /// Number of tensors evicted from the cache.
+    size_t evictions;
+    /// Total size of tensors evicted from the cache in bytes.
+    size_t evicted_bytes;
+    /// Total size of tensors currently held by the cache in bytes.
+    size_t size_bytes;
+} dnnl_graph_constant_tensor_cache_stats_t;
+
+/// @} dnnl_graph_api_constant_tensor_cache
+
 /// @} dnnl_graph_api
 
 /// @} dnnl_api
@@ -75,6 +75,14 @@ typedef enum {
     dnnl_packed,
     /// Coordinate Sparse Encoding (COO).
     dnnl_coo,
+    /// Block Compressed Sparse Row (BSR) encoding. The tensor is split into
+    /// dense blocks of the same shape and only the blocks that have non-zero
+    /// entries are stored, in the same order as the entries of CSR.
+    dnnl_bsr,
+    /// Grouped encoding. The tensor is a stack of dense row-major groups
+    /// whose sizes along one dimension vary and are given by an offsets
+    /// buffer, e.g. the tokens routed to each expert of a mixture of experts.
+    dnnl_grouped,
 } dnnl_sparse_encoding_t;
 
 #ifdef DNNL_EXPERIMENTAL_PROFILING
@@ -2474,6 +2482,14 @@ typedef struct dnnl_primitive *dnnl_primitive_t;
 /// A constant primitive handle.
 typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 
+/// @struct dnnl_primitive_future
+/// An opaque structure to describe a primitive being created asynchronously.
+struct dnnl_primitive_future;
+/// A primitive future handle.
+typedef struct dnnl_primitive_future *dnnl_primitive_future_t;
+/// A constant primitive future handle.
+typedef const struct dnnl_primitive_future *const_dnnl_primitive_future_t;
+
 /// Undefined argument.
 #define DNNL_ARG_UNDEF 0
 /// Source argument #0.
@@ -174,6 +174,27 @@ dnnl_status_t DNNL_API dnnl_brgemm_set_B_scales(
 dnnl_status_t DNNL_API dnnl_brgemm_set_D_scales(
         dnnl_brgemm_t brgemm, int d_scale_mask);
 
+/// Sets packing of tensor B by a BRGeMM ukernel object.
+///
+/// When set, tensors B passed to the execution calls are expected in the
+/// `in_pack_type` layout. The ukernel packs a tensor B the first time it sees
+/// its address on the calling thread and keeps the packed copy in a
+/// thread-local buffer bounded by the L2 cache size. Later calls on the same
+/// thread reuse the copy, so the content of tensor B must not change until
+/// #dnnl_brgemm_release_hw_context() is called on the thread. This removes a
+/// separate `dnnl_transform_execute` pass over tensor B. The `ldb` value
+/// passed at the creation stage becomes the leading dimension of the packed
+/// tensor and must be 16, 32, 48, or 64, not less than N.
+///
+/// @param brgemm BRGeMM ukernel object.
+/// @param in_pack_type Packing type of tensors B passed for execution. Must be
+///     one of `dnnl_pack_type_no_trans`, or `dnnl_pack_type_trans`.
+/// @param in_ldb Leading dimension of tensors B passed for execution.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_brgemm_set_pack_B(dnnl_brgemm_t brgemm,
+        dnnl_pack_type_t in_pack_type, dnnl_dim_t in_ldb);
+
 /// Finalizes initialization of a BRGeMM ukernel object.
 ///
 /// This step is mandatory to query information from the object.
@@ -276,6 +297,41 @@ dnnl_status_t DNNL_API dnnl_brgemm_execute_postops(const_dnnl_brgemm_t brgemm,
         const void *C_ptr, void *D_ptr, void *scratchpad_ptr,
         const_dnnl_ukernel_attr_params_t attr_params);
 
+/// Executes a BRGeMM ukernel object with tensors A and B passed as arrays of
+/// pointers.
+///
+/// @param brgemm BRGeMM ukernel object.
+/// @param A_ptrs Array of pointers to tensors A, one for each batch. The
+///     number of batches must coincide with the `batch_size` value passed at
+///     the creation stage.
+/// @param B_ptrs Array of pointers to tensors B, one for each batch.
+/// @param C_ptr Pointer to a tensor C (accumulation buffer).
+/// @param scratchpad_ptr Pointer to a scratchpad buffer.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_brgemm_execute_ptrs(const_dnnl_brgemm_t brgemm,
+        const void *const *A_ptrs, const void *const *B_ptrs, void *C_ptr,
+        void *scratchpad_ptr);
+
+/// Executes a BRGeMM ukernel object with post operations and with tensors A
+/// and B passed as arrays of pointers.
+///
+/// @param brgemm BRGeMM ukernel object.
+/// @param A_ptrs Array of pointers to tensors A, one for each batch. The
+///     number of batches must coincide with the `batch_size` value passed at
+///     the creation stage.
+/// @param B_ptrs Array of pointers to tensors B, one for each batch.
+/// @param C_ptr Pointer to a tensor C (accumulation buffer).
+/// @param D_ptr Pointer to a tensor D (output buffer).
+/// @param scratchpad_ptr Pointer to a scratchpad buffer.
+/// @param attr_params Ukernel attributes memory storage.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_brgemm_execute_ptrs_postops(
+        const_dnnl_brgemm_t brgemm, const void *const *A_ptrs,
+        const void *const *B_ptrs, const void *C_ptr, void *D_ptr,
+        void *scratchpad_ptr, const_dnnl_ukernel_attr_params_t attr_params);
+
 /// Destroys a BRGeMM ukernel object.
 ///
 /// @param brgemm BRGeMM ukernel object to destroy.
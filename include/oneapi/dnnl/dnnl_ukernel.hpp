@@ -257,6 +257,26 @@ struct brgemm : public handle<dnnl_brgemm_t> {
             error::wrap_c_api(status, "could not set D scales");
     }
 
+    /// Sets packing of tensor B by a BRGeMM ukernel object.
+    ///
+    /// When set, tensors B passed for execution are expected in the
+    /// `in_pack_type` layout. The ukernel packs a tensor B the first time it
+    /// sees its address on the calling thread and reuses the packed copy in
+    /// later calls on the thread, so the content of tensor B must not change
+    /// until #release_hw_context() is called on the thread. The `ldb` value
+    /// passed at object construction stage becomes the leading dimension of
+    /// the packed tensor and must be 16, 32, 48, or 64, not less than N.
+    ///
+    /// @param in_pack_type Packing type of tensors B passed for execution.
+    ///     Must be one of `pack_type::no_trans`, or `pack_type::trans`.
+    /// @param in_ldb Leading dimension of tensors B passed for execution.
+    void set_pack_B(pack_type in_pack_type, memory::dim in_ldb) {
+        dnnl_status_t status = dnnl_brgemm_set_pack_B(get(),
+                static_cast<dnnl_pack_type_t>(in_pack_type), in_ldb);
+        if (status != dnnl_success)
+            error::wrap_c_api(status, "could not set B packing");
+    }
+
     /// Finalizes initialization of a BRGeMM ukernel object.
     ///
     /// This step must be performed prior to querying information from the
@@ -381,6 +401,48 @@ struct brgemm : public handle<dnnl_brgemm_t> {
                     status, "could not execute a BRGeMM ukernel object");
     }
 
+    /// Executes a BRGeMM ukernel object with tensors A and B passed as
+    /// vectors of pointers.
+    ///
+    /// @param A_ptrs Vector of pointers to tensors A, one for each batch. The
+    ///     number of batches must coincide with the `batch_size` value passed
+    ///     at object construction stage.
+    /// @param B_ptrs Vector of pointers to tensors B, one for each batch.
+    /// @param C Pointer to a tensor C (accumulation buffer).
+    /// @param scratchpad Pointer to a scratchpad buffer.
+    void execute(const std::vector<const void *> &A_ptrs,
+            const std::vector<const void *> &B_ptrs, void *C,
+            void *scratchpad) const {
+        dnnl_status_t status = dnnl_brgemm_execute_ptrs(
+                get(), A_ptrs.data(), B_ptrs.data(), C, scratchpad);
+        if (status != dnnl_success)
+            error::wrap_c_api(
+                    status, "could not execute a BRGeMM ukernel object");
+    }
+
+    /// Executes a BRGeMM ukernel object with post operations and with
+    /// tensors A and B passed as vectors of pointers.
+    ///
+    /// @param A_ptrs Vector of pointers to tensors A, one for each batch. The
+    ///     number of batches must coincide with the `batch_size` value passed
+    ///     at object construction stage.
+    /// @param B_ptrs Vector of pointers to tensors B, one for each batch.
+    /// @param C Pointer to a tensor C (accumulation buffer).
+    /// @param D Pointer to a tensor D (output buffer).
+    /// @param scratchpad Pointer to a scratchpad buffer.
+    /// @param params Post-op memory arguments. Must be passed If binary
+    ///     post-op or scales were set.
+    void execute(const std::vector<const void *> &A_ptrs,
+            const std::vector<const void *> &B_ptrs, const void *C, void *D,
+            void *scratchpad,
+            const attr_params &params = default_attr_params()) const {
+        dnnl_status_t status = dnnl_brgemm_execute_ptrs_postops(get(),
+                A_ptrs.data(), B_ptrs.data(), C, D, scratchpad, params.get());
+        if (status != dnnl_success)
+            error::wrap_c_api(
+                    status, "could not execute a BRGeMM ukernel object");
+    }
+
     /// Returns a constant reference to a static instance of default constructed
     /// primitive post-operations attribute.
     static const post_ops &default_post_ops() {
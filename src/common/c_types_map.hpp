@@ -25,6 +25,7 @@
 // to give names that better reflects the meaning of the entities
 using primitive_iface_t = dnnl_primitive;
 using primitive_desc_iface_t = dnnl_primitive_desc;
+using primitive_future_t = dnnl_primitive_future;
 
 namespace dnnl {
 namespace impl {
@@ -216,6 +217,8 @@ namespace sparse_encoding {
 const sparse_encoding_t undef = dnnl_sparse_encoding_undef;
 const sparse_encoding_t csr = dnnl_csr;
 const sparse_encoding_t coo = dnnl_coo;
+const sparse_encoding_t bsr = dnnl_bsr;
+const sparse_encoding_t grouped = dnnl_grouped;
 const sparse_encoding_t packed = dnnl_packed;
 } // namespace sparse_encoding
 
@@ -20,17 +20,13 @@
 #include <algorithm>
 #include <future>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "oneapi/dnnl/dnnl_config.h"
 
-#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
-#include "cpu/platform.hpp"
-#else
-#include <chrono>
-#endif
-
 #ifdef _WIN32
 #include <windows.h>
 #endif
@@ -63,6 +59,9 @@ struct cache_t {
 
     virtual int get_size() const = 0;
 
+    virtual status_t set_shards(int shards) = 0;
+    virtual int get_shards() const = 0;
+
     // Returns the cached value or cache_object_t() on a miss
     virtual cache_object_t get(const key_t &key) = 0;
 
@@ -121,7 +120,11 @@ protected:
     }
 };
 
-// The cache uses LRU replacement policy
+// The cache uses LRU replacement policy. Entries are distributed between
+// shards by key hash, and every shard keeps its own map, lock and recency list.
+// The list is threaded through the map nodes themselves, hence both hits and
+// evictions are O(1), and threads working with different shards do not
+// contend with each other. The capacity is split evenly between shards.
 template <typename K, typename O, typename C,
         key_merge_t<K, O> key_merge = nullptr>
 struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
@@ -130,24 +133,26 @@ struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
     using object_t = typename lru_base_t::object_t;
     using cache_object_t = typename lru_base_t::cache_object_t;
     using value_t = typename lru_base_t::value_t;
-    lru_cache_t(int capacity) : capacity_(capacity) {}
+    lru_cache_t(int capacity, int shards = 1) : capacity_(capacity) {
+        init_shards(std::max(shards, 1));
+    }
 
     ~lru_cache_t() override {
-        if (cache_mapper().empty()) return;
+        for (auto &s : shards_) {
+            if (s->mapper_.empty()) continue;
+            if (is_destroying_cache_safe()) continue;
 
-        if (!is_destroying_cache_safe()) {
             // It is safe to remove those entries that are not affected by the
             // unloading order issue e.g. native CPU.
-            for (auto it = cache_mapper().begin();
-                    it != cache_mapper().end();) {
+            for (auto it = s->mapper_.begin(); it != s->mapper_.end();) {
                 if (!it->first.has_runtime_dependencies()) {
-                    it = cache_mapper().erase(it);
+                    s->unlink(&*it);
+                    it = s->mapper_.erase(it);
                 } else {
                     ++it;
                 }
             }
-            release_cache();
-            return;
+            s->release();
         }
     }
 
@@ -156,7 +161,9 @@ struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
         {
             utils::lock_read_t lock_r(this->rw_mutex());
             if (capacity_ == 0) { return cache_object_t(); }
-            e = get_future(key);
+            auto &s = shard(key);
+            std::lock_guard<std::mutex> lock_s(s.mutex_);
+            e = get_future(s, key);
         }
 
         if (e.valid()) return e.get();
@@ -171,17 +178,48 @@ struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
     status_t set_capacity(int capacity) override {
         utils::lock_write_t lock_w(this->rw_mutex());
         capacity_ = capacity;
-        // Check if number of entries exceeds the new capacity
-        if (get_size_no_lock() > capacity_) {
-            // Evict excess entries
-            int n_excess_entries = get_size_no_lock() - capacity_;
-            evict(n_excess_entries);
-        }
+        distribute_capacity();
+        // Evict excess entries if the number of entries exceeds the new
+        // capacity
+        for (auto &s : shards_)
+            s->evict(s->size() - s->capacity_);
         return status::success;
     }
     void set_capacity_without_clearing(int capacity) {
         utils::lock_write_t lock_w(this->rw_mutex());
         capacity_ = capacity;
+        distribute_capacity();
+    }
+
+    int get_shards() const override {
+        utils::lock_read_t lock_r(this->rw_mutex());
+        return (int)shards_.size();
+    }
+
+    status_t set_shards(int shards) override {
+        if (shards < 1) return status::invalid_arguments;
+
+        utils::lock_write_t lock_w(this->rw_mutex());
+        if (shards == (int)shards_.size()) return status::success;
+
+        auto old_shards = std::move(shards_);
+        init_shards(shards);
+        // Re-insert entries from the least recently used one so that the
+        // recency order within every old shard is preserved.
+        for (auto &old : old_shards) {
+            for (auto *n = old->tail_; n; n = n->second.prev_) {
+                auto &s = shard(n->first);
+                auto res = s.mapper_.emplace(std::piecewise_construct,
+                        std::forward_as_tuple(n->first),
+                        std::forward_as_tuple(n->second.value_));
+                MAYBE_UNUSED(res);
+                assert(res.second);
+                s.link_front(&*res.first);
+            }
+        }
+        for (auto &s : shards_)
+            s->evict(s->size() - s->capacity_);
+        return status::success;
     }
 
     int get_size() const override {
@@ -190,63 +228,150 @@ struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
     }
 
 protected:
-    int get_size_no_lock() const { return (int)cache_mapper().size(); }
-
-    value_t get_or_add(const key_t &key, const value_t &value) override {
-        {
-            // 1. Section with shared access (read lock)
-            utils::lock_read_t lock_r(this->rw_mutex());
-            // Check if the cache is enabled.
-            if (capacity_ == 0) { return value_t(); }
-            // Check if the requested entry is present in the cache (likely
-            // cache_hit)
-            auto e = get_future(key);
-            if (e.valid()) { return e; }
+    int get_size_no_lock() const {
+        int size = 0;
+        for (auto &s : shards_) {
+            std::lock_guard<std::mutex> lock_s(s->mutex_);
+            size += s->size();
         }
+        return size;
+    }
 
-        utils::lock_write_t lock_w(this->rw_mutex());
-        // 2. Section with exclusive access (write lock).
-        // In a multithreaded scenario, in the context of one thread the cache
-        // may have changed by another thread between releasing the read lock
-        // and acquiring the write lock (a.k.a. ABA problem), therefore
-        // additional checks have to be performed for correctness. Double check
-        // the capacity due to possible race condition
+    value_t get_or_add(const key_t &key, const value_t &value) override {
+        // The shard structure is only changed under the exclusive lock, while
+        // lookups and insertions are serialized per shard.
+        utils::lock_read_t lock_r(this->rw_mutex());
+        // Check if the cache is enabled.
         if (capacity_ == 0) { return value_t(); }
 
-        // Double check if the requested entry is present in the cache (unlikely
-        // cache_hit).
-        auto e = get_future(key);
+        auto &s = shard(key);
+        std::lock_guard<std::mutex> lock_s(s.mutex_);
+        auto e = get_future(s, key);
         if (!e.valid()) {
             // If the entry is missing in the cache then add it (cache_miss)
-            add(key, value);
+            add(s, key, value);
         }
         return e;
     }
 
     void remove_if_invalidated(const key_t &key) override {
-        utils::lock_write_t lock_w(this->rw_mutex());
+        utils::lock_read_t lock_r(this->rw_mutex());
 
         if (capacity_ == 0) { return; }
 
-        auto it = cache_mapper().find(key);
+        auto &s = shard(key);
+        std::lock_guard<std::mutex> lock_s(s.mutex_);
+        auto it = s.mapper_.find(key);
         // The entry has been already evicted at this point
-        if (it == cache_mapper().end()) { return; }
+        if (it == s.mapper_.end()) { return; }
 
         const auto &value = it->second.value_;
         // If the entry is not invalidated
         if (!value.get().is_empty()) { return; }
 
         // Remove the invalidated entry
-        cache_mapper().erase(it);
+        s.erase(it);
     }
 
 private:
-    static size_t get_timestamp() {
-#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
-        return cpu::platform::get_timestamp();
-#else
-        return std::chrono::steady_clock::now().time_since_epoch().count();
-#endif
+    struct entry_t;
+    using node_t = std::pair<const key_t, entry_t>;
+
+    struct entry_t {
+        entry_t(const value_t &value) : value_(value) {}
+        value_t value_;
+        // Neighbours in the recency list of the owning shard. Nodes of
+        // std::unordered_map are never relocated, so the pointers stay valid
+        // until the entry itself is erased.
+        node_t *prev_ = nullptr;
+        node_t *next_ = nullptr;
+    };
+
+    struct shard_t {
+        using mapper_t = std::unordered_map<key_t, entry_t>;
+
+        int size() const { return (int)mapper_.size(); }
+
+        void link_front(node_t *n) {
+            n->second.prev_ = nullptr;
+            n->second.next_ = head_;
+            if (head_) head_->second.prev_ = n;
+            head_ = n;
+            if (!tail_) tail_ = n;
+        }
+
+        void unlink(node_t *n) {
+            auto &e = n->second;
+            if (e.prev_) e.prev_->second.next_ = e.next_;
+            if (e.next_) e.next_->second.prev_ = e.prev_;
+            if (head_ == n) head_ = e.next_;
+            if (tail_ == n) tail_ = e.prev_;
+            e.prev_ = e.next_ = nullptr;
+        }
+
+        void touch(node_t *n) {
+            if (head_ == n) return;
+            unlink(n);
+            link_front(n);
+        }
+
+        void erase(typename mapper_t::iterator it) {
+            unlink(&*it);
+            mapper_.erase(it);
+        }
+
+        // Evicts `n` least recently used entries.
+        void evict(int n) {
+            if (n <= 0) return;
+            if (n >= size()) {
+                mapper_.clear();
+                head_ = tail_ = nullptr;
+                return;
+            }
+            for (int e = 0; e < n; e++) {
+                auto it = mapper_.find(tail_->first);
+                assert(it != mapper_.end());
+                erase(it);
+            }
+        }
+
+        // Leaks cached resources. Used to avoid issues with calling
+        // destructors allocated by an already unloaded dynamic library.
+        void release() {
+            auto t = utils::make_unique<mapper_t>();
+            std::swap(*t, mapper_);
+            t.release();
+            head_ = tail_ = nullptr;
+        }
+
+        mutable std::mutex mutex_;
+        mapper_t mapper_;
+        // The most and the least recently used entries.
+        node_t *head_ = nullptr;
+        node_t *tail_ = nullptr;
+        int capacity_ = 0;
+    };
+
+    void init_shards(int shards) {
+        shards_.clear();
+        for (int i = 0; i < shards; i++)
+            shards_.emplace_back(utils::make_unique<shard_t>());
+        distribute_capacity();
+    }
+
+    void distribute_capacity() {
+        const int n = (int)shards_.size();
+        for (int i = 0; i < n; i++)
+            shards_[i]->capacity_ = capacity_ / n + (i < capacity_ % n);
+    }
+
+    shard_t &shard(const key_t &key) const {
+        if (shards_.size() == 1) return *shards_[0];
+        // The upper bits of the hash are mixed in as the same hash value
+        // selects a bucket in the shard mapper.
+        size_t h = std::hash<key_t>()(key);
+        h ^= h >> (sizeof(size_t) * 4);
+        return *shards_[h % shards_.size()];
     }
 
     void update_entry(const key_t &key, const object_t &p) override {
@@ -255,7 +380,7 @@ private:
         // intended behavior
         if ((void *)key_merge == nullptr) return;
 
-        utils::lock_write_t lock_w(this->rw_mutex());
+        utils::lock_read_t lock_r(this->rw_mutex());
 
         if (capacity_ == 0) { return; }
 
@@ -264,8 +389,10 @@ private:
         //    by another thread
         // 2. After the requested entry had been evicted it was inserted again
         //    by another thread
-        auto it = cache_mapper().find(key);
-        if (it == cache_mapper().end()
+        auto &s = shard(key);
+        std::lock_guard<std::mutex> lock_s(s.mutex_);
+        auto it = s.mapper_.find(key);
+        if (it == s.mapper_.end()
                 || it->first.thread_id() != key.thread_id()) {
             return;
         }
@@ -273,95 +400,32 @@ private:
         key_merge(it->first, p);
     }
 
-    void evict(int n) {
-        using v_t =
-                typename std::unordered_map<key_t, timed_entry_t>::value_type;
+    void add(shard_t &s, const key_t &key, const value_t &value) {
+        // The shard gets no entries when the capacity is smaller than the
+        // number of shards.
+        if (s.capacity_ == 0) return;
 
-        if (n == capacity_) {
-            cache_mapper().clear();
-            return;
-        }
+        // Evict the least recently used entry
+        s.evict(s.size() - s.capacity_ + 1);
 
-        for (int e = 0; e < n; e++) {
-            // Find the smallest timestamp
-            // TODO: revisit the eviction algorithm due to O(n) complexity, E.g.
-            // maybe evict multiple entries at once.
-            auto it = std::min_element(cache_mapper().begin(),
-                    cache_mapper().end(),
-                    [&](const v_t &left, const v_t &right) {
-                        // By default, load() and operator T use sequentially
-                        // consistent memory ordering, which enforces writing
-                        // the timestamps into registers in the same exact order
-                        // they are read from the CPU cache line. Since eviction
-                        // is performed under a write lock, this order is not
-                        // important, therefore we can safely use the weakest
-                        // memory ordering (relaxed). This brings about a few
-                        // microseconds performance improvement for default
-                        // cache capacity.
-                        return left.second.timestamp_.load(
-                                       std::memory_order_relaxed)
-                                < right.second.timestamp_.load(
-                                        std::memory_order_relaxed);
-                    });
-            auto res = cache_mapper().erase(it->first);
-            MAYBE_UNUSED(res);
-            assert(res);
-        }
-    }
-    void add(const key_t &key, const value_t &value) {
-        // std::list::size() method has linear complexity. Check the cache size
-        // using std::unordered_map::size();
-        if (get_size_no_lock() == capacity_) {
-            // Evict the least recently used entry
-            evict(1);
-        }
-
-        size_t timestamp = get_timestamp();
-
-        auto res = cache_mapper().emplace(std::piecewise_construct,
-                std::forward_as_tuple(key),
-                std::forward_as_tuple(value, timestamp));
+        auto res = s.mapper_.emplace(std::piecewise_construct,
+                std::forward_as_tuple(key), std::forward_as_tuple(value));
         MAYBE_UNUSED(res);
         assert(res.second);
+        s.link_front(&*res.first);
     }
-    value_t get_future(const key_t &key) {
-        auto it = cache_mapper().find(key);
-        if (it == cache_mapper().end()) return value_t();
 
-        size_t timestamp = get_timestamp();
-        it->second.timestamp_.store(timestamp);
+    value_t get_future(shard_t &s, const key_t &key) {
+        auto it = s.mapper_.find(key);
+        if (it == s.mapper_.end()) return value_t();
+
+        s.touch(&*it);
         // Return the entry
         return it->second.value_;
     }
 
     int capacity_;
-    struct timed_entry_t {
-        value_t value_;
-        std::atomic<size_t> timestamp_;
-        timed_entry_t(const value_t &value, size_t timestamp)
-            : value_(value), timestamp_(timestamp) {}
-    };
-
-    std::unordered_map<key_t, timed_entry_t> &cache_mapper() {
-        return cache_mapper_;
-    }
-
-    const std::unordered_map<key_t, timed_entry_t> &cache_mapper() const {
-        return cache_mapper_;
-    }
-
-    // Leaks cached resources. Used to avoid issues with calling destructors
-    // allocated by an already unloaded dynamic library.
-    void release_cache() {
-        auto t = utils::make_unique<std::unordered_map<key_t, timed_entry_t>>();
-        std::swap(*t, cache_mapper_);
-        t.release();
-    }
-    // Each entry in the cache has a corresponding key and timestamp. NOTE:
-    // pairs that contain atomics cannot be stored in an unordered_map *as an
-    // element*, since it invokes the copy constructor of std::atomic, which is
-    // deleted.
-    std::unordered_map<key_t, timed_entry_t> cache_mapper_;
+    std::vector<std::unique_ptr<shard_t>> shards_;
 };
 
 } // namespace utils
@@ -85,7 +85,8 @@ status_t conv_desc_init(convolution_desc_t *conv_desc, prop_kind_t prop_kind,
     (prop_kind == backward_weights ? cd.diff_weights_desc : cd.weights_desc)
             = *weights_desc;
     if (with_bias)
-        (prop_kind == backward_weights ? cd.diff_bias_desc : cd.bias_desc)
+        (one_of(prop_kind, backward_weights, backward) ? cd.diff_bias_desc
+                                                        : cd.bias_desc)
                 = *bias_desc;
 
     cd.accum_data_type = types::default_accum_data_type(src_desc->data_type,
@@ -188,22 +189,52 @@ status_t conv_attr_check(const convolution_desc_t &desc, const engine_t *engine,
         if (enable_quantization)
             fwd_attr_mask |= smask_t::zero_points_data_type
                     | smask_t::scales_data_type;
+        // Weights decompression: floating-point activations and integer
+        // weights dequantized with per-group scales and zero-points.
+        const bool is_wei_decompression
+                = utils::one_of(src_dt, data_type::bf16, data_type::f16)
+                && utils::one_of(desc.weights_desc.data_type, data_type::s8,
+                        data_type::u8, data_type::s4, data_type::u4);
+        if (is_wei_decompression)
+            fwd_attr_mask |= smask_t::zero_points_data_type
+                    | smask_t::zero_points_groups | smask_t::scales_data_type
+                    | smask_t::scales_groups;
 
         VCHECK_CONV_UNIMPL(attr->has_default_values(fwd_attr_mask, dst_dt),
                 VERBOSE_UNSUPPORTED_ATTR);
 
+        const bool with_groups
+                = desc.src_desc.ndims != desc.weights_desc.ndims;
+        const int wei_oc_mask = with_groups ? 3 : 1;
+        const int wei_oc_ic_mask = with_groups ? 7 : 3;
+        const dim_t icg = desc.weights_desc.dims[with_groups + 1];
+
+        // Groups of weights scales and zero-points are defined over the output
+        // and input channels dims. Only grouping over input channels is
+        // supported.
+        auto wei_groups_ok = [&](const quant_entry_t &e) {
+            if (e.has_default_groups()) return true;
+            const dim_t g_ic = e.get_group(1);
+            return is_wei_decompression && attr->fpmath_.apply_to_int_
+                    && e.get_mask() == wei_oc_ic_mask && e.get_group(0) == 1
+                    && g_ic > 0 && icg % g_ic == 0;
+        };
+
         // Check scales
         if (!attr->scales_.has_default_values()) {
             const auto &sc = attr->scales_;
-            const bool with_groups
-                    = desc.src_desc.ndims != desc.weights_desc.ndims;
             VCHECK_CONV_UNIMPL(IMPLICATION(!sc.has_default_values(DNNL_ARG_SRC),
                                        sc.get_mask(DNNL_ARG_SRC) == 0),
                     VERBOSE_UNSUPPORTED_SCALES_CFG);
             VCHECK_CONV_UNIMPL(
                     IMPLICATION(!sc.has_default_values(DNNL_ARG_WEIGHTS),
                             utils::one_of(sc.get_mask(DNNL_ARG_WEIGHTS), 0,
-                                    with_groups ? 3 : 1)),
+                                    wei_oc_mask)
+                                    || (is_wei_decompression
+                                            && sc.get_mask(DNNL_ARG_WEIGHTS)
+                                                    == wei_oc_ic_mask)),
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
+            VCHECK_CONV_UNIMPL(wei_groups_ok(sc.get(DNNL_ARG_WEIGHTS)),
                     VERBOSE_UNSUPPORTED_SCALES_CFG);
             VCHECK_CONV_UNIMPL(
                     IMPLICATION(!sc.has_default_values(DNNL_ARG_DST),
@@ -221,7 +252,15 @@ status_t conv_attr_check(const convolution_desc_t &desc, const engine_t *engine,
                     VERBOSE_UNSUPPORTED_ZP_CFG);
             VCHECK_CONV_UNIMPL(
                     IMPLICATION(!zp.has_default_values(DNNL_ARG_WEIGHTS),
-                            zp.get_mask(DNNL_ARG_WEIGHTS) == 0),
+                            zp.get_mask(DNNL_ARG_WEIGHTS) == 0
+                                    || (is_wei_decompression
+                                            && utils::one_of(
+                                                    zp.get_mask(
+                                                            DNNL_ARG_WEIGHTS),
+                                                    wei_oc_mask,
+                                                    wei_oc_ic_mask))),
+                    VERBOSE_UNSUPPORTED_ZP_CFG);
+            VCHECK_CONV_UNIMPL(wei_groups_ok(zp.get(DNNL_ARG_WEIGHTS)),
                     VERBOSE_UNSUPPORTED_ZP_CFG);
             VCHECK_CONV_UNIMPL(IMPLICATION(!zp.has_default_values(DNNL_ARG_DST),
                                        utils::one_of(zp.get_mask(DNNL_ARG_DST),
@@ -234,7 +273,7 @@ status_t conv_attr_check(const convolution_desc_t &desc, const engine_t *engine,
             const auto &po = attr->post_ops_;
             using namespace primitive_kind;
             VCHECK_CONV_UNIMPL(po.has_default_values({binary, eltwise, prelu,
-                                       sum, convolution}),
+                                       sum, convolution, pooling}),
                     VERBOSE_UNSUPPORTED_POSTOP);
 
             // Check sum
@@ -310,4 +349,38 @@ status_t dnnl_convolution_backward_weights_primitive_desc_create(
             (const op_desc_t *)&conv_desc, hint_fwd_pd, attr);
 }
 
+status_t dnnl_convolution_backward_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *diff_src_desc, const memory_desc_t *weights_desc,
+        const memory_desc_t *diff_weights_desc,
+        const memory_desc_t *diff_bias_desc, const memory_desc_t *diff_dst_desc,
+        const dims_t strides, const dims_t dilates, const dims_t padding_l,
+        const dims_t padding_r, const primitive_desc_iface_t *hint_fwd_pd,
+        const primitive_attr_t *attr) {
+    VCHECK_CONV(!any_null(diff_src_desc, diff_weights_desc), VERBOSE_NULL_ARG);
+
+    auto conv_desc = convolution_desc_t();
+    CHECK(dnnl::impl::conv_desc_init(&conv_desc, backward, alg_kind, src_desc,
+            weights_desc, diff_bias_desc, diff_dst_desc, strides, dilates,
+            padding_l, padding_r));
+
+    // Gradients must have the same shapes as the tensors they are computed
+    // for.
+    VCHECK_CONV(diff_src_desc->ndims == src_desc->ndims
+                    && utils::array_cmp(diff_src_desc->dims, src_desc->dims,
+                            src_desc->ndims),
+            VERBOSE_INCONSISTENT_DIM, "src", -1, "diff_src", -1);
+    VCHECK_CONV(diff_weights_desc->ndims == weights_desc->ndims
+                    && utils::array_cmp(diff_weights_desc->dims,
+                            weights_desc->dims, weights_desc->ndims),
+            VERBOSE_INCONSISTENT_DIM, "weights", -1, "diff_weights", -1);
+    conv_desc.diff_src_desc = *diff_src_desc;
+    conv_desc.diff_weights_desc = *diff_weights_desc;
+
+    CHECK(dnnl::impl::conv_attr_check(conv_desc, engine, attr));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&conv_desc, hint_fwd_pd, attr);
+}
+
 // vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -34,8 +34,9 @@ memory_desc_t *conv_prop_invariant_wei_d(convolution_desc_t *desc) {
 }
 
 memory_desc_t *conv_prop_invariant_bia_d(convolution_desc_t *desc) {
-    return desc->prop_kind == backward_weights ? &desc->diff_bias_desc
-                                               : &desc->bias_desc;
+    return utils::one_of(desc->prop_kind, backward_weights, backward)
+            ? &desc->diff_bias_desc
+            : &desc->bias_desc;
 }
 
 memory_desc_t *conv_prop_invariant_dst_d(convolution_desc_t *desc) {
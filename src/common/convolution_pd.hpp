@@ -551,6 +551,102 @@ protected:
 };
 // NOLINTEND(google-default-arguments)
 
+// Backward propagation computing both the data and the weights gradients.
+// NOLINTBEGIN(google-default-arguments)
+struct convolution_bwd_pd_t : public convolution_pd_t {
+    using base_class = convolution_bwd_pd_t;
+    using hint_class = convolution_fwd_pd_t;
+
+    convolution_bwd_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+            const convolution_fwd_pd_t *hint_fwd_pd)
+        : convolution_pd_t(adesc, attr, hint_fwd_pd)
+        , src_md_(desc_.src_desc)
+        , diff_src_md_(desc_.diff_src_desc)
+        , weights_md_(desc_.weights_desc)
+        , diff_weights_md_(desc_.diff_weights_desc)
+        , diff_bias_md_(desc_.diff_bias_desc)
+        , diff_dst_md_(desc_.diff_dst_desc) {}
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (utils::one_of(arg, DNNL_ARG_SRC, DNNL_ARG_WEIGHTS,
+                    DNNL_ARG_DIFF_DST))
+            return arg_usage_t::input;
+
+        if (utils::one_of(arg, DNNL_ARG_DIFF_SRC, DNNL_ARG_DIFF_WEIGHTS))
+            return arg_usage_t::output;
+
+        if (arg == DNNL_ARG_DIFF_BIAS)
+            return with_bias() ? arg_usage_t::output : arg_usage_t::unused;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_DIFF_SRC: return diff_src_md(0);
+            case DNNL_ARG_WEIGHTS: return weights_md(0);
+            case DNNL_ARG_DIFF_WEIGHTS: return diff_weights_md(0);
+            case DNNL_ARG_DIFF_BIAS: return diff_weights_md(1);
+            case DNNL_ARG_DIFF_DST: return diff_dst_md(0, user_input);
+            default: return convolution_pd_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->src_desc : &src_md_;
+        return &glob_zero_md;
+    }
+    const memory_desc_t *diff_src_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0)
+            return user_input ? &desc()->diff_src_desc : &diff_src_md_;
+        return &glob_zero_md;
+    }
+    const memory_desc_t *diff_dst_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0)
+            return user_input ? &desc()->diff_dst_desc : &diff_dst_md_;
+        return &glob_zero_md;
+    }
+    const memory_desc_t *weights_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0)
+            return user_input ? &desc()->weights_desc : &weights_md_;
+        return &glob_zero_md;
+    }
+    const memory_desc_t *diff_weights_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0)
+            return user_input ? &desc()->diff_weights_desc : &diff_weights_md_;
+        if (index == 1)
+            return user_input ? &desc()->diff_bias_desc : &diff_bias_md_;
+        return &glob_zero_md;
+    }
+
+    // Bias exists only as a gradient.
+    const memory_desc_t *invariant_bia_md() const override {
+        return diff_weights_md(1);
+    }
+    format_kind_t invariant_bia_user_format_kind() const override {
+        return diff_weights_md(1, /* user_input = */ true)->format_kind;
+    }
+
+    int n_inputs() const override { return 3; }
+    int n_outputs() const override { return 2 + with_bias(); }
+
+protected:
+    memory_desc_t src_md_;
+    memory_desc_t diff_src_md_;
+    memory_desc_t weights_md_;
+    memory_desc_t diff_weights_md_;
+    memory_desc_t diff_bias_md_;
+    memory_desc_t diff_dst_md_;
+};
+// NOLINTEND(google-default-arguments)
+
 } // namespace impl
 } // namespace dnnl
 
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <functional>
 #include <mutex>
+#include <vector>
 
 #include "utils.hpp"
 #include "z_magic.hpp"
@@ -259,6 +260,13 @@ void balance2D(U nthr, U ithr, T ny, T &ny_start, T &ny_end, T nx, T &nx_start,
  *                                         calls for_nd
  *  - parallel_nd_ext(nthr, dims..., f)  - creates a parallel section and then
  *                                         calls for_nd_ext
+ *  - parallel_dynamic(nthr, work, f)    - executes f(start, end) on chunks of
+ *                                         [0, work) in parallel with work
+ *                                         stealing between threads
+ *  - parallel_dynamic_ext(nthr, work, f) - same as parallel_dynamic, but
+ *                                         passes ithr to f(ithr, start, end)
+ *  - parallel_nd_dynamic(dims..., f)    - same as parallel_nd, but for loops
+ *                                         with uneven work per iteration
  */
 
 /* general parallelization */
@@ -641,6 +649,162 @@ static inline void parallel_nd(dim_t D0, dim_t D1, dim_t D2, dim_t D3, dim_t D4,
         });
 }
 
+/* parallel_dynamic section */
+// A range of work items owned by a thread. The owner takes chunks from the
+// front of the range, while idle threads steal the back half of it. The
+// padding keeps ranges of different threads in different cache lines.
+struct work_range_t {
+    std::mutex mutex;
+    dim_t start = 0;
+    dim_t end = 0;
+    char pad[64];
+};
+
+static inline void for_dynamic(int ithr, std::vector<work_range_t> &ranges,
+        dim_t chunk, const std::function<void(int, dim_t, dim_t)> &f) {
+    const int nranges = (int)ranges.size();
+    dim_t start {0}, end {0};
+
+    auto pop_front = [&](work_range_t &r) {
+        std::lock_guard<std::mutex> guard(r.mutex);
+        if (r.start >= r.end) return false;
+        start = r.start;
+        end = std::min(r.start + chunk, r.end);
+        r.start = end;
+        return true;
+    };
+    auto steal_back = [&](work_range_t &r) {
+        std::lock_guard<std::mutex> guard(r.mutex);
+        if (r.start >= r.end) return false;
+        start = r.end - utils::div_up(r.end - r.start, 2);
+        end = r.end;
+        r.end = start;
+        return true;
+    };
+
+    auto &own = ranges[ithr];
+    while (true) {
+        while (pop_front(own))
+            f(ithr, start, end);
+
+        // Ranges are checked starting from the neighbor to spread thieves
+        // across victims. A thread which fails to steal anything is done:
+        // the remaining work is already taken by other threads.
+        bool stolen = false;
+        for (int i = 1; i < nranges && !stolen; i++)
+            stolen = steal_back(ranges[(ithr + i) % nranges]);
+        if (!stolen) return;
+
+        std::lock_guard<std::mutex> guard(own.mutex);
+        own.start = start;
+        own.end = end;
+    }
+}
+
+// Each thread starts with the same range `balance211()` would give it, so
+// balanced loops keep their locality and pay only for a lock per chunk.
+static inline void parallel_dynamic_ext(int nthr, dim_t work_amount,
+        const std::function<void(int, dim_t, dim_t)> &f) {
+    // The number of chunks per thread trades scheduling overhead for
+    // granularity of load balancing.
+    constexpr dim_t chunks_per_thread = 16;
+
+    if (work_amount <= 0) return;
+    nthr = (int)std::min(
+            (dim_t)adjust_num_threads(nthr, work_amount), work_amount);
+    if (nthr <= 1) {
+        f(0, 0, work_amount);
+        return;
+    }
+
+    std::vector<work_range_t> ranges(nthr);
+    for (int ithr = 0; ithr < nthr; ithr++)
+        balance211(work_amount, nthr, ithr, ranges[ithr].start,
+                ranges[ithr].end);
+    const dim_t chunk = std::max(
+            (dim_t)1, work_amount / ((dim_t)nthr * chunks_per_thread));
+
+    // `parallel()` may use fewer threads than requested, e.g. in a nested
+    // parallel region. Threads then steal the work of the missing ones.
+    parallel(nthr, [&](int ithr, int) { for_dynamic(ithr, ranges, chunk, f); });
+}
+
+static inline void parallel_dynamic(int nthr, dim_t work_amount,
+        const std::function<void(dim_t, dim_t)> &f) {
+    parallel_dynamic_ext(nthr, work_amount,
+            [&](int, dim_t start, dim_t end) { f(start, end); });
+}
+
+/* parallel_nd_dynamic section */
+static inline void parallel_nd_dynamic(
+        dim_t D0, const std::function<void(dim_t)> &f) {
+    parallel_dynamic(0, D0, [&](dim_t start, dim_t end) {
+        for (dim_t d0 = start; d0 < end; ++d0)
+            f(d0);
+    });
+}
+static inline void parallel_nd_dynamic(
+        dim_t D0, dim_t D1, const std::function<void(dim_t, dim_t)> &f) {
+    parallel_dynamic(0, D0 * D1, [&](dim_t start, dim_t end) {
+        dim_t d0 {0}, d1 {0};
+        utils::nd_iterator_init(start, d0, D0, d1, D1);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            f(d0, d1);
+            utils::nd_iterator_step(d0, D0, d1, D1);
+        }
+    });
+}
+static inline void parallel_nd_dynamic(dim_t D0, dim_t D1, dim_t D2,
+        const std::function<void(dim_t, dim_t, dim_t)> &f) {
+    parallel_dynamic(0, D0 * D1 * D2, [&](dim_t start, dim_t end) {
+        dim_t d0 {0}, d1 {0}, d2 {0};
+        utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            f(d0, d1, d2);
+            utils::nd_iterator_step(d0, D0, d1, D1, d2, D2);
+        }
+    });
+}
+static inline void parallel_nd_dynamic(dim_t D0, dim_t D1, dim_t D2, dim_t D3,
+        const std::function<void(dim_t, dim_t, dim_t, dim_t)> &f) {
+    parallel_dynamic(0, D0 * D1 * D2 * D3, [&](dim_t start, dim_t end) {
+        dim_t d0 {0}, d1 {0}, d2 {0}, d3 {0};
+        utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2, d3, D3);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            f(d0, d1, d2, d3);
+            utils::nd_iterator_step(d0, D0, d1, D1, d2, D2, d3, D3);
+        }
+    });
+}
+static inline void parallel_nd_dynamic(dim_t D0, dim_t D1, dim_t D2, dim_t D3,
+        dim_t D4,
+        const std::function<void(dim_t, dim_t, dim_t, dim_t, dim_t)> &f) {
+    parallel_dynamic(0, D0 * D1 * D2 * D3 * D4, [&](dim_t start, dim_t end) {
+        dim_t d0 {0}, d1 {0}, d2 {0}, d3 {0}, d4 {0};
+        utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2, d3, D3, d4, D4);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            f(d0, d1, d2, d3, d4);
+            utils::nd_iterator_step(d0, D0, d1, D1, d2, D2, d3, D3, d4, D4);
+        }
+    });
+}
+static inline void parallel_nd_dynamic(dim_t D0, dim_t D1, dim_t D2, dim_t D3,
+        dim_t D4, dim_t D5,
+        const std::function<void(dim_t, dim_t, dim_t, dim_t, dim_t, dim_t)>
+                &f) {
+    const dim_t work_amount = D0 * D1 * D2 * D3 * D4 * D5;
+    parallel_dynamic(0, work_amount, [&](dim_t start, dim_t end) {
+        dim_t d0 {0}, d1 {0}, d2 {0}, d3 {0}, d4 {0}, d5 {0};
+        utils::nd_iterator_init(
+                start, d0, D0, d1, D1, d2, D2, d3, D3, d4, D4, d5, D5);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            f(d0, d1, d2, d3, d4, d5);
+            utils::nd_iterator_step(
+                    d0, D0, d1, D1, d2, D2, d3, D3, d4, D4, d5, D5);
+        }
+    });
+}
+
 } // namespace impl
 } // namespace dnnl
 
@@ -38,7 +38,7 @@ struct iface_t::cache_t {
     using result_t = iface_t::result_t;
     using create_func_t = iface_t::create_func_t;
 
-    cache_t(int capacity) : cache_(capacity) {};
+    cache_t(int capacity, int shards) : cache_(capacity, shards) {};
 
     ~cache_t() = default;
 
@@ -48,6 +48,9 @@ struct iface_t::cache_t {
     int get_capacity() const { return cache_.get_capacity(); }
     int get_size() const { return cache_.get_size(); }
 
+    status_t set_shards(int shards) { return cache_.set_shards(shards); }
+    int get_shards() const { return cache_.get_shards(); }
+
     result_t get_or_create(
             const key_t &key, create_func_t create, void *create_context) {
         // Always try to fetch the kernel from the cache. There's no scenario
@@ -67,7 +70,8 @@ iface_t get() {
 #else
     static const int capacity = 0;
 #endif
-    static iface_t::cache_t cache(capacity);
+    static const int shards = getenv_int_user("PRIMITIVE_CACHE_SHARDS", 1);
+    static iface_t::cache_t cache(capacity, shards);
     return cache;
 }
 
@@ -83,6 +87,14 @@ int iface_t::get_size() const {
     return cache_.get_size();
 }
 
+status_t iface_t::set_shards(int shards) {
+    return cache_.set_shards(shards);
+}
+
+int iface_t::get_shards() const {
+    return cache_.get_shards();
+}
+
 iface_t::result_t iface_t::get_or_create(
         const key_t &key, create_func_t create, void *create_context) {
     auto r = cache_.get_or_create(key, create, create_context);
@@ -126,6 +126,9 @@ struct iface_t {
     int get_capacity() const;
     int get_size() const;
 
+    status_t set_shards(int shards);
+    int get_shards() const;
+
     result_t get_or_create(
             const key_t &key, create_func_t create, void *create_context);
 
@@ -21,6 +21,7 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "memory_desc_wrapper.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
@@ -296,6 +297,52 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
     return status::success;
 }
 
+// Checks the grouped form of matmul, where the source and the destination
+// are split into groups of rows and every group is multiplied by its own
+// matrix of the weights: dst[g] = src[g] x wei[g].
+status_t grouped_matmul_desc_check(const matmul_desc_t &op_d) {
+    const memory_desc_t &src_md = op_d.src_desc;
+    const memory_desc_t &wei_md = op_d.weights_desc;
+    const memory_desc_t &dst_md = op_d.dst_desc;
+    const auto &src_sd = src_md.format_desc.sparse_desc;
+    const auto &dst_sd = dst_md.format_desc.sparse_desc;
+
+    // Note: per-group bias and reduction are not defined yet.
+    VCHECK_MATMUL(op_d.bias_desc.ndims == 0, VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VCHECK_MATMUL(op_d.reduce_desc.ndims == 0, VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    VCHECK_MATMUL(everyone_is(2, src_md.ndims, dst_md.ndims), VERBOSE_BAD_NDIMS,
+            "dst", dst_md.ndims);
+    VCHECK_MATMUL(
+            wei_md.ndims == 3, VERBOSE_BAD_NDIMS, "weights", wei_md.ndims);
+    VCHECK_MATMUL(dst_md.format_kind == format_kind::sparse
+                    && dst_sd.encoding == sparse_encoding::grouped,
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VCHECK_MATMUL(wei_md.format_kind != format_kind::sparse,
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VCHECK_MATMUL(everyone_is(0, src_sd.variable_dim_idx,
+                          dst_sd.variable_dim_idx),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VCHECK_MATMUL(everyone_is(src_sd.group_count, dst_sd.group_count,
+                          wei_md.dims[0]),
+            VERBOSE_INCONSISTENT_DIM, "src", 0, "weights", 0);
+    VCHECK_MATMUL(src_sd.metadata_types[0] == dst_sd.metadata_types[0],
+            VERBOSE_INCONSISTENT_MDS, "src", "dst");
+
+    VCHECK_MATMUL(!memory_desc_wrapper(src_md).has_runtime_dims()
+                    && !memory_desc_wrapper(wei_md).has_runtime_dims()
+                    && !memory_desc_wrapper(dst_md).has_runtime_dims(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VCHECK_MATMUL(dst_md.dims[0] == src_md.dims[0], VERBOSE_INCONSISTENT_DIM,
+            "dst", 0, "src", 0);
+    VCHECK_MATMUL(src_md.dims[1] == wei_md.dims[1], VERBOSE_INCONSISTENT_DIM,
+            "src", 1, "weights", 1);
+    VCHECK_MATMUL(dst_md.dims[1] == wei_md.dims[2], VERBOSE_INCONSISTENT_DIM,
+            "dst", 1, "weights", 2);
+
+    return status::success;
+}
+
 } // namespace
 
 namespace dnnl {
@@ -328,6 +375,19 @@ status_t matmul_desc_init(matmul_desc_t *matmul_desc,
                 VERBOSE_BAD_PARAM, "reduce_kind");
     }
 
+    if (src_desc->format_kind == format_kind::sparse
+            && src_desc->format_desc.sparse_desc.encoding
+                    == sparse_encoding::grouped) {
+        CHECK(grouped_matmul_desc_check(op_d));
+        op_d.accum_data_type = types::default_accum_data_type(
+                src_desc->data_type, weights_desc->data_type,
+                dst_desc->data_type, prop_kind::forward);
+        VCHECK_MATMUL(op_d.accum_data_type != data_type::undef,
+                VERBOSE_INVALID_DATATYPE, "accumulation");
+        *matmul_desc = op_d;
+        return status::success;
+    }
+
     const bool with_bias = op_d.bias_desc.ndims != 0;
     const bool with_reduce = op_d.reduce_desc.ndims != 0;
     const int ndims = dst_desc->ndims;
@@ -170,6 +170,79 @@ status_t memory_desc_init_by_coo_encoding(memory_desc_t &memory_desc, int ndims,
     return success;
 }
 
+status_t memory_desc_init_by_bsr_encoding(memory_desc_t &memory_desc, int ndims,
+        const dims_t dims, data_type_t data_type, dim_t nnz,
+        const dims_t block_dims, data_type_t indices_dt,
+        data_type_t pointers_dt) {
+    if (ndims == 0) {
+        memory_desc = types::zero_md();
+        return success;
+    }
+
+    // This is the only number of dims that is supported at this point.
+    VCHECK_MEMORY(ndims == 2, unimplemented, VERBOSE_BAD_NDIMS, "", ndims);
+
+    bool args_ok = memory_desc_sanity_check(
+                           ndims, dims, data_type, format_kind::undef)
+            && block_dims != nullptr;
+    VCHECK_MEMORY(args_ok, invalid_arguments, VERBOSE_MEM_DESC_CHECK_FAIL);
+    for (int d = 0; d < ndims; d++)
+        VCHECK_MEMORY(block_dims[d] > 0 && dims[d] % block_dims[d] == 0,
+                invalid_arguments, VERBOSE_MEM_DESC_CHECK_FAIL);
+
+    auto md = memory_desc_t();
+    md.ndims = ndims;
+    array_copy(md.dims, dims, ndims);
+    md.data_type = data_type;
+    array_copy(md.padded_dims, dims, ndims);
+    md.format_kind = format_kind::sparse;
+    md.format_desc.sparse_desc.encoding = sparse_encoding::bsr;
+    md.format_desc.sparse_desc.nnz = nnz;
+    md.format_desc.sparse_desc.metadata_types[0] = indices_dt;
+    md.format_desc.sparse_desc.metadata_types[1] = pointers_dt;
+    array_copy(md.format_desc.sparse_desc.block_dims, block_dims, ndims);
+
+    memory_desc = md;
+
+    return success;
+}
+
+status_t memory_desc_init_by_grouped_encoding(memory_desc_t &memory_desc,
+        int ndims, const dims_t dims, data_type_t data_type,
+        int variable_dim_idx, dim_t group_count, data_type_t offsets_dt) {
+    if (ndims == 0) {
+        memory_desc = types::zero_md();
+        return success;
+    }
+
+    // This is the only configuration that is supported at this point.
+    VCHECK_MEMORY(ndims == 2, unimplemented, VERBOSE_BAD_NDIMS, "", ndims);
+    VCHECK_MEMORY(variable_dim_idx == 0, unimplemented,
+            VERBOSE_BAD_PARAM, "variable_dim_idx");
+
+    bool args_ok = memory_desc_sanity_check(
+                           ndims, dims, data_type, format_kind::undef)
+            && group_count > 0;
+    VCHECK_MEMORY(args_ok, invalid_arguments, VERBOSE_MEM_DESC_CHECK_FAIL);
+
+    auto md = memory_desc_t();
+    md.ndims = ndims;
+    array_copy(md.dims, dims, ndims);
+    md.data_type = data_type;
+    array_copy(md.padded_dims, dims, ndims);
+    md.format_kind = format_kind::sparse;
+    md.format_desc.sparse_desc.encoding = sparse_encoding::grouped;
+    // All the values are stored.
+    md.format_desc.sparse_desc.nnz = array_product(dims, ndims);
+    md.format_desc.sparse_desc.metadata_types[0] = offsets_dt;
+    md.format_desc.sparse_desc.group_count = group_count;
+    md.format_desc.sparse_desc.variable_dim_idx = variable_dim_idx;
+
+    memory_desc = md;
+
+    return success;
+}
+
 status_t memory_desc_init_by_packed_encoding(memory_desc_t &memory_desc,
         int ndims, const dims_t dims, data_type_t data_type, dim_t nnz) {
     if (ndims == 0) {
@@ -640,6 +713,34 @@ status_t dnnl_memory_desc_create_with_coo_encoding(memory_desc_t **memory_desc,
     return success;
 }
 
+status_t dnnl_memory_desc_create_with_bsr_encoding(memory_desc_t **memory_desc,
+        int ndims, const dims_t dims, data_type_t data_type, dim_t nnz,
+        const dims_t block_dims, data_type_t indices_dt,
+        data_type_t pointers_dt) {
+    if (any_null(memory_desc)) return invalid_arguments;
+
+    auto md = utils::make_unique<memory_desc_t>();
+    if (!md) return out_of_memory;
+    CHECK(memory_desc_init_by_bsr_encoding(*md, ndims, dims, data_type, nnz,
+            block_dims, indices_dt, pointers_dt));
+    (*memory_desc) = md.release();
+    return success;
+}
+
+status_t dnnl_memory_desc_create_with_grouped_encoding(
+        memory_desc_t **memory_desc, int ndims, const dims_t dims,
+        data_type_t data_type, int variable_dim_idx, dim_t group_count,
+        data_type_t offsets_dt) {
+    if (any_null(memory_desc)) return invalid_arguments;
+
+    auto md = utils::make_unique<memory_desc_t>();
+    if (!md) return out_of_memory;
+    CHECK(memory_desc_init_by_grouped_encoding(*md, ndims, dims, data_type,
+            variable_dim_idx, group_count, offsets_dt));
+    (*memory_desc) = md.release();
+    return success;
+}
+
 status_t dnnl_memory_desc_create_with_packed_encoding(
         memory_desc_t **memory_desc, int ndims, const dims_t dims,
         data_type_t data_type, dim_t nnz) {
@@ -790,7 +891,9 @@ status_t dnnl_memory_desc_query_v2(
                     case sparse_encoding::coo:
                         *(int *)result = md->ndims + 1;
                         break;
+                    case sparse_encoding::bsr:
                     case sparse_encoding::packed: *(int *)result = 3; break;
+                    case sparse_encoding::grouped: *(int *)result = 2; break;
                     default: assert(!"unknown encoding"); *(int *)result = 0;
                 }
             } else
@@ -176,21 +176,39 @@ struct sparse_desc_t {
     //  - 1: indices
     //  - 2: pointers
     //
+    // BSR: Number of handles is 3:
+    //  - 0: values
+    //  - 1: block column indices
+    //  - 2: block row pointers
+    //
+    // grouped: Number of handles is 2:
+    //  - 0: values
+    //  - 1: offsets of the groups
+    //
     // packed: Number of handles is 3:
     //  - 0: values
     //  - 1: offsets
     //  - 2: bitmask
     sparse_encoding_t encoding;
 
-    // Number of non-zero entries.
+    // Number of non-zero entries. For BSR, the number of non-zero blocks.
     dnnl_dim_t nnz;
 
     // Metadata types. Each encoding defines how to interpret these.
-    // - CSR: 0th - index data type
-    //        1st - pointer data type
+    // - CSR, BSR: 0th - index data type
+    //             1st - pointer data type
+    // - grouped: 0th - offset data type
     // - packed: N/A
     dnnl_data_type_t metadata_types[max_metadata_types];
 
+    // Dimensions of a block for BSR. Zeros for other encodings.
+    dims_t block_dims;
+
+    // Number of groups and the index of the dimension they are split along
+    // for the grouped encoding. Zeros for other encodings.
+    dnnl_dim_t group_count;
+    int variable_dim_idx;
+
     // The packed sparse encoding is described with `blocking_desc_t` and
     // can only be initialized by the implementation. The special encoding
     // `packed` will instruct the implementation to do that.
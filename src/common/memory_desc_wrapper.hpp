@@ -111,6 +111,21 @@ struct memory_desc_wrapper : public c_compatible {
         return sparse_desc().nnz;
     }
 
+    const dims_t &block_dims() const {
+        assert(is_sparse_desc());
+        return sparse_desc().block_dims;
+    }
+
+    dim_t group_count() const {
+        assert(is_sparse_desc());
+        return sparse_desc().group_count;
+    }
+
+    int variable_dim_idx() const {
+        assert(is_sparse_desc());
+        return sparse_desc().variable_dim_idx;
+    }
+
     const dims_t &strides() const { return blocking_desc().strides; }
 
     const memory_extra_desc_t &extra() const { return md_->extra; }
@@ -308,6 +323,37 @@ struct memory_desc_wrapper : public c_compatible {
                     assert(!"unknown index");
                     return 0;
                 }
+            } else if (sparse_desc().encoding == sparse_encoding::bsr) {
+                const auto &blk = block_dims();
+                switch (index) {
+                    // Return size for values.
+                    case 0:
+                        return nnz() * blk[0] * blk[1] * data_type_size();
+                    // Return size for block column indices.
+                    case 1: {
+                        const auto idx_dt = metadata_type(0);
+                        return nnz() * types::data_type_size(idx_dt);
+                    }
+                    // Return size for block row pointers.
+                    case 2: {
+                        const auto ptr_dt = metadata_type(1);
+                        return (dims()[0] / blk[0] + 1)
+                                * types::data_type_size(ptr_dt);
+                    }
+                    default: assert(!"unknown index"); return 0;
+                }
+            } else if (sparse_desc().encoding == sparse_encoding::grouped) {
+                switch (index) {
+                    // Return size for values.
+                    case 0: return nelems() * data_type_size();
+                    // Return size for offsets.
+                    case 1: {
+                        const auto off_dt = metadata_type(0);
+                        return (group_count() + 1)
+                                * types::data_type_size(off_dt);
+                    }
+                    default: assert(!"unknown index"); return 0;
+                }
             } else if (sparse_desc().encoding == sparse_encoding::packed) {
                 // If the size if queried from a user-created memory descriptor.
                 if (blocking_desc().strides[0] == 0) return 0;
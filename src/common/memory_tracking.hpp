@@ -195,6 +195,7 @@ enum {
     key_conv_brgemm_inp_buffer,
     key_conv_brgemm_inp_buffer_mask,
     key_conv_brgemm_out_buffer,
+    key_conv_brgemm_wei_buffer,
     key_conv_bwd_w_1st_bia_reorder,
     key_conv_bwd_w_1st_wei_reorder,
     key_conv_gemm_acc,
@@ -231,6 +232,8 @@ enum {
     key_deconv_zp,
     key_eltwise_diff_dst,
     key_eltwise_src,
+    key_fusion_backward_diff_wei_acc,
+    key_fusion_backward_diff_wei_partial,
     key_fusion_forward_scratchpad,
     key_fusion_inout_buffer,
     key_gemm_asm_tmp_buffer,
@@ -317,6 +320,8 @@ enum {
     key_rnn_ptrs_wei_layer,
     key_rnn_ptrs_wei_iter,
     key_rnn_ptrs_wei_projection,
+    key_sdpa_scores,
+    key_sdpa_tiles,
     key_softmax_reduction,
     key_softmax_interim_store,
     key_sum_reduction,
@@ -0,0 +1,164 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <list>
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "packed_weights_cache.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace packed_weights_cache {
+
+namespace {
+
+// Entries are kept in the least recently used order, the most recently used
+// one being at the front of the list.
+struct cache_t {
+    cache_t(int capacity) : capacity_(capacity) {}
+
+    int get_capacity() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return capacity_;
+    }
+
+    void set_capacity(int capacity) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        capacity_ = capacity;
+        evict(capacity_);
+    }
+
+    uint64_t get_generation() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return generation_;
+    }
+
+    buffer_t get(const key_t &key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(key);
+        if (it == index_.end()) return buffer_t();
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return it->second->second;
+    }
+
+    void add(const key_t &key, const buffer_t &buffer, uint64_t generation) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (capacity_ == 0 || generation != generation_) return;
+        // Another thread may have packed the same weights meanwhile.
+        if (index_.count(key)) return;
+        evict(capacity_ - 1);
+        entries_.emplace_front(key, buffer);
+        index_.emplace(key, entries_.begin());
+    }
+
+    void invalidate(const void *handle) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        generation_++;
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            if (handle != nullptr && it->first.handle() != handle) {
+                ++it;
+                continue;
+            }
+            index_.erase(it->first);
+            it = entries_.erase(it);
+        }
+    }
+
+private:
+    using entry_t = std::pair<key_t, buffer_t>;
+
+    // Evicts the least recently used entries to keep at most `size` ones.
+    void evict(int size) {
+        while ((int)entries_.size() > nstl::max(size, 0)) {
+            index_.erase(entries_.back().first);
+            entries_.pop_back();
+        }
+    }
+
+    std::mutex mutex_;
+    int capacity_;
+    uint64_t generation_ = 0;
+    std::list<entry_t> entries_;
+    std::map<key_t, std::list<entry_t>::iterator> index_;
+};
+
+cache_t &global_cache() {
+    static cache_t cache(getenv_int_user("PACKED_WEIGHTS_CACHE_CAPACITY", 0));
+    return cache;
+}
+
+} // namespace
+
+int get_capacity() {
+    return global_cache().get_capacity();
+}
+
+status_t set_capacity(int capacity) {
+    if (capacity < 0) return status::invalid_arguments;
+    global_cache().set_capacity(capacity);
+    return status::success;
+}
+
+bool is_enabled() {
+    return get_capacity() > 0;
+}
+
+uint64_t get_generation() {
+    return global_cache().get_generation();
+}
+
+buffer_t allocate(size_t size) {
+    char *ptr = (char *)impl::malloc(size, 64);
+    if (ptr == nullptr) return buffer_t();
+    return buffer_t(ptr, [](char *p) { impl::free(p); });
+}
+
+buffer_t get(const key_t &key) {
+    return global_cache().get(key);
+}
+
+void add(const key_t &key, const buffer_t &buffer, uint64_t generation) {
+    global_cache().add(key, buffer, generation);
+}
+
+void invalidate(const void *handle) {
+    global_cache().invalidate(handle);
+}
+
+} // namespace packed_weights_cache
+} // namespace impl
+} // namespace dnnl
+
+// API
+dnnl::impl::status_t dnnl_get_packed_weights_cache_capacity(int *capacity) {
+    if (capacity == nullptr) return dnnl::impl::status::invalid_arguments;
+    *capacity = dnnl::impl::packed_weights_cache::get_capacity();
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_set_packed_weights_cache_capacity(int capacity) {
+    return dnnl::impl::packed_weights_cache::set_capacity(capacity);
+}
+
+dnnl::impl::status_t dnnl_packed_weights_cache_invalidate(const void *handle) {
+    dnnl::impl::packed_weights_cache::invalidate(handle);
+    return dnnl::impl::status::success;
+}
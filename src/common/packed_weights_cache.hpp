@@ -0,0 +1,85 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PACKED_WEIGHTS_CACHE_HPP
+#define COMMON_PACKED_WEIGHTS_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace packed_weights_cache {
+
+// Storage of packed copies of user weights that are shared between primitives
+// consuming the same weights buffer with the same packed layout, e.g. matmul
+// primitives created for different M of one layer. An entry is identified by
+// the address of the user buffer and by a layout descriptor filled in by the
+// implementation. The library cannot detect modifications of user buffers, so
+// entries must be explicitly invalidated by the user when weights change.
+//
+// Every invalidation bumps the cache generation. A packed copy is added to the
+// cache only if the generation did not change while the copy was produced,
+// so a copy made from stale weights is never picked up.
+
+struct key_t {
+    key_t(const void *handle, std::vector<dim_t> layout)
+        : handle_(handle), layout_(std::move(layout)) {}
+
+    bool operator<(const key_t &other) const {
+        if (handle_ != other.handle_) return handle_ < other.handle_;
+        return layout_ < other.layout_;
+    }
+
+    const void *handle() const { return handle_; }
+
+private:
+    const void *handle_;
+    std::vector<dim_t> layout_;
+};
+
+using buffer_t = std::shared_ptr<char>;
+
+// The cache is disabled when the capacity is 0, which is the default.
+int get_capacity();
+status_t set_capacity(int capacity);
+bool is_enabled();
+
+uint64_t get_generation();
+
+// Allocates a buffer suitable for a packed copy of weights. Returns an empty
+// buffer if the allocation fails.
+buffer_t allocate(size_t size);
+
+// Returns an empty buffer on a miss.
+buffer_t get(const key_t &key);
+void add(const key_t &key, const buffer_t &buffer, uint64_t generation);
+
+// Drops entries packed from the buffer at `handle`, or all entries if
+// `handle` is nullptr.
+void invalidate(const void *handle);
+
+} // namespace packed_weights_cache
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -0,0 +1,262 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define DNNL_PERSISTENT_CACHE_USE_MMAP
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "persistent_cache.hpp"
+#include "primitive_iface.hpp"
+#include "rw_mutex.hpp"
+#include "verbose.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace persistent_cache {
+
+namespace {
+
+// The file layout is: header, cache blob ID, cache blob.
+struct header_t {
+    char magic[8];
+    uint64_t id_size;
+    uint64_t blob_size;
+};
+
+const char magic[8] = {'O', 'N', 'E', 'D', 'N', 'N', 'P', 'C'};
+
+utils::rw_mutex_t &dir_mutex() {
+    static utils::rw_mutex_t mutex;
+    return mutex;
+}
+
+std::string &dir_storage() {
+    static std::string dir = []() {
+        // Paths are case-sensitive, hence `getenv_string_user` can't be used.
+        char value[1024];
+        for (const auto &prefix : {"ONEDNN_", "DNNL_"}) {
+            std::string name = std::string(prefix) + "PERSISTENT_CACHE_DIR";
+            if (getenv(name.c_str(), value, sizeof(value)) > 0)
+                return std::string(value);
+        }
+        return std::string();
+    }();
+    return dir;
+}
+
+std::string blob_path(const std::string &dir, const std::vector<uint8_t> &id) {
+    size_t seed = id.size();
+    for (auto b : id)
+        seed = hash_combine(seed, b);
+
+    char name[32];
+    snprintf(name, sizeof(name), "%016" PRIx64 ".blob", (uint64_t)seed);
+    return dir + "/" + name;
+}
+
+// Distinguishes temporary files written by concurrent threads and processes.
+std::string tmp_suffix() {
+#ifdef _WIN32
+    const auto pid = (uint64_t)GetCurrentProcessId();
+#else
+    const auto pid = (uint64_t)getpid();
+#endif
+    const auto tid = (uint64_t)std::hash<std::thread::id>()(
+            std::this_thread::get_id());
+    return ".tmp." + std::to_string(pid) + "." + std::to_string(tid);
+}
+
+} // namespace
+
+status_t blob_t::load(const std::string &path, const std::vector<uint8_t> &id) {
+    reset();
+
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+#ifdef DNNL_PERSISTENT_CACHE_USE_MMAP
+    bool is_symlink = false;
+    CHECK(check_for_symlinks(path.c_str(), &is_symlink));
+    if (is_symlink) return status::invalid_arguments;
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return status::success;
+
+    struct stat finfo;
+    if (fstat(fd, &finfo) == 0 && finfo.st_size > 0) {
+        size = (size_t)finfo.st_size;
+        void *map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map != MAP_FAILED) {
+            map_ = map;
+            map_size_ = size;
+            data = static_cast<const uint8_t *>(map);
+        }
+    }
+    ::close(fd);
+#else
+    FILE *fp = fopen(path.c_str(), "rb");
+    if (!fp) return status::success;
+
+    if (fseek(fp, 0, SEEK_END) == 0) {
+        long end = ftell(fp);
+        if (end > 0 && fseek(fp, 0, SEEK_SET) == 0) {
+            buffer_.resize((size_t)end);
+            if (fread(buffer_.data(), 1, buffer_.size(), fp) == buffer_.size())
+                data = buffer_.data();
+            size = buffer_.size();
+        }
+    }
+    fclose(fp);
+#endif
+    if (!data) return status::success;
+
+    header_t header;
+    bool ok = size >= sizeof(header);
+    if (ok) {
+        std::memcpy(&header, data, sizeof(header));
+        ok = std::memcmp(header.magic, magic, sizeof(magic)) == 0
+                && header.id_size == id.size() && header.blob_size > 0
+                && header.blob_size < size
+                && size == sizeof(header) + header.id_size + header.blob_size
+                && std::memcmp(data + sizeof(header), id.data(), id.size())
+                        == 0;
+    }
+    if (!ok) {
+        VDEBUGINFO(1, common, persistent_cache,
+                "ignoring mismatched blob %s", path.c_str());
+        reset();
+        return status::success;
+    }
+
+    blob_ = data + sizeof(header) + header.id_size;
+    blob_size_ = (size_t)header.blob_size;
+    return status::success;
+}
+
+void blob_t::reset() {
+#ifdef DNNL_PERSISTENT_CACHE_USE_MMAP
+    if (map_) munmap(map_, map_size_);
+#endif
+    map_ = nullptr;
+    map_size_ = 0;
+    buffer_.clear();
+    blob_ = nullptr;
+    blob_size_ = 0;
+}
+
+status_t set_dir(const char *dir) {
+    utils::lock_write_t lock_w(dir_mutex());
+    dir_storage() = dir ? dir : "";
+#if DNNL_GPU_RUNTIME != DNNL_RUNTIME_OCL
+    // Only OpenCL GPU primitives support cache blobs.
+    if (!dir_storage().empty())
+        VWARN(common, persistent_cache,
+                "primitives of this build don't support cache blobs, %s is "
+                "not used",
+                dir);
+#endif
+    return status::success;
+}
+
+std::string get_dir() {
+    utils::lock_read_t lock_r(dir_mutex());
+    return dir_storage();
+}
+
+bool is_enabled() {
+    utils::lock_read_t lock_r(dir_mutex());
+    return !dir_storage().empty();
+}
+
+status_t load(const std::vector<uint8_t> &id, blob_t &blob) {
+    if (id.empty()) return status::success;
+
+    const auto dir = get_dir();
+    if (dir.empty()) return status::success;
+
+    return blob.load(blob_path(dir, id), id);
+}
+
+status_t store(
+        const std::vector<uint8_t> &id, const dnnl_primitive *primitive_iface) {
+    if (id.empty()) return status::success;
+
+    const auto dir = get_dir();
+    if (dir.empty()) return status::success;
+
+    size_t size = 0;
+    CHECK(primitive_iface->get_cache_blob_size(&size));
+    if (size == 0) return status::success;
+
+    std::vector<uint8_t> data(size);
+    CHECK(primitive_iface->get_cache_blob(cache_blob_t(data.data(), size)));
+
+    header_t header;
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.id_size = id.size();
+    header.blob_size = size;
+
+    // The blob is written into a temporary file which is renamed afterwards,
+    // so concurrent processes never observe a partially written blob.
+    const auto path = blob_path(dir, id);
+    const auto tmp_path = path + tmp_suffix();
+    FILE *fp = fopen(tmp_path.c_str(), "wb");
+    if (!fp) {
+        VWARN(common, persistent_cache, "cannot create %s", tmp_path.c_str());
+        return status::success;
+    }
+    bool ok = fwrite(&header, sizeof(header), 1, fp) == 1
+            && fwrite(id.data(), 1, id.size(), fp) == id.size()
+            && fwrite(data.data(), 1, size, fp) == size;
+    ok = fclose(fp) == 0 && ok;
+    if (!ok || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+        VWARN(common, persistent_cache, "cannot write %s", path.c_str());
+    }
+    return status::success;
+}
+
+} // namespace persistent_cache
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_set_persistent_cache_dir(const char *dir) {
+    return dnnl::impl::persistent_cache::set_dir(dir);
+}
+
+dnnl_status_t dnnl_get_persistent_cache_dir(const char **dir) {
+    if (dir == nullptr) return dnnl::impl::status::invalid_arguments;
+    // The returned string is owned by the calling thread and stays valid until
+    // the next call.
+    static thread_local std::string dir_copy;
+    dir_copy = dnnl::impl::persistent_cache::get_dir();
+    *dir = dir_copy.c_str();
+    return dnnl::impl::status::success;
+}
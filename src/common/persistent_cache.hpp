@@ -0,0 +1,86 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PERSISTENT_CACHE_HPP
+#define COMMON_PERSISTENT_CACHE_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "c_types_map.hpp"
+#include "cache_blob.hpp"
+#include "utils.hpp"
+
+struct dnnl_primitive;
+
+namespace dnnl {
+namespace impl {
+namespace persistent_cache {
+
+// Library-managed storage of cache blobs. Every blob is kept in a separate
+// file inside a user-provided directory. A file name is derived from the hash
+// of the cache blob ID, and the file stores the full ID to detect collisions.
+// Since the cache blob ID includes the library version, the git commit hash and
+// the device information, blobs produced by a different library build or for a
+// different device are never picked up.
+
+// Read-only view of a blob file. The file is memory-mapped when the platform
+// supports it and read into memory otherwise.
+struct blob_t {
+    blob_t() = default;
+    ~blob_t() { reset(); }
+
+    status_t load(const std::string &path, const std::vector<uint8_t> &id);
+    void reset();
+
+    cache_blob_t get() const {
+        if (!blob_) return cache_blob_t();
+        return cache_blob_t(const_cast<uint8_t *>(blob_), blob_size_);
+    }
+
+    explicit operator bool() const { return blob_ != nullptr; }
+
+private:
+    void *map_ = nullptr;
+    size_t map_size_ = 0;
+    std::vector<uint8_t> buffer_;
+
+    const uint8_t *blob_ = nullptr;
+    size_t blob_size_ = 0;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(blob_t);
+};
+
+status_t set_dir(const char *dir);
+// Returns an empty string if the persistent cache is disabled.
+std::string get_dir();
+
+bool is_enabled();
+
+// Returns status::success and a valid blob on a hit. A miss, a truncated file
+// or an ID mismatch leave the blob empty.
+status_t load(const std::vector<uint8_t> &id, blob_t &blob);
+status_t store(
+        const std::vector<uint8_t> &id, const dnnl_primitive *primitive_iface);
+
+} // namespace persistent_cache
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
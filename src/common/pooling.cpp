@@ -19,6 +19,7 @@
 
 #include "c_types_map.hpp"
 #include "opdesc.hpp"
+#include "pooling_pd.hpp"
 #include "primitive_desc_iface.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
@@ -38,7 +39,8 @@ using namespace dnnl::impl::types;
     VCONDCHECK(primitive, create, check, pooling, (cond), \
             status::unimplemented, msg, ##__VA_ARGS__);
 
-namespace {
+namespace dnnl {
+namespace impl {
 status_t pooling_desc_init(pooling_desc_t *pool_desc, prop_kind_t prop_kind,
         alg_kind_t alg_kind, const memory_desc_t *src_desc,
         const memory_desc_t *dst_desc, const dims_t strides,
@@ -129,7 +131,10 @@ status_t pooling_desc_init(pooling_desc_t *pool_desc, prop_kind_t prop_kind,
     *pool_desc = pd;
     return success;
 }
+} // namespace impl
+} // namespace dnnl
 
+namespace {
 status_t pooling_attr_check(const pooling_desc_t &desc, const engine_t *engine,
         const primitive_attr_t *attr) {
     using smask_t = primitive_attr_t::skip_mask_t;
@@ -40,6 +40,12 @@
 namespace dnnl {
 namespace impl {
 
+status_t pooling_desc_init(pooling_desc_t *pool_desc, prop_kind_t prop_kind,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *dst_desc, const dims_t strides,
+        const dims_t kernel, const dims_t dilation, const dims_t padding_l,
+        const dims_t padding_r);
+
 struct pooling_fwd_pd_t;
 
 struct pooling_pd_t : public primitive_desc_t {
@@ -206,6 +206,33 @@ status_t post_ops_t::append_dw(data_type_t wei_dt, data_type_t bias_dt,
     return success;
 }
 
+status_t post_ops_t::append_pooling(alg_kind_t alg, dim_t kernel_size,
+        dim_t stride_size, dim_t padding_l_size) {
+    if (len() == post_ops_limit) return out_of_memory;
+    using namespace alg_kind;
+    bool ok = one_of(alg, pooling_max, pooling_avg_include_padding,
+            pooling_avg_exclude_padding);
+    if (!ok) return invalid_arguments;
+
+    ok = kernel_size > 0 && stride_size > 0;
+    if (!ok) return invalid_arguments;
+
+    // Avoiding cases when kernel in pad area
+    ok = padding_l_size >= 0 && (padding_l_size + 1) <= kernel_size;
+    if (!ok) return invalid_arguments;
+
+    entry_.emplace_back();
+    auto &e = entry_.back();
+    e.kind = primitive_kind::pooling;
+    auto &p = e.pooling;
+    p.alg = alg;
+    p.kernel = kernel_size;
+    p.stride = stride_size;
+    p.padding = padding_l_size;
+
+    return success;
+}
+
 status_t post_ops_t::validate_binary(alg_kind_t alg,
         const memory_desc_t *user_src1_desc,
         const memory_desc_t *user_src2_desc) const {
@@ -755,6 +782,28 @@ status_t dnnl_post_ops_get_params_dw(const post_ops_t *post_ops, int index,
     return success;
 }
 
+status_t dnnl_post_ops_append_pooling(post_ops_t *post_ops, alg_kind_t alg,
+        dim_t kernel_size, dim_t stride_size, dim_t padding_l_size) {
+    if (post_ops == nullptr) return invalid_arguments;
+
+    return post_ops->append_pooling(
+            alg, kernel_size, stride_size, padding_l_size);
+}
+
+status_t dnnl_post_ops_get_params_pooling(const post_ops_t *post_ops,
+        int index, alg_kind_t *alg, dim_t *kernel, dim_t *stride,
+        dim_t *padding) {
+    CHECK(simple_get_params_check(post_ops, index, primitive_kind::pooling));
+
+    const auto &p = post_ops->entry_[index].pooling;
+    if (alg) *alg = p.alg;
+    if (kernel) *kernel = p.kernel;
+    if (stride) *stride = p.stride;
+    if (padding) *padding = p.padding;
+
+    return success;
+}
+
 status_t dnnl_post_ops_append_binary(post_ops_t *post_ops, alg_kind_t alg_kind,
         const memory_desc_t *user_src1_desc) {
     if (post_ops == nullptr) return invalid_arguments;
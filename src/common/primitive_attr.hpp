@@ -304,6 +304,13 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             dnnl::impl::data_type_t dst_dt;
         };
 
+        struct pooling_t {
+            dnnl::impl::alg_kind_t alg;
+            dnnl::impl::dim_t kernel;
+            dnnl::impl::dim_t stride;
+            dnnl::impl::dim_t padding;
+        };
+
         struct binary_t {
             dnnl::impl::alg_kind_t alg;
             // This is an unmodifiable user copy of attributes which is used in
@@ -326,6 +333,7 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             sum_t sum;
             eltwise_t eltwise;
             depthwise_conv_t depthwise_conv;
+            pooling_t pooling;
             binary_t binary;
             prelu_t prelu;
         };
@@ -357,6 +365,10 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             return kind == primitive_kind::convolution;
         }
 
+        bool is_pooling() const {
+            return kind == dnnl::impl::primitive_kind::pooling;
+        }
+
         bool is_binary() const {
             return kind == dnnl::impl::primitive_kind::binary;
         }
@@ -407,6 +419,12 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
                             && depthwise_conv.dst_dt
                                     == rhs.depthwise_conv.dst_dt;
                     break;
+                case primitive_kind::pooling:
+                    ret = pooling.alg == rhs.pooling.alg
+                            && pooling.kernel == rhs.pooling.kernel
+                            && pooling.stride == rhs.pooling.stride
+                            && pooling.padding == rhs.pooling.padding;
+                    break;
                 case primitive_kind::binary:
                     ret = binary.alg == rhs.binary.alg
                             && binary.user_src1_desc
@@ -436,6 +454,9 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             dnnl::impl::data_type_t bias_dt, dnnl::impl::data_type_t dst_dt,
             dnnl::impl::dim_t kernel_size, dnnl::impl::dim_t stride_size,
             dnnl::impl::dim_t padding_l_size);
+    dnnl::impl::status_t append_pooling(dnnl::impl::alg_kind_t alg,
+            dnnl::impl::dim_t kernel_size, dnnl::impl::dim_t stride_size,
+            dnnl::impl::dim_t padding_l_size);
     dnnl::impl::status_t append_binary(dnnl::impl::alg_kind_t alg,
             const dnnl::impl::memory_desc_t *user_src1_desc,
             const dnnl::impl::memory_desc_t *user_src2_desc = nullptr);
@@ -32,7 +32,7 @@ struct primitive_cache_t {
     using result_t = primitive_cache_iface_t::result_t;
     using create_func_t = result_t (&)(void *);
 
-    primitive_cache_t(int capacity) : cache_(capacity) {};
+    primitive_cache_t(int capacity, int shards) : cache_(capacity, shards) {};
 
     ~primitive_cache_t() = default;
 
@@ -42,6 +42,9 @@ struct primitive_cache_t {
     int get_capacity() const { return cache_.get_capacity(); }
     int get_size() const { return cache_.get_size(); }
 
+    status_t set_shards(int shards) { return cache_.set_shards(shards); }
+    int get_shards() const { return cache_.get_shards(); }
+
     std::shared_ptr<primitive_desc_t> get_pd(const key_t &key) {
         result_t result = cache_.get(key);
         return result.value != nullptr ? result.value->pd() : nullptr;
@@ -75,7 +78,8 @@ primitive_cache_t &global_primitive_cache() {
 #else
     static const int capacity = 0;
 #endif
-    static primitive_cache_t cache(capacity);
+    static const int shards = getenv_int_user("PRIMITIVE_CACHE_SHARDS", 1);
+    static primitive_cache_t cache(capacity, shards);
     return cache;
 }
 
@@ -122,6 +126,14 @@ int primitive_cache_iface_t::get_size() const {
     return cache_.get_size();
 }
 
+status_t primitive_cache_iface_t::set_shards(int shards) {
+    return cache_.set_shards(shards);
+}
+
+int primitive_cache_iface_t::get_shards() const {
+    return cache_.get_shards();
+}
+
 std::shared_ptr<primitive_desc_t> primitive_cache_iface_t::get_pd(
         const key_t &key) {
     return cache_.get_pd(key);
@@ -148,6 +160,17 @@ status_t set_primitive_cache_capacity(
     return status::success;
 }
 
+status_t set_primitive_cache_shards(int primitive_shards, int kernel_shards) {
+    if (primitive_shards < 1 || kernel_shards < 1)
+        return status::invalid_arguments;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    auto status = global_primitive_cache().set_shards(primitive_shards);
+    CHECK(status);
+    return kernel_cache::get().set_shards(kernel_shards);
+#endif
+    return status::success;
+}
+
 } // namespace impl
 } // namespace dnnl
 
@@ -165,3 +188,17 @@ dnnl::impl::status_t dnnl_get_primitive_cache_capacity(int *capacity) {
 dnnl::impl::status_t dnnl_set_primitive_cache_capacity(int capacity) {
     return dnnl::impl::set_primitive_cache_capacity(capacity, capacity);
 }
+
+dnnl::impl::status_t dnnl_get_primitive_cache_shards(int *shards) {
+    if (shards == nullptr) return dnnl::impl::status::invalid_arguments;
+    *shards = 1;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    *shards = dnnl::impl::global_primitive_cache().get_shards();
+    assert(*shards == dnnl::impl::kernel_cache::get().get_shards());
+#endif
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_set_primitive_cache_shards(int shards) {
+    return dnnl::impl::set_primitive_cache_shards(shards, shards);
+}
@@ -50,6 +50,9 @@ struct primitive_cache_iface_t {
     int get_capacity() const;
     int get_size() const;
 
+    status_t set_shards(int shards);
+    int get_shards() const;
+
     std::shared_ptr<primitive_desc_t> get_pd(const key_t &key);
     result_t get_or_create(const key_t &key, create_func_t create,
             void *create_context, bool force_create);
@@ -61,6 +64,7 @@ private:
 primitive_cache_iface_t primitive_cache();
 status_t set_primitive_cache_capacity(
         int primitive_capacity, int kernel_capacity);
+status_t set_primitive_cache_shards(int primitive_shards, int kernel_shards);
 
 // Undocumented API for testing.
 status_t DNNL_API get_primitive_cache_size(int *size);
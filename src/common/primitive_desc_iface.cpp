@@ -103,13 +103,22 @@ status_t dnnl_primitive_desc::create_primitive_iface(
     if (status != status::success) return status;
     // Step 2: create primitive_iface_t, init and return it to user
     primitive_iface_t *p_iface = nullptr;
-    CHECK(safe_ptr_assign(p_iface, new primitive_iface_t(p.first, engine())));
-    status = p_iface->init();
+    CHECK(wrap_primitive(&p_iface, p.first));
+    primitive_iface = std::make_pair(p_iface, p.second);
+    return status::success;
+}
+
+status_t dnnl_primitive_desc::wrap_primitive(
+        primitive_iface_t **primitive_iface,
+        const std::shared_ptr<primitive_t> &primitive) const {
+    primitive_iface_t *p_iface = nullptr;
+    CHECK(safe_ptr_assign(p_iface, new primitive_iface_t(primitive, engine())));
+    const status_t status = p_iface->init();
     if (status != status::success) {
         p_iface->release();
         return status;
     }
-    primitive_iface = std::make_pair(p_iface, p.second);
+    *primitive_iface = p_iface;
     return status::success;
 }
 
@@ -135,6 +144,10 @@ std::string dnnl_primitive_desc::info_with_runtime_dims(
             engine_, src_md, wei_md, bia_md, dst_md);
 }
 
+dnnl_primitive_desc *dnnl_primitive_desc::clone() const {
+    return new dnnl_primitive_desc(impl(), engine());
+}
+
 dnnl::impl::engine_t *dnnl_primitive_desc::src_engine() const {
     return engine();
 }
@@ -181,9 +194,8 @@ status_t dnnl_primitive_desc_clone(
     if (utils::any_null(primitive_desc_iface, existing_primitive_desc_iface))
         return invalid_arguments;
 
-    return safe_ptr_assign(*primitive_desc_iface,
-            new primitive_desc_iface_t(existing_primitive_desc_iface->impl(),
-                    existing_primitive_desc_iface->engine()));
+    return safe_ptr_assign(
+            *primitive_desc_iface, existing_primitive_desc_iface->clone());
 }
 
 status_t dnnl_primitive_desc_destroy(
@@ -69,11 +69,20 @@ struct dnnl_primitive_desc : public dnnl::impl::c_compatible {
     virtual dnnl::impl::status_t query(
             dnnl::impl::query_t what, int idx, void *result) const;
 
-    virtual dnnl::impl::status_t create_primitive_iface(
+    // Returns a new primitive descriptor sharing the implementation.
+    virtual dnnl_primitive_desc *clone() const;
+
+    dnnl::impl::status_t create_primitive_iface(
             std::pair<primitive_iface_t *, dnnl::impl::cache_state_t>
                     &primitive_iface,
             const dnnl::impl::cache_blob_t &cache_blob) const;
 
+    // Creates a primitive_iface_t for an already created implementation. The
+    // scratchpad of the primitive is created on the calling thread.
+    virtual dnnl::impl::status_t wrap_primitive(
+            primitive_iface_t **primitive_iface,
+            const std::shared_ptr<dnnl::impl::primitive_t> &primitive) const;
+
     const std::shared_ptr<dnnl::impl::primitive_desc_t> &impl() const;
 
 protected:
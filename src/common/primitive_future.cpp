@@ -0,0 +1,224 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "primitive_cache.hpp"
+#include "primitive_desc_iface.hpp"
+#include "primitive_future.hpp"
+#include "primitive_iface.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+
+// The primitive cache key includes the maximum number of threads, so the
+// creating thread must report the same number as the requesting one for the
+// created primitive to be found in the cache.
+void run_with_max_threads(int nthr, const std::function<void()> &f) {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    if (omp_get_max_threads() != nthr) omp_set_num_threads(nthr);
+    f();
+#elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+    if (tbb::this_task_arena::max_concurrency() != nthr) {
+        tbb::task_arena arena(nthr);
+        arena.execute(f);
+    } else {
+        f();
+    }
+#else
+    MAYBE_UNUSED(nthr);
+    f();
+#endif
+}
+
+} // namespace
+
+primitive_creation_pool_t &primitive_creation_pool_t::get_instance() {
+#ifdef _WIN32
+    // Joining threads while the library is being unloaded deadlocks on
+    // Windows, hence the pool is never destroyed there.
+    static primitive_creation_pool_t *pool = new primitive_creation_pool_t();
+    return *pool;
+#else
+    static primitive_creation_pool_t pool;
+    return pool;
+#endif
+}
+
+primitive_creation_pool_t::primitive_creation_pool_t()
+    : idle_threads_(0), stop_(false) {
+    // The pool uses the primitive cache, so the cache must be constructed
+    // first to be destroyed after the pool.
+    primitive_cache();
+
+    const int default_nthr
+            = std::max(1, (int)std::thread::hardware_concurrency());
+    nthr_ = getenv_int_user("PRIMITIVE_CREATION_THREADS", default_nthr);
+    if (nthr_ < 1) nthr_ = default_nthr;
+}
+
+primitive_creation_pool_t::~primitive_creation_pool_t() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto &t : threads_)
+        t.join();
+}
+
+void primitive_creation_pool_t::submit(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(std::move(task));
+        // Threads are started on demand to keep the pool free for
+        // applications which never create primitives asynchronously.
+        if ((int)threads_.size() < nthr_
+                && tasks_.size() > (size_t)idle_threads_) {
+            threads_.emplace_back(&primitive_creation_pool_t::worker, this);
+        }
+    }
+    cv_.notify_one();
+}
+
+void primitive_creation_pool_t::worker() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        idle_threads_++;
+        cv_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+        idle_threads_--;
+        if (stop_) return;
+
+        auto task = std::move(tasks_.front());
+        tasks_.pop_front();
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
+
+status_t create_primitive_async(
+        std::future<primitive_creation_result_t> &future,
+        const primitive_desc_iface_t *pd_iface) {
+    std::shared_ptr<primitive_desc_iface_t> pd_clone(pd_iface->clone());
+    if (!pd_clone) return out_of_memory;
+
+    const int nthr = dnnl_get_max_threads();
+    auto promise
+            = std::make_shared<std::promise<primitive_creation_result_t>>();
+    future = promise->get_future();
+    primitive_creation_pool_t::get_instance().submit(
+            [pd_clone, nthr, promise]() {
+                primitive_creation_result_t result;
+                result.pd = pd_clone;
+                run_with_max_threads(nthr, [&]() {
+                    primitive_iface_t *p_iface = nullptr;
+                    result.status = dnnl_primitive_create(
+                            &p_iface, pd_clone.get());
+                    primitive_iface_ptr_t p_iface_ptr(p_iface);
+                    if (result.status == success)
+                        result.primitive = p_iface->get_primitive();
+                });
+                promise->set_value(std::move(result));
+            });
+    return success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+bool dnnl_primitive_future::is_ready() const {
+    return future_.valid()
+            && future_.wait_for(std::chrono::seconds(0))
+            == std::future_status::ready;
+}
+
+status_t dnnl_primitive_future::get(primitive_iface_t **primitive_iface) {
+    if (!future_.valid()) return invalid_arguments;
+
+    auto result = future_.get();
+    if (result.status != success) return result.status;
+    return result.pd->wrap_primitive(primitive_iface, result.primitive);
+}
+
+status_t dnnl_primitive_create_async(primitive_future_t **future,
+        const primitive_desc_iface_t *primitive_desc_iface) {
+    if (utils::any_null(future, primitive_desc_iface))
+        return invalid_arguments;
+
+    std::future<primitive_creation_result_t> f;
+    CHECK(create_primitive_async(f, primitive_desc_iface));
+    return safe_ptr_assign(*future, new primitive_future_t(std::move(f)));
+}
+
+status_t dnnl_primitive_future_is_ready(
+        const primitive_future_t *future, int *is_ready) {
+    if (utils::any_null(future, is_ready)) return invalid_arguments;
+    *is_ready = future->is_ready();
+    return success;
+}
+
+status_t dnnl_primitive_future_get(
+        primitive_future_t *future, primitive_iface_t **primitive_iface) {
+    if (utils::any_null(future, primitive_iface)) return invalid_arguments;
+    return future->get(primitive_iface);
+}
+
+status_t dnnl_primitive_future_destroy(primitive_future_t *future) {
+    // The implementation stays in the primitive cache if the primitive hasn't
+    // been taken.
+    delete future;
+    return success;
+}
+
+status_t dnnl_primitive_precompile(
+        int n, const primitive_desc_iface_t *const *primitive_desc_ifaces) {
+    if (n < 0 || (n > 0 && primitive_desc_ifaces == nullptr))
+        return invalid_arguments;
+
+    std::vector<std::future<primitive_creation_result_t>> futures(n);
+    status_t status = success;
+    for (int i = 0; i < n; i++) {
+        if (primitive_desc_ifaces[i] == nullptr) {
+            status = invalid_arguments;
+            break;
+        }
+        status = create_primitive_async(futures[i], primitive_desc_ifaces[i]);
+        if (status != success) break;
+    }
+
+    // Primitives are destroyed on the workers, their implementations stay in
+    // the primitive cache.
+    for (auto &f : futures) {
+        if (!f.valid()) continue;
+        auto result = f.get();
+        if (status == success) status = result.status;
+    }
+    return status;
+}
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
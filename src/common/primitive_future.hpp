@@ -0,0 +1,108 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PRIMITIVE_FUTURE_HPP
+#define COMMON_PRIMITIVE_FUTURE_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// A pool of threads creating primitives in the background. Creation goes
+// through the regular path, so created primitives land in the primitive cache.
+// The number of threads is controlled with ONEDNN_PRIMITIVE_CREATION_THREADS
+// and defaults to the number of hardware threads.
+struct primitive_creation_pool_t {
+    static primitive_creation_pool_t &get_instance();
+
+    void submit(std::function<void()> task);
+
+    int get_num_threads() const { return nthr_; }
+
+private:
+    primitive_creation_pool_t();
+    ~primitive_creation_pool_t();
+
+    void worker();
+
+    int nthr_;
+    int idle_threads_;
+    bool stop_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+    std::vector<std::thread> threads_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(primitive_creation_pool_t);
+};
+
+struct primitive_iface_deleter_t {
+    void operator()(primitive_iface_t *p) const { dnnl_primitive_destroy(p); }
+};
+
+using primitive_iface_ptr_t
+        = std::unique_ptr<primitive_iface_t, primitive_iface_deleter_t>;
+
+// The worker keeps only the implementation: a primitive_iface_t owns a
+// scratchpad which may be thread-local, so the one created on the worker is
+// destroyed there and the primitive is wrapped anew on the thread taking it.
+struct primitive_creation_result_t {
+    status_t status = status::success;
+    std::shared_ptr<primitive_desc_iface_t> pd;
+    std::shared_ptr<primitive_t> primitive;
+};
+
+// Starts creation of a primitive on the pool. The primitive descriptor is
+// cloned, so it can be destroyed right after the call.
+status_t create_primitive_async(
+        std::future<primitive_creation_result_t> &future,
+        const primitive_desc_iface_t *pd_iface);
+
+} // namespace impl
+} // namespace dnnl
+
+// dnnl_primitive_future is a user facing handle of a primitive being created
+// in the background. The created primitive can be taken out only once.
+struct dnnl_primitive_future : public dnnl::impl::c_compatible {
+    dnnl_primitive_future(
+            std::future<dnnl::impl::primitive_creation_result_t> &&future)
+        : future_(std::move(future)) {}
+
+    bool is_ready() const;
+    dnnl::impl::status_t get(primitive_iface_t **primitive_iface);
+
+private:
+    std::future<dnnl::impl::primitive_creation_result_t> future_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_primitive_future);
+};
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
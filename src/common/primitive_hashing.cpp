@@ -181,6 +181,11 @@ size_t get_md_hash(const memory_desc_t &md) {
             seed = get_array_hash(seed,
                     md.format_desc.sparse_desc.metadata_types,
                     sparse_desc_t::max_metadata_types);
+            seed = get_array_hash(seed, md.format_desc.sparse_desc.block_dims,
+                    DNNL_MAX_NDIMS);
+            seed = hash_combine(seed, md.format_desc.sparse_desc.group_count);
+            seed = hash_combine(
+                    seed, md.format_desc.sparse_desc.variable_dim_idx);
             // User cannot initialize `packed_desc` therefore `packed_desc`
             // is always zero initialized.
             break;
@@ -275,6 +280,16 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
                 seed = hash_combine(
                         seed, static_cast<size_t>(entry.depthwise_conv.dst_dt));
                 break;
+            case primitive_kind::pooling:
+                seed = hash_combine(
+                        seed, static_cast<size_t>(entry.pooling.alg));
+                seed = hash_combine(
+                        seed, static_cast<size_t>(entry.pooling.kernel));
+                seed = hash_combine(
+                        seed, static_cast<size_t>(entry.pooling.stride));
+                seed = hash_combine(
+                        seed, static_cast<size_t>(entry.pooling.padding));
+                break;
             case primitive_kind::binary:
                 seed = hash_combine(
                         seed, static_cast<size_t>(entry.binary.alg));
@@ -740,6 +755,7 @@ size_t get_desc_hash(const sdpa_desc_t &desc) {
     seed = hash_combine(seed, desc.vs_zero_points.get_hash());
     seed = hash_combine(seed, get_md_hash(desc.dst_desc));
     seed = hash_combine(seed, get_md_hash(desc.attn_mask_desc));
+    seed = hash_combine(seed, get_md_hash(desc.block_table_desc));
     // Scale type
     seed = hash_combine(seed, static_cast<size_t>(desc.scale_dt));
     seed = hash_combine(seed, desc.invert_scale);
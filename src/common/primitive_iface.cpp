@@ -18,6 +18,7 @@
 
 #include "c_types_map.hpp"
 #include "engine.hpp"
+#include "persistent_cache.hpp"
 
 #if defined(DNNL_ENABLE_ITT_TASKS)
 #include "ittnotify.hpp"
@@ -59,12 +60,11 @@ void unpoison_outputs(const exec_args_t &args) {
 namespace dnnl {
 namespace impl {
 
-status_t primitive_create(primitive_iface_t **primitive_iface,
+namespace {
+status_t create_primitive_iface(
+        std::pair<primitive_iface_t *, cache_state_t> &p_iface,
         const primitive_desc_iface_t *primitive_desc_iface,
-        const cache_blob_t &cache_blob = cache_blob_t()) {
-
-    std::pair<primitive_iface_t *, cache_state_t> p_iface;
-
+        const cache_blob_t &cache_blob) {
     if (get_verbose(verbose_t::create_profile,
                 prim_kind2_comp_kind(primitive_desc_iface->impl()->kind()))) {
         double start_ms = get_msec();
@@ -84,6 +84,46 @@ status_t primitive_create(primitive_iface_t **primitive_iface,
         CHECK(primitive_desc_iface->create_primitive_iface(
                 p_iface, cache_blob));
     }
+    return status::success;
+}
+} // namespace
+
+status_t primitive_create(primitive_iface_t **primitive_iface,
+        const primitive_desc_iface_t *primitive_desc_iface,
+        const cache_blob_t &cache_blob = cache_blob_t()) {
+
+    std::pair<primitive_iface_t *, cache_state_t> p_iface;
+
+    // The library-managed persistent cache is used only when the user doesn't
+    // provide a cache blob. An empty cache blob ID means that the primitive
+    // doesn't support cache blobs.
+    persistent_cache::blob_t persistent_blob;
+    const auto &cache_blob_id = persistent_cache::is_enabled()
+            ? primitive_desc_iface->impl()->get_cache_blob_id(
+                    primitive_desc_iface->engine())
+            : std::vector<uint8_t>();
+    const bool use_persistent_cache = !cache_blob && !cache_blob_id.empty();
+    if (use_persistent_cache)
+        CHECK(persistent_cache::load(cache_blob_id, persistent_blob));
+
+    status_t status = create_primitive_iface(p_iface, primitive_desc_iface,
+            cache_blob ? cache_blob : persistent_blob.get());
+    if (status != status::success && persistent_blob) {
+        // A blob that can't be deserialized, e.g. produced by a different
+        // driver, falls back to the regular creation.
+        persistent_blob.reset();
+        status = create_primitive_iface(
+                p_iface, primitive_desc_iface, cache_blob_t());
+    }
+    CHECK(status);
+
+    if (use_persistent_cache && !persistent_blob
+            && p_iface.second != cache_state_t::primitive_hit) {
+        // Storing the blob is the best effort, a failure doesn't affect the
+        // created primitive.
+        persistent_cache::store(cache_blob_id, p_iface.first);
+    }
+
     return safe_ptr_assign((*primitive_iface), p_iface.first);
 }
 
@@ -307,6 +347,7 @@ status_t dnnl_primitive::init() {
         }
         scratchpad_.reset(scratchpad_ptr);
         if (scratchpad_ptr->size() < scratchpad_size) return out_of_memory;
+        if (use_global_scratchpad) global_scratchpad_size_ = scratchpad_size;
     }
     return primitive_->create_resource(pd()->engine(), resource_mapper_);
 }
@@ -66,6 +66,16 @@ struct dnnl_primitive : public dnnl::impl::c_compatible {
             dnnl::impl::cache_blob_t cache_blob) const;
     dnnl::impl::status_t execute(dnnl::impl::exec_ctx_t &ctx) const;
 
+    const std::shared_ptr<dnnl::impl::primitive_t> &get_primitive() const {
+        return primitive_;
+    }
+
+    // Returns the size of the global scratchpad used by the primitive. Since
+    // the global scratchpad is thread-local, a thread which executes the
+    // primitive but didn't create it must reserve a scratchpad of this size.
+    size_t global_scratchpad_size() const { return global_scratchpad_size_; }
+    bool has_scratchpad() const { return scratchpad_ != nullptr; }
+
     void retain() { counter_++; }
 
     void release() {
@@ -79,6 +89,7 @@ private:
     std::atomic<int> counter_;
     std::shared_ptr<dnnl::impl::primitive_t> primitive_;
     std::unique_ptr<dnnl::impl::scratchpad_t> scratchpad_;
+    size_t global_scratchpad_size_ = 0;
     std::unique_ptr<primitive_desc_iface_t> pd_;
     dnnl::impl::resource_mapper_t resource_mapper_;
 
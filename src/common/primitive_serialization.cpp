@@ -165,6 +165,12 @@ void serialize(serialization_stream_t &sstream, const post_ops_t &post_ops) {
                 sstream.append(entry.depthwise_conv.bias_dt);
                 sstream.append(entry.depthwise_conv.dst_dt);
                 break;
+            case primitive_kind::pooling:
+                sstream.append(entry.pooling.alg);
+                sstream.append(entry.pooling.kernel);
+                sstream.append(entry.pooling.stride);
+                sstream.append(entry.pooling.padding);
+                break;
             case primitive_kind::binary:
                 sstream.append(entry.binary.alg);
                 serialize(sstream, entry.binary.user_src1_desc);
@@ -60,6 +60,11 @@ struct reorder_primitive_desc_iface_t : public dnnl_primitive_desc {
         return scratchpad_engine_;
     }
 
+    dnnl_primitive_desc *clone() const override {
+        return new reorder_primitive_desc_iface_t(
+                pd_, engine(), src_engine_, dst_engine_);
+    }
+
     dnnl::impl::status_t query(
             dnnl::impl::query_t what, int idx, void *result) const override {
         auto status = dnnl::impl::status::success;
@@ -75,28 +80,18 @@ struct reorder_primitive_desc_iface_t : public dnnl_primitive_desc {
         return status;
     }
 
-    status_t create_primitive_iface(
-            std::pair<primitive_iface_t *, cache_state_t> &primitive_iface,
-            const cache_blob_t &cache_blob) const override {
-        // Step 1: create impl::primitive_t or get it from primitive cache
-        std::pair<std::shared_ptr<primitive_t>, cache_state_t> p;
-        // Top level primitive can be fetched from the primitive cache since
-        // it's fetching it faster.
-        constexpr bool force_create_from_blob = false;
-        auto status = pd_->create_primitive(
-                p, engine(), cache_blob, force_create_from_blob);
-        if (status != status::success) return status;
-        // Step 2: create primitive_iface_t, init and return it to user
+    status_t wrap_primitive(primitive_iface_t **primitive_iface,
+            const std::shared_ptr<primitive_t> &primitive) const override {
         primitive_iface_t *p_iface = nullptr;
         CHECK(safe_ptr_assign(p_iface,
                 new primitive_iface_t(
-                        p.first, engine(), src_engine_, dst_engine_)));
-        status = p_iface->init();
+                        primitive, engine(), src_engine_, dst_engine_)));
+        const status_t status = p_iface->init();
         if (status != status::success) {
             p_iface->release();
             return status;
         }
-        primitive_iface = std::make_pair(p_iface, p.second);
+        *primitive_iface = p_iface;
         return status::success;
     }
 
@@ -32,9 +32,10 @@ dnnl_status_t DNNL_API sdpa_primitive_desc_create(
         bool invert_scale, dnnl_dim_t kv_head_number, int attn_mask_type,
         dnnl_alg_kind_t softmax_alg, const_dnnl_primitive_attr_t attr,
         const_dnnl_primitive_attr_t kq_attr,
-        const_dnnl_primitive_attr_t vs_attr) {
+        const_dnnl_primitive_attr_t vs_attr,
+        const_dnnl_memory_desc_t block_table_desc) {
     CHECK(sdpa_desc_check(query_desc, key_desc, value_desc, dst_desc, mask_desc,
-            engine, attr, kq_attr, vs_attr));
+            engine, attr, kq_attr, vs_attr, block_table_desc));
     CHECK(sdpa_attr_check(
             query_desc, key_desc, value_desc, engine, attr, kq_attr, vs_attr));
 
@@ -42,7 +43,7 @@ dnnl_status_t DNNL_API sdpa_primitive_desc_create(
             key_desc, value_desc, dst_desc, mask_desc,
             (dnnl::impl::data_type_t)scale_dt, invert_scale, kv_head_number,
             static_cast<attn_mask_type_t>(attn_mask_type), softmax_alg, kq_attr,
-            vs_attr);
+            vs_attr, block_table_desc);
     return dnnl::impl::primitive_desc_create(primitive_desc_iface, engine,
             (const dnnl::impl::op_desc_t *)&sdpa_desc, nullptr, attr);
 }
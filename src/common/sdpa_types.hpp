@@ -32,6 +32,7 @@ namespace impl {
 #define DNNL_ARG_KEYS DNNL_ARG_SRC_1
 #define DNNL_ARG_VALUES DNNL_ARG_SRC_2
 #define DNNL_ARG_ATTN_MASK DNNL_ARG_SHIFT
+#define DNNL_ARG_BLOCK_TABLE DNNL_ARG_SRC_3
 
 // NOLINTBEGIN(modernize-use-using)
 /// Types of attention mask
@@ -79,6 +80,11 @@ struct sdpa_desc_t : public op_desc_t {
 
     memory_desc_t dst_desc;
     memory_desc_t attn_mask_desc;
+    // Block table for paged keys and values: entry (b, p) is the index of the
+    // page holding keys [p * page_size, (p + 1) * page_size) of batch b. Keys
+    // and values are then described per page, with the number of pages as the
+    // batch dimension and the page size as the number of keys.
+    memory_desc_t block_table_desc;
     data_type_t scale_dt {};
     // invert_scale = false: multiply by scale
     // invert_scale = true:  divide by scale
@@ -93,7 +99,14 @@ struct sdpa_desc_t : public op_desc_t {
     // Head size.
     dnnl_dim_t head_size() const { return q_desc.dims[q_desc.ndims - 1]; }
     // Number of keys.
-    dnnl_dim_t keys() const { return k_desc.dims[k_desc.ndims - 1]; }
+    dnnl_dim_t keys() const {
+        const dnnl_dim_t n = k_desc.dims[k_desc.ndims - 1];
+        return is_paged() ? n * block_table_desc.dims[1] : n;
+    }
+    // Number of keys in a page.
+    dnnl_dim_t page_size() const { return k_desc.dims[k_desc.ndims - 1]; }
+    // Whether keys and values are stored in pages.
+    bool is_paged() const { return block_table_desc.ndims != 0; }
     // Number of values.
     dnnl_dim_t values() const { return v_desc.dims[v_desc.ndims - 1]; }
     // Total batch size.
@@ -16,6 +16,7 @@
 
 #include <assert.h>
 #include <memory>
+#include <vector>
 
 #include "oneapi/dnnl/dnnl.h"
 
@@ -65,6 +66,16 @@ status_t dnnl_stream_wait(stream_t *stream) {
     return stream->wait();
 }
 
+status_t dnnl_stream_set_cpu_numa_nodes(
+        stream_t *stream, int nnodes, const int *nodes) {
+    bool args_ok = !any_null(stream) && nnodes >= 0
+            && IMPLICATION(nnodes > 0, nodes != nullptr);
+    if (!args_ok) return invalid_arguments;
+    if (stream->engine()->kind() != engine_kind::cpu) return invalid_arguments;
+
+    return stream->set_cpu_numa_nodes(std::vector<int>(nodes, nodes + nnodes));
+}
+
 status_t dnnl_stream_destroy(stream_t *stream) {
     delete stream;
     return success;
@@ -18,6 +18,8 @@
 #define COMMON_STREAM_HPP
 
 #include <assert.h>
+#include <functional>
+#include <vector>
 #include "oneapi/dnnl/dnnl.h"
 #include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
 
@@ -26,6 +28,18 @@
 #include "common/stream_impl.hpp"
 #include "common/utils.hpp"
 
+namespace dnnl {
+namespace impl {
+
+// A region of memory accessed by a task submitted to a stream.
+struct memory_region_t {
+    const void *ptr;
+    size_t size;
+};
+
+} // namespace impl
+} // namespace dnnl
+
 struct dnnl_stream : public dnnl::impl::c_compatible {
     dnnl_stream(dnnl::impl::engine_t *engine, dnnl::impl::stream_impl_t *impl)
         : engine_(engine), impl_(impl) {}
@@ -45,12 +59,28 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
             const primitive_iface_t *primitive_iface,
             dnnl::impl::exec_ctx_t &ctx);
 
+    /** submits a task which reads `inputs` and writes `outputs`. Streams with
+     * out-of-order execution may defer the task until the previously
+     * submitted work accessing the same memory is completed. */
+    virtual dnnl::impl::status_t enqueue_task(
+            const std::function<dnnl::impl::status_t()> &task,
+            const std::vector<dnnl::impl::memory_region_t> &inputs,
+            const std::vector<dnnl::impl::memory_region_t> &outputs) {
+        return task();
+    }
+
     /** blocks until all submitted primitives to the stream are completed */
     virtual dnnl::impl::status_t wait() = 0;
 
     virtual void before_exec_hook() {}
     virtual void after_exec_hook() {}
 
+    /** binds threads executing primitives to the CPUs of the NUMA nodes */
+    virtual dnnl::impl::status_t set_cpu_numa_nodes(
+            const std::vector<int> &nodes) {
+        return dnnl::impl::status::unimplemented;
+    }
+
     virtual dnnl::impl::status_t reset_profiling() {
         if (!is_profiling_enabled())
             return dnnl::impl::status::invalid_arguments;
@@ -405,6 +405,9 @@ inline bool sparse_desc_is_equal(
 
     for (int i = 0; i < sparse_desc_t::max_metadata_types; i++)
         ok = ok && lhs.metadata_types[i] == rhs.metadata_types[i];
+    ok = ok && utils::array_cmp(lhs.block_dims, rhs.block_dims, DNNL_MAX_NDIMS);
+    ok = ok && lhs.group_count == rhs.group_count
+            && lhs.variable_dim_idx == rhs.variable_dim_idx;
 
     return ok;
 }
@@ -985,6 +988,7 @@ inline bool operator==(const sdpa_desc_t &lhs, const sdpa_desc_t &rhs) {
             && COMPARE_DESC_MEMBERS(vs_zero_points)
             && COMPARE_DESC_MEMBERS(dst_desc)
             && COMPARE_DESC_MEMBERS(attn_mask_desc)
+            && COMPARE_DESC_MEMBERS(block_table_desc)
             && COMPARE_DESC_MEMBERS(scale_dt)
             && COMPARE_DESC_MEMBERS(invert_scale)
             && COMPARE_DESC_MEMBERS(kv_head_number)
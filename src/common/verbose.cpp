@@ -765,6 +765,11 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
                     if (c.wei_dt == s8 || c.dst_dt != f32)
                         ss << ":" << c.dst_dt;
                 } break;
+                case primitive_kind::pooling: {
+                    const auto &p = e.pooling;
+                    ss << delim << p.alg << ":k" << p.kernel << "s" << p.stride
+                       << "p" << p.padding;
+                } break;
                 case primitive_kind::eltwise: {
                     const post_ops_t::entry_t::eltwise_t &ew = e.eltwise;
                     ss << delim << ew.alg;
@@ -1576,6 +1581,10 @@ std::string init_info_sdpa(const engine_t *e, const pd_t *pd) {
         ss << md2fmt_str("msk", pd->attn_mask_md(),
                 pd->invariant_src_user_format_kind(3))
            << " ";
+    if (pd->with_block_table())
+        ss << md2fmt_str("blk", pd->block_table_md(),
+                pd->invariant_src_user_format_kind(4))
+           << " ";
     ss << md2fmt_str("dst", pd->dst_md(), pd->invariant_dst_user_format_kind())
        << ",";
 
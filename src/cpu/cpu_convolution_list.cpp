@@ -29,6 +29,7 @@
 #include "cpu/ref_convolution.hpp"
 #include "cpu/ref_convolution_int8.hpp"
 #include "cpu/ref_fused_convolution.hpp"
+#include "cpu/ref_fused_convolution_bwd.hpp"
 
 #if DNNL_X64
 #include "cpu/x64/gemm_bf16_convolution.hpp"
@@ -49,6 +50,7 @@
 #include "cpu/x64/jit_brgemm_conv_bwd.hpp"
 #include "cpu/x64/jit_brgemm_conv_bwd_strided.hpp"
 #include "cpu/x64/jit_brgemm_conv_bwd_w.hpp"
+#include "cpu/x64/jit_brgemm_wino_conv.hpp"
 #include "cpu/x64/jit_sse41_1x1_convolution.hpp"
 #include "cpu/x64/jit_sse41_convolution.hpp"
 #include "cpu/x64/jit_uni_dw_convolution.hpp"
@@ -96,6 +98,34 @@ using namespace dnnl::impl::prop_kind;
     } \
 }
 
+#define BRGEMM_BF16_WEI_DECOMP_FWD_CONVS(dtwei, dtdst) { \
+    {forward, bf16, dtwei, dtdst}, { \
+        CPU_INSTANCE_AMX(brgemm_1x1_convolution_fwd_t<avx512_core_amx>) \
+        CPU_INSTANCE_AMX(brgemm_convolution_fwd_t<avx512_core_amx>) \
+        CPU_INSTANCE_AVX512(brgemm_1x1_convolution_fwd_t<avx512_core_bf16>) \
+        CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core_bf16>) \
+        CPU_INSTANCE_AVX2(brgemm_1x1_convolution_fwd_t<avx2_vnni_2>) \
+        CPU_INSTANCE_AVX2(brgemm_convolution_fwd_t<avx2_vnni_2>) \
+        CPU_INSTANCE(ref_convolution_fwd_t) \
+        nullptr, \
+    } \
+}
+
+#define BRGEMM_F16_WEI_DECOMP_FWD_CONVS(dtwei, dtdst) { \
+    {forward, f16, dtwei, dtdst}, { \
+        CPU_INSTANCE_AMX(brgemm_1x1_convolution_fwd_t<avx512_core_amx_fp16>) \
+        CPU_INSTANCE_AMX(brgemm_convolution_fwd_t<avx512_core_amx_fp16>) \
+        CPU_INSTANCE_AVX512(brgemm_1x1_convolution_fwd_t<avx10_2_512>) \
+        CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx10_2_512>) \
+        CPU_INSTANCE_AVX512(brgemm_1x1_convolution_fwd_t<avx512_core_fp16>) \
+        CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core_fp16>) \
+        CPU_INSTANCE_AVX2(brgemm_1x1_convolution_fwd_t<avx2_vnni_2>) \
+        CPU_INSTANCE_AVX2(brgemm_convolution_fwd_t<avx2_vnni_2>) \
+        CPU_INSTANCE(ref_convolution_fwd_t) \
+        nullptr, \
+    } \
+}
+
 #define BRGEMM_FP8_BWD_D_CONVS(dtsrc, dtwei, dtdst) { \
     {backward_data, dtsrc, dtwei, dtdst}, REG_BWD_D_PK({ \
         CPU_INSTANCE_AMX(brgemm_convolution_bwd_t<avx10_2_512_amx_2>) \
@@ -123,6 +153,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
         {{forward, f32, f32, f32}, {
             CPU_INSTANCE_AVX512(brdgmm_dw_convolution_fwd_t)
             CPU_INSTANCE_X64(ip_convolution_fwd_t)
+            CPU_INSTANCE_AVX2(brgemm_wino_convolution_fwd_t)
             CPU_INSTANCE_AMX(brgemm_1x1_convolution_fwd_t<avx10_2_512_amx_2>)
             CPU_INSTANCE_AMX(brgemm_convolution_fwd_t<avx10_2_512_amx_2>)
             CPU_INSTANCE_AMX(brgemm_1x1_convolution_fwd_t<avx512_core_amx>)
@@ -185,6 +216,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
         {{forward, bf16, bf16, f32}, {
             CPU_INSTANCE_AVX512(brdgmm_dw_convolution_fwd_t)
             CPU_INSTANCE_X64(ip_convolution_fwd_t)
+            CPU_INSTANCE_AVX512(brgemm_wino_convolution_fwd_t)
             CPU_INSTANCE_AMX(brgemm_1x1_convolution_fwd_t<avx512_core_amx>)
             CPU_INSTANCE_AMX(brgemm_convolution_fwd_t<avx512_core_amx>)
             CPU_INSTANCE_AMX(jit_avx512_core_amx_1x1_convolution_fwd_t)
@@ -204,6 +236,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
         {{forward, bf16, bf16, bf16}, {
             CPU_INSTANCE_AVX512(brdgmm_dw_convolution_fwd_t)
             CPU_INSTANCE_X64(ip_convolution_fwd_t)
+            CPU_INSTANCE_AVX512(brgemm_wino_convolution_fwd_t)
             CPU_INSTANCE_AMX(brgemm_1x1_convolution_fwd_t<avx512_core_amx>)
             CPU_INSTANCE_AMX(brgemm_convolution_fwd_t<avx512_core_amx>)
             CPU_INSTANCE_AMX(jit_avx512_core_amx_1x1_convolution_fwd_t)
@@ -258,6 +291,23 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE(ref_fused_convolution_fwd_t)
             nullptr,
         }},
+        // Weights decompression
+        BRGEMM_BF16_WEI_DECOMP_FWD_CONVS(s8, bf16),
+        BRGEMM_BF16_WEI_DECOMP_FWD_CONVS(s8, f32),
+        BRGEMM_BF16_WEI_DECOMP_FWD_CONVS(u8, bf16),
+        BRGEMM_BF16_WEI_DECOMP_FWD_CONVS(u8, f32),
+        BRGEMM_BF16_WEI_DECOMP_FWD_CONVS(s4, bf16),
+        BRGEMM_BF16_WEI_DECOMP_FWD_CONVS(s4, f32),
+        BRGEMM_BF16_WEI_DECOMP_FWD_CONVS(u4, bf16),
+        BRGEMM_BF16_WEI_DECOMP_FWD_CONVS(u4, f32),
+        BRGEMM_F16_WEI_DECOMP_FWD_CONVS(s8, f16),
+        BRGEMM_F16_WEI_DECOMP_FWD_CONVS(s8, f32),
+        BRGEMM_F16_WEI_DECOMP_FWD_CONVS(u8, f16),
+        BRGEMM_F16_WEI_DECOMP_FWD_CONVS(u8, f32),
+        BRGEMM_F16_WEI_DECOMP_FWD_CONVS(s4, f16),
+        BRGEMM_F16_WEI_DECOMP_FWD_CONVS(s4, f32),
+        BRGEMM_F16_WEI_DECOMP_FWD_CONVS(u4, f16),
+        BRGEMM_F16_WEI_DECOMP_FWD_CONVS(u4, f32),
         BRGEMM_FP8_FWD_CONVS(f8_e5m2, f8_e5m2, f16),
         BRGEMM_FP8_FWD_CONVS(f8_e5m2, f8_e5m2, f32),
         BRGEMM_FP8_FWD_CONVS(f8_e5m2, f8_e5m2, bf16),
@@ -479,6 +529,19 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
         BRGEMM_FP8_BWD_W_CONVS(f8_e4m3, f32, f8_e4m3),
         BRGEMM_FP8_BWD_W_CONVS(f8_e4m3, f16, f8_e5m2),
         BRGEMM_FP8_BWD_W_CONVS(f8_e4m3, f16, f8_e4m3),
+        // BWD fp (data and weights gradients)
+        {{backward, f32, f32, f32}, REG_BWD_PK({
+            CPU_INSTANCE(ref_fused_convolution_bwd_t)
+            nullptr,
+        })},
+        {{backward, bf16, bf16, bf16}, REG_BWD_PK({
+            CPU_INSTANCE(ref_fused_convolution_bwd_t)
+            nullptr,
+        })},
+        {{backward, f16, f16, f16}, REG_BWD_PK({
+            CPU_INSTANCE(ref_fused_convolution_bwd_t)
+            nullptr,
+        })},
         // FWD int8 (src:s8)
         {{forward, s8, s8, f32}, {
             CPU_INSTANCE_AVX512(brdgmm_dw_convolution_fwd_t)
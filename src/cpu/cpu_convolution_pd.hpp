@@ -54,6 +54,16 @@ struct cpu_convolution_fwd_pd_t : public convolution_fwd_pd_t {
         return !is_zero_preserved;
     }
 
+    // Floating-point activations with integer weights that are dequantized
+    // with weights scales and zero-points before the computations.
+    bool with_wei_decompression() const {
+        using namespace data_type;
+        return utils::one_of(invariant_src_md()->data_type, bf16, f16)
+                && utils::one_of(
+                        invariant_wei_md()->data_type, s8, u8, s4, u4)
+                && attr()->fpmath_.apply_to_int_;
+    }
+
 protected:
     // See `convolution_pd_t::attr_scales_ok` comment.
     status_t attr_scales_ok(
@@ -72,6 +82,32 @@ protected:
         return convolution_fwd_pd_t::attr_zero_points_ok(supported_args_map);
     }
 
+    // Checks weights scales and zero-points for weights decompression. Both
+    // are optional and may be set per output channel or per groups of input
+    // channels of every output channel.
+    status_t attr_wei_decompression_ok() const {
+        using namespace data_type;
+        const int oc_mask = with_groups() ? 3 : 1;
+        const int oc_ic_mask = with_groups() ? 7 : 3;
+        CHECK(attr_scales_ok({{DNNL_ARG_WEIGHTS, {0, oc_mask, oc_ic_mask}}}));
+        CHECK(attr_zero_points_ok(
+                {{DNNL_ARG_WEIGHTS, {0, oc_mask, oc_ic_mask}}}));
+
+        const auto &sc = attr()->scales_;
+        const auto &zp = attr()->zero_points_;
+        VDISPATCH_CONV_IC(IMPLICATION(!sc.has_default_values(DNNL_ARG_WEIGHTS),
+                                  utils::one_of(sc.get_data_type(
+                                                        DNNL_ARG_WEIGHTS),
+                                          f32, bf16, f16)),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        VDISPATCH_CONV_IC(IMPLICATION(!zp.has_default_values(DNNL_ARG_WEIGHTS),
+                                  utils::one_of(zp.get_data_type(
+                                                        DNNL_ARG_WEIGHTS),
+                                          s8, u8, s4, u4, s32)),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+        return status::success;
+    }
+
 private:
     bool has_padded_dst() const {
         memory_desc_wrapper dst_d(&dst_md_);
@@ -102,6 +138,10 @@ struct cpu_convolution_bwd_weights_pd_t : public convolution_bwd_weights_pd_t {
     }
 };
 
+struct cpu_convolution_bwd_pd_t : public convolution_bwd_pd_t {
+    using convolution_bwd_pd_t::convolution_bwd_pd_t;
+};
+
 } // namespace cpu
 } // namespace impl
 } // namespace dnnl
@@ -25,6 +25,7 @@
 #include "common/stream.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/cpu_numa.hpp"
 #include "cpu/platform.hpp"
 
 namespace dnnl {
@@ -89,6 +90,7 @@ protected:
     status_t init_allocate(size_t size) override {
         void *ptr = malloc(size, platform::get_cache_line_size());
         if (!ptr) return status::out_of_memory;
+        if (numa::is_numa_aware()) numa::first_touch(ptr, size);
         data_ = decltype(data_)(ptr, destroy);
         return status::success;
     }
@@ -0,0 +1,205 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <cstdio>
+#include <string>
+
+#include "common/utils.hpp"
+
+#include "cpu/cpu_numa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace numa {
+
+namespace {
+
+#if defined(__linux__)
+// Parses a list in the sysfs format, e.g. "0-3,8-11".
+std::vector<int> parse_list(const std::string &str) {
+    std::vector<int> values;
+    size_t pos = 0;
+    while (pos < str.size()) {
+        size_t next = str.find(',', pos);
+        if (next == std::string::npos) next = str.size();
+        const std::string range = str.substr(pos, next - pos);
+        pos = next + 1;
+
+        int first = 0, last = 0;
+        const int n = sscanf(range.c_str(), "%d-%d", &first, &last);
+        if (n < 1) continue;
+        if (n == 1) last = first;
+        for (int v = first; v <= last; v++)
+            values.push_back(v);
+    }
+    return values;
+}
+
+std::string read_line(const std::string &path) {
+    FILE *fp = fopen(path.c_str(), "r");
+    if (!fp) return std::string();
+    char buf[4096] = {0};
+    const bool ok = fgets(buf, sizeof(buf), fp) != nullptr;
+    fclose(fp);
+    return ok ? std::string(buf) : std::string();
+}
+#endif
+
+struct topology_t {
+    topology_t() {
+#if defined(__linux__)
+        cpu_set_t allowed;
+        const bool has_affinity
+                = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+
+        const std::string sys = "/sys/devices/system/node/";
+        for (int node : parse_list(read_line(sys + "online"))) {
+            auto cpus = parse_list(read_line(
+                    sys + "node" + std::to_string(node) + "/cpulist"));
+            // CPUs outside of the process affinity mask, e.g. set with
+            // numactl, can't be used.
+            std::vector<int> usable_cpus;
+            for (int cpu : cpus) {
+                if (cpu >= CPU_SETSIZE) continue;
+                if (has_affinity && !CPU_ISSET(cpu, &allowed)) continue;
+                usable_cpus.push_back(cpu);
+            }
+            node_cpus.push_back(std::move(usable_cpus));
+        }
+#endif
+        if (node_cpus.empty()) node_cpus.emplace_back();
+    }
+
+    std::vector<std::vector<int>> node_cpus;
+};
+
+const topology_t &topology() {
+    static const topology_t topology;
+    return topology;
+}
+
+// Buffers smaller than that are likely to stay in caches, so page placement
+// doesn't matter for them.
+constexpr size_t first_touch_threshold = 2 * 1024 * 1024;
+
+} // namespace
+
+int get_num_nodes() {
+    return (int)topology().node_cpus.size();
+}
+
+const std::vector<int> &get_node_cpus(int node) {
+    return topology().node_cpus[node];
+}
+
+status_t get_cpus(const std::vector<int> &nodes, std::vector<int> &cpus) {
+    cpus.clear();
+    for (int node : nodes) {
+        if (node < 0 || node >= get_num_nodes())
+            return status::invalid_arguments;
+        const auto &node_cpus = get_node_cpus(node);
+        cpus.insert(cpus.end(), node_cpus.begin(), node_cpus.end());
+    }
+    return cpus.empty() && !nodes.empty() ? status::invalid_arguments
+                                          : status::success;
+}
+
+bool is_numa_aware() {
+    static const bool is_enabled
+            = getenv_int_user("CPU_NUMA_AWARE", 0) && get_num_nodes() > 1;
+    return is_enabled;
+}
+
+bool is_binding_supported() {
+#if defined(__linux__) && DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    return true;
+#else
+    return false;
+#endif
+}
+
+status_t bind_threads(const std::vector<int> &cpus) {
+#if defined(__linux__) && DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    if (cpus.empty()) return status::invalid_arguments;
+
+    // OpenMP reuses the team of the calling thread between parallel regions,
+    // so the team is bound once and then only when the CPUs or the number of
+    // threads change. That keeps a parallel region out of every execution.
+    static thread_local std::vector<int> team_cpus;
+    static thread_local int team_nthr = 0;
+    const int max_nthr = dnnl_get_max_threads();
+    if (team_nthr == max_nthr && team_cpus == cpus) return status::success;
+
+    std::atomic<bool> all_bound(true);
+    parallel(max_nthr, [&](int ithr, int nthr) {
+        // A thread may be shared by teams of several calling threads.
+        static thread_local int bound_cpu = -1;
+        const int cpu = cpus[ithr % cpus.size()];
+        if (bound_cpu == cpu) return;
+
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        CPU_SET(cpu, &cpu_set);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set)
+                == 0)
+            bound_cpu = cpu;
+        else
+            all_bound = false;
+    });
+    if (all_bound) {
+        team_cpus = cpus;
+        team_nthr = max_nthr;
+    }
+    return status::success;
+#else
+    UNUSED(cpus);
+    return status::unimplemented;
+#endif
+}
+
+void first_touch(void *ptr, size_t size) {
+#if defined(__linux__)
+    if (!ptr || size < first_touch_threshold) return;
+
+    const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    char *base = static_cast<char *>(ptr);
+    const size_t npages = utils::div_up(size, page_size);
+    parallel(0, [&](int ithr, int nthr) {
+        size_t start {0}, end {0};
+        balance211(npages, nthr, ithr, start, end);
+        for (size_t p = start; p < end; p++)
+            base[p * page_size] = 0;
+    });
+#else
+    UNUSED(ptr);
+    UNUSED(size);
+#endif
+}
+
+} // namespace numa
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,64 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_NUMA_HPP
+#define CPU_CPU_NUMA_HPP
+
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace numa {
+
+// NUMA topology of the system as reported by the OS. On systems without NUMA
+// information there is a single node without a known list of CPUs.
+int get_num_nodes();
+const std::vector<int> &get_node_cpus(int node);
+
+// Returns the CPUs of the given nodes ordered node by node, so that
+// consecutive threads bound to them form per-node teams.
+status_t get_cpus(const std::vector<int> &nodes, std::vector<int> &cpus);
+
+// NUMA-aware mode is enabled with ONEDNN_CPU_NUMA_AWARE. In this mode memory
+// allocated by the library is first touched by the threads which consume it.
+bool is_numa_aware();
+
+// Binds threads of the calling thread's team to `cpus`: thread `ithr` is bound
+// to `cpus[ithr % cpus.size()]`. Since `balance211()` gives consecutive
+// threads consecutive chunks of work, work partitioning then follows node
+// boundaries. Repeated calls with the same CPUs and number of threads from a
+// calling thread don't rebind its team. Only OpenMP runtime on Linux is
+// supported.
+bool is_binding_supported();
+status_t bind_threads(const std::vector<int> &cpus);
+
+// Touches every page of the buffer from the thread which gets the same part
+// of it from `balance211()` in `parallel()`, so that the OS places the pages
+// on the node of the consuming thread.
+void first_touch(void *ptr, size_t size);
+
+} // namespace numa
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
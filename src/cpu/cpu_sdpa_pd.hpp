@@ -0,0 +1,179 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_SDPA_PD_HPP
+#define CPU_CPU_SDPA_PD_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/sdpa_pd.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+#include "cpu/cpu_engine.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Maps an element of the keys or values tensor to the offset of its scale or
+// zero point. Parameters are stored densely over the dimensions from the mask,
+// with the last two dimensions divided by the groups.
+struct sdpa_quant_t {
+    sdpa_quant_t() = default;
+    sdpa_quant_t(const quant_entry_t &entry, const memory_desc_t &md) {
+        dim_t stride = 1;
+        for (int d = 3; d >= 0; d--) {
+            groups_[d] = 1;
+            strides_[d] = 0;
+            if (entry.has_default_values()) continue;
+            if (!(entry.get_mask() & (1 << d))) continue;
+            if (d >= 2) groups_[d] = entry.get_group(d - 2);
+            strides_[d] = stride;
+            stride *= md.dims[d] / groups_[d];
+        }
+    }
+
+    bool groups_ok(const memory_desc_t &md) const {
+        for (int d = 0; d < 4; d++)
+            if (groups_[d] <= 0 || md.dims[d] % groups_[d] != 0) return false;
+        return true;
+    }
+
+    dim_t off(dim_t d0, dim_t d1, dim_t d2, dim_t d3) const {
+        return d0 / groups_[0] * strides_[0] + d1 / groups_[1] * strides_[1]
+                + d2 / groups_[2] * strides_[2] + d3 / groups_[3] * strides_[3];
+    }
+
+private:
+    dim_t groups_[4] = {1, 1, 1, 1};
+    dim_t strides_[4] = {0, 0, 0, 0};
+};
+
+struct cpu_sdpa_pd_t : public sdpa_pd_t {
+    using sdpa_pd_t::sdpa_pd_t;
+
+    // Number of query heads sharing a head of keys and values.
+    dim_t kv_group_size() const {
+        return qry_md()->dims[1] / key_md()->dims[1];
+    }
+
+    const sdpa_quant_t &key_scales() const { return key_scales_; }
+    const sdpa_quant_t &key_zp() const { return key_zp_; }
+    const sdpa_quant_t &value_scales() const { return value_scales_; }
+    const sdpa_quant_t &value_zp() const { return value_zp_; }
+
+protected:
+    // Checks the configuration supported by all CPU implementations: 4D
+    // tensors in plain formats, broadcast over the batch and the heads, keys
+    // and values quantized with arbitrary masks and groups, and optionally
+    // stored in pages.
+    status_t init_common(engine_t *engine) {
+        using namespace data_type;
+        using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+        VDISPATCH_SDPA(attr()->has_default_values(skip_mask_t::scales),
+                VERBOSE_UNSUPPORTED_ATTR);
+        VDISPATCH_SDPA(utils::everyone_is(4, qry_md()->ndims, key_md()->ndims,
+                               val_md()->ndims, dst_md()->ndims),
+                VERBOSE_UNSUPPORTED_TAG);
+        VDISPATCH_SDPA(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+        for (auto md : {qry_md(), key_md(), val_md(), dst_md()}) {
+            const memory_desc_wrapper mdw(md);
+            VDISPATCH_SDPA(mdw.is_plain(), VERBOSE_UNSUPPORTED_TAG);
+        }
+
+        VDISPATCH_SDPA(utils::one_of(qry_md()->data_type, f32, bf16, f16),
+                VERBOSE_UNSUPPORTED_DT);
+        VDISPATCH_SDPA(utils::one_of(dst_md()->data_type, f32, bf16, f16),
+                VERBOSE_UNSUPPORTED_DT);
+        VDISPATCH_SDPA(utils::one_of(key_md()->data_type, f32, bf16, f16, s8,
+                               u8, s4, u4),
+                VERBOSE_UNSUPPORTED_DT);
+        VDISPATCH_SDPA(utils::one_of(val_md()->data_type, f32, bf16, f16, s8,
+                               u8, s4, u4),
+                VERBOSE_UNSUPPORTED_DT);
+        for (auto md : {qry_md(), dst_md(), key_md(), val_md()})
+            VDISPATCH_SDPA(platform::has_data_type_support(md->data_type),
+                    VERBOSE_UNSUPPORTED_DT);
+
+        const dim_t q_heads = qry_md()->dims[1];
+        VDISPATCH_SDPA(key_md()->dims[1] == val_md()->dims[1]
+                        && q_heads % key_md()->dims[1] == 0,
+                "number of heads in query tensor(%ld) must be a multiple of "
+                "the number of heads in the key(%ld) and value(%ld) tensors",
+                static_cast<long int>(q_heads),
+                static_cast<long int>(key_md()->dims[1]),
+                static_cast<long int>(val_md()->dims[1]));
+        if (with_block_table()) {
+            const memory_desc_wrapper bt_mdw(block_table_md());
+            VDISPATCH_SDPA(!bt_mdw.format_any() && bt_mdw.is_plain(),
+                    VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_SDPA(key_md()->dims[0] == val_md()->dims[0],
+                    VERBOSE_INCONSISTENT_DIM, "keys", 0, "values", 0);
+        } else {
+            for (auto md : {key_md(), val_md()})
+                VDISPATCH_SDPA(
+                        utils::one_of(md->dims[0], 1, qry_md()->dims[0]),
+                        VERBOSE_INCONSISTENT_DIM, "keys", 0, "queries", 0);
+        }
+
+        if (with_attn_mask() && !with_causal_mask()) {
+            const auto *msk = attn_mask_md();
+            const memory_desc_wrapper msk_mdw(msk);
+            VDISPATCH_SDPA(msk->ndims == 4, VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_SDPA(msk_mdw.is_plain(), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_SDPA(utils::one_of(msk->data_type, f32, bf16, f16),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SDPA(utils::one_of(msk->dims[0], 1, qry_md()->dims[0])
+                            && utils::one_of(msk->dims[1], 1, q_heads)
+                            && utils::one_of(msk->dims[2], 1, desc()->queries())
+                            && msk->dims[3] == desc()->keys(),
+                    "attn_mask dimensions can't be broadcast to the scores");
+        }
+
+        key_scales_ = sdpa_quant_t(desc()->kq_scales, *key_md());
+        key_zp_ = sdpa_quant_t(desc()->kq_zero_points, *key_md());
+        value_scales_ = sdpa_quant_t(desc()->vs_scales, *val_md());
+        value_zp_ = sdpa_quant_t(desc()->vs_zero_points, *val_md());
+        VDISPATCH_SDPA(key_scales_.groups_ok(*key_md())
+                        && key_zp_.groups_ok(*key_md())
+                        && value_scales_.groups_ok(*val_md())
+                        && value_zp_.groups_ok(*val_md()),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        if (with_key_zp())
+            VDISPATCH_SDPA(utils::one_of(key_zp_dt(), s8, u8, s32, s4, u4),
+                    VERBOSE_UNSUPPORTED_ZP_CFG);
+        if (with_value_zp())
+            VDISPATCH_SDPA(utils::one_of(value_zp_dt(), s8, u8, s32, s4, u4),
+                    VERBOSE_UNSUPPORTED_ZP_CFG);
+
+        return status::success;
+    }
+
+private:
+    sdpa_quant_t key_scales_;
+    sdpa_quant_t key_zp_;
+    sdpa_quant_t value_scales_;
+    sdpa_quant_t value_zp_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,132 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "common/memory.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/primitive_exec_types.hpp"
+#include "common/primitive_iface.hpp"
+#include "common/scratchpad.hpp"
+
+#include "cpu/cpu_stream.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+void append_memory_regions(
+        const memory_t *mem, std::vector<memory_region_t> &regions) {
+    const memory_desc_wrapper mdw(mem->md());
+    for (int i = 0; i < (int)mem->get_num_handles(); i++) {
+        const auto *mem_storage = mem->memory_storage(i);
+        void *handle = nullptr;
+        if (mem_storage) mem_storage->get_data_handle(&handle);
+        if (!handle) continue;
+        const size_t size = mem_storage->offset() + mdw.size(i, true, true);
+        regions.push_back({handle, size});
+    }
+}
+
+} // namespace
+
+cpu_stream_t::cpu_stream_t(engine_t *engine, impl::stream_impl_t *stream_impl)
+    : stream_t(engine, stream_impl) {
+    // In NUMA-aware mode threads are grouped by nodes by default.
+    if (numa::is_numa_aware() && numa::is_binding_supported()) {
+        std::vector<int> nodes(numa::get_num_nodes());
+        for (int i = 0; i < (int)nodes.size(); i++)
+            nodes[i] = i;
+        numa::get_cpus(nodes, numa_cpus_);
+    }
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP \
+        || DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+    // Independent primitives are executed concurrently by workers. The
+    // threads of the calling thread are split between the workers only for
+    // parallel regions which don't fix the number of threads; primitives use
+    // the number they were created with.
+    if (flags() & stream_flags::out_of_order) {
+        const int nthr = dnnl_get_max_threads();
+        const int nteams = std::max(
+                1, std::min(nthr, getenv_int_user("CPU_STREAM_TEAMS", 2)));
+        scheduler_ = utils::make_unique<stream_scheduler_t>(
+                engine, nteams, std::max(1, nthr / nteams));
+    }
+#endif
+}
+
+status_t cpu_stream_t::enqueue_primitive(
+        const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
+    const size_t global_scratchpad_size
+            = primitive_iface->global_scratchpad_size();
+
+    if (!scheduler_) return stream_t::enqueue_primitive(primitive_iface, ctx);
+    if (scheduler_->is_worker_thread()) {
+        // The worker may not have a large enough global scratchpad, which
+        // is reserved for the time of the execution then.
+        std::unique_ptr<scratchpad_t> scratchpad;
+        if (global_scratchpad_size > 0) {
+            scratchpad.reset(
+                    create_scratchpad(engine(), global_scratchpad_size, true));
+            if (!scratchpad || scratchpad->size() < global_scratchpad_size)
+                return status::out_of_memory;
+        }
+        return stream_t::enqueue_primitive(primitive_iface, ctx);
+    }
+
+    std::vector<memory_region_t> inputs, outputs;
+    for (const auto &arg : ctx.args()) {
+        if (!arg.second.mem) continue;
+        append_memory_regions(
+                arg.second.mem, arg.second.is_const ? inputs : outputs);
+    }
+    // Executions of a primitive which owns a scratchpad are serialized.
+    if (primitive_iface->has_scratchpad())
+        outputs.push_back({primitive_iface, 1});
+
+    // Memory objects are kept alive until the primitive is executed.
+    std::shared_ptr<exec_args_t> args(
+            new exec_args_t(ctx.args()), [](exec_args_t *ptr) {
+                for (auto &arg : *ptr)
+                    if (arg.second.mem) arg.second.mem->release();
+                delete ptr;
+            });
+    for (auto &arg : *args)
+        if (arg.second.mem) arg.second.mem->retain();
+
+    return scheduler_->submit(
+            [this, primitive_iface, args]() {
+                exec_ctx_t task_ctx(this, exec_args_t(*args));
+                return primitive_iface->execute(task_ctx);
+            },
+            inputs, outputs, global_scratchpad_size);
+}
+
+status_t cpu_stream_t::enqueue_task(const std::function<status_t()> &task,
+        const std::vector<memory_region_t> &inputs,
+        const std::vector<memory_region_t> &outputs) {
+    if (!scheduler_ || scheduler_->is_worker_thread()) return task();
+    return scheduler_->submit(task, inputs, outputs);
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
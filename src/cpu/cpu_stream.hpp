@@ -23,24 +23,59 @@
 #include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
 #endif
 
+#include <functional>
+#include <memory>
+#include <vector>
+
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/stream.hpp"
 
+#include "cpu/cpu_numa.hpp"
+#include "cpu/cpu_stream_scheduler.hpp"
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
 
 struct cpu_stream_t : public stream_t {
-    cpu_stream_t(engine_t *engine, impl::stream_impl_t *stream_impl)
-        : stream_t(engine, stream_impl) {}
+    cpu_stream_t(engine_t *engine, impl::stream_impl_t *stream_impl);
     ~cpu_stream_t() override = default;
 
+    dnnl::impl::status_t enqueue_primitive(
+            const primitive_iface_t *primitive_iface,
+            dnnl::impl::exec_ctx_t &ctx) override;
+
+    dnnl::impl::status_t enqueue_task(
+            const std::function<dnnl::impl::status_t()> &task,
+            const std::vector<dnnl::impl::memory_region_t> &inputs,
+            const std::vector<dnnl::impl::memory_region_t> &outputs) override;
+
     dnnl::impl::status_t wait() override {
-        // CPU execution is synchronous so return immediately
-        return dnnl::impl::status::success;
+        // CPU execution is synchronous unless the stream is out-of-order.
+        // Work submitted from a task of the stream is executed synchronously,
+        // so there is nothing to wait for there.
+        if (!scheduler_ || scheduler_->is_worker_thread())
+            return dnnl::impl::status::success;
+        return scheduler_->wait();
+    }
+
+    dnnl::impl::status_t set_cpu_numa_nodes(
+            const std::vector<int> &nodes) override {
+        if (!numa::is_binding_supported()) return status::unimplemented;
+        std::vector<int> cpus;
+        CHECK(numa::get_cpus(nodes, cpus));
+        numa_cpus_ = std::move(cpus);
+        return status::success;
     }
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_THREADPOOL
+    void before_exec_hook() override {
+        if (!numa_cpus_.empty() && !scheduler_)
+            numa::bind_threads(numa_cpus_);
+    }
+#endif
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     cpu_stream_t(engine_t *engine,
             dnnl::threadpool_interop::threadpool_iface *threadpool)
@@ -56,6 +91,14 @@ struct cpu_stream_t : public stream_t {
         threadpool_utils::deactivate_threadpool();
     }
 #endif
+
+private:
+    // CPUs the threads executing primitives are bound to.
+    std::vector<int> numa_cpus_;
+    // Executes primitives of an out-of-order stream. It's the last member, so
+    // that the submitted work is completed before the rest of the stream is
+    // destroyed.
+    std::unique_ptr<stream_scheduler_t> scheduler_;
 };
 
 } // namespace cpu
@@ -0,0 +1,185 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdint>
+
+#include "common/dnnl_thread.hpp"
+#include "common/scratchpad.hpp"
+
+#include "cpu/cpu_stream_scheduler.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+// The scheduler the calling thread is a worker of.
+thread_local const stream_scheduler_t *current_scheduler = nullptr;
+
+bool overlap(const memory_region_t &a, const memory_region_t &b) {
+    const auto a_begin = reinterpret_cast<uintptr_t>(a.ptr);
+    const auto b_begin = reinterpret_cast<uintptr_t>(b.ptr);
+    return a_begin < b_begin + b.size && b_begin < a_begin + a.size;
+}
+
+bool overlap(const std::vector<memory_region_t> &a,
+        const std::vector<memory_region_t> &b) {
+    for (const auto &ra : a)
+        for (const auto &rb : b)
+            if (overlap(ra, rb)) return true;
+    return false;
+}
+
+} // namespace
+
+stream_scheduler_t::stream_scheduler_t(
+        engine_t *engine, int nteams, int team_nthr)
+    : engine_(engine)
+    , nteams_(nteams)
+    , team_nthr_(team_nthr)
+    , status_(status::success)
+    , stop_(false) {
+    for (int i = 0; i < nteams_; i++)
+        threads_.emplace_back(&stream_scheduler_t::worker, this);
+}
+
+stream_scheduler_t::~stream_scheduler_t() {
+    wait();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    ready_cv_.notify_all();
+    for (auto &t : threads_)
+        t.join();
+}
+
+bool stream_scheduler_t::is_worker_thread() const {
+    return current_scheduler == this;
+}
+
+bool stream_scheduler_t::depends_on(const task_t &task, const task_t &prev) {
+    return overlap(task.outputs, prev.inputs)
+            || overlap(task.outputs, prev.outputs)
+            || overlap(task.inputs, prev.outputs);
+}
+
+status_t stream_scheduler_t::submit(const std::function<status_t()> &func,
+        const std::vector<memory_region_t> &inputs,
+        const std::vector<memory_region_t> &outputs,
+        size_t global_scratchpad_size) {
+    auto task = utils::make_unique<task_t>();
+    task->func = func;
+    task->inputs = inputs;
+    task->outputs = outputs;
+    task->global_scratchpad_size = global_scratchpad_size;
+    task->ndeps = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto &prev : pending_) {
+            if (!depends_on(*task, *prev)) continue;
+            prev->dependents.push_back(task.get());
+            task->ndeps++;
+        }
+        task_t *t = task.get();
+        t->self = pending_.insert(pending_.end(), std::move(task));
+        if (t->ndeps > 0) return status::success;
+        ready_.push_back(t);
+    }
+    ready_cv_.notify_one();
+    return status::success;
+}
+
+status_t stream_scheduler_t::wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this]() { return pending_.empty(); });
+    const status_t status = status_;
+    status_ = status::success;
+    return status;
+}
+
+void stream_scheduler_t::complete(task_t *task, status_t status) {
+    if (status_ == status::success) status_ = status;
+
+    int nready = 0;
+    for (auto *t : task->dependents) {
+        if (--t->ndeps > 0) continue;
+        ready_.push_back(t);
+        nready++;
+    }
+    pending_.erase(task->self);
+
+    if (nready == 1) ready_cv_.notify_one();
+    if (nready > 1) ready_cv_.notify_all();
+    if (pending_.empty()) done_cv_.notify_all();
+}
+
+void stream_scheduler_t::worker() {
+    current_scheduler = this;
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    // The number of threads is a per-thread setting. It applies only to
+    // parallel regions which don't fix the number of threads.
+    omp_set_num_threads(team_nthr_);
+#elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+    tbb::task_arena arena(team_nthr_);
+#endif
+
+    // Primitives with a global scratchpad use the one of the executing
+    // thread, so the worker keeps a scratchpad which fits the largest task.
+    std::unique_ptr<scratchpad_t> scratchpad;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        ready_cv_.wait(lock, [this]() { return stop_ || !ready_.empty(); });
+        if (stop_) break;
+
+        task_t *task = ready_.front();
+        ready_.pop_front();
+        lock.unlock();
+
+        status_t status = status::success;
+        const size_t scratchpad_size = scratchpad ? scratchpad->size() : 0;
+        if (task->global_scratchpad_size > scratchpad_size) {
+            scratchpad.reset(create_scratchpad(
+                    engine_, task->global_scratchpad_size, true));
+            if (!scratchpad || !scratchpad->get_memory_storage()
+                    || scratchpad->size() < task->global_scratchpad_size)
+                status = status::out_of_memory;
+        }
+        if (status == status::success) {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+            arena.execute([&]() { status = task->func(); });
+#else
+            status = task->func();
+#endif
+        }
+        // Objects captured by the task are released outside of the lock.
+        task->func = nullptr;
+
+        lock.lock();
+        complete(task, status);
+    }
+    lock.unlock();
+    scratchpad.reset();
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
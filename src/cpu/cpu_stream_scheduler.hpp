@@ -0,0 +1,103 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_STREAM_SCHEDULER_HPP
+#define CPU_CPU_STREAM_SCHEDULER_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/stream.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Executes tasks of an out-of-order stream. A task waits for all previously
+// submitted tasks accessing overlapping memory, unless both only read it.
+// Ready tasks are executed concurrently by `nteams` worker threads. Parallel
+// regions which don't fix the number of threads run with `team_nthr` threads
+// on a worker.
+struct stream_scheduler_t {
+    stream_scheduler_t(engine_t *engine, int nteams, int team_nthr);
+    ~stream_scheduler_t();
+
+    // `global_scratchpad_size` is the size of the global scratchpad the task
+    // needs on the executing thread, see
+    // `primitive_iface_t::global_scratchpad_size()`.
+    status_t submit(const std::function<status_t()> &func,
+            const std::vector<memory_region_t> &inputs,
+            const std::vector<memory_region_t> &outputs,
+            size_t global_scratchpad_size = 0);
+
+    // Blocks until all submitted tasks are completed. Returns the first error
+    // reported by the tasks since the previous call.
+    status_t wait();
+
+    int get_num_teams() const { return nteams_; }
+    int get_team_num_threads() const { return team_nthr_; }
+
+    // Returns true when called from a task of the scheduler, in which case
+    // the work is expected to be executed synchronously.
+    bool is_worker_thread() const;
+
+private:
+    struct task_t {
+        std::function<status_t()> func;
+        std::vector<memory_region_t> inputs;
+        std::vector<memory_region_t> outputs;
+        size_t global_scratchpad_size;
+        int ndeps;
+        std::vector<task_t *> dependents;
+        std::list<std::unique_ptr<task_t>>::iterator self;
+    };
+
+    static bool depends_on(const task_t &task, const task_t &prev);
+    void complete(task_t *task, status_t status);
+    void worker();
+
+    engine_t *engine_;
+    int nteams_;
+    int team_nthr_;
+
+    std::mutex mutex_;
+    std::condition_variable ready_cv_;
+    std::condition_variable done_cv_;
+    // Tasks which are submitted but not completed yet.
+    std::list<std::unique_ptr<task_t>> pending_;
+    std::deque<task_t *> ready_;
+    status_t status_;
+    bool stop_;
+    std::vector<std::thread> threads_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(stream_scheduler_t);
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -15,6 +15,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
+
 #include "oneapi/dnnl/dnnl.h"
 
 #include "common/bfloat16.hpp"
@@ -39,6 +41,7 @@
 #include "cpu/x64/gemm/f32/jit_avx512_common_gemm_f32.hpp"
 #include "cpu/x64/gemm/f32/jit_avx_gemm_f32.hpp"
 
+#include "cpu/x64/gemm/gemm_batch.hpp"
 #include "cpu/x64/gemm/gemm_driver.hpp"
 
 using namespace dnnl::impl::cpu::x64;
@@ -149,6 +152,61 @@ dnnl_status_t extended_sgemm(const char *transa, const char *transb,
             transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, bias);
 }
 
+dnnl_status_t sgemm_batch(dim_t batch_size, const char *transa,
+        const char *transb, const dim_t *M, const dim_t *N, const dim_t *K,
+        const float *alpha, const float *const *A, const dim_t *lda,
+        const float *const *B, const dim_t *ldb, const float *beta,
+        float *const *C, const dim_t *ldc) {
+    if (batch_size < 0) return dnnl_invalid_arguments;
+    if (batch_size == 0) return dnnl_success;
+    if (utils::any_null(transa, transb, M, N, K, A, lda, B, ldb, C, ldc))
+        return dnnl_invalid_arguments;
+    // Packed matrices are not supported by the batched API.
+    if (utils::one_of(*transa, 'P', 'p') || utils::one_of(*transb, 'P', 'p'))
+        return dnnl_invalid_arguments;
+    for (dim_t i = 0; i < batch_size; i++) {
+        dnnl_status_t status = check_gemm_input(transa, transb, &M[i], &N[i],
+                &K[i], A[i], &lda[i], B[i], &ldb[i], C[i], &ldc[i], alpha,
+                beta, false);
+        if (status != dnnl_success) return status;
+    }
+
+    // When there are fewer problems than threads, every problem gets all the
+    // threads instead.
+    if (batch_size < dnnl_get_max_threads()) {
+        for (dim_t i = 0; i < batch_size; i++) {
+            dnnl_status_t status = extended_sgemm(transa, transb, &M[i], &N[i],
+                    &K[i], alpha, A[i], &lda[i], B[i], &ldb[i], beta, C[i],
+                    &ldc[i]);
+            if (status != dnnl_success) return status;
+        }
+        return dnnl_success;
+    }
+
+#if DNNL_X64 && !__BUILD_GEMM_NONE
+    {
+        auto status = brgemm_sgemm_batch(batch_size, transa, transb, M, N, K,
+                alpha, A, lda, B, ldb, beta, C, ldc);
+        if (status != status::unimplemented) return status;
+    }
+#endif
+
+    // Every problem is computed by a single thread, as the GEMM called from
+    // a parallel region does not spawn threads.
+    std::atomic<dnnl_status_t> batch_status(dnnl_success);
+    parallel(0, [&](int ithr, int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(batch_size, nthr, ithr, start, end);
+        for (dim_t i = start; i < end; i++) {
+            dnnl_status_t status = extended_sgemm(transa, transb, &M[i], &N[i],
+                    &K[i], alpha, A[i], &lda[i], B[i], &ldb[i], beta, C[i],
+                    &ldc[i]);
+            if (status != dnnl_success) batch_status = status;
+        }
+    });
+    return batch_status;
+}
+
 // Tries calling Intel MKL cblas_gemm_s8u8s32 if applicable and available
 dnnl_status_t try_cblas_gemm_s8u8s32(const char *transa, const char *transb,
         const char *offsetc, const dim_t *M, const dim_t *N, const dim_t *K,
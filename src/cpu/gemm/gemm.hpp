@@ -57,6 +57,14 @@ dnnl_status_t extended_sgemm(const char *transa, const char *transb,
         const float *beta, float *C, const dim_t *ldc,
         const float *bias = nullptr, bool force_jit_gemm = false);
 
+// Computes a batch of independent column-major f32 GEMMs with common
+// transposition flags, alpha and beta.
+dnnl_status_t sgemm_batch(dim_t batch_size, const char *transa,
+        const char *transb, const dim_t *M, const dim_t *N, const dim_t *K,
+        const float *alpha, const float *const *A, const dim_t *lda,
+        const float *const *B, const dim_t *ldb, const float *beta,
+        float *const *C, const dim_t *ldc);
+
 dnnl_status_t gemm_s8u8s32(const char *transa, const char *transb,
         const char *offsetc, const dim_t *m, const dim_t *n, const dim_t *k,
         const float *alpha, const int8_t *a, const dim_t *lda, const int8_t *ao,
@@ -245,6 +245,16 @@ private:
     }
 };
 
+// Returns true if the `G + 1` offsets of a grouped tensor with `M` rows are
+// non-decreasing and stay within the rows, so that every group is a valid
+// range of rows.
+inline bool grouped_offsets_ok(const int32_t *offsets, dim_t G, dim_t M) {
+    if (offsets[0] < 0) return false;
+    for (dim_t g = 0; g < G; g++)
+        if (offsets[g + 1] < offsets[g]) return false;
+    return offsets[G] <= M;
+}
+
 } // namespace matmul
 } // namespace cpu
 } // namespace impl
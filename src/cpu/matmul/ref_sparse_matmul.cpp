@@ -20,6 +20,7 @@
 
 #include "cpu/ref_io_helper.hpp"
 
+#include "cpu/matmul/matmul_utils.hpp"
 #include "cpu/matmul/ref_sparse_matmul.hpp"
 
 namespace dnnl {
@@ -55,6 +56,12 @@ status_t ref_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
         auto wei_buffer_1 = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 1);
         auto wei_buffer_2 = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 2);
 
+        if (weights_d.encoding() == sparse_encoding::bsr) {
+            run_bsr_kernel(src, wei_values, wei_buffer_1, wei_buffer_2, dst, M,
+                    N, K, weights_d.block_dims(), mm_dt, false);
+            return status::success;
+        }
+
         // Both COO and CSR encoded data is operated on using CSR kernel for
         // matrix multiplication.
         // For COO encoding, data preparation includes using a temporary
@@ -98,6 +105,19 @@ status_t ref_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
         auto src_buffer_1 = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
         auto src_buffer_2 = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 2);
 
+        if (src_d.encoding() == sparse_encoding::bsr) {
+            run_bsr_kernel(weights, src_values, src_buffer_1, src_buffer_2, dst,
+                    M, N, K, src_d.block_dims(), mm_dt, true);
+            return status::success;
+        }
+        if (src_d.encoding() == sparse_encoding::grouped) {
+            if (!grouped_offsets_ok(src_buffer_1, src_d.group_count(), M))
+                return status::invalid_arguments;
+            run_grouped_kernel(src_values, weights, src_buffer_1, dst,
+                    src_d.group_count(), N, K, mm_dt);
+            return status::success;
+        }
+
         // Both COO and CSR encoded data is operated on using CSR kernel for
         // matrix multiplication.
         // For COO encoding, data preparation includes using a temporary
@@ -155,8 +175,9 @@ void ref_sparse_matmul_t::run_csr_kernel(const void *dmat, const void *values,
     if (is_src_sparse) {
         // With a sparse source tensor, the matrix multiplication is carried out
         // for a sparse multiplier with parallelization over the sparse rows
-        // of the multiplier matrix.
-        parallel_nd(M, [&](dim_t m) {
+        // of the multiplier matrix. Rows are distributed dynamically since
+        // they have different numbers of non-zero elements.
+        parallel_nd_dynamic(M, [&](dim_t m) {
             const dim_t row_start = pointers[m];
             const dim_t row_end = pointers[m + 1];
 
@@ -197,6 +218,76 @@ void ref_sparse_matmul_t::run_csr_kernel(const void *dmat, const void *values,
     }
 }
 
+void ref_sparse_matmul_t::run_bsr_kernel(const void *dmat, const void *values,
+        const int32_t *indices, const int32_t *pointers, void *res,
+        const dim_t M, const dim_t N, const dim_t K, const dims_t blk_dims,
+        const data_type_t mm_dt, bool is_src_sparse) const {
+    const dim_t blk_rows = blk_dims[0];
+    const dim_t blk_cols = blk_dims[1];
+    const dim_t blk_size = blk_rows * blk_cols;
+
+    if (is_src_sparse) {
+        // Rows of a block row share the non-zero blocks, and block rows are
+        // distributed dynamically since they have different numbers of them.
+        parallel_nd_dynamic(M / blk_rows, [&](dim_t mb) {
+            for_(dim_t i = 0; i < blk_rows; i++)
+            for (dim_t n = 0; n < N; n++) {
+                const dim_t c_idx = (mb * blk_rows + i) * N + n;
+                float c_val = io::load_float_value(mm_dt, res, c_idx);
+
+                for_(dim_t b = pointers[mb]; b < pointers[mb + 1]; b++)
+                for (dim_t j = 0; j < blk_cols; j++) {
+                    const dim_t a_idx = b * blk_size + i * blk_cols + j;
+                    const dim_t b_idx = (indices[b] * blk_cols + j) * N + n;
+                    const float a_val
+                            = io::load_float_value(mm_dt, values, a_idx);
+                    const float b_val
+                            = io::load_float_value(mm_dt, dmat, b_idx);
+                    c_val += a_val * b_val;
+                }
+                io::store_float_value(mm_dt, c_val, res, c_idx);
+            }
+        });
+    } else {
+        parallel_nd(M, [&](dim_t m) {
+            for_(dim_t kb = 0; kb < K / blk_rows; kb++)
+            for_(dim_t b = pointers[kb]; b < pointers[kb + 1]; b++)
+            for_(dim_t i = 0; i < blk_rows; i++)
+            for (dim_t j = 0; j < blk_cols; j++) {
+                const dim_t a_idx = m * K + kb * blk_rows + i;
+                const dim_t b_idx = b * blk_size + i * blk_cols + j;
+                const dim_t c_idx = m * N + indices[b] * blk_cols + j;
+                const float a_val = io::load_float_value(mm_dt, dmat, a_idx);
+                const float b_val = io::load_float_value(mm_dt, values, b_idx);
+                float c_val = io::load_float_value(mm_dt, res, c_idx);
+                c_val += a_val * b_val;
+                io::store_float_value(mm_dt, c_val, res, c_idx);
+            }
+        });
+    }
+}
+
+void ref_sparse_matmul_t::run_grouped_kernel(const void *src, const void *wei,
+        const int32_t *offsets, void *res, const dim_t G, const dim_t N,
+        const dim_t K, const data_type_t mm_dt) const {
+    // Groups have different numbers of rows, so they are distributed
+    // dynamically.
+    parallel_nd_dynamic(G, [&](dim_t g) {
+        for_(dim_t m = offsets[g]; m < offsets[g + 1]; m++)
+        for (dim_t n = 0; n < N; n++) {
+            float c_val = 0.f;
+            for (dim_t k = 0; k < K; k++) {
+                const dim_t a_idx = m * K + k;
+                const dim_t b_idx = (g * K + k) * N + n;
+                const float a_val = io::load_float_value(mm_dt, src, a_idx);
+                const float b_val = io::load_float_value(mm_dt, wei, b_idx);
+                c_val += a_val * b_val;
+            }
+            io::store_float_value(mm_dt, c_val, res, m * N + n);
+        }
+    });
+}
+
 } // namespace matmul
 } // namespace cpu
 } // namespace impl
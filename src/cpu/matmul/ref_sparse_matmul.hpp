@@ -52,12 +52,15 @@ struct ref_sparse_matmul_t : public primitive_t {
             VDISPATCH_MATMUL(IMPLICATION(src_d.is_sparse_desc(),
                                      utils::one_of(src_d.encoding(),
                                              sparse_encoding::csr,
-                                             sparse_encoding::coo)),
+                                             sparse_encoding::coo,
+                                             sparse_encoding::bsr,
+                                             sparse_encoding::grouped)),
                     VERBOSE_UNSUPPORTED_SPARSE_CFG);
             VDISPATCH_MATMUL(IMPLICATION(wei_d.is_sparse_desc(),
                                      utils::one_of(wei_d.encoding(),
                                              sparse_encoding::csr,
-                                             sparse_encoding::coo)),
+                                             sparse_encoding::coo,
+                                             sparse_encoding::bsr)),
                     VERBOSE_UNSUPPORTED_SPARSE_CFG);
 
             VDISPATCH_MATMUL(
@@ -72,10 +75,17 @@ struct ref_sparse_matmul_t : public primitive_t {
                         IMPLICATION(sparse_mem_encoding == sparse_encoding::coo,
                                 s32 == src_d.metadata_type(0)),
                         VERBOSE_UNSUPPORTED_SPARSE_CFG);
+                VDISPATCH_MATMUL(IMPLICATION(utils::one_of(sparse_mem_encoding,
+                                                 sparse_encoding::csr,
+                                                 sparse_encoding::bsr),
+                                         utils::everyone_is(s32,
+                                                 src_d.metadata_type(0),
+                                                 src_d.metadata_type(1))),
+                        VERBOSE_UNSUPPORTED_SPARSE_CFG);
                 VDISPATCH_MATMUL(
-                        IMPLICATION(sparse_mem_encoding == sparse_encoding::csr,
-                                utils::everyone_is(s32, src_d.metadata_type(0),
-                                        src_d.metadata_type(1))),
+                        IMPLICATION(sparse_mem_encoding
+                                        == sparse_encoding::grouped,
+                                s32 == src_d.metadata_type(0)),
                         VERBOSE_UNSUPPORTED_SPARSE_CFG);
             }
             if (wei_d.is_sparse_desc()) {
@@ -85,10 +95,12 @@ struct ref_sparse_matmul_t : public primitive_t {
                                 s32 == wei_d.metadata_type(0)),
                         VERBOSE_UNSUPPORTED_SPARSE_CFG);
 
-                VDISPATCH_MATMUL(
-                        IMPLICATION(sparse_mem_encoding == sparse_encoding::csr,
-                                utils::everyone_is(s32, wei_d.metadata_type(0),
-                                        wei_d.metadata_type(1))),
+                VDISPATCH_MATMUL(IMPLICATION(utils::one_of(sparse_mem_encoding,
+                                                 sparse_encoding::csr,
+                                                 sparse_encoding::bsr),
+                                         utils::everyone_is(s32,
+                                                 wei_d.metadata_type(0),
+                                                 wei_d.metadata_type(1))),
                         VERBOSE_UNSUPPORTED_SPARSE_CFG);
             }
 
@@ -104,6 +116,9 @@ struct ref_sparse_matmul_t : public primitive_t {
 
         bool formats_ok(const memory_desc_wrapper &src_d,
                 const memory_desc_wrapper &wei_d) const {
+            // The destination of grouped matmul is grouped as well.
+            if (sparse_mem_encoding == sparse_encoding::grouped)
+                return wei_d.matches_one_of_tag(format_tag::abc);
             if (!memory_desc_wrapper(dst_md()).matches_one_of_tag(
                         format_tag::ab))
                 return false;
@@ -148,6 +163,20 @@ struct ref_sparse_matmul_t : public primitive_t {
             const dim_t M, const dim_t N, const dim_t K,
             const data_type_t mm_dt, bool is_src_sparse) const;
 
+    // Same as above for BSR encoded data with blocks of `blk_dims`, which
+    // are multiplied element by element.
+    void run_bsr_kernel(const void *dmat, const void *values,
+            const int32_t *indices, const int32_t *pointers, void *res,
+            const dim_t M, const dim_t N, const dim_t K, const dims_t blk_dims,
+            const data_type_t mm_dt, bool is_src_sparse) const;
+
+    // Executes grouped matrix multiplication, where the rows of the source
+    // and of the result are split into groups by `offsets` and every group
+    // is multiplied by its own matrix of `wei`.
+    void run_grouped_kernel(const void *src, const void *wei,
+            const int32_t *offsets, void *res, const dim_t G, const dim_t N,
+            const dim_t K, const data_type_t mm_dt) const;
+
     status_t execute(const exec_ctx_t &ctx) const override;
 
 private:
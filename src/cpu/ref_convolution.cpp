@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2024 Intel Corporation
+* Copyright 2016-2025 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -77,6 +77,37 @@ status_t ref_convolution_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
     const auto ndims = pd()->desc()->src_desc.ndims;
     const auto dst_rnd_mode = pd()->attr()->rounding_mode_.get(DNNL_ARG_DST);
 
+    const bool with_wei_decompression = pd()->with_wei_decompression();
+    const auto &wei_scales = pd()->attr()->scales_.get(DNNL_ARG_WEIGHTS);
+    const auto &wei_zero_points
+            = pd()->attr()->zero_points_.get(DNNL_ARG_WEIGHTS);
+    const void *wei_scales_ptr
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS);
+    const void *wei_zero_points_ptr = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS);
+
+    // Returns the offset of a scale or a zero-point of the weights element
+    // with (g, oc, ic) coordinates.
+    auto wei_qparam_off = [=](const quant_entry_t &e, dim_t g, dim_t oc,
+                                  dim_t ic) -> dim_t {
+        if (e.get_mask() == 0) return 0;
+        const bool per_ic = e.get_mask() & (1 << (with_groups + 1));
+        const dim_t ic_group = e.get_group(1);
+        const dim_t n_ic_groups = per_ic ? IC / ic_group : 1;
+        return (g * OC + oc) * n_ic_groups + (per_ic ? ic / ic_group : 0);
+    };
+
+    auto decompress_wei = [=](float w, dim_t g, dim_t oc, dim_t ic) {
+        if (!wei_zero_points.has_default_values())
+            w -= io::load_float_value(wei_zero_points.get_data_type(),
+                    wei_zero_points_ptr,
+                    wei_qparam_off(wei_zero_points, g, oc, ic));
+        if (!wei_scales.has_default_values())
+            w *= io::load_float_value(wei_scales.get_data_type(),
+                    wei_scales_ptr, wei_qparam_off(wei_scales, g, oc, ic));
+        return w;
+    };
+
     auto ker = [=](dim_t g, dim_t mb, dim_t oc, dim_t od, dim_t oh, dim_t ow) {
         float d = 0;
         for_(dim_t ic = 0; ic < IC; ++ic)
@@ -98,8 +129,9 @@ status_t ref_convolution_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
 
             const float s
                     = io::load_float_value(src_d.data_type(), src, src_off);
-            const float w = io::load_float_value(
+            float w = io::load_float_value(
                     weights_d.data_type(), weights, wei_off);
+            if (with_wei_decompression) w = decompress_wei(w, g, oc, ic);
             d += s * w;
         }
         return d;
@@ -190,7 +222,8 @@ status_t ref_convolution_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
             [&](dim_t g, dim_t mb, dim_t oc, dim_t od, dim_t oh, dim_t ow) {
                 float acc = 0;
                 if (src_d.is_plain() && weights_d.is_plain()
-                        && src_ic_stride == 1 && weights_kw_stride == 1)
+                        && src_ic_stride == 1 && weights_kw_stride == 1
+                        && !with_wei_decompression)
                     acc += ker_plain(g, mb, oc, od, oh, ow);
                 else
                     acc += ker(g, mb, oc, od, oh, ow);
@@ -58,8 +58,9 @@ struct ref_convolution_fwd_t : public primitive_t {
                     utils::one_of(src_type, f32, bf16, f16, f8_e5m2, f8_e4m3),
                     VERBOSE_UNSUPPORTED_DT);
             VDISPATCH_CONV(IMPLICATION(src_type != wei_type,
-                                   utils::one_of(wei_type, f16, bf16)
-                                           && src_type == f32),
+                                   (utils::one_of(wei_type, f16, bf16)
+                                           && src_type == f32)
+                                           || with_wei_decompression()),
                     VERBOSE_UNSUPPORTED_DT);
             VDISPATCH_CONV(utils::one_of(dst_type, src_type, f32),
                     VERBOSE_UNSUPPORTED_DT);
@@ -67,11 +68,17 @@ struct ref_convolution_fwd_t : public primitive_t {
                     utils::one_of(bia_type, data_type::undef, src_type, f32),
                     VERBOSE_UNSUPPORTED_BIAS_CFG);
             VDISPATCH_CONV(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
-            VDISPATCH_CONV(
-                    attr()->has_default_values(smask_t::post_ops
-                                    | smask_t::sum_dt | smask_t::rounding_mode,
-                            dst_type),
+
+            auto skip_mask = smask_t::post_ops | smask_t::sum_dt
+                    | smask_t::rounding_mode;
+            if (with_wei_decompression())
+                skip_mask |= smask_t::fpmath_mode | smask_t::scales_data_type
+                        | smask_t::scales_groups
+                        | smask_t::zero_points_data_type
+                        | smask_t::zero_points_groups;
+            VDISPATCH_CONV(attr()->has_default_values(skip_mask, dst_type),
                     VERBOSE_UNSUPPORTED_POSTOP);
+            if (with_wei_decompression()) CHECK(attr_wei_decompression_ok());
             VDISPATCH_CONV(attr()->post_ops_.check_sum_consistency(
                                    dst_type, /* is_int8 */ false),
                     VERBOSE_UNSUPPORTED_POSTOP);
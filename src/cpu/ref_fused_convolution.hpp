@@ -18,6 +18,8 @@
 #ifndef CPU_REF_FUSED_CONVOLUTION_HPP
 #define CPU_REF_FUSED_CONVOLUTION_HPP
 
+#include "common/dnnl_thread.hpp"
+#include "common/pooling_pd.hpp"
 #include "common/primitive.hpp"
 #include "common/primitive_desc_iterator.hpp"
 #include "common/reorder.hpp"
@@ -25,6 +27,7 @@
 
 #include "cpu/cpu_convolution_pd.hpp"
 #include "cpu/dw_convolution_utils.hpp"
+#include "cpu/platform.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -83,7 +86,7 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
 
             VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
             VDISPATCH_CONV(attr()->post_ops_.has_default_values(
-                                   {binary, eltwise, convolution}),
+                                   {binary, eltwise, convolution, pooling}),
                     VERBOSE_UNSUPPORTED_ATTR);
 
             CHECK(init_ops(engine));
@@ -125,7 +128,7 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
                     && arg < DNNL_ARG_ATTR_MULTIPLE_POST_OP(
                                post_ops_t::post_ops_limit)) {
                 const auto &po = attr()->post_ops_;
-                auto dw_idx = po.find(primitive_kind::convolution);
+                auto dw_idx = find_fused_op(po);
                 for (int idx = 0; idx < po.len(); ++idx) {
                     if (arg
                             != (DNNL_ARG_ATTR_MULTIPLE_POST_OP(idx)
@@ -174,9 +177,31 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
             return convolution_fwd_pd_t::arg_usage(arg);
         }
 
+        // A band of output rows of an image computed by the row-tiled
+        // execution. Source rows [mid_start, mid_start + mid_rows) of the
+        // fused operation are produced by the convolution from its source
+        // rows [src_start, src_start + src_rows) into the intermediate buffer
+        // right before being consumed.
+        struct row_tile_t {
+            dim_t out_start, out_rows;
+            dim_t mid_start, mid_rows;
+            dim_t src_start, src_rows;
+            // Top and bottom padding of the convolution and of the fused
+            // operation within the band.
+            dim_t pad_t[2], pad_b[2];
+            // Index of the pair of primitive descriptors in `tile_pds_`.
+            int pds_idx;
+        };
+
+        bool is_row_tiled() const { return !row_tiles_.empty(); }
+
         size_t user_scratchpad_size_;
         std::vector<std::shared_ptr<primitive_desc_t>> op_pds_;
         std::vector<arg_cache_t> args_;
+        // Pairs of the convolution and the fused operation for every distinct
+        // shape of a row tile.
+        std::vector<std::shared_ptr<primitive_desc_t>> tile_pds_;
+        std::vector<row_tile_t> row_tiles_;
 
     private:
         std::string name_ = "ref_fused_convolution:any";
@@ -219,9 +244,11 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
             using namespace data_type;
             primitive_attr_t root_attr(*attr());
             if (!root_attr.is_initialized()) return status::out_of_memory;
-            auto po_op_iter
-                    = attr()->post_ops_.find(primitive_kind::convolution);
+            auto po_op_iter = find_fused_op(attr()->post_ops_);
             if (po_op_iter == -1) return status::unimplemented;
+            // Post-ops following a fused operation are passed to it as is.
+            if (find_fused_op(attr()->post_ops_, po_op_iter + 1) != -1)
+                return status::unimplemented;
 
             primitive_attr_t attr_1x1(*attr());
             // erase dw_conv post-op scales
@@ -283,10 +310,17 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
 
                 const auto &prev_op_pd = op_pds_.back();
 
-                if (po.entry_[po_op_iter].kind != primitive_kind::convolution)
+                if (prev_op_pd->kind() != primitive_kind::convolution)
                     return status::unimplemented;
 
-                if (prev_op_pd->kind() != primitive_kind::convolution)
+                if (po.entry_[po_op_iter].is_pooling()) {
+                    CHECK(append_pooling_op(engine, po_op_iter,
+                            inout_sp_offset_begin, inout_sp_offset_end));
+                    po_op_iter = end;
+                    continue;
+                }
+
+                if (po.entry_[po_op_iter].kind != primitive_kind::convolution)
                     return status::unimplemented;
 
                 auto conv_pd = reinterpret_cast<convolution_pd_t *>(
@@ -353,11 +387,270 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
 
             assert(!op_pds_.empty());
 
-            CHECK(init_scratchpad_memory(inout_sp_offset_end));
+            // Fall back to the full intermediate buffer if the row-tiled
+            // execution is not applicable.
+            if (init_row_tiling(engine) != status::success) {
+                tile_pds_.clear();
+                row_tiles_.clear();
+            }
+
+            size_t inout_buffer_size = inout_sp_offset_end;
+            if (is_row_tiled()) {
+                inout_buffer_size = 0;
+                for (size_t i = 0; i < tile_pds_.size(); i += 2) {
+                    inout_buffer_size = nstl::max(inout_buffer_size,
+                            memory_desc_wrapper(tile_pds_[i]->dst_md())
+                                    .size());
+                }
+            }
+
+            CHECK(init_scratchpad_memory(inout_buffer_size));
 
             return status::success;
         }
 
+        // Splits every image into bands of output rows so that the
+        // intermediate band stays in cache between the convolution and the
+        // fused operation. The rows of the intermediate tensor shared by
+        // adjacent bands are recomputed.
+        status_t init_row_tiling(engine_t *engine) {
+            using namespace format_tag;
+
+            if (op_pds_.size() != 2) return status::unimplemented;
+            const auto *conv_pd
+                    = static_cast<const convolution_pd_t *>(op_pds_[0].get());
+            const auto &fused_pd = op_pds_[1];
+            if (conv_pd->ndims() != 4) return status::unimplemented;
+            if (attr()->post_ops_.find(primitive_kind::binary) != -1)
+                return status::unimplemented;
+            const memory_desc_wrapper src_d(conv_pd->src_md());
+            const memory_desc_wrapper mid_d(conv_pd->dst_md());
+            const memory_desc_wrapper dst_d(fused_pd->dst_md());
+            if (!src_d.matches_tag(nhwc) || !dst_d.matches_tag(nhwc))
+                return status::unimplemented;
+
+            const auto conv_geom = get_row_geometry(conv_pd);
+            const auto fused_geom = fused_pd->kind() == primitive_kind::pooling
+                    ? get_row_geometry(
+                            static_cast<const pooling_pd_t *>(fused_pd.get()))
+                    : get_row_geometry(static_cast<const convolution_pd_t *>(
+                            fused_pd.get()));
+
+            const dim_t MB = conv_pd->MB();
+            const dim_t OH = fused_geom.out;
+            const size_t mid_row_size = conv_pd->OW() * conv_pd->OC()
+                    * types::data_type_size(mid_d.data_type());
+            const size_t budget = platform::get_per_core_cache_size(2)
+                    * dnnl_get_max_threads() / 2;
+            const dim_t halo = nstl::max<dim_t>(
+                    fused_geom.k_range - fused_geom.stride, 1);
+            dim_t tile_rows = nstl::max<dim_t>(
+                    (dim_t)(budget / (mid_row_size * fused_geom.stride)),
+                    4 * halo);
+            tile_rows = nstl::min(tile_rows, OH);
+            if (tile_rows == OH && MB == 1) return status::unimplemented;
+
+            for (dim_t o0 = 0; o0 < OH; o0 += tile_rows) {
+                row_tile_t tile;
+                tile.out_start = o0;
+                tile.out_rows = nstl::min(tile_rows, OH - o0);
+                fused_geom.get_input_rows(tile.out_start, tile.out_rows,
+                        tile.mid_start, tile.mid_rows, tile.pad_t[1],
+                        tile.pad_b[1]);
+                conv_geom.get_input_rows(tile.mid_start, tile.mid_rows,
+                        tile.src_start, tile.src_rows, tile.pad_t[0],
+                        tile.pad_b[0]);
+
+                tile.pds_idx = -1;
+                for (const auto &t : row_tiles_) {
+                    if (t.out_rows == tile.out_rows
+                            && t.mid_rows == tile.mid_rows
+                            && t.src_rows == tile.src_rows
+                            && utils::array_cmp(t.pad_t, tile.pad_t, 2)
+                            && utils::array_cmp(t.pad_b, tile.pad_b, 2)) {
+                        tile.pds_idx = t.pds_idx;
+                        break;
+                    }
+                }
+                if (tile.pds_idx == -1) {
+                    tile.pds_idx = (int)tile_pds_.size() / 2;
+                    CHECK(append_tile_pds(engine, tile));
+                }
+                row_tiles_.push_back(tile);
+            }
+            return status::success;
+        }
+
+        // Geometry of an operation along the rows of an image.
+        struct row_geometry_t {
+            dim_t in, out, k_range, stride, pad;
+
+            // Computes the input rows and the padding needed for the output
+            // rows [out_start, out_start + out_rows).
+            void get_input_rows(dim_t out_start, dim_t out_rows,
+                    dim_t &in_start, dim_t &in_rows, dim_t &pad_t,
+                    dim_t &pad_b) const {
+                const dim_t lo = out_start * stride - pad;
+                const dim_t hi = (out_start + out_rows - 1) * stride - pad
+                        + k_range;
+                in_start = nstl::max<dim_t>(lo, 0);
+                in_rows = nstl::min(hi, in) - in_start;
+                pad_t = in_start - lo;
+                pad_b = hi - nstl::min(hi, in);
+            }
+        };
+
+        template <typename op_pd_t>
+        static row_geometry_t get_row_geometry(const op_pd_t *pd) {
+            return {pd->IH(), pd->OH(), 1 + (pd->KH() - 1) * (pd->KDH() + 1),
+                    pd->KSH(), pd->padT()};
+        }
+
+        status_t append_tile_pds(engine_t *engine, const row_tile_t &tile) {
+            using namespace format_tag;
+
+            const auto *conv_pd
+                    = static_cast<const convolution_pd_t *>(op_pds_[0].get());
+            const auto &fused_pd = op_pds_[1];
+
+            auto band_md = [](memory_desc_t &md, const memory_desc_t *full_md,
+                                   dim_t rows) {
+                dims_t dims;
+                utils::array_copy(dims, full_md->dims, full_md->ndims);
+                dims[0] = 1;
+                dims[2] = rows;
+                return memory_desc_init_by_tag(md, full_md->ndims, dims,
+                        full_md->data_type, nhwc);
+            };
+
+            convolution_desc_t cd_conv = *conv_pd->desc();
+            CHECK(band_md(cd_conv.src_desc, conv_pd->src_md(), tile.src_rows));
+            CHECK(band_md(cd_conv.dst_desc, conv_pd->dst_md(), tile.mid_rows));
+            cd_conv.weights_desc = *conv_pd->weights_md(0);
+            cd_conv.bias_desc = *conv_pd->weights_md(1);
+            cd_conv.padding[0][0] = tile.pad_t[0];
+            cd_conv.padding[1][0] = tile.pad_b[0];
+
+            convolution_desc_t cd_dw;
+            pooling_desc_t pd_pool;
+            op_desc_t *fused_desc = nullptr;
+            if (fused_pd->kind() == primitive_kind::pooling) {
+                const auto *pool_pd
+                        = static_cast<const pooling_pd_t *>(fused_pd.get());
+                pd_pool = *pool_pd->desc();
+                CHECK(band_md(
+                        pd_pool.src_desc, pool_pd->src_md(), tile.mid_rows));
+                CHECK(band_md(
+                        pd_pool.dst_desc, pool_pd->dst_md(), tile.out_rows));
+                pd_pool.padding[0][0] = tile.pad_t[1];
+                pd_pool.padding[1][0] = tile.pad_b[1];
+                fused_desc = (op_desc_t *)&pd_pool;
+            } else {
+                const auto *dw_pd
+                        = static_cast<const convolution_pd_t *>(fused_pd.get());
+                cd_dw = *dw_pd->desc();
+                CHECK(band_md(cd_dw.src_desc, dw_pd->src_md(), tile.mid_rows));
+                CHECK(band_md(cd_dw.dst_desc, dw_pd->dst_md(), tile.out_rows));
+                cd_dw.weights_desc = *dw_pd->weights_md(0);
+                cd_dw.bias_desc = *dw_pd->weights_md(1);
+                cd_dw.padding[0][0] = tile.pad_t[1];
+                cd_dw.padding[1][0] = tile.pad_b[1];
+                fused_desc = (op_desc_t *)&cd_dw;
+            }
+
+            for (const auto &op : {std::make_pair((op_desc_t *)&cd_conv,
+                                           op_pds_[0].get()),
+                         std::make_pair(fused_desc, fused_pd.get())}) {
+                primitive_desc_iterator_t it(
+                        engine, op.first, op.second->attr(), nullptr);
+                if (!it.is_initialized()) return status::out_of_memory;
+                std::shared_ptr<primitive_desc_t> pd = *(++it);
+                if (!pd) return status::unimplemented;
+                // The user memory and the arguments are shared with the
+                // full-size primitives, so the layouts must be the same.
+                if (*pd->weights_md(0) != *op.second->weights_md(0))
+                    return status::unimplemented;
+                user_scratchpad_size_ = nstl::max<size_t>(user_scratchpad_size_,
+                        pd->scratchpad_size(attr()->scratchpad_mode_));
+                tile_pds_.emplace_back(std::move(pd));
+            }
+            return status::success;
+        }
+
+        // Returns the index of the first post-op executed by a separate
+        // primitive, starting from `start`.
+        static int find_fused_op(const post_ops_t &po, int start = 0) {
+            for (int idx = start; idx < po.len(); ++idx) {
+                if (po.entry_[idx].is_convolution()
+                        || po.entry_[idx].is_pooling())
+                    return idx;
+            }
+            return -1;
+        }
+
+        status_t append_pooling_op(engine_t *engine, int po_idx,
+                size_t &sp_begin, size_t &sp_end) {
+            const auto &po = attr()->post_ops_;
+            const auto &p = po.entry_[po_idx].pooling;
+            const memory_desc_t *src_md = op_pds_.back()->dst_md();
+            const int ndims = src_md->ndims;
+            if (ndims != 4) return status::unimplemented;
+
+            dims_t dst_dims, pad_r;
+            utils::array_copy(dst_dims, src_md->dims, ndims);
+            for (int d = 2; d < ndims; d++) {
+                dst_dims[d] = (src_md->dims[d] + 2 * p.padding - p.kernel)
+                                / p.stride
+                        + 1;
+                if (dst_dims[d] <= 0) return status::unimplemented;
+                pad_r[d - 2] = (dst_dims[d] - 1) * p.stride + p.kernel
+                        - src_md->dims[d] - p.padding;
+            }
+            memory_desc_t dst_md;
+            CHECK(memory_desc_init_by_tag(dst_md, ndims, dst_dims,
+                    src_md->data_type, format_tag::any));
+
+            const dims_t strides = {p.stride, p.stride};
+            const dims_t kernel = {p.kernel, p.kernel};
+            const dims_t dilation = {0, 0};
+            const dims_t pad_l = {p.padding, p.padding};
+            pooling_desc_t pool_desc;
+            CHECK(pooling_desc_init(&pool_desc, prop_kind::forward_inference,
+                    p.alg, src_md, &dst_md, strides, kernel, dilation, pad_l,
+                    pad_r));
+
+            primitive_attr_t attr_pool;
+            attr_pool.scratchpad_mode_ = attr()->scratchpad_mode_;
+            attr_pool.post_ops_.entry_.assign(
+                    po.entry_.begin() + po_idx + 1, po.entry_.end());
+
+            primitive_desc_iterator_t it(
+                    engine, (op_desc_t *)&pool_desc, &attr_pool, nullptr);
+            if (!it.is_initialized()) return status::out_of_memory;
+            std::shared_ptr<primitive_desc_t> pool_pd = *(++it);
+            if (!pool_pd) return status::unimplemented;
+
+            CHECK(append_op(pool_pd, sp_begin, sp_end, engine));
+
+            const auto &op = op_pds_.back();
+            arg_cache_t arg_cache;
+            arg_cache.append_inout_arg(
+                    DNNL_ARG_SRC, sp_begin, op->src_md(), true);
+            arg_cache.append_ctx_arg(DNNL_ARG_DST);
+            // Initialize binary post_op.
+            CHECK(attr_pool.set_default_formats(op->dst_md()));
+            for (int idx = 0; idx < attr_pool.post_ops_.len(); ++idx) {
+                if (attr_pool.post_ops_.contain(primitive_kind::binary, idx))
+                    arg_cache.append_ctx_arg(
+                            (DNNL_ARG_ATTR_MULTIPLE_POST_OP(idx)
+                                    | DNNL_ARG_SRC_1),
+                            (DNNL_ARG_ATTR_MULTIPLE_POST_OP(idx + po_idx + 1)
+                                    | DNNL_ARG_SRC_1));
+            }
+            args_.push_back(arg_cache);
+            return status::success;
+        }
+
         status_t init_scratchpad_memory(size_t inout_buffer_size) {
 
             auto scratchpad = scratchpad_registry().registrar();
@@ -381,10 +674,11 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
     ref_fused_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
 
     status_t init(engine_t *engine) override {
-        const auto &op_pds = pd()->op_pds_;
+        const auto &op_pds
+                = pd()->is_row_tiled() ? pd()->tile_pds_ : pd()->op_pds_;
         for (auto &op_pd : op_pds) {
             std::shared_ptr<primitive_t> p;
-            op_pd->create_primitive(p, engine);
+            CHECK(op_pd->create_primitive(p, engine));
             primitives_.emplace_back(p);
         }
         return status::success;
@@ -401,6 +695,8 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
 #endif
 
     status_t execute(const exec_ctx_t &ctx) const override {
+        if (pd()->is_row_tiled()) return execute_row_tiled(ctx);
+
         engine_t *engine = ctx.stream()->engine();
         const auto scratchpad = ctx.get_scratchpad_grantor();
 
@@ -442,6 +738,71 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    status_t execute_row_tiled(const exec_ctx_t &ctx) const {
+        engine_t *engine = ctx.stream()->engine();
+        const auto scratchpad = ctx.get_scratchpad_grantor();
+
+        const auto inout_buffer = scratchpad.get_memory_storage(
+                memory_tracking::names::key_fusion_inout_buffer);
+
+        const auto &ctx_args = ctx.args();
+        const auto *src_storage
+                = ctx_args.at(DNNL_ARG_SRC).mem->memory_storage();
+        const auto *dst_storage
+                = ctx_args.at(DNNL_ARG_DST).mem->memory_storage();
+        const memory_desc_wrapper src_d(pd()->src_md());
+        const memory_desc_wrapper dst_d(pd()->dst_md());
+
+        for_(dim_t n = 0; n < pd()->MB(); n++)
+        for (const auto &tile : pd()->row_tiles_) {
+            const auto &conv_pd = pd()->tile_pds_[2 * tile.pds_idx];
+            const auto &dw_pd = pd()->tile_pds_[2 * tile.pds_idx + 1];
+
+            // Memory objects for the bands of the user tensors and of the
+            // intermediate buffer.
+            auto band = [&](const memory_storage_t *storage,
+                                const memory_desc_t *md, size_t offset) {
+                return std::unique_ptr<memory_t, memory_deleter_t>(
+                        new memory_t(engine, md,
+                                storage->get_sub_storage(offset,
+                                        memory_desc_wrapper(md).size())));
+            };
+            const auto src = band(src_storage, conv_pd->src_md(),
+                    src_d.blk_off(n, 0, tile.src_start, 0)
+                            * src_d.data_type_size());
+            const auto mid = band(inout_buffer.get(), conv_pd->dst_md(), 0);
+            const auto dst = band(dst_storage, dw_pd->dst_md(),
+                    dst_d.blk_off(n, 0, tile.out_start, 0)
+                            * dst_d.data_type_size());
+
+            for (int i = 0; i < 2; i++) {
+                const auto &op = primitives_[2 * tile.pds_idx + i];
+
+                exec_args_t exec_args;
+                for (const auto &arg_info : pd()->args_[i].info()) {
+                    if (arg_info.is_ctx_arg)
+                        exec_args[arg_info.op_arg]
+                                = ctx_args.at(arg_info.ctx_arg);
+                }
+                exec_args[DNNL_ARG_SRC]
+                        = {i == 0 ? src.get() : mid.get(), true};
+                exec_args[DNNL_ARG_DST]
+                        = {i == 0 ? mid.get() : dst.get(), false};
+
+                exec_ctx_t op_ctx(ctx, std::move(exec_args));
+
+                nested_scratchpad_t ns(ctx,
+                        memory_tracking::names::key_fusion_forward_scratchpad,
+                        op);
+                op_ctx.set_scratchpad_grantor(ns.grantor());
+                CHECK(op->execute(op_ctx));
+            }
+        }
+
+        return status::success;
+    }
+
     std::vector<std::shared_ptr<primitive_t>> primitives_;
 };
 
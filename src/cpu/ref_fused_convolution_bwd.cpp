@@ -0,0 +1,396 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/reorder.hpp"
+#include "common/stream.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/ref_fused_convolution_bwd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace memory_tracking::names;
+
+namespace {
+
+// Returns true if the images of a tensor are stored one after another, so
+// that a chunk of images is a plain sub-buffer.
+bool is_mb_outermost(const memory_desc_t &md) {
+    const memory_desc_wrapper d(md);
+    if (!d.is_blocking_desc() || d.offset0() != 0) return false;
+    const auto &bd = d.blocking_desc();
+    for (int i = 0; i < bd.inner_nblks; i++)
+        if (bd.inner_idxs[i] == 0) return false;
+    return d.size()
+            == (size_t)(d.padded_dims()[0] * bd.strides[0])
+            * d.data_type_size();
+}
+
+memory_desc_t chunk_md(const memory_desc_t &md, dim_t mb) {
+    memory_desc_t chunk = md;
+    chunk.dims[0] = mb;
+    chunk.padded_dims[0] = mb;
+    return chunk;
+}
+
+// The offset of the bias in the buffers holding the weights gradient.
+size_t diff_bia_offset(const memory_desc_t &diff_wei_md) {
+    return utils::rnd_up(memory_desc_wrapper(diff_wei_md).size(), 64);
+}
+
+} // namespace
+
+status_t ref_fused_convolution_bwd_t::pd_t::init(engine_t *engine) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    VDISPATCH_CONV(desc()->prop_kind == prop_kind::backward,
+            VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(attr()->has_default_values(
+                           smask_t::fpmath_mode | smask_t::accumulation_mode),
+            VERBOSE_UNSUPPORTED_ATTR);
+
+    CHECK(create_nested_pds(engine, MB(), bwd_d_pd_, bwd_w_pd_));
+
+    // Both nested primitives consume the same diff destination.
+    VDISPATCH_CONV(*bwd_d_pd_->diff_dst_md() == *bwd_w_pd_->diff_dst_md(),
+            VERBOSE_INCONSISTENT_MDS, "diff_dst", "diff_dst");
+    src_md_ = *bwd_w_pd_->src_md();
+    diff_src_md_ = *bwd_d_pd_->diff_src_md();
+    weights_md_ = *bwd_d_pd_->weights_md();
+    diff_weights_md_ = *bwd_w_pd_->diff_weights_md(0);
+    diff_bias_md_ = *bwd_w_pd_->diff_weights_md(1);
+    diff_dst_md_ = *bwd_d_pd_->diff_dst_md();
+    if (desc_.alg_kind == alg_kind::convolution_auto)
+        desc_.alg_kind = static_cast<const convolution_pd_t *>(bwd_d_pd_.get())
+                                 ->desc()
+                                 ->alg_kind;
+
+    mb_chunk_ = MB();
+    CHECK(init_chunking(engine));
+
+    init_scratchpad();
+    for (const auto *op_pd : {bwd_d_pd_.get(), bwd_w_pd_.get()}) {
+        name_.append(":");
+        name_.append(op_pd->name());
+    }
+    return status::success;
+}
+
+// Creates the nested primitive descriptors for `mb` images. Descriptors for
+// the whole minibatch take the memory descriptors passed by the user, the ones
+// for a chunk take the layouts of the former and produce the weights gradient
+// in f32.
+status_t ref_fused_convolution_bwd_t::pd_t::create_nested_pds(engine_t *engine,
+        dim_t mb, std::shared_ptr<primitive_desc_t> &bwd_d_pd,
+        std::shared_ptr<primitive_desc_t> &bwd_w_pd) const {
+    const bool is_chunk = mb < MB();
+    const auto src_md = is_chunk ? chunk_md(src_md_, mb) : src_md_;
+    const auto diff_src_md
+            = is_chunk ? chunk_md(diff_src_md_, mb) : diff_src_md_;
+    const auto diff_dst_md
+            = is_chunk ? chunk_md(diff_dst_md_, mb) : diff_dst_md_;
+    const auto &diff_wei_md = is_chunk ? chunk_diff_wei_md_ : diff_weights_md_;
+    const auto &diff_bia_md = is_chunk ? chunk_diff_bia_md_ : diff_bias_md_;
+
+    convolution_desc_t bwd_d_desc, bwd_w_desc;
+    CHECK(conv_desc_init(&bwd_d_desc, prop_kind::backward_data,
+            desc()->alg_kind, &diff_src_md, &weights_md_, nullptr,
+            &diff_dst_md, desc()->strides, desc()->dilates,
+            desc()->padding[0], desc()->padding[1]));
+    CHECK(conv_desc_init(&bwd_w_desc, prop_kind::backward_weights,
+            desc()->alg_kind, &src_md, &diff_wei_md,
+            with_bias() ? &diff_bia_md : nullptr, &diff_dst_md,
+            desc()->strides, desc()->dilates, desc()->padding[0],
+            desc()->padding[1]));
+
+    primitive_desc_iterator_t it_d(
+            engine, (op_desc_t *)&bwd_d_desc, attr(), hint_fwd_pd_);
+    if (!it_d.is_initialized()) return status::out_of_memory;
+    bwd_d_pd = *(++it_d);
+    VDISPATCH_CONV(bwd_d_pd, VERBOSE_PRIMITIVE_CREATION_FAIL,
+            "backward data convolution");
+
+    // The weights gradient reuses the diff destination layout picked by the
+    // data gradient.
+    bwd_w_desc.diff_dst_desc = *bwd_d_pd->diff_dst_md();
+    primitive_desc_iterator_t it_w(
+            engine, (op_desc_t *)&bwd_w_desc, attr(), hint_fwd_pd_);
+    if (!it_w.is_initialized()) return status::out_of_memory;
+    bwd_w_pd = *(++it_w);
+    VDISPATCH_CONV(bwd_w_pd, VERBOSE_PRIMITIVE_CREATION_FAIL,
+            "backward weights convolution");
+    return status::success;
+}
+
+// Picks the number of images processed at once so that the chunks of the
+// tensors walked along the minibatch fit in the cache, and replaces the nested
+// primitive descriptors with the ones for a chunk. The whole minibatch is
+// processed at once if the layouts do not allow for chunks or if the nested
+// primitives cannot be created for them.
+//
+// A low precision weights gradient is accumulated in a separate f32 buffer,
+// so the nested backward weights primitive picks its layout: the user one is
+// typically blocked for the low precision data type and only the reference
+// implementation would take it for f32.
+status_t ref_fused_convolution_bwd_t::pd_t::init_chunking(engine_t *engine) {
+    const dim_t MB = this->MB();
+    if (MB == 1 || has_zero_dim_memory()) return status::success;
+    size_t image_size = 0;
+    for (const auto *md : {&src_md_, &diff_src_md_, &diff_dst_md_}) {
+        if (!is_mb_outermost(*md)) return status::success;
+        image_size += memory_desc_wrapper(md).size() / MB;
+    }
+
+    const size_t budget = platform::get_per_core_cache_size(3)
+            * dnnl_get_max_threads() / 2;
+    dim_t mb_chunk = nstl::max<dim_t>((dim_t)(budget / image_size), 1);
+    if (mb_chunk >= MB) return status::success;
+    // Chunks of equal size share the nested primitives.
+    while (MB % mb_chunk != 0)
+        mb_chunk--;
+
+    const bool with_diff_wei_acc
+            = diff_weights_md_.data_type != data_type::f32
+            || (with_bias() && diff_bias_md_.data_type != data_type::f32);
+    chunk_diff_wei_md_ = diff_weights_md_;
+    chunk_diff_wei_md_.data_type = data_type::f32;
+    if (with_diff_wei_acc
+            && memory_desc_init_by_tag(chunk_diff_wei_md_,
+                       diff_weights_md_.ndims, diff_weights_md_.dims,
+                       data_type::f32, format_tag::any)
+                    != status::success)
+        return status::success;
+    chunk_diff_bia_md_ = diff_bias_md_;
+    if (with_bias()) chunk_diff_bia_md_.data_type = data_type::f32;
+
+    std::shared_ptr<primitive_desc_t> bwd_d_pd, bwd_w_pd, diff_wei_reorder_pd;
+    if (create_nested_pds(engine, mb_chunk, bwd_d_pd, bwd_w_pd)
+            != status::success)
+        return status::success;
+    if (*bwd_d_pd->diff_dst_md() != chunk_md(diff_dst_md_, mb_chunk))
+        return status::success;
+    if (with_diff_wei_acc) {
+        chunk_diff_wei_md_ = *bwd_w_pd->diff_weights_md(0);
+        if (reorder_primitive_desc_create(diff_wei_reorder_pd, engine,
+                    &chunk_diff_wei_md_, &diff_weights_md_)
+                != status::success)
+            return status::success;
+    } else if (*bwd_w_pd->diff_weights_md(0) != chunk_diff_wei_md_)
+        return status::success;
+
+    mb_chunk_ = mb_chunk;
+    with_diff_wei_acc_ = with_diff_wei_acc;
+    bwd_d_pd_ = std::move(bwd_d_pd);
+    bwd_w_pd_ = std::move(bwd_w_pd);
+    diff_wei_reorder_pd_ = std::move(diff_wei_reorder_pd);
+    return status::success;
+}
+
+void ref_fused_convolution_bwd_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    if (is_chunked()) {
+        const size_t diff_wei_size = diff_bia_offset(chunk_diff_wei_md_)
+                + memory_desc_wrapper(chunk_diff_bia_md_).size();
+        scratchpad.book(key_fusion_backward_diff_wei_partial, diff_wei_size, 1,
+                64);
+        if (with_diff_wei_acc_)
+            scratchpad.book(
+                    key_fusion_backward_diff_wei_acc, diff_wei_size, 1, 64);
+    }
+    scratchpad.book(key_nested_multiple + 0, bwd_d_pd_->scratchpad_registry());
+    scratchpad.book(key_nested_multiple + 1, bwd_w_pd_->scratchpad_registry());
+    if (diff_wei_reorder_pd_)
+        scratchpad.book(key_nested_multiple + 2,
+                diff_wei_reorder_pd_->scratchpad_registry());
+}
+
+status_t ref_fused_convolution_bwd_t::init(engine_t *engine) {
+    CHECK(pd()->bwd_d_pd_->create_primitive(bwd_d_p_, engine));
+    CHECK(pd()->bwd_w_pd_->create_primitive(bwd_w_p_, engine));
+    if (pd()->diff_wei_reorder_pd_)
+        CHECK(pd()->diff_wei_reorder_pd_->create_primitive(
+                diff_wei_reorder_p_, engine));
+    return status::success;
+}
+
+status_t ref_fused_convolution_bwd_t::execute_nested(
+        const exec_ctx_t &ctx, int idx, exec_args_t &&args) const {
+    const auto &p = idx == 0 ? bwd_d_p_
+            : idx == 1       ? bwd_w_p_
+                             : diff_wei_reorder_p_;
+    exec_ctx_t nested_ctx(ctx, std::move(args));
+    nested_scratchpad_t ns(ctx, key_nested_multiple + idx, p);
+    nested_ctx.set_scratchpad_grantor(ns.grantor());
+    return p->execute(nested_ctx);
+}
+
+status_t ref_fused_convolution_bwd_t::execute(const exec_ctx_t &ctx) const {
+    if (pd()->is_chunked()) return execute_chunked(ctx);
+
+    const auto &args = ctx.args();
+    exec_args_t bwd_d_args, bwd_w_args;
+    bwd_d_args[DNNL_ARG_DIFF_DST] = args.at(DNNL_ARG_DIFF_DST);
+    bwd_d_args[DNNL_ARG_WEIGHTS] = args.at(DNNL_ARG_WEIGHTS);
+    bwd_d_args[DNNL_ARG_DIFF_SRC] = args.at(DNNL_ARG_DIFF_SRC);
+    CHECK(execute_nested(ctx, 0, std::move(bwd_d_args)));
+
+    bwd_w_args[DNNL_ARG_SRC] = args.at(DNNL_ARG_SRC);
+    bwd_w_args[DNNL_ARG_DIFF_DST] = args.at(DNNL_ARG_DIFF_DST);
+    bwd_w_args[DNNL_ARG_DIFF_WEIGHTS] = args.at(DNNL_ARG_DIFF_WEIGHTS);
+    if (pd()->with_bias())
+        bwd_w_args[DNNL_ARG_DIFF_BIAS] = args.at(DNNL_ARG_DIFF_BIAS);
+    return execute_nested(ctx, 1, std::move(bwd_w_args));
+}
+
+status_t ref_fused_convolution_bwd_t::execute_chunked(
+        const exec_ctx_t &ctx) const {
+    using mem_ptr_t = std::unique_ptr<memory_t, memory_deleter_t>;
+
+    engine_t *engine = ctx.stream()->engine();
+    const auto &args = ctx.args();
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    const bool with_bias = pd()->with_bias();
+    const bool with_acc = pd()->with_diff_wei_acc_;
+    const dim_t mb_chunk = pd()->mb_chunk_;
+
+    const auto &wei_md = pd()->chunk_diff_wei_md_;
+    const auto &bia_md = pd()->chunk_diff_bia_md_;
+    const size_t bia_off = diff_bia_offset(wei_md);
+    const dim_t wei_nelems = memory_desc_wrapper(wei_md).size() / sizeof(float);
+    const dim_t bia_nelems = memory_desc_wrapper(bia_md).size() / sizeof(float);
+
+    auto make_mem = [&](const memory_storage_t *storage,
+                            const memory_desc_t &md, size_t offset) {
+        return mem_ptr_t(new memory_t(engine, &md,
+                storage->get_sub_storage(
+                        offset, memory_desc_wrapper(md).size())));
+    };
+
+    // The weights gradient of the first chunk goes directly to the buffer
+    // where the gradients of all chunks are accumulated, the gradients of the
+    // other chunks go to a temporary buffer first.
+    const auto partial_storage = scratchpad.get_memory_storage(
+            key_fusion_backward_diff_wei_partial);
+    const auto partial_wei = make_mem(partial_storage.get(), wei_md, 0);
+    const auto partial_bia = with_bias
+            ? make_mem(partial_storage.get(), bia_md, bia_off)
+            : nullptr;
+    auto *partial = scratchpad.template get<char>(
+            key_fusion_backward_diff_wei_partial);
+
+    memory_arg_t acc_wei = args.at(DNNL_ARG_DIFF_WEIGHTS);
+    memory_arg_t acc_bia = with_bias ? args.at(DNNL_ARG_DIFF_BIAS)
+                                     : memory_arg_t {nullptr, false};
+    float *acc_wei_ptr = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_WEIGHTS);
+    float *acc_bia_ptr
+            = with_bias ? CTX_OUT_MEM(float *, DNNL_ARG_DIFF_BIAS) : nullptr;
+    mem_ptr_t acc_wei_mem, acc_bia_mem;
+    std::unique_ptr<memory_storage_t> acc_storage;
+    if (with_acc) {
+        acc_storage = scratchpad.get_memory_storage(
+                key_fusion_backward_diff_wei_acc);
+        acc_wei_mem = make_mem(acc_storage.get(), wei_md, 0);
+        acc_wei = {acc_wei_mem.get(), false};
+        auto *acc = scratchpad.template get<char>(
+                key_fusion_backward_diff_wei_acc);
+        acc_wei_ptr = reinterpret_cast<float *>(acc);
+        if (with_bias) {
+            acc_bia_mem = make_mem(acc_storage.get(), bia_md, bia_off);
+            acc_bia = {acc_bia_mem.get(), false};
+            acc_bia_ptr = reinterpret_cast<float *>(acc + bia_off);
+        }
+    }
+
+    const auto *src_storage = args.at(DNNL_ARG_SRC).mem->memory_storage();
+    const auto *diff_src_storage
+            = args.at(DNNL_ARG_DIFF_SRC).mem->memory_storage();
+    const auto *diff_dst_storage
+            = args.at(DNNL_ARG_DIFF_DST).mem->memory_storage();
+    const auto *bwd_d_pd = pd()->bwd_d_pd_.get();
+    const auto *bwd_w_pd = pd()->bwd_w_pd_.get();
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+
+    for (dim_t n = 0; n < pd()->MB(); n += mb_chunk) {
+        const auto src = make_mem(src_storage, *bwd_w_pd->src_md(),
+                src_d.blk_off(n) * src_d.data_type_size());
+        const auto diff_src = make_mem(diff_src_storage,
+                *bwd_d_pd->diff_src_md(),
+                diff_src_d.blk_off(n) * diff_src_d.data_type_size());
+        const auto diff_dst = make_mem(diff_dst_storage,
+                *bwd_d_pd->diff_dst_md(),
+                diff_dst_d.blk_off(n) * diff_dst_d.data_type_size());
+
+        exec_args_t bwd_d_args, bwd_w_args;
+        bwd_d_args[DNNL_ARG_DIFF_DST] = {diff_dst.get(), true};
+        bwd_d_args[DNNL_ARG_WEIGHTS] = args.at(DNNL_ARG_WEIGHTS);
+        bwd_d_args[DNNL_ARG_DIFF_SRC] = {diff_src.get(), false};
+        CHECK(execute_nested(ctx, 0, std::move(bwd_d_args)));
+
+        const bool is_first = n == 0;
+        bwd_w_args[DNNL_ARG_SRC] = {src.get(), true};
+        bwd_w_args[DNNL_ARG_DIFF_DST] = {diff_dst.get(), true};
+        bwd_w_args[DNNL_ARG_DIFF_WEIGHTS]
+                = is_first ? acc_wei : memory_arg_t {partial_wei.get(), false};
+        if (with_bias)
+            bwd_w_args[DNNL_ARG_DIFF_BIAS] = is_first
+                    ? acc_bia
+                    : memory_arg_t {partial_bia.get(), false};
+        CHECK(execute_nested(ctx, 1, std::move(bwd_w_args)));
+        if (is_first) continue;
+
+        const auto *partial_wei_ptr = reinterpret_cast<const float *>(partial);
+        parallel_nd(wei_nelems,
+                [&](dim_t i) { acc_wei_ptr[i] += partial_wei_ptr[i]; });
+        if (with_bias) {
+            const auto *partial_bia_ptr
+                    = reinterpret_cast<const float *>(partial + bia_off);
+            for (dim_t i = 0; i < bia_nelems; i++)
+                acc_bia_ptr[i] += partial_bia_ptr[i];
+        }
+    }
+
+    if (!with_acc) return status::success;
+
+    exec_args_t reorder_args;
+    reorder_args[DNNL_ARG_FROM] = {acc_wei_mem.get(), true};
+    reorder_args[DNNL_ARG_TO] = args.at(DNNL_ARG_DIFF_WEIGHTS);
+    CHECK(execute_nested(ctx, 2, std::move(reorder_args)));
+
+    // The bias is one-dimensional, so the layouts of the accumulator and the
+    // user buffer match element-wise.
+    if (with_bias) {
+        void *diff_bia = CTX_OUT_MEM(void *, DNNL_ARG_DIFF_BIAS);
+        const auto diff_bia_dt = pd()->diff_weights_md(1)->data_type;
+        for (dim_t i = 0; i < bia_nelems; i++)
+            io::store_float_value(diff_bia_dt, acc_bia_ptr[i], diff_bia, i);
+    }
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,103 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_FUSED_CONVOLUTION_BWD_HPP
+#define CPU_REF_FUSED_CONVOLUTION_BWD_HPP
+
+#include <memory>
+#include <string>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Computes the data and the weights gradients of a convolution with a pair of
+// nested backward data and backward weights primitives.
+//
+// When the images are contiguous in the source, the diff source and the diff
+// destination tensors, the minibatch is split into chunks sized to fit the
+// cache. Both nested primitives are run back to back on every chunk, so the
+// weights gradient reads the chunk of the diff destination while it is still
+// in cache after the data gradient. Partial weights gradients of the chunks
+// are accumulated in f32, and a low precision weights gradient is converted
+// to the user layout with a nested reorder at the end.
+struct ref_fused_convolution_bwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_bwd_pd_t {
+        using cpu_convolution_bwd_pd_t::cpu_convolution_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T(name_.c_str(), ref_fused_convolution_bwd_t);
+
+        status_t init(engine_t *engine);
+
+        bool is_chunked() const { return mb_chunk_ < MB(); }
+
+        // Images processed by one run of the nested primitives.
+        dim_t mb_chunk_ = 0;
+        // Whether the weights gradient is accumulated in a separate f32
+        // buffer rather than in the user one.
+        bool with_diff_wei_acc_ = false;
+        // Memory descriptors of the f32 weights gradient of a chunk. The
+        // layout of the weights matches the user one unless the gradient is
+        // accumulated in a separate buffer, in which case it is picked by the
+        // nested backward weights primitive.
+        memory_desc_t chunk_diff_wei_md_;
+        memory_desc_t chunk_diff_bia_md_;
+        std::shared_ptr<primitive_desc_t> bwd_d_pd_;
+        std::shared_ptr<primitive_desc_t> bwd_w_pd_;
+        // Converts the accumulated weights gradient to the user buffer.
+        std::shared_ptr<primitive_desc_t> diff_wei_reorder_pd_;
+
+    private:
+        std::string name_ = "ref_fused_convolution_bwd:any";
+
+        status_t create_nested_pds(engine_t *engine, dim_t mb,
+                std::shared_ptr<primitive_desc_t> &bwd_d_pd,
+                std::shared_ptr<primitive_desc_t> &bwd_w_pd) const;
+        status_t init_chunking(engine_t *engine);
+        void init_scratchpad();
+    };
+
+    ref_fused_convolution_bwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    status_t execute_nested(
+            const exec_ctx_t &ctx, int idx, exec_args_t &&args) const;
+    status_t execute_chunked(const exec_ctx_t &ctx) const;
+
+    std::shared_ptr<primitive_t> bwd_d_p_;
+    std::shared_ptr<primitive_t> bwd_w_p_;
+    std::shared_ptr<primitive_t> diff_wei_reorder_p_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
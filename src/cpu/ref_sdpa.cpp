@@ -0,0 +1,196 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <float.h>
+#include <math.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/ref_sdpa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t ref_sdpa_t::execute_ref(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    auto qry = CTX_IN_MEM(const void *, DNNL_ARG_QUERIES);
+    auto key = CTX_IN_MEM(const void *, DNNL_ARG_KEYS);
+    auto val = CTX_IN_MEM(const void *, DNNL_ARG_VALUES);
+    auto msk = CTX_IN_MEM(const void *, DNNL_ARG_ATTN_MASK);
+    auto block_table = CTX_IN_MEM(const int32_t *, DNNL_ARG_BLOCK_TABLE);
+    auto scale_ptr = CTX_IN_MEM(const void *, DNNL_ARG_SCALE);
+    auto key_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_KEYS);
+    auto key_zp = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_KEYS);
+    auto val_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_VALUES);
+    auto val_zp = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const auto *d = pd()->desc();
+    const memory_desc_wrapper qry_d(pd()->qry_md());
+    const memory_desc_wrapper key_d(pd()->key_md());
+    const memory_desc_wrapper val_d(pd()->val_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper msk_d(pd()->attn_mask_md());
+    const memory_desc_wrapper bt_d(pd()->block_table_md());
+
+    const dim_t MB = qry_d.dims()[0];
+    const dim_t H = qry_d.dims()[1];
+    const dim_t Q = d->queries();
+    const dim_t K = d->keys();
+    const dim_t D = d->head_size();
+    const dim_t V = d->values();
+    const dim_t kv_group = pd()->kv_group_size();
+    const dim_t key_mb = key_d.dims()[0];
+    const dim_t val_mb = val_d.dims()[0];
+    const bool paged = pd()->with_block_table();
+    const dim_t page_size = d->page_size();
+
+    const bool with_mask = pd()->with_attn_mask() && !pd()->with_causal_mask();
+    const bool with_key_scales = pd()->with_key_scales();
+    const bool with_key_zp = pd()->with_key_zp();
+    const bool with_val_scales = pd()->with_value_scales();
+    const bool with_val_zp = pd()->with_value_zp();
+    const bool inf_as_zero
+            = d->softmax_alg == alg_kind::softmax_accurate_inf_as_zero;
+
+    float scale = 1.f;
+    if (pd()->with_attn_scale()) {
+        scale = io::load_float_value(d->scale_dt, scale_ptr, 0);
+        if (d->invert_scale) scale = 1.f / scale;
+    }
+
+    // Returns the number of keys a query attends to.
+    auto num_keys = [&](dim_t q) {
+        if (d->mask_type == attn_mask_type::top_left)
+            return nstl::min(K, q + 1);
+        if (d->mask_type == attn_mask_type::bottom_right)
+            return nstl::max(dim_t(0), nstl::min(K, q + K - Q + 1));
+        return K;
+    };
+
+    // Returns the batch of key `k` of batch `mb` in the keys and values tensors
+    // and its index there, or false if the key is in an absent page.
+    auto locate = [&](dim_t mb, dim_t k, dim_t &kmb, dim_t &vmb, dim_t &kk) {
+        if (!paged) {
+            kmb = mb % key_mb;
+            vmb = mb % val_mb;
+            kk = k;
+            return true;
+        }
+        const dim_t page = block_table[bt_d.off(mb, k / page_size)];
+        kmb = vmb = page;
+        kk = k % page_size;
+        return page >= 0 && page < key_mb;
+    };
+
+    auto load_key = [&](dim_t mb, dim_t h, dim_t i, dim_t k) {
+        float v = io::load_float_value(
+                key_d.data_type(), key, key_d.off(mb, h, i, k));
+        if (with_key_zp)
+            v -= io::load_int_value(pd()->key_zp_dt(), key_zp,
+                    pd()->key_zp().off(mb, h, i, k));
+        if (with_key_scales)
+            v *= io::load_float_value(pd()->key_scales_dt(), key_scales,
+                    pd()->key_scales().off(mb, h, i, k));
+        return v;
+    };
+
+    auto load_val = [&](dim_t mb, dim_t h, dim_t k, dim_t i) {
+        float v = io::load_float_value(
+                val_d.data_type(), val, val_d.off(mb, h, k, i));
+        if (with_val_zp)
+            v -= io::load_int_value(pd()->value_zp_dt(), val_zp,
+                    pd()->value_zp().off(mb, h, k, i));
+        if (with_val_scales)
+            v *= io::load_float_value(pd()->value_scales_dt(), val_scales,
+                    pd()->value_scales().off(mb, h, k, i));
+        return v;
+    };
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    float *scores_base = scratchpad.template get<float>(
+            memory_tracking::names::key_sdpa_scores);
+
+    parallel(0, [&](int ithr, int nthr) {
+        float *s = scores_base + ithr * K;
+        for_nd(ithr, nthr, MB, H, Q, [&](dim_t mb, dim_t h, dim_t q) {
+            const dim_t kv_h = h / kv_group;
+            const dim_t nk = num_keys(q);
+            dim_t kmb, vmb, kk;
+
+            float s_max = -INFINITY;
+            for (dim_t k = 0; k < nk; k++) {
+                if (!locate(mb, k, kmb, vmb, kk)) {
+                    s[k] = -INFINITY;
+                    continue;
+                }
+                float acc = 0.f;
+                for (dim_t i = 0; i < D; i++) {
+                    const float q_val = io::load_float_value(
+                            qry_d.data_type(), qry, qry_d.off(mb, h, q, i));
+                    acc += q_val * load_key(kmb, kv_h, i, kk);
+                }
+                acc *= scale;
+                if (with_mask) {
+                    const auto msk_off = msk_d.off(mb % msk_d.dims()[0],
+                            h % msk_d.dims()[1],
+                            msk_d.dims()[2] == 1 ? 0 : q, k);
+                    acc += io::load_float_value(
+                            msk_d.data_type(), msk, msk_off);
+                }
+                s[k] = acc;
+                s_max = nstl::max(s_max, acc);
+            }
+
+            // Keys masked out entirely give a zero sum, so the output turns
+            // into NaN unless infinities are treated as zeros.
+            float s_sum = 0.f;
+            for (dim_t k = 0; k < nk; k++) {
+                s[k] = s_max == -INFINITY ? 0.f : expf(s[k] - s_max);
+                s_sum += s[k];
+            }
+            const float s_norm = s_sum > 0.f ? 1.f / s_sum
+                    : inf_as_zero            ? 0.f
+                                             : NAN;
+
+            for (dim_t i = 0; i < V; i++) {
+                float acc = 0.f;
+                for (dim_t k = 0; k < nk; k++)
+                    if (locate(mb, k, kmb, vmb, kk))
+                        acc += s[k] * load_val(vmb, kv_h, kk, i);
+                io::store_float_value(dst_d.data_type(), acc * s_norm, dst,
+                        dst_d.off(mb, h, q, i));
+            }
+        });
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -76,6 +76,14 @@ status_t dnnl_brgemm_set_D_scales(brgemm_t *brgemm, int d_scale_mask) {
     return status::unimplemented;
 }
 
+status_t dnnl_brgemm_set_pack_B(
+        brgemm_t *brgemm, pack_type_t in_pack_type, dim_t in_ldb) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_brgemm_set_pack_B(brgemm, in_pack_type, in_ldb);
+#endif
+    return status::unimplemented;
+}
+
 status_t dnnl_brgemm_finalize(brgemm_t *brgemm) {
 #if DNNL_X64
     return x64::ukernel::dnnl_brgemm_finalize(brgemm);
@@ -147,6 +155,27 @@ status_t dnnl_brgemm_execute_postops(const brgemm_t *brgemm, const void *A_ptr,
     return status::unimplemented;
 }
 
+status_t dnnl_brgemm_execute_ptrs(const brgemm_t *brgemm,
+        const void *const *A_ptrs, const void *const *B_ptrs, void *C_ptr,
+        void *scratchpad_ptr) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_brgemm_execute_ptrs(
+            brgemm, A_ptrs, B_ptrs, C_ptr, scratchpad_ptr);
+#endif
+    return status::unimplemented;
+}
+
+status_t dnnl_brgemm_execute_ptrs_postops(const brgemm_t *brgemm,
+        const void *const *A_ptrs, const void *const *B_ptrs,
+        const void *C_ptr, void *D_ptr, void *scratchpad_ptr,
+        const attr_params_t *attr_params) {
+#if DNNL_X64
+    return x64::ukernel::dnnl_brgemm_execute_ptrs_postops(brgemm, A_ptrs,
+            B_ptrs, C_ptr, D_ptr, scratchpad_ptr, attr_params);
+#endif
+    return status::unimplemented;
+}
+
 status_t dnnl_brgemm_destroy(brgemm_t *brgemm) {
 #if DNNL_X64
     return x64::ukernel::dnnl_brgemm_destroy(brgemm);
@@ -0,0 +1,162 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+#include "common/bit_cast.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+#include "cpu/x64/gemm/gemm_batch.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace {
+
+// A problem in terms of the row-major brgemm, i.e. C^T = B^T * A^T for the
+// column-major C = A * B.
+struct brg_problem_t {
+    dim_t M, N, K, LDA, LDB, LDC;
+    uint32_t alpha, beta;
+
+    bool operator<(const brg_problem_t &rhs) const {
+        return std::tie(M, N, K, LDA, LDB, LDC, alpha, beta)
+                < std::tie(rhs.M, rhs.N, rhs.K, rhs.LDA, rhs.LDB, rhs.LDC,
+                        rhs.alpha, rhs.beta);
+    }
+};
+
+using brg_kernel_ptr_t = std::shared_ptr<brgemm_kernel_t>;
+
+// The kernels are kept across the calls so that the batches of the same
+// shapes are generated once. Once the cache is full the kernels for the new
+// shapes live for a single call only.
+constexpr size_t kernel_cache_capacity = 1024;
+
+// The brgemm kernels are single-threaded and don't block K, so bigger
+// problems are left to the regular GEMM.
+constexpr dim_t max_problem_size = 128 * 128 * 128;
+
+status_t get_kernel(const brg_problem_t &prb, float alpha, float beta,
+        brg_kernel_ptr_t &kernel) {
+    static std::mutex cache_mutex;
+    static std::map<brg_problem_t, brg_kernel_ptr_t> cache;
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        const auto it = cache.find(prb);
+        if (it != cache.end()) {
+            kernel = it->second;
+            return status::success;
+        }
+    }
+
+    brgemm_desc_t brg;
+    CHECK(brgemm_desc_init(&brg, isa_undef, brgemm_addr, data_type::f32,
+            data_type::f32, false, false, brgemm_row_major, alpha, beta,
+            prb.LDA, prb.LDB, prb.LDC, prb.M, prb.N, prb.K));
+    // AMX kernels need a tile configuration and a scratchpad per call.
+    if (brg.is_tmm) return status::unimplemented;
+
+    brgemm_attr_t brgattr;
+    brgattr.max_bs = 1;
+    CHECK(brgemm_desc_set_attr(&brg, brgattr));
+    CHECK(brgemm_desc_finalize(&brg));
+
+    brgemm_kernel_t *ker = nullptr;
+    CHECK(brgemm_kernel_create(&ker, brg));
+    kernel.reset(ker);
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    if (cache.size() < kernel_cache_capacity) cache.emplace(prb, kernel);
+    return status::success;
+}
+
+} // namespace
+
+dnnl_status_t brgemm_sgemm_batch(dim_t batch_size, const char *transa,
+        const char *transb, const dim_t *M, const dim_t *N, const dim_t *K,
+        const float *alpha, const float *const *A, const dim_t *lda,
+        const float *const *B, const dim_t *ldb, const float *beta,
+        float *const *C, const dim_t *ldc) {
+    using namespace utils;
+
+    if (!mayiuse(avx2)) return status::unimplemented;
+    if (!one_of(*transa, 'n', 'N') || !one_of(*transb, 'n', 'N'))
+        return status::unimplemented;
+
+    // Map every problem to its group, the problems with empty C are skipped.
+    std::map<brg_problem_t, dim_t> group_ids;
+    std::vector<brg_problem_t> groups;
+    std::vector<dim_t> group_of(batch_size, -1);
+    std::vector<dim_t> order;
+    order.reserve(batch_size);
+    for (dim_t i = 0; i < batch_size; i++) {
+        if (M[i] == 0 || N[i] == 0) continue;
+        if (K[i] == 0 || M[i] * N[i] * K[i] > max_problem_size)
+            return status::unimplemented;
+
+        const brg_problem_t prb {N[i], M[i], K[i], ldb[i], lda[i], ldc[i],
+                utils::bit_cast<uint32_t>(*alpha),
+                utils::bit_cast<uint32_t>(*beta)};
+        const auto ins = group_ids.emplace(prb, (dim_t)groups.size());
+        if (ins.second) groups.push_back(prb);
+        group_of[i] = ins.first->second;
+        order.push_back(i);
+    }
+    if (groups.size() > kernel_cache_capacity) return status::unimplemented;
+
+    std::vector<brg_kernel_ptr_t> kernels(groups.size());
+    for (size_t g = 0; g < groups.size(); g++)
+        CHECK(get_kernel(groups[g], *alpha, *beta, kernels[g]));
+
+    // The problems of a group are kept together, so that a thread mostly
+    // calls a single kernel.
+    std::stable_sort(order.begin(), order.end(),
+            [&](dim_t a, dim_t b) { return group_of[a] < group_of[b]; });
+
+    const dim_t work_amount = (dim_t)order.size();
+    parallel(0, [&](int ithr, int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(work_amount, nthr, ithr, start, end);
+
+        brgemm_batch_element_t batch_element;
+        for (dim_t w = start; w < end; w++) {
+            const dim_t i = order[w];
+            batch_element.ptr.A = B[i];
+            batch_element.ptr.B = A[i];
+            brgemm_kernel_execute(
+                    kernels[group_of[i]].get(), 1, &batch_element, C[i]);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
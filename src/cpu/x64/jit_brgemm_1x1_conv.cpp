@@ -61,8 +61,15 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
     auto skip_mask = skip_mask_t::post_ops | skip_mask_t::sum_dt
             | skip_mask_t::zero_points | skip_mask_t::fpmath_mode;
     if (is_int8 || is_fp8) skip_mask |= skip_mask_t::scales;
+    if (with_wei_decompression())
+        skip_mask |= skip_mask_t::scales_data_type | skip_mask_t::scales_groups
+                | skip_mask_t::zero_points_data_type
+                | skip_mask_t::zero_points_groups;
 
     VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(
+            IMPLICATION(with_wei_decompression(), one_of(src_type, bf16, f16)),
+            VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_CONV(expect_data_types(src_type, wei_type, data_type::undef,
                            dst_type, data_type::undef),
             VERBOSE_UNSUPPORTED_DT);
@@ -81,8 +88,12 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
             VERBOSE_UNSUPPORTED_ATTR);
     VDISPATCH_CONV(attr()->post_ops_.check_sum_consistency(dst_type, is_int8),
             VERBOSE_UNSUPPORTED_POSTOP);
-    CHECK(attr_scales_ok());
-    CHECK(attr_zero_points_ok());
+    if (with_wei_decompression()) {
+        CHECK(attr_wei_decompression_ok());
+    } else {
+        CHECK(attr_scales_ok());
+        CHECK(attr_zero_points_ok());
+    }
 
     CHECK(brgemm_convolution_utils::init_1x1_conf(jcp_, isa, *desc(), src_md_,
             weights_md_, dst_md_, bias_md_, attr_, dnnl_get_max_threads()));
@@ -158,6 +169,9 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
     if (jcp_.with_scales)
         book_precomputed_scales(
                 scratchpad, attr()->scales_, OC(), jcp_.scale_adjust_factor);
+    if (jcp_.with_wei_decompression)
+        brgemm_convolution_utils::book_wei_decompression_buffer(
+                scratchpad, jcp_, get_wei_ocb_stride(jcp_));
 
     return status::success;
 }
@@ -166,7 +180,7 @@ template <cpu_isa_t isa>
 status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init_brgemm_desc() {
 
     const auto src_type = src_md(0)->data_type;
-    const auto wei_type = weights_md(0)->data_type;
+    const auto wei_type = jcp_.wei_dt;
     const float alpha = 1.0;
     const float beta = 1.0;
 
@@ -224,6 +238,8 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init_brgemm_desc() {
         const auto &p = attr()->post_ops_;
         brg.with_sum = p.find(primitive_kind::sum) != -1;
         brg.with_weights_scale_adjust = jcp_.scale_adjust_factor != 1.0f;
+        brg.skip_scales = jcp_.with_wei_decompression;
+        brg.skip_zp_b_compensation = jcp_.with_wei_decompression;
         CHECK(brgemm_desc_set_postops(
                 &brg, attr(), &dst_md_, LDD, jcp_.bia_dt));
         CHECK(brgemm_desc_finalize(&brg));
@@ -267,15 +283,8 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::init(engine_t *engine) {
     dst_h_sz = OH * dst_w_sz;
     dst_d_sz = OD * dst_h_sz;
 
-    const auto src_type = pd()->src_md(0)->data_type;
-    const data_type_t last_ic_block_dt
-            = get_mac_emu_data_type(src_type, isa, isa == avx512_core_fp16);
-    const auto last_ic_block = data_type_vnni_granularity(last_ic_block_dt);
-
     wei_ic_stride = jcp.wei_plain ? jcp.oc_without_padding : jcp.oc_block;
-    wei_ocb_stride = jcp.wei_plain
-            ? jcp.oc_block
-            : (dim_t)rnd_up(jcp.icp, last_ic_block) * jcp.oc_block;
+    wei_ocb_stride = pd_t::get_wei_ocb_stride(jcp);
     wei_g_stride = jcp.wei_plain ? jcp.oc : jcp.nb_oc * wei_ocb_stride;
 
     if (jcp.is_rtus) {
@@ -289,7 +298,7 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::init(engine_t *engine) {
     const bool is_jit_supported = mayiuse(avx512_core);
     const auto attr = pd()->attr();
     const auto &attr_scales = attr->scales_;
-    if (is_jit_supported && pd()->OC() > 1
+    if (is_jit_supported && pd()->OC() > 1 && jcp.with_scales
             && req_copy_scales(attr_scales, jcp.scale_adjust_factor)) {
         int wei_scale_mask = attr_scales.get_mask(DNNL_ARG_WEIGHTS);
         if (wei_scale_mask > 0) {
@@ -412,10 +421,9 @@ void brgemm_1x1_convolution_fwd_t<isa>::exec_ker(
         const float *dst_scales, const bool is_last_os) const {
 
     const memory_desc_wrapper src_d(pd()->src_md());
-    const memory_desc_wrapper weights_d(pd()->weights_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
     const size_t src_dt_size = types::data_type_size(src_d.data_type());
-    const size_t wei_dt_size = types::data_type_size(weights_d.data_type());
+    const size_t wei_dt_size = pd()->jcp_.wei_dsz;
     const size_t dst_dt_size = types::data_type_size(dst_d.data_type());
 
     const char *const __restrict src = brgemm_ctx.src;
@@ -472,7 +480,9 @@ void brgemm_1x1_convolution_fwd_t<isa>::exec_ker(
             = jcp.is_rtus ? rtus_src : src + src_mb_c_offset + src_hw_offset;
 
     const auto wei_offset = g * wei_g_stride + ocb * wei_ocb_stride;
-    const auto wei_base = weights + wei_dt_size * wei_offset;
+    const auto wei_base = jcp.with_wei_decompression
+            ? get_wei_buffer(brgemm_ctx, ithr)
+            : weights + wei_dt_size * wei_offset;
 
     // Using blk_off to offset batch is motivated input\output striding aligment
     // See `blk_off` definition.
@@ -573,6 +583,16 @@ void brgemm_1x1_convolution_fwd_t<isa>::exec_ker(
     }
 }
 
+template <cpu_isa_t isa>
+void brgemm_1x1_convolution_fwd_t<isa>::decompress_weights(
+        const brgemm_exec_ctx_t &brgemm_ctx, int ithr, int g, int ocb) const {
+    brgemm_convolution_utils::decompress_wei_block(pd()->jcp_,
+            memory_desc_wrapper(pd()->weights_md()), pd()->attr(),
+            brgemm_ctx.weights,
+            brgemm_ctx.wei_scales, brgemm_ctx.wei_zero_points, g, ocb,
+            wei_ocb_stride, get_wei_buffer(brgemm_ctx, ithr));
+}
+
 template <cpu_isa_t isa>
 void brgemm_1x1_convolution_fwd_t<isa>::execute_os_blocking(
         const brgemm_exec_ctx_t &brgemm_ctx,
@@ -603,6 +623,7 @@ void brgemm_1x1_convolution_fwd_t<isa>::execute_os_blocking(
                 : nullptr;
         int last_n = -1;
         int last_g = -1;
+        int last_ocb = -1;
         int last_brg_idx = -1;
         int start {0}, end {0};
         balance211(work_amount, nthr, ithr, start, end);
@@ -620,6 +641,8 @@ void brgemm_1x1_convolution_fwd_t<isa>::execute_os_blocking(
         for (auto work = start; work < end; work++) {
             if (jcp.is_rtus && (last_n != n || last_g != g))
                 std::memset(inp_buffer_mask, 0, jcp.inp_buffer_mask_size);
+            if (jcp.with_wei_decompression && (last_g != g || last_ocb != ocb))
+                decompress_weights(brgemm_ctx, ithr, g, ocb);
             const auto osb_start = oss * jcp.nb_os_blocking;
             const auto osb_range
                     = nstl::min(jcp.nb_os - osb_start, jcp.nb_os_blocking);
@@ -646,6 +669,7 @@ void brgemm_1x1_convolution_fwd_t<isa>::execute_os_blocking(
             }
             last_n = n;
             last_g = g;
+            last_ocb = ocb;
             if (jcp.loop_order == loop_ndhwgc)
                 nd_iterator_step(n, jcp.mb, oss, os_chunks, g, jcp.ngroups, ocb,
                         jcp.nb_oc);
@@ -679,6 +703,8 @@ void brgemm_1x1_convolution_fwd_t<isa>::execute_full_spatial(
                 ? c_buffer_global + ithr * acc_dsz * jcp.LDC * jcp.M
                 : nullptr;
         int last_brg_idx = -1;
+        int last_g = -1;
+        int last_ocb = -1;
         int start {0}, end {0};
         balance211(work_amount, nthr, ithr, start, end);
         int n {0}, g {0}, ocb {0}, od {0}, oh {0}, owb {0};
@@ -693,6 +719,12 @@ void brgemm_1x1_convolution_fwd_t<isa>::execute_full_spatial(
             assert(!"Unknown loop order");
 
         for (auto work = start; work < end; work++) {
+            if (jcp.with_wei_decompression
+                    && (last_g != g || last_ocb != ocb)) {
+                decompress_weights(brgemm_ctx, ithr, g, ocb);
+                last_g = g;
+                last_ocb = ocb;
+            }
             for (int icc = 0; icc < pd()->ic_chunks_; icc++) {
                 const int ow = owb * jcp.ow_block;
                 exec_ker(brgemm_ctx, ithr, brg_batch, c_buffer, nullptr, g, n,
@@ -729,10 +761,13 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::execute_forward_all(
     DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
 
     const int wei_scale_mask = pd()->attr()->scales_.get_mask(DNNL_ARG_WEIGHTS);
-    const float *oscales = scale_utils::precompute_scales(scratchpad,
-            src_scales, wei_scales, pd()->IC(), pd()->OC(), false,
-            wei_scale_mask > 0, pd()->attr(), jit_scale_precompute_.get(),
-            jcp.scale_adjust_factor);
+    // Weights scales are applied on weights decompression.
+    const float *oscales = jcp.with_wei_decompression
+            ? nullptr
+            : scale_utils::precompute_scales(scratchpad, src_scales,
+                    wei_scales, pd()->IC(), pd()->OC(), false,
+                    wei_scale_mask > 0, pd()->attr(),
+                    jit_scale_precompute_.get(), jcp.scale_adjust_factor);
 
     DEFINE_ZERO_POINT_VALUE(src_zero_point, DNNL_ARG_SRC);
     DEFINE_ZERO_POINT_VALUE(dst_zero_point, DNNL_ARG_DST);
@@ -76,6 +76,16 @@ struct brgemm_1x1_convolution_fwd_t : public primitive_t {
 
         jit_brgemm_conv_conf_t jcp_ = utils::zero<decltype(jcp_)>();
 
+        static dim_t get_wei_ocb_stride(const jit_brgemm_conv_conf_t &jcp) {
+            if (jcp.wei_plain) return jcp.oc_block;
+            const data_type_t last_ic_block_dt = get_mac_emu_data_type(
+                    jcp.src_dt, isa, isa == avx512_core_fp16);
+            const auto last_ic_block
+                    = data_type_vnni_granularity(last_ic_block_dt);
+            return static_cast<dim_t>(utils::rnd_up(jcp.icp, last_ic_block))
+                    * jcp.oc_block;
+        }
+
     private:
         status_t init_brgemm_desc();
     };
@@ -107,15 +117,33 @@ private:
             , post_ops_binary_rhs_arg_vec(binary_injector::prepare_binary_args(
                       pd->attr()->post_ops_, ctx))
             , wsp_tile(ctx.get_scratchpad_grantor().template get<char>(
-                      memory_tracking::names::key_conv_amx_tile_buffer)) {}
+                      memory_tracking::names::key_conv_amx_tile_buffer))
+            , wei_scales(CTX_IN_MEM(
+                      const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS))
+            , wei_zero_points(CTX_IN_MEM(const void *,
+                      DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS))
+            , wei_buffer(ctx.get_scratchpad_grantor().template get<char>(
+                      memory_tracking::names::key_conv_brgemm_wei_buffer)) {}
         const char *const __restrict src;
         const char *const __restrict weights;
         const char *const __restrict bias;
         char *const __restrict dst;
         const std::vector<const void *> post_ops_binary_rhs_arg_vec;
         char *const wsp_tile;
+        // Weights decompression parameters and per-thread buffers.
+        const void *const wei_scales;
+        const void *const wei_zero_points;
+        char *const wei_buffer;
     };
 
+    char *get_wei_buffer(const brgemm_exec_ctx_t &brgemm_ctx, int ithr) const {
+        const size_t buffer_size = utils::rnd_up(
+                wei_ocb_stride * wei_dsz, brgemm_convolution_utils::P4K);
+        return brgemm_ctx.wei_buffer + ithr * buffer_size;
+    }
+    void decompress_weights(
+            const brgemm_exec_ctx_t &brgemm_ctx, int ithr, int g, int ocb) const;
+
     void maybe_rtus(int ithr, const char *__restrict src,
             char *__restrict inp_buffer, uint8_t *__restrict inp_buffer_mask,
             int g, int n, int icc, int od, int oh, int ow) const;
@@ -187,7 +187,7 @@ status_t brgemm_convolution_fwd_t<isa>::pd_t::add_brg_descriptor(int vM,
     if (do_init && is_K_tail && jcp_.K > 0) return status::success;
 
     const auto src_type = src_md(0)->data_type;
-    const auto wei_type = weights_md(0)->data_type;
+    const auto wei_type = jcp_.wei_dt;
     const auto is_amx = brgemm_convolution_utils::is_amx(isa);
 
     const float alpha = 1.0;
@@ -320,6 +320,8 @@ status_t brgemm_convolution_fwd_t<isa>::pd_t::add_brg_descriptor(int vM,
     auto LDD = jcp_.oc_without_padding;
     brg.with_sum = with_sum_;
     brg.with_weights_scale_adjust = jcp_.scale_adjust_factor != 1.0f;
+    brg.skip_scales = jcp_.with_wei_decompression;
+    brg.skip_zp_b_compensation = jcp_.with_wei_decompression;
     CHECK(brgemm_desc_set_postops(&brg, attr(), &dst_md_, LDD, jcp_.bia_dt));
     CHECK(brgemm_desc_finalize(&brg));
 
@@ -366,8 +368,15 @@ status_t brgemm_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
     auto skip_mask = skip_mask_t::post_ops | skip_mask_t::sum_dt
             | skip_mask_t::zero_points | skip_mask_t::fpmath_mode;
     if (is_int8 || is_fp8) skip_mask |= skip_mask_t::scales;
+    if (with_wei_decompression())
+        skip_mask |= skip_mask_t::scales_data_type | skip_mask_t::scales_groups
+                | skip_mask_t::zero_points_data_type
+                | skip_mask_t::zero_points_groups;
 
     VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(
+            IMPLICATION(with_wei_decompression(), one_of(src_type, bf16, f16)),
+            VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_CONV(IMPLICATION(is_int8,
                            one_of(bias_md_.data_type, data_type::undef, f32,
                                    s32, s8, u8)),
@@ -383,8 +392,12 @@ status_t brgemm_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
             VERBOSE_UNSUPPORTED_ATTR);
     VDISPATCH_CONV(attr()->post_ops_.check_sum_consistency(dst_type, is_int8),
             VERBOSE_UNSUPPORTED_POSTOP);
-    CHECK(attr_scales_ok());
-    CHECK(attr_zero_points_ok());
+    if (with_wei_decompression()) {
+        CHECK(attr_wei_decompression_ok());
+    } else {
+        CHECK(attr_scales_ok());
+        CHECK(attr_zero_points_ok());
+    }
     VDISPATCH_CONV(
             impl::is_dense_format_kind({src_md(0), weights_md(0), dst_md(0)}),
             VERBOSE_UNSUPPORTED_SPARSE_CFG);
@@ -677,6 +690,9 @@ status_t brgemm_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
     if (jcp_.with_scales)
         book_precomputed_scales(
                 scratchpad, attr()->scales_, OC(), jcp_.scale_adjust_factor);
+    if (jcp_.with_wei_decompression)
+        brgemm_convolution_utils::book_wei_decompression_buffer(
+                scratchpad, jcp_, wei_ocb_stride);
 
     return status::success;
 }
@@ -935,7 +951,7 @@ status_t brgemm_convolution_fwd_t<isa>::init(engine_t *engine) {
     const bool is_jit_supported = mayiuse(avx512_core);
     const auto attr = pd()->attr();
     const auto &attr_scales = attr->scales_;
-    if (is_jit_supported && pd()->OC() > 1
+    if (is_jit_supported && pd()->OC() > 1 && jcp.with_scales
             && req_copy_scales(attr_scales, jcp.scale_adjust_factor)) {
         int wei_scale_mask = attr_scales.get_mask(DNNL_ARG_WEIGHTS);
         if (wei_scale_mask > 0) {
@@ -1263,6 +1279,8 @@ struct brgemm_convolution_fwd_t<isa>::brgemm_thread_ctx_t {
     uint8_t *__restrict inp_buffer_mask {nullptr};
     const char *const __restrict weights {nullptr};
     void *__restrict inp_buffer_zero {nullptr};
+    // Decompressed weights of the current (g, ocb) block.
+    char *__restrict wei_buffer {nullptr};
 };
 
 template <cpu_isa_t isa>
@@ -1280,10 +1298,17 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     const memory_tracking::grantor_t scratchpad = ctx.get_scratchpad_grantor();
 
     const int wei_scale_mask = pd()->attr()->scales_.get_mask(DNNL_ARG_WEIGHTS);
-    const float *oscales = scale_utils::precompute_scales(scratchpad,
-            src_scales, wei_scales, pd()->IC(), pd()->OC(), false,
-            wei_scale_mask > 0, pd()->attr(), jit_scale_precompute_.get(),
-            jcp.scale_adjust_factor);
+    // Weights scales are applied on weights decompression.
+    const float *oscales = jcp.with_wei_decompression
+            ? nullptr
+            : scale_utils::precompute_scales(scratchpad, src_scales,
+                    wei_scales, pd()->IC(), pd()->OC(), false,
+                    wei_scale_mask > 0, pd()->attr(),
+                    jit_scale_precompute_.get(), jcp.scale_adjust_factor);
+    const void *wei_decomp_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS);
+    const void *wei_decomp_zero_points = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS);
 
     brgemm_exec_ctx_t brgemm_ctx(ctx, _pd);
 
@@ -1339,6 +1364,12 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     char *const wsp_tile_global = is_amx
             ? scratchpad.template get<char>(key_conv_amx_tile_buffer)
             : nullptr;
+    char *const wei_buffer_global = jcp.with_wei_decompression
+            ? scratchpad.template get<char>(key_conv_brgemm_wei_buffer)
+            : nullptr;
+    const size_t wei_buffer_size
+            = rnd_up(static_cast<size_t>(_pd->wei_ocb_stride) * wei_dsz,
+                    brgemm_convolution_utils::P4K);
 
     maybe_conv_weights(ctx, wei, wei);
 
@@ -1383,6 +1414,9 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
                 : nullptr;
 
         btc.input = jcp.copy_input ? btc.inp_buffer : src;
+        btc.wei_buffer = jcp.with_wei_decompression
+                ? wei_buffer_global + ithr * wei_buffer_size
+                : nullptr;
 
         dim_t start {0}, end {0};
         balance211(work_amount, nthr, ithr, start, end);
@@ -1390,6 +1424,11 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
         int n {0}, g {0}, ocb {0}, odb {0}, ohb {0}, owb {0};
         BRGEMM_CONV_ITERATOR_INIT;
         for (auto work = start; work < end; work++) {
+            if (jcp.with_wei_decompression && (btc.g != g || btc.ocb != ocb))
+                brgemm_convolution_utils::decompress_wei_block(jcp,
+                        weights_d, _pd->attr(), wei,
+                        wei_decomp_scales, wei_decomp_zero_points, g, ocb,
+                        _pd->wei_ocb_stride, btc.wei_buffer);
             btc.g = g;
             btc.n = n;
             btc.ocb = ocb;
@@ -2044,10 +2083,12 @@ void brgemm_convolution_fwd_t<isa>::ker_base(brgemm_thread_ctx_t &btc) const {
             jcp, ow, kw_s, kw_full_s, kw_full_f, kw_f);
 
     const auto src_base = src + get_src_base_offset(btc, ic);
-    const auto wei_base = weights
-            + wei_dsz
-                    * (btc.g * _pd->wei_g_stride
-                            + btc.ocb * _pd->wei_ocb_stride);
+    const auto wei_base = jcp.with_wei_decompression
+            ? btc.wei_buffer
+            : weights
+                    + wei_dsz
+                            * (btc.g * _pd->wei_g_stride
+                                    + btc.ocb * _pd->wei_ocb_stride);
 
     const auto call_brgemm = [&](int brg_idx, int ic_block_s, int n_ic_blocks,
                                      size_t comp_ker_offs, bool do_postops,
@@ -2192,10 +2233,12 @@ void brgemm_convolution_fwd_t<isa>::ker_trans(brgemm_thread_ctx_t &btc) const {
 
     MAYBE_UNUSED(src);
 
-    const auto wei_base = weights
-            + wei_dsz
-                    * (btc.g * _pd->wei_g_stride
-                            + btc.ocb * _pd->wei_ocb_stride);
+    const auto wei_base = jcp.with_wei_decompression
+            ? btc.wei_buffer
+            : weights
+                    + wei_dsz
+                            * (btc.g * _pd->wei_g_stride
+                                    + btc.ocb * _pd->wei_ocb_stride);
     const int ow_b {ow},
             ow_e {ow + (is_ow_tail ? jcp.ow % jcp.ow_block : jcp.ow_block)};
     const int oh_b {oh},
@@ -2327,10 +2370,12 @@ void brgemm_convolution_fwd_t<isa>::ker_vpad(brgemm_thread_ctx_t &btc) const {
     MAYBE_UNUSED(is_oh_tail);
 
     const char *const __restrict src_base = src + get_src_base_offset(btc, ic);
-    const char *const __restrict wei_base = weights
-            + wei_dsz
-                    * (btc.g * _pd->wei_g_stride
-                            + btc.ocb * _pd->wei_ocb_stride);
+    const char *const __restrict wei_base = jcp.with_wei_decompression
+            ? btc.wei_buffer
+            : weights
+                    + wei_dsz
+                            * (btc.g * _pd->wei_g_stride
+                                    + btc.ocb * _pd->wei_ocb_stride);
 
     const int ow_b {ow}, ow_e {ow + (is_ow_tail ? jcp.M_tail : jcp.M)};
     iiw_b = ow_b * SW - LP;
@@ -23,6 +23,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
 #include "cpu/scale_utils.hpp"
 #include "cpu/x64/brgemm/brgemm_utils.hpp"
 #include "cpu/x64/cpu_barrier.hpp"
@@ -381,7 +382,20 @@ status_t pick_tags(jit_brgemm_conv_conf_t &jcp, memory_desc_t &src_md,
     const bool any_eligible = is_any_eligible(jcp);
     CHECK(init_tag(jcp.src_tag, src_md, src_d, src_tag, any_eligible));
     CHECK(init_tag(jcp.dst_tag, dst_md, dst_d, dst_tag, any_eligible));
-    CHECK(init_tag(jcp.wei_tag, weights_md, weights_d, wei_tag, true));
+    if (jcp.with_wei_decompression) {
+        // `wei_tag` is the layout of the decompressed blocks. The integer
+        // weights are read through their memory descriptor and stay plain,
+        // there are no reorders of int4 data into the blocked layouts.
+        jcp.wei_tag = wei_tag;
+        if (weights_d.format_kind() == format_kind::any)
+            CHECK(memory_desc_init_by_tag(weights_md,
+                    pick(weights_d.ndims() - 3, abc, abcd, abcde, abcdef)));
+        VDISPATCH_CONV_IC(weights_d.is_plain()
+                        && !weights_d.has_runtime_dims_or_strides(),
+                VERBOSE_UNSUPPORTED_TAG_S, "weights");
+    } else {
+        CHECK(init_tag(jcp.wei_tag, weights_md, weights_d, wei_tag, true));
+    }
 
     return status::success;
 }
@@ -735,6 +749,8 @@ status_t brg_blocking_t::get_brgemm_ur(
         CHECK(brgemm_desc_set_attr(&brg, brgattr));
 
         brg.with_sum = with_sum;
+        brg.skip_scales = with_wei_decompression;
+        brg.skip_zp_b_compensation = with_wei_decompression;
         CHECK(brgemm_desc_set_postops(&brg, attr, &dst_md, LDD, bia_dt));
         CHECK(brgemm_utils::brgemm_blocking(&brg));
     }
@@ -1711,6 +1727,19 @@ status_t init_jcp(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
     jcp.wei_dt = weights_md.data_type;
     jcp.bia_dt = jcp.with_bias ? bias_md.data_type : data_type::undef;
 
+    // Integer weights are dequantized into the source data type by blocks of
+    // output channels right before the brgemm calls, so all kernels are
+    // generated for floating-point weights.
+    jcp.with_wei_decompression
+            = one_of(jcp.prop_kind, forward_training, forward_inference)
+            && one_of(jcp.src_dt, bf16, f16)
+            && one_of(jcp.wei_dt, s8, u8, s4, u4)
+            && attr.fpmath_.apply_to_int_;
+    if (jcp.with_wei_decompression) {
+        jcp.orig_wei_dt = jcp.wei_dt;
+        jcp.wei_dt = jcp.src_dt;
+    }
+
     if (one_of(jcp.src_dt, u8, s8)) {
         jcp.acc_dt = s32;
     } else if (one_of(jcp.src_dt, f32, bf16, f16, f8_e5m2, f8_e4m3)) {
@@ -1755,7 +1784,8 @@ status_t init_jcp(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
 
     if (one_of(jcp.prop_kind, prop_kind::forward_training,
                 prop_kind::forward_inference)
-            && jcp.ngroups == 1 && jcp.dilate_w == 0 && jcp.kw > 1
+            && !jcp.with_wei_decompression && jcp.ngroups == 1
+            && jcp.dilate_w == 0 && jcp.kw > 1
             && jcp.stride_w > 1 && jcp.l_pad <= 0 && jcp.r_pad <= 0
             && jcp.ic % jcp.vnni_block == 0
             && IMPLICATION(jcp.ic > jcp.simd_w, jcp.ic % jcp.simd_w == 0)) {
@@ -2016,6 +2046,9 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
                       && wei_amount > brg_blocking_t::L2)
             ? loop_gcndhw
             : ((bcast_amount < wei_amount) ? loop_ngcdhw : loop_ndhwgc);
+    // Reuse a block of decompressed weights across the spatial dims.
+    if (jcp.with_wei_decompression && jcp.loop_order == loop_ndhwgc)
+        jcp.loop_order = loop_ngcdhw;
     jcp.brgemm_kernel_loop_order
             = brgemm_kernel_loop_order_t::brgemm_lo_default;
 
@@ -2123,7 +2156,8 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
         //TODO: support all 3d cases
         const bool relo_supported_shape = jcp.trans_dim_koef == 1
                 && IMPLICATION(jcp.id > 1, relo_conv_weights_wi == false)
-                && !cd.use_inversion && jcp.dilate_w == 0;
+                && !cd.use_inversion && jcp.dilate_w == 0
+                && !jcp.with_wei_decompression;
 
         const auto rnd_kwic = (float)jcp.kw * rnd_up(jcp.ic, jcp.simd_w);
         const auto src_per_ic
@@ -2165,6 +2199,7 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
         const bool relo_supported_shape
                 = everyone_is(0, jcp.dilate_h, jcp.dilate_w)
                 && jcp.trans_dim_koef == 1 && jcp.ndims < 5 && !cd.use_inversion
+                && !jcp.with_wei_decompression
                 && IMPLICATION(jcp.s8s8_compensation_required,
                         everyone_is(0, jcp.t_pad, jcp.b_pad));
 
@@ -2380,10 +2415,13 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
 
     const auto &src_scales = attr.scales_.get(DNNL_ARG_SRC);
     const auto &wei_scales = attr.scales_.get(DNNL_ARG_WEIGHTS);
+    // Weights scales are applied on weights decompression.
     jcp.with_scales = !src_scales.has_default_values()
-            || !wei_scales.has_default_values()
+            || (!wei_scales.has_default_values()
+                    && !jcp.with_wei_decompression)
             || jcp.scale_adjust_factor != 1.0f;
-    jcp.is_oc_scale = wei_scales.get_mask() > 0;
+    jcp.is_oc_scale
+            = wei_scales.get_mask() > 0 && !jcp.with_wei_decompression;
 
     const bool compensation_w_padding
             = (jcp.s8s8_compensation_required || jcp.src_zero_point)
@@ -2497,6 +2535,8 @@ status_t init_1x1_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
                 = max_size < wei_size || (jcp.mb == 1 && os < os_cutoff);
         jcp.loop_order = use_loop_ngcdhw ? loop_ngcdhw : loop_ndhwgc;
     }
+    // Reuse a block of decompressed weights across the spatial dims.
+    if (jcp.with_wei_decompression) jcp.loop_order = loop_ngcdhw;
 
     const auto min_oc_block = jcp.acc_simd_w;
 
@@ -2655,10 +2695,13 @@ status_t init_1x1_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
 
     const auto &src_scales = attr.scales_.get(DNNL_ARG_SRC);
     const auto &wei_scales = attr.scales_.get(DNNL_ARG_WEIGHTS);
+    // Weights scales are applied on weights decompression.
     jcp.with_scales = !src_scales.has_default_values()
-            || !wei_scales.has_default_values()
+            || (!wei_scales.has_default_values()
+                    && !jcp.with_wei_decompression)
             || jcp.scale_adjust_factor != 1.0f;
-    jcp.is_oc_scale = wei_scales.get_mask() > 0;
+    jcp.is_oc_scale
+            = wei_scales.get_mask() > 0 && !jcp.with_wei_decompression;
 
     // enable ununroll_bd_loop for big shapes to reduce kernel sizes
     jcp.ununroll_bd_loop
@@ -2731,6 +2774,80 @@ void init_scratchpad(memory_tracking::registrar_t &scratchpad,
     }
 }
 
+void book_wei_decompression_buffer(memory_tracking::registrar_t &scratchpad,
+        const jit_brgemm_conv_conf_t &jcp, dim_t wei_ocb_size) {
+    const size_t buffer_size
+            = rnd_up(static_cast<size_t>(wei_ocb_size) * jcp.wei_dsz, P4K);
+    scratchpad.book(key_conv_brgemm_wei_buffer,
+            static_cast<size_t>(jcp.nthr) * buffer_size, sizeof(char), 0, P4K);
+}
+
+void decompress_wei_block(const jit_brgemm_conv_conf_t &jcp,
+        const memory_desc_wrapper &wei_d, const primitive_attr_t *attr,
+        const char *wei, const void *scales, const void *zero_points, int g,
+        int ocb, dim_t wei_ocb_size, char *wei_block) {
+    const auto &wei_scales = attr->scales_.get(DNNL_ARG_WEIGHTS);
+    const auto &wei_zero_points = attr->zero_points_.get(DNNL_ARG_WEIGHTS);
+    const bool with_scales = !wei_scales.has_default_values();
+    const bool with_zero_points = !wei_zero_points.has_default_values();
+
+    const dim_t oc_per_g = jcp.oc_without_padding / jcp.ngroups;
+    const dim_t ic_per_g = jcp.ic_without_padding;
+    const int oc_block = jcp.oc_block;
+    const int vnni_block = jcp.vnni_block;
+    const dim_t ks = static_cast<dim_t>(jcp.kd) * jcp.kh * jcp.kw;
+    const dim_t nb_icv = wei_ocb_size / (ks * oc_block * vnni_block);
+    const bool with_groups = wei_d.ndims() == jcp.ndims + 1;
+    const int ic_mask = 1 << (with_groups ? 2 : 1);
+
+    // The compressed weights are plain, see `pick_tags()`.
+    const auto &strides = wei_d.blocking_desc().strides;
+    const int sp = with_groups + 2;
+    const dim_t g_stride = with_groups ? strides[0] : 0;
+    const dim_t oc_stride = strides[with_groups];
+    const dim_t ic_stride = strides[with_groups + 1];
+    const dim_t kd_stride = jcp.ndims == 5 ? strides[sp] : 0;
+    const dim_t kh_stride = jcp.ndims >= 4 ? strides[sp + jcp.ndims - 4] : 0;
+    const dim_t kw_stride = strides[sp + jcp.ndims - 3];
+    const dim_t g_off = wei_d.offset0() + g * g_stride;
+
+    // Scales and zero-points are dense over (g, oc) and groups of ic.
+    auto qparam_off = [&](const quant_entry_t &e, dim_t oc, dim_t ic) {
+        if (e.get_mask() == 0) return dim_t(0);
+        const bool per_ic = e.get_mask() & ic_mask;
+        const dim_t ic_group = e.get_group(1);
+        const dim_t nb_ic_groups = per_ic ? ic_per_g / ic_group : 1;
+        return (g * oc_per_g + oc) * nb_ic_groups
+                + (per_ic ? ic / ic_group : 0);
+    };
+
+    for_(dim_t k = 0; k < ks; k++)
+    for_(dim_t icv = 0; icv < nb_icv; icv++)
+    for_(int o = 0; o < oc_block; o++)
+    for (int v = 0; v < vnni_block; v++) {
+        const dim_t idx = ((k * nb_icv + icv) * oc_block + o) * vnni_block + v;
+        const dim_t oc = static_cast<dim_t>(ocb) * oc_block + o;
+        const dim_t ic = icv * vnni_block + v;
+        // Padded elements must stay zero regardless of zero-points.
+        float w = 0.f;
+        if (oc < oc_per_g && ic < ic_per_g) {
+            const dim_t kw = k % jcp.kw;
+            const dim_t kh = (k / jcp.kw) % jcp.kh;
+            const dim_t kd = k / (jcp.kw * jcp.kh);
+            const dim_t off = g_off + oc * oc_stride + ic * ic_stride
+                    + kd * kd_stride + kh * kh_stride + kw * kw_stride;
+            w = io::load_float_value(jcp.orig_wei_dt, wei, off);
+            if (with_zero_points)
+                w -= io::load_float_value(wei_zero_points.get_data_type(),
+                        zero_points, qparam_off(wei_zero_points, oc, ic));
+            if (with_scales)
+                w *= io::load_float_value(wei_scales.get_data_type(), scales,
+                        qparam_off(wei_scales, oc, ic));
+        }
+        io::store_float_value(jcp.wei_dt, w, wei_block, idx);
+    }
+}
+
 void balance_bwd_w(jit_brgemm_conv_conf_t &jcp) {
 
     const auto os_chunks = jcp.nthr_mb_work;
@@ -56,6 +56,18 @@ void set_amx_wsp_per_thread(jit_brgemm_conv_conf_t &jcp);
 void init_scratchpad(memory_tracking::registrar_t &scratchpad,
         const jit_brgemm_conv_conf_t &jcp);
 
+// Weights decompression: a thread dequantizes the weights of one group and one
+// block of output channels at a time into its own buffer of `wei_ocb_size`
+// elements, which is then consumed by brgemm kernels as regular weights.
+// Compressed weights are plain, the decompressed block has the `jcp.wei_tag`
+// layout.
+void book_wei_decompression_buffer(memory_tracking::registrar_t &scratchpad,
+        const jit_brgemm_conv_conf_t &jcp, dim_t wei_ocb_size);
+void decompress_wei_block(const jit_brgemm_conv_conf_t &jcp,
+        const memory_desc_wrapper &wei_d, const primitive_attr_t *attr,
+        const char *wei, const void *scales, const void *zero_points, int g,
+        int ocb, dim_t wei_ocb_size, char *wei_block);
+
 status_t init_conf_bwd_w(jit_brgemm_conv_conf_t &jcp,
         const convolution_desc_t &cd, memory_desc_t &src_md,
         memory_desc_t &diff_weights_md, memory_desc_t &diff_bias_md,
@@ -0,0 +1,485 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <math.h>
+
+#include "common/bfloat16.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/jit_brgemm_sdpa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+
+namespace {
+
+// Blocks are sized for the per-thread buffers to fit into L2 for the common
+// head sizes.
+constexpr dim_t max_q_blk = 32;
+constexpr dim_t max_k_blk = 64;
+
+template <typename data_t>
+void cvt_to_f32(float *out, const data_t *inp, dim_t stride, dim_t n) {
+    for (dim_t i = 0; i < n; i++)
+        out[i] = static_cast<float>(inp[i * stride]);
+}
+
+// Converts `n` elements of type `dt` located at `off + i * stride` to f32.
+void cvt_to_f32(float *out, data_type_t dt, const void *inp, dim_t off,
+        dim_t stride, dim_t n) {
+    switch (dt) {
+        case f32:
+            cvt_to_f32(out, static_cast<const float *>(inp) + off, stride, n);
+            break;
+        case bf16:
+            if (stride == 1)
+                cvt_bfloat16_to_float(
+                        out, static_cast<const bfloat16_t *>(inp) + off, n);
+            else
+                cvt_to_f32(out, static_cast<const bfloat16_t *>(inp) + off,
+                        stride, n);
+            break;
+        case f16:
+            if (stride == 1)
+                cvt_float16_to_float(
+                        out, static_cast<const float16_t *>(inp) + off, n);
+            else
+                cvt_to_f32(out, static_cast<const float16_t *>(inp) + off,
+                        stride, n);
+            break;
+        case s8:
+            cvt_to_f32(out, static_cast<const int8_t *>(inp) + off, stride, n);
+            break;
+        case u8:
+            cvt_to_f32(out, static_cast<const uint8_t *>(inp) + off, stride, n);
+            break;
+        default:
+            for (dim_t i = 0; i < n; i++)
+                out[i] = io::load_float_value(dt, inp, off + i * stride);
+    }
+}
+
+// Converts `n` f32 elements to type `dt` located at `off + i * stride`.
+void cvt_from_f32(void *out, data_type_t dt, dim_t off, dim_t stride,
+        const float *inp, dim_t n) {
+    if (stride == 1 && dt == bf16) {
+        cvt_float_to_bfloat16(static_cast<bfloat16_t *>(out) + off, inp, n);
+    } else if (stride == 1 && dt == f16) {
+        cvt_float_to_float16(static_cast<float16_t *>(out) + off, inp, n);
+    } else {
+        for (dim_t i = 0; i < n; i++)
+            io::store_float_value(dt, inp[i], out, off + i * stride);
+    }
+}
+
+} // namespace
+
+status_t brgemm_sdpa_t::pd_t::init(engine_t *engine) {
+    CHECK(init_common(engine));
+
+    isa_ = mayiuse(avx512_core) ? avx512_core
+            : mayiuse(avx2)     ? avx2
+                                : isa_undef;
+    VDISPATCH_SDPA(isa_ != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+
+    const dim_t Q = desc()->queries();
+    const dim_t K = desc()->keys();
+    const dim_t D = desc()->head_size();
+    const dim_t V = desc()->values();
+    q_blk_ = nstl::min(Q, max_q_blk);
+    k_blk_ = nstl::min(K, max_k_blk);
+
+    CHECK(init_brgemm(kq_desc_, q_blk_, k_blk_, D, 0.f));
+    CHECK(init_brgemm(vs_desc_, q_blk_, V, k_blk_, 1.f));
+
+    init_scratchpad();
+    return status::success;
+}
+
+status_t brgemm_sdpa_t::pd_t::init_brgemm(
+        brgemm_desc_t &brg, dim_t M, dim_t N, dim_t K, float beta) {
+    CHECK(brgemm_desc_init(&brg, isa_, brgemm_addr, f32, f32,
+            /* transA = */ false, /* transB = */ false, brgemm_row_major,
+            /* alpha = */ 1.f, beta, /* LDA = */ K, /* LDB = */ N,
+            /* LDC = */ N, M, N, K));
+
+    brgemm_attr_t brgattr;
+    brgattr.max_bs = 1;
+    CHECK(brgemm_desc_set_attr(&brg, brgattr));
+    CHECK(brgemm_desc_finalize(&brg));
+    return status::success;
+}
+
+void brgemm_sdpa_t::pd_t::init_scratchpad() {
+    const dim_t D = desc()->head_size();
+    const dim_t V = desc()->values();
+    // Buffers are cache line aligned.
+    auto align = [](dim_t size) { return utils::rnd_up(size, 16); };
+
+    qry_buf_size_ = align(q_blk_ * D);
+    key_buf_size_ = align(D * k_blk_);
+    val_buf_size_ = align(k_blk_ * V);
+    scores_buf_size_ = align(q_blk_ * k_blk_);
+    acc_buf_size_ = align(q_blk_ * V);
+    stats_buf_size_ = align(2 * q_blk_);
+    tmp_buf_size_ = align(nstl::max(nstl::max(D, V), k_blk_));
+    thr_buf_size_ = qry_buf_size_ + key_buf_size_ + val_buf_size_
+            + scores_buf_size_ + acc_buf_size_ + stats_buf_size_
+            + tmp_buf_size_;
+
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(
+            key_sdpa_tiles, thr_buf_size_ * dnnl_get_max_threads());
+}
+
+status_t brgemm_sdpa_t::init(engine_t *engine) {
+    brgemm_kernel_t *ker = nullptr;
+    CHECK(brgemm_kernel_create(&ker, pd()->kq_desc_));
+    CHECK(safe_ptr_assign(kq_kernel_, ker));
+    CHECK(brgemm_kernel_create(&ker, pd()->vs_desc_));
+    CHECK(safe_ptr_assign(vs_kernel_, ker));
+    return status::success;
+}
+
+status_t brgemm_sdpa_t::execute(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    auto qry = CTX_IN_MEM(const void *, DNNL_ARG_QUERIES);
+    auto key = CTX_IN_MEM(const void *, DNNL_ARG_KEYS);
+    auto val = CTX_IN_MEM(const void *, DNNL_ARG_VALUES);
+    auto msk = CTX_IN_MEM(const void *, DNNL_ARG_ATTN_MASK);
+    auto block_table = CTX_IN_MEM(const int32_t *, DNNL_ARG_BLOCK_TABLE);
+    auto scale_ptr = CTX_IN_MEM(const void *, DNNL_ARG_SCALE);
+    auto key_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_KEYS);
+    auto key_zp = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_KEYS);
+    auto val_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_VALUES);
+    auto val_zp = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const auto *pd = this->pd();
+    const auto *d = pd->desc();
+    const memory_desc_wrapper qry_d(pd->qry_md());
+    const memory_desc_wrapper key_d(pd->key_md());
+    const memory_desc_wrapper val_d(pd->val_md());
+    const memory_desc_wrapper dst_d(pd->dst_md());
+    const memory_desc_wrapper msk_d(pd->attn_mask_md());
+    const memory_desc_wrapper bt_d(pd->block_table_md());
+
+    const dim_t MB = qry_d.dims()[0];
+    const dim_t H = qry_d.dims()[1];
+    const dim_t Q = d->queries();
+    const dim_t K = d->keys();
+    const dim_t D = d->head_size();
+    const dim_t V = d->values();
+    const dim_t q_blk = pd->q_blk_;
+    const dim_t k_blk = pd->k_blk_;
+    const dim_t nb_q = utils::div_up(Q, q_blk);
+    const dim_t kv_group = pd->kv_group_size();
+    const bool paged = pd->with_block_table();
+    const dim_t page_size = d->page_size();
+
+    const bool with_mask = pd->with_attn_mask() && !pd->with_causal_mask();
+    const bool with_key_quant = pd->with_key_scales() || pd->with_key_zp();
+    const bool with_val_quant = pd->with_value_scales() || pd->with_value_zp();
+    const bool inf_as_zero
+            = d->softmax_alg == alg_kind::softmax_accurate_inf_as_zero;
+
+    float scale = 1.f;
+    if (pd->with_attn_scale()) {
+        scale = io::load_float_value(d->scale_dt, scale_ptr, 0);
+        if (d->invert_scale) scale = 1.f / scale;
+    }
+
+    const auto &qs = qry_d.blocking_desc().strides;
+    const auto &ks = key_d.blocking_desc().strides;
+    const auto &vs = val_d.blocking_desc().strides;
+    const auto &ds = dst_d.blocking_desc().strides;
+
+    // Returns the number of keys a query attends to. It doesn't decrease
+    // with the query index, so the last query of a block bounds the keys
+    // processed for the whole block.
+    auto num_keys = [&](dim_t q) {
+        if (d->mask_type == attn_mask_type::top_left)
+            return nstl::min(K, q + 1);
+        if (d->mask_type == attn_mask_type::bottom_right)
+            return nstl::max(dim_t(0), nstl::min(K, q + K - Q + 1));
+        return K;
+    };
+
+    auto dequantize = [&](float &v, const void *scales, data_type_t scales_dt,
+                              const sdpa_quant_t &scales_q, bool with_scales,
+                              const void *zp, data_type_t zp_dt,
+                              const sdpa_quant_t &zp_q, bool with_zp, dim_t d0,
+                              dim_t d1, dim_t d2, dim_t d3) {
+        if (with_zp)
+            v -= io::load_int_value(zp_dt, zp, zp_q.off(d0, d1, d2, d3));
+        if (with_scales)
+            v *= io::load_float_value(
+                    scales_dt, scales, scales_q.off(d0, d1, d2, d3));
+    };
+
+    // Returns the length of the run of keys starting at key `k` of batch `mb`
+    // that are stored contiguously, up to `n` keys. The position of the run in
+    // the keys and values tensors is returned in `kmb`, `vmb` and `kk`, with
+    // negative batches for keys in absent pages.
+    auto locate_run = [&](dim_t mb, dim_t k, dim_t n, dim_t &kmb, dim_t &vmb,
+                              dim_t &kk) {
+        if (!paged) {
+            kmb = mb % key_d.dims()[0];
+            vmb = mb % val_d.dims()[0];
+            kk = k;
+            return n;
+        }
+        const dim_t page = block_table[bt_d.off(mb, k / page_size)];
+        const bool absent = page < 0 || page >= key_d.dims()[0];
+        kmb = vmb = absent ? -1 : page;
+        kk = k % page_size;
+        return nstl::min(n, page_size - kk);
+    };
+
+    // Keys are stored as D x k_blk. The tail of the block and keys of absent
+    // pages are zeroed so that the corresponding scores stay finite until they
+    // are masked out.
+    auto load_keys = [&](float *buf, float *tmp, dim_t mb, dim_t h, dim_t k0,
+                             dim_t nk) {
+        if (nk < k_blk)
+            for (dim_t i = 0; i < D; i++)
+                utils::array_set(buf + i * k_blk + nk, 0.f, k_blk - nk);
+        dim_t kmb, vmb, kk;
+        for (dim_t j = 0, n = 0; j < nk; j += n) {
+            n = locate_run(mb, k0 + j, nk - j, kmb, vmb, kk);
+            if (kmb < 0) {
+                for (dim_t i = 0; i < D; i++)
+                    utils::array_set(buf + i * k_blk + j, 0.f, n);
+                continue;
+            }
+            const dim_t base = key_d.offset0() + kmb * ks[0] + h * ks[1];
+            if (ks[3] <= ks[2]) {
+                for (dim_t i = 0; i < D; i++)
+                    cvt_to_f32(buf + i * k_blk + j, key_d.data_type(), key,
+                            base + i * ks[2] + kk * ks[3], ks[3], n);
+            } else {
+                for (dim_t jj = 0; jj < n; jj++) {
+                    cvt_to_f32(tmp, key_d.data_type(), key,
+                            base + (kk + jj) * ks[3], ks[2], D);
+                    for (dim_t i = 0; i < D; i++)
+                        buf[i * k_blk + j + jj] = tmp[i];
+                }
+            }
+            if (!with_key_quant) continue;
+            for (dim_t i = 0; i < D; i++)
+                for (dim_t jj = 0; jj < n; jj++)
+                    dequantize(buf[i * k_blk + j + jj], key_scales,
+                            pd->key_scales_dt(), pd->key_scales(),
+                            pd->with_key_scales(), key_zp, pd->key_zp_dt(),
+                            pd->key_zp(), pd->with_key_zp(), kmb, h, i,
+                            kk + jj);
+        }
+    };
+
+    // Values are stored as k_blk x V. The tail of the block and values of
+    // absent pages are zeroed as they are multiplied by zero probabilities.
+    auto load_values = [&](float *buf, float *tmp, dim_t mb, dim_t h,
+                               dim_t k0, dim_t nk) {
+        if (nk < k_blk) utils::array_set(buf + nk * V, 0.f, (k_blk - nk) * V);
+        dim_t kmb, vmb, kk;
+        for (dim_t j = 0, n = 0; j < nk; j += n) {
+            n = locate_run(mb, k0 + j, nk - j, kmb, vmb, kk);
+            if (vmb < 0) {
+                utils::array_set(buf + j * V, 0.f, n * V);
+                continue;
+            }
+            const dim_t base = val_d.offset0() + vmb * vs[0] + h * vs[1];
+            if (vs[3] <= vs[2]) {
+                for (dim_t jj = 0; jj < n; jj++)
+                    cvt_to_f32(buf + (j + jj) * V, val_d.data_type(), val,
+                            base + (kk + jj) * vs[2], vs[3], V);
+            } else {
+                for (dim_t i = 0; i < V; i++) {
+                    cvt_to_f32(tmp, val_d.data_type(), val,
+                            base + i * vs[3] + kk * vs[2], vs[2], n);
+                    for (dim_t jj = 0; jj < n; jj++)
+                        buf[(j + jj) * V + i] = tmp[jj];
+                }
+            }
+            if (!with_val_quant) continue;
+            for (dim_t jj = 0; jj < n; jj++)
+                for (dim_t i = 0; i < V; i++)
+                    dequantize(buf[(j + jj) * V + i], val_scales,
+                            pd->value_scales_dt(), pd->value_scales(),
+                            pd->with_value_scales(), val_zp,
+                            pd->value_zp_dt(), pd->value_zp(),
+                            pd->with_value_zp(), vmb, h, kk + jj, i);
+        }
+    };
+
+    // Scores of keys in absent pages are masked out.
+    auto mask_absent_keys = [&](float *scores, dim_t mb, dim_t k0, dim_t nk) {
+        if (!paged) return;
+        dim_t kmb, vmb, kk;
+        for (dim_t j = 0, n = 0; j < nk; j += n) {
+            n = locate_run(mb, k0 + j, nk - j, kmb, vmb, kk);
+            if (kmb >= 0) continue;
+            for (dim_t r = 0; r < q_blk; r++)
+                utils::array_set(scores + r * k_blk + j, -INFINITY, n);
+        }
+    };
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    float *tiles = scratchpad.template get<float>(key_sdpa_tiles);
+
+    parallel(0, [&](int ithr, int nthr) {
+        float *qry_buf = tiles + ithr * pd->thr_buf_size_;
+        float *key_buf = qry_buf + pd->qry_buf_size_;
+        float *val_buf = key_buf + pd->key_buf_size_;
+        float *scores_buf = val_buf + pd->val_buf_size_;
+        float *acc_buf = scores_buf + pd->scores_buf_size_;
+        float *row_max = acc_buf + pd->acc_buf_size_;
+        float *row_sum = row_max + q_blk;
+        float *tmp_buf = row_max + pd->stats_buf_size_;
+
+        brgemm_batch_element_t batch;
+
+        for_nd(ithr, nthr, MB, H, nb_q, [&](dim_t mb, dim_t h, dim_t qb) {
+            const dim_t q0 = qb * q_blk;
+            const dim_t nq = nstl::min(q_blk, Q - q0);
+            const dim_t kv_h = h / kv_group;
+
+            // The attention scale is applied to the queries, rows past the
+            // end are zeroed so that their scores stay finite.
+            for (dim_t r = 0; r < q_blk; r++) {
+                float *row = qry_buf + r * D;
+                if (r >= nq) {
+                    utils::array_set(row, 0.f, D);
+                    continue;
+                }
+                cvt_to_f32(row, qry_d.data_type(), qry,
+                        qry_d.offset0() + mb * qs[0] + h * qs[1]
+                                + (q0 + r) * qs[2],
+                        qs[3], D);
+                if (scale != 1.f)
+                    for (dim_t i = 0; i < D; i++)
+                        row[i] *= scale;
+            }
+            utils::array_set(row_max, -INFINITY, q_blk);
+            utils::array_set(row_sum, 0.f, q_blk);
+            utils::array_set(acc_buf, 0.f, q_blk * V);
+
+            const dim_t nk_total = num_keys(q0 + nq - 1);
+            for (dim_t k0 = 0; k0 < nk_total; k0 += k_blk) {
+                const dim_t nk = nstl::min(k_blk, nk_total - k0);
+
+                load_keys(key_buf, tmp_buf, mb, kv_h, k0, nk);
+                batch.ptr.A = qry_buf;
+                batch.ptr.B = key_buf;
+                brgemm_kernel_execute(kq_kernel_.get(), 1, &batch, scores_buf);
+                mask_absent_keys(scores_buf, mb, k0, nk);
+
+                // Online softmax: probabilities of the block are computed
+                // against the running maximum, and the accumulated output is
+                // rescaled whenever the maximum grows.
+                for (dim_t r = 0; r < q_blk; r++) {
+                    float *s = scores_buf + r * k_blk;
+                    const dim_t row_nk = r < nq
+                            ? nstl::max(dim_t(0),
+                                    nstl::min(nk, num_keys(q0 + r) - k0))
+                            : 0;
+                    if (with_mask && row_nk > 0) {
+                        const dim_t msk_off = msk_d.offset0()
+                                + (mb % msk_d.dims()[0]) * msk_d.strides()[0]
+                                + (h % msk_d.dims()[1]) * msk_d.strides()[1]
+                                + (msk_d.dims()[2] == 1 ? 0 : q0 + r)
+                                        * msk_d.strides()[2]
+                                + k0 * msk_d.strides()[3];
+                        cvt_to_f32(tmp_buf, msk_d.data_type(), msk, msk_off,
+                                msk_d.strides()[3], row_nk);
+                        for (dim_t j = 0; j < row_nk; j++)
+                            s[j] += tmp_buf[j];
+                    }
+
+                    float s_max = row_max[r];
+                    for (dim_t j = 0; j < row_nk; j++)
+                        s_max = nstl::max(s_max, s[j]);
+                    if (s_max == -INFINITY) {
+                        utils::array_set(s, 0.f, k_blk);
+                        continue;
+                    }
+
+                    float s_sum = 0.f;
+                    for (dim_t j = 0; j < row_nk; j++) {
+                        s[j] = expf(s[j] - s_max);
+                        s_sum += s[j];
+                    }
+                    if (row_nk < k_blk)
+                        utils::array_set(s + row_nk, 0.f, k_blk - row_nk);
+
+                    const float alpha = expf(row_max[r] - s_max);
+                    if (alpha != 1.f) {
+                        float *acc = acc_buf + r * V;
+                        for (dim_t i = 0; i < V; i++)
+                            acc[i] *= alpha;
+                    }
+                    row_sum[r] = row_sum[r] * alpha + s_sum;
+                    row_max[r] = s_max;
+                }
+
+                load_values(val_buf, tmp_buf, mb, kv_h, k0, nk);
+                batch.ptr.A = scores_buf;
+                batch.ptr.B = val_buf;
+                brgemm_kernel_execute(vs_kernel_.get(), 1, &batch, acc_buf);
+            }
+
+            // Keys masked out entirely give a zero sum, so the output turns
+            // into NaN unless infinities are treated as zeros.
+            for (dim_t r = 0; r < nq; r++) {
+                float *acc = acc_buf + r * V;
+                const float norm = row_sum[r] > 0.f ? 1.f / row_sum[r]
+                        : inf_as_zero               ? 0.f
+                                                    : NAN;
+                for (dim_t i = 0; i < V; i++)
+                    acc[i] *= norm;
+                cvt_from_f32(dst, dst_d.data_type(),
+                        dst_d.offset0() + mb * ds[0] + h * ds[1]
+                                + (q0 + r) * ds[2],
+                        ds[3], acc, V);
+            }
+        });
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,95 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_SDPA_HPP
+#define CPU_X64_JIT_BRGEMM_SDPA_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_sdpa_pd.hpp"
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Flash attention: every thread processes a block of queries of one head and
+// streams the keys and values through it in blocks. Scores of a block are
+// computed with a brgemm kernel and folded into the output with the online
+// softmax, so memory for scores doesn't depend on the number of keys. Keys
+// and values of any supported data type are converted to f32 block by block,
+// which also gathers them from pages when they are paged.
+struct brgemm_sdpa_t : public primitive_t {
+    struct pd_t : public cpu_sdpa_pd_t {
+        using cpu_sdpa_pd_t::cpu_sdpa_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg:", isa_, ""),
+                brgemm_sdpa_t);
+
+        status_t init(engine_t *engine);
+
+        // Sizes of the blocks of queries and keys.
+        dim_t q_blk_ = 0;
+        dim_t k_blk_ = 0;
+        // Sizes of the per-thread buffers, in floats.
+        dim_t qry_buf_size_ = 0;
+        dim_t key_buf_size_ = 0;
+        dim_t val_buf_size_ = 0;
+        dim_t scores_buf_size_ = 0;
+        dim_t acc_buf_size_ = 0;
+        dim_t stats_buf_size_ = 0;
+        dim_t tmp_buf_size_ = 0;
+        dim_t thr_buf_size_ = 0;
+
+        cpu_isa_t isa_ = isa_undef;
+        // Scores = Q x K and Acc += P x V, in f32.
+        brgemm_desc_t kq_desc_;
+        brgemm_desc_t vs_desc_;
+
+    private:
+        status_t init_brgemm(brgemm_desc_t &brg, dim_t M, dim_t N, dim_t K,
+                float beta);
+        void init_scratchpad();
+    };
+
+    brgemm_sdpa_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> kq_kernel_;
+    std::unique_ptr<brgemm_kernel_t> vs_kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,537 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/packed_weights_cache.hpp"
+#include "common/primitive_hashing.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/jit_brgemm_wino_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+
+constexpr int max_alpha = 8;
+// Number of channels transformed at a time.
+constexpr int simd_w = 16;
+
+// Transformation matrices of F(4x4, 3x3) and F(6x6, 3x3) with the
+// interpolation points 0, +-1, +-2 and 0, +-1, +-2, +-1/2 respectively, see
+// A. Lavin and S. Gray, "Fast Algorithms for Convolutional Neural Networks".
+struct wino_matrices_t {
+    float BT[max_alpha][max_alpha];
+    float G[max_alpha][3];
+    float AT[max_alpha - 2][max_alpha];
+};
+
+const wino_matrices_t &get_matrices(int m) {
+    static const wino_matrices_t f4 = {
+            {
+                    {4.f, 0.f, -5.f, 0.f, 1.f, 0.f},
+                    {0.f, -4.f, -4.f, 1.f, 1.f, 0.f},
+                    {0.f, 4.f, -4.f, -1.f, 1.f, 0.f},
+                    {0.f, -2.f, -1.f, 2.f, 1.f, 0.f},
+                    {0.f, 2.f, -1.f, -2.f, 1.f, 0.f},
+                    {0.f, 4.f, 0.f, -5.f, 0.f, 1.f},
+            },
+            {
+                    {1.f / 4, 0.f, 0.f},
+                    {-1.f / 6, -1.f / 6, -1.f / 6},
+                    {-1.f / 6, 1.f / 6, -1.f / 6},
+                    {1.f / 24, 1.f / 12, 1.f / 6},
+                    {1.f / 24, -1.f / 12, 1.f / 6},
+                    {0.f, 0.f, 1.f},
+            },
+            {
+                    {1.f, 1.f, 1.f, 1.f, 1.f, 0.f},
+                    {0.f, 1.f, -1.f, 2.f, -2.f, 0.f},
+                    {0.f, 1.f, 1.f, 4.f, 4.f, 0.f},
+                    {0.f, 1.f, -1.f, 8.f, -8.f, 1.f},
+            },
+    };
+    static const wino_matrices_t f6 = {
+            {
+                    {1.f, 0.f, -21.f / 4, 0.f, 21.f / 4, 0.f, -1.f, 0.f},
+                    {0.f, 1.f, 1.f, -17.f / 4, -17.f / 4, 1.f, 1.f, 0.f},
+                    {0.f, -1.f, 1.f, 17.f / 4, -17.f / 4, -1.f, 1.f, 0.f},
+                    {0.f, 1.f / 2, 1.f / 4, -5.f / 2, -5.f / 4, 2.f, 1.f, 0.f},
+                    {0.f, -1.f / 2, 1.f / 4, 5.f / 2, -5.f / 4, -2.f, 1.f, 0.f},
+                    {0.f, 2.f, 4.f, -5.f / 2, -5.f, 1.f / 2, 1.f, 0.f},
+                    {0.f, -2.f, 4.f, 5.f / 2, -5.f, -1.f / 2, 1.f, 0.f},
+                    {0.f, -1.f, 0.f, 21.f / 4, 0.f, -21.f / 4, 0.f, 1.f},
+            },
+            {
+                    {1.f, 0.f, 0.f},
+                    {-2.f / 9, -2.f / 9, -2.f / 9},
+                    {-2.f / 9, 2.f / 9, -2.f / 9},
+                    {1.f / 90, 1.f / 45, 2.f / 45},
+                    {1.f / 90, -1.f / 45, 2.f / 45},
+                    {32.f / 45, 16.f / 45, 8.f / 45},
+                    {32.f / 45, -16.f / 45, 8.f / 45},
+                    {0.f, 0.f, 1.f},
+            },
+            {
+                    {1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 0.f},
+                    {0.f, 1.f, -1.f, 2.f, -2.f, 1.f / 2, -1.f / 2, 0.f},
+                    {0.f, 1.f, 1.f, 4.f, 4.f, 1.f / 4, 1.f / 4, 0.f},
+                    {0.f, 1.f, -1.f, 8.f, -8.f, 1.f / 8, -1.f / 8, 0.f},
+                    {0.f, 1.f, 1.f, 16.f, 16.f, 1.f / 16, 1.f / 16, 0.f},
+                    {0.f, 1.f, -1.f, 32.f, -32.f, 1.f / 32, -1.f / 32, 1.f},
+            },
+    };
+    return m == 4 ? f4 : f6;
+}
+
+// Number of multiplications per output point relative to the tiles
+// covering the destination.
+dim_t wino_cost(int m, dim_t oh, dim_t ow) {
+    return div_up(oh, m) * div_up(ow, m) * (m + 2) * (m + 2);
+}
+
+float load_float(data_type_t dt, const void *ptr, dim_t idx) {
+    if (dt == bf16) return static_cast<const bfloat16_t *>(ptr)[idx];
+    return static_cast<const float *>(ptr)[idx];
+}
+
+void store_float(data_type_t dt, void *ptr, dim_t idx, float val) {
+    if (dt == bf16)
+        static_cast<bfloat16_t *>(ptr)[idx] = val;
+    else
+        static_cast<float *>(ptr)[idx] = val;
+}
+
+} // namespace
+
+status_t brgemm_wino_convolution_fwd_t::pd_t::init(engine_t *engine) {
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    const bool is_f32 = expect_data_types(f32, f32, f32, f32, f32);
+    const bool is_bf16
+            = expect_data_types(bf16, bf16, data_type::undef,
+                      data_type::undef, f32)
+            && one_of(invariant_dst_md()->data_type, bf16, f32)
+            && IMPLICATION(with_bias(),
+                    one_of(invariant_bia_md()->data_type, bf16, f32));
+
+    VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(one_of(desc()->alg_kind, alg_kind::convolution_winograd,
+                           alg_kind::convolution_auto),
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_CONV(is_f32 || is_bf16, VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_CONV(is_f32 ? mayiuse(avx2) : mayiuse(avx512_core),
+            VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_CONV(attr()->has_default_values(skip_mask_t::post_ops,
+                           invariant_dst_md()->data_type),
+            VERBOSE_UNSUPPORTED_ATTR);
+
+    const auto &po = attr()->post_ops_;
+    VDISPATCH_CONV(po.has_default_values({primitive_kind::eltwise,
+                           primitive_kind::sum})
+                    && po.check_sum_consistency(
+                            invariant_dst_md()->data_type, false),
+            VERBOSE_UNSUPPORTED_POSTOP);
+
+    VDISPATCH_CONV(ndims() == 4 && !with_groups(), VERBOSE_BAD_NDIMS,
+            "src", ndims());
+    VDISPATCH_CONV(KH() == 3 && KW() == 3 && KSH() == 1 && KSW() == 1
+                    && KDH() == 0 && KDW() == 0,
+            VERBOSE_UNSUPPORTED_FEATURE, "only 3x3 stride 1 kernels");
+    VDISPATCH_CONV(everyone_is(true, 0 <= padT(), padT() <= 1, 0 <= padL(),
+                           padL() <= 1, 0 <= padB(), padB() <= 1,
+                           0 <= padR(), padR() <= 1),
+            VERBOSE_UNSUPPORTED_PAD_FEATURE, "padding greater than 1");
+
+    VDISPATCH_CONV(set_default_formats_common(format_tag::nhwc,
+                           format_tag::hwio, format_tag::nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    VDISPATCH_CONV(src_d.matches_tag(format_tag::nhwc)
+                    && dst_d.matches_tag(format_tag::nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(wei_d.is_plain() && !wei_d.has_runtime_dims_or_strides(),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    const bool is_auto = desc()->alg_kind == alg_kind::convolution_auto;
+    CHECK(init_conf(is_auto));
+    VDISPATCH_CONV(set_default_alg_kind(alg_kind::convolution_winograd),
+            VERBOSE_BAD_ALGORITHM);
+
+    init_scratchpad();
+    return status::success;
+}
+
+status_t brgemm_wino_convolution_fwd_t::pd_t::init_conf(bool is_auto) {
+    auto &jcp = jcp_;
+    jcp.src_dt = invariant_src_md()->data_type;
+    jcp.wei_dt = invariant_wei_md()->data_type;
+    jcp.dst_dt = invariant_dst_md()->data_type;
+    jcp.bia_dt = with_bias() ? invariant_bia_md()->data_type : data_type::undef;
+    jcp.isa = mayiuse(avx512_core) ? avx512_core : avx2;
+
+    jcp.mb = MB();
+    jcp.ic = IC();
+    jcp.oc = OC();
+    jcp.ih = IH();
+    jcp.iw = IW();
+    jcp.oh = OH();
+    jcp.ow = OW();
+    jcp.t_pad = padT();
+    jcp.l_pad = padL();
+    jcp.with_bias = with_bias();
+    const auto &po = attr()->post_ops_;
+    jcp.with_sum = po.find(primitive_kind::sum) >= 0;
+    jcp.with_post_ops = po.len() > 0;
+
+    // Winograd pays off for convolutions with many channels, while for the
+    // others the direct implementations are preferred with the automatic
+    // algorithm selection. bf16 is computed in f32, which is slower than the
+    // direct bf16 implementations, so it is used only when requested.
+    const bool is_big_enough = jcp.ic >= 64 && jcp.oc >= 64 && jcp.oh >= 8
+            && jcp.ow >= 8;
+    VDISPATCH_CONV_IC(
+            IMPLICATION(is_auto, is_big_enough && jcp.wei_dt == f32),
+            VERBOSE_IMPL_HEURISTIC_FAIL, "direct convolution is preferred");
+
+    jcp.m = wino_cost(6, jcp.oh, jcp.ow) < wino_cost(4, jcp.oh, jcp.ow)
+            ? 6
+            : 4;
+    jcp.alpha = jcp.m + 2;
+    jcp.tiles_h = div_up(jcp.oh, jcp.m);
+    jcp.tiles_w = div_up(jcp.ow, jcp.m);
+    jcp.ntiles = jcp.mb * jcp.tiles_h * jcp.tiles_w;
+    jcp.nthr = dnnl_get_max_threads();
+
+    // Transformed tiles of a block and the results of their multiplication
+    // should stay in L2.
+    const dim_t alpha2 = jcp.alpha * jcp.alpha;
+    const dim_t tile_bytes = alpha2 * (jcp.ic + jcp.oc) * sizeof(float);
+    const dim_t l2 = platform::get_per_core_cache_size(2);
+    jcp.tile_block = saturate<dim_t>(8, 64, l2 / 2 / tile_bytes);
+    jcp.tile_block = nstl::max<dim_t>(1,
+            nstl::min(jcp.tile_block, div_up(jcp.ntiles, jcp.nthr)));
+    jcp.ntile_blocks = div_up(jcp.ntiles, jcp.tile_block);
+
+    const dim_t M_tail = jcp.ntiles % jcp.tile_block;
+    for (int i = 0; i < 2; i++) {
+        const dim_t M = i == 0 ? jcp.tile_block : M_tail;
+        if (M == 0) continue;
+        auto &brg = brg_descs_[i];
+        CHECK(brgemm_desc_init(&brg, jcp.isa, brgemm_addr, f32, f32, false,
+                false, brgemm_row_major, 1.f, 0.f, jcp.ic, jcp.oc, jcp.oc, M,
+                jcp.oc, jcp.ic));
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = 1;
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        CHECK(brgemm_desc_finalize(&brg));
+    }
+
+    return status::success;
+}
+
+void brgemm_wino_convolution_fwd_t::pd_t::init_scratchpad() {
+    const auto &jcp = jcp_;
+    auto scratchpad = scratchpad_registry().registrar();
+    const dim_t alpha2 = jcp.alpha * jcp.alpha;
+    scratchpad.book<float>(key_wino_U, alpha2 * jcp.ic * jcp.oc);
+    scratchpad.book<float>(
+            key_wino_V, jcp.nthr * alpha2 * jcp.tile_block * jcp.ic);
+    scratchpad.book<float>(
+            key_wino_M, jcp.nthr * alpha2 * jcp.tile_block * jcp.oc);
+}
+
+status_t brgemm_wino_convolution_fwd_t::init(engine_t *engine) {
+    const auto &jcp = pd()->jcp_;
+    for (int i = 0; i < 2; i++) {
+        const auto &brg = pd()->get_brg_desc(i);
+        if (brg.bcast_dim == 0) continue;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, brg));
+        CHECK(safe_ptr_assign(brg_kernels_[i], ker));
+    }
+    if (jcp.with_post_ops) {
+        CHECK(safe_ptr_assign(ref_post_ops_,
+                new ref_post_ops_t(pd()->attr()->post_ops_)));
+        CHECK(ref_post_ops_->init(pd()->dst_md()));
+    }
+    return status::success;
+}
+
+void brgemm_wino_convolution_fwd_t::transform_weights(
+        const char *wei, float *U) const {
+    const auto &jcp = pd()->jcp_;
+    const auto &mat = get_matrices(jcp.m);
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const int alpha = jcp.alpha;
+
+    parallel_nd(jcp.ic, jcp.oc, [&](dim_t ic, dim_t oc) {
+        float g[3][3];
+        for_(int kh = 0; kh < 3; kh++)
+        for (int kw = 0; kw < 3; kw++)
+            g[kh][kw] = load_float(
+                    jcp.wei_dt, wei, wei_d.blk_off(oc, ic, kh, kw));
+        float t[max_alpha][3];
+        for_(int i = 0; i < alpha; i++)
+        for (int j = 0; j < 3; j++) {
+            t[i][j] = 0.f;
+            for (int k = 0; k < 3; k++)
+                t[i][j] += mat.G[i][k] * g[k][j];
+        }
+        const dim_t off = ic * jcp.oc + oc;
+        for_(int i = 0; i < alpha; i++)
+        for (int j = 0; j < alpha; j++) {
+            float u = 0.f;
+            for (int k = 0; k < 3; k++)
+                u += t[i][k] * mat.G[j][k];
+            const dim_t p = i * alpha + j;
+            U[p * jcp.ic * jcp.oc + off] = u;
+        }
+    });
+}
+
+void brgemm_wino_convolution_fwd_t::transform_src(const char *src, float *V,
+        dim_t tile_start, dim_t ntiles) const {
+    const auto &jcp = pd()->jcp_;
+    const auto &mat = get_matrices(jcp.m);
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const int alpha = jcp.alpha;
+    const dim_t V_p_stride = jcp.tile_block * jcp.ic;
+
+    for (dim_t t = 0; t < ntiles; t++) {
+        dim_t n {0}, th {0}, tw {0};
+        nd_iterator_init(tile_start + t, n, jcp.mb, th, jcp.tiles_h, tw,
+                jcp.tiles_w);
+        const dim_t y0 = th * jcp.m - jcp.t_pad;
+        const dim_t x0 = tw * jcp.m - jcp.l_pad;
+
+        for (dim_t c0 = 0; c0 < jcp.ic; c0 += simd_w) {
+            const dim_t nc = nstl::min<dim_t>(simd_w, jcp.ic - c0);
+            float d[max_alpha][max_alpha][simd_w];
+            for_(int i = 0; i < alpha; i++)
+            for (int j = 0; j < alpha; j++) {
+                const dim_t y = y0 + i, x = x0 + j;
+                const bool inside
+                        = 0 <= y && y < jcp.ih && 0 <= x && x < jcp.iw;
+                const dim_t off = inside ? src_d.blk_off(n, c0, y, x) : 0;
+                for (int c = 0; c < simd_w; c++)
+                    d[i][j][c] = inside && c < nc
+                            ? load_float(jcp.src_dt, src, off + c)
+                            : 0.f;
+            }
+
+            // B^T d
+            float bd[max_alpha][max_alpha][simd_w];
+            for_(int i = 0; i < alpha; i++)
+            for (int j = 0; j < alpha; j++) {
+                PRAGMA_OMP_SIMD()
+                for (int c = 0; c < simd_w; c++)
+                    bd[i][j][c] = 0.f;
+                for (int k = 0; k < alpha; k++) {
+                    const float b = mat.BT[i][k];
+                    if (b == 0.f) continue;
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < simd_w; c++)
+                        bd[i][j][c] += b * d[k][j][c];
+                }
+            }
+
+            // (B^T d) B
+            for_(int i = 0; i < alpha; i++)
+            for (int j = 0; j < alpha; j++) {
+                float v[simd_w] = {};
+                for (int k = 0; k < alpha; k++) {
+                    const float b = mat.BT[j][k];
+                    if (b == 0.f) continue;
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < simd_w; c++)
+                        v[c] += b * bd[i][k][c];
+                }
+                const dim_t off
+                        = (i * alpha + j) * V_p_stride + t * jcp.ic + c0;
+                utils::array_copy(V + off, v, nc);
+            }
+        }
+    }
+}
+
+void brgemm_wino_convolution_fwd_t::transform_dst(const exec_ctx_t &ctx,
+        const float *M, const char *bias, char *dst, dim_t tile_start,
+        dim_t ntiles) const {
+    const auto &jcp = pd()->jcp_;
+    const auto &mat = get_matrices(jcp.m);
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const int alpha = jcp.alpha;
+    const int m = jcp.m;
+    const dim_t M_p_stride = jcp.tile_block * jcp.oc;
+
+    for (dim_t t = 0; t < ntiles; t++) {
+        dim_t n {0}, th {0}, tw {0};
+        nd_iterator_init(tile_start + t, n, jcp.mb, th, jcp.tiles_h, tw,
+                jcp.tiles_w);
+        const dim_t y0 = th * m;
+        const dim_t x0 = tw * m;
+
+        for (dim_t c0 = 0; c0 < jcp.oc; c0 += simd_w) {
+            const dim_t nc = nstl::min<dim_t>(simd_w, jcp.oc - c0);
+
+            // A^T M
+            float am[max_alpha - 2][max_alpha][simd_w];
+            for_(int i = 0; i < m; i++)
+            for (int j = 0; j < alpha; j++) {
+                PRAGMA_OMP_SIMD()
+                for (int c = 0; c < simd_w; c++)
+                    am[i][j][c] = 0.f;
+                for (int k = 0; k < alpha; k++) {
+                    const float a = mat.AT[i][k];
+                    if (a == 0.f) continue;
+                    const float *M_k = M + (k * alpha + j) * M_p_stride
+                            + t * jcp.oc + c0;
+                    for (int c = 0; c < nc; c++)
+                        am[i][j][c] += a * M_k[c];
+                }
+            }
+
+            float b[simd_w] = {};
+            if (jcp.with_bias) {
+                for (int c = 0; c < nc; c++)
+                    b[c] = load_float(jcp.bia_dt, bias, c0 + c);
+            }
+
+            // (A^T M) A
+            for_(int i = 0; i < m; i++)
+            for (int j = 0; j < m; j++) {
+                const dim_t y = y0 + i, x = x0 + j;
+                if (y >= jcp.oh || x >= jcp.ow) continue;
+                float res[simd_w];
+                PRAGMA_OMP_SIMD()
+                for (int c = 0; c < simd_w; c++)
+                    res[c] = b[c];
+                for (int k = 0; k < alpha; k++) {
+                    const float a = mat.AT[j][k];
+                    if (a == 0.f) continue;
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < simd_w; c++)
+                        res[c] += a * am[i][k][c];
+                }
+
+                const dim_t off = dst_d.blk_off(n, c0, y, x);
+                for (int c = 0; c < nc; c++) {
+                    if (jcp.with_post_ops) {
+                        ref_post_ops_t::args_t args;
+                        if (jcp.with_sum)
+                            args.dst_val
+                                    = load_float(jcp.dst_dt, dst, off + c);
+                        args.ctx = &ctx;
+                        ref_post_ops_->execute(res[c], args);
+                    }
+                    store_float(jcp.dst_dt, dst, off + c, res[c]);
+                }
+            }
+        }
+    }
+}
+
+status_t brgemm_wino_convolution_fwd_t::execute(const exec_ctx_t &ctx) const {
+    const auto &jcp = pd()->jcp_;
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto wei = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+
+    const dim_t alpha2 = jcp.alpha * jcp.alpha;
+    const dim_t U_p_stride = jcp.ic * jcp.oc;
+
+    // Transformed weights depend on the weights only, so they are shared
+    // with the following executions when the packed weights cache is on.
+    packed_weights_cache::buffer_t cached_U;
+    if (packed_weights_cache::is_enabled()) {
+        const packed_weights_cache::key_t key(wei,
+                {jcp.m, jcp.ic, jcp.oc, jcp.wei_dt,
+                        (dim_t)primitive_hashing::get_md_hash(
+                                *pd()->weights_md())});
+        cached_U = packed_weights_cache::get(key);
+        if (!cached_U) {
+            const uint64_t generation = packed_weights_cache::get_generation();
+            cached_U = packed_weights_cache::allocate(
+                    alpha2 * U_p_stride * sizeof(float));
+            if (cached_U) {
+                transform_weights(wei, (float *)cached_U.get());
+                packed_weights_cache::add(key, cached_U, generation);
+            }
+        }
+    }
+    const float *U = (const float *)cached_U.get();
+    if (!U) {
+        float *U_scratch = scratchpad.template get<float>(key_wino_U);
+        transform_weights(wei, U_scratch);
+        U = U_scratch;
+    }
+
+    float *V_base = scratchpad.template get<float>(key_wino_V);
+    float *M_base = scratchpad.template get<float>(key_wino_M);
+    const dim_t V_thr_size = alpha2 * jcp.tile_block * jcp.ic;
+    const dim_t M_thr_size = alpha2 * jcp.tile_block * jcp.oc;
+
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(jcp.ntile_blocks, nthr, ithr, start, end);
+        float *V = V_base + ithr * V_thr_size;
+        float *M = M_base + ithr * M_thr_size;
+
+        for (dim_t tb = start; tb < end; tb++) {
+            const dim_t tile_start = tb * jcp.tile_block;
+            const dim_t ntiles
+                    = nstl::min(jcp.tile_block, jcp.ntiles - tile_start);
+            const auto *ker
+                    = brg_kernels_[ntiles == jcp.tile_block ? 0 : 1].get();
+
+            transform_src(src, V, tile_start, ntiles);
+            for (dim_t p = 0; p < alpha2; p++) {
+                brgemm_batch_element_t batch;
+                batch.ptr.A = V + p * jcp.tile_block * jcp.ic;
+                batch.ptr.B = U + p * U_p_stride;
+                brgemm_kernel_execute(
+                        ker, 1, &batch, M + p * jcp.tile_block * jcp.oc);
+            }
+            transform_dst(ctx, M, bias, dst, tile_start, ntiles);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
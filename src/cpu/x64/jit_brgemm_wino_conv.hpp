@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_WINO_CONV_HPP
+#define CPU_X64_JIT_BRGEMM_WINO_CONV_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+#include "cpu/primitive_attr_postops.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Winograd F(m x m, 3 x 3) convolution. Every m x m tile of the destination
+// is computed from an alpha x alpha tile of the source, alpha = m + 2:
+//     Y = A^T [(G g G^T) * (B^T d B)] A,
+// where the elementwise product turns into alpha^2 independent matrix
+// multiplications over channels when accumulated across input channels. The
+// multiplications are done by brgemm for a block of tiles at a time.
+struct brgemm_wino_conf_t {
+    cpu_isa_t isa;
+    data_type_t src_dt, wei_dt, dst_dt, bia_dt;
+
+    dim_t mb, ic, oc, ih, iw, oh, ow;
+    dim_t t_pad, l_pad;
+    bool with_bias, with_sum, with_post_ops;
+
+    // Output tile size and input tile size.
+    int m, alpha;
+    dim_t tiles_h, tiles_w, ntiles;
+    // Number of tiles in a matrix multiplication and number of blocks of
+    // tiles.
+    dim_t tile_block, ntile_blocks;
+    int nthr;
+};
+
+struct brgemm_wino_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_wino:", jcp_.isa, ""),
+                brgemm_wino_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // Index 0 is the kernel for a full block of tiles, index 1 is the
+        // kernel for the last, possibly incomplete, block.
+        const brgemm_desc_t &get_brg_desc(int idx) const {
+            return brg_descs_[idx];
+        }
+
+        brgemm_wino_conf_t jcp_ = utils::zero<decltype(jcp_)>();
+
+    private:
+        status_t init_conf(bool is_auto);
+        void init_scratchpad();
+
+        brgemm_desc_t brg_descs_[2];
+    };
+
+    brgemm_wino_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // Computes G g G^T for every pair of channels into the layout expected
+    // by brgemm: [alpha^2][ic][oc]. The transforms and the multiplications
+    // are done in f32 for bf16 too, since rounding the transformed tiles to
+    // bf16 loses too much precision.
+    void transform_weights(const char *wei, float *U) const;
+    void transform_src(const char *src, float *V, dim_t tile_start,
+            dim_t ntiles) const;
+    void transform_dst(const exec_ctx_t &ctx, const float *M, const char *bias,
+            char *dst, dim_t tile_start, dim_t ntiles) const;
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[2];
+    std::unique_ptr<ref_post_ops_t> ref_post_ops_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -829,6 +829,10 @@ struct jit_brgemm_conv_conf_t {
     bool is_fp8_convert {false};
     bool is_f32_f16 {false};
     bool is_f32_bf16 {false};
+    // Integer weights of `orig_wei_dt` are dequantized into `wei_dt` with
+    // weights scales and zero-points before the computations.
+    bool with_wei_decompression {false};
+    data_type_t orig_wei_dt {data_type::undef};
     bool comp_with_vpads;
 
     int nthr_mb, nthr_g, nthr_oc_b, nthr_ic_b, nthr_oh;
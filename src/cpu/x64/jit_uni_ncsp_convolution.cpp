@@ -235,6 +235,12 @@ status_t jit_uni_ncsp_convolution_fwd_t::pd_t::init(engine_t *engine) {
     VDISPATCH_CONV(
             impl::is_dense_format_kind({src_md(), weights_md(), dst_md()}),
             VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    // Fused convolution and pooling post-ops change the destination shape,
+    // which the nested nspc convolution would not reflect in `dst_md_`.
+    const auto &po = attr()->post_ops_;
+    VDISPATCH_CONV(po.find(primitive_kind::convolution) == -1
+                    && po.find(primitive_kind::pooling) == -1,
+            VERBOSE_UNSUPPORTED_POSTOP);
 
     reduction_helper_ = reduction_helper_t(this);
     // TODO: Support attributes in matmul-based convolution.
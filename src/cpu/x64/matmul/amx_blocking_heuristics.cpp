@@ -952,6 +952,20 @@ void matmul_amx_blocking_params_micro_t::find_best_blocking(
     }
 }
 
+int matmul_amx_blocking_params_micro_t::get_runtime_M_chunk_size(
+        const brgemm_matmul_conf_t &bgmmc, dim_t M, int nthr) {
+    assert(bgmmc.is_runtime_M && !bgmmc.is_runtime_N);
+    // The chunk size selected at creation maximizes the reuse of the copied
+    // blocks of B, but for short sequences it leaves a single chunk of rows
+    // to the threads. Take the largest chunk that still gives work to every
+    // thread, the rows of the last chunk are processed by the tail kernels.
+    for (int m_ch_sz = bgmmc.M_chunk_size; m_ch_sz > 1; m_ch_sz--) {
+        const dim_t m_chunks = div_up(M, bgmmc.M_blk * m_ch_sz);
+        if (bgmmc.batch * m_chunks * bgmmc.N_chunks >= nthr) return m_ch_sz;
+    }
+    return 1;
+}
+
 void matmul_amx_blocking_params_micro_t::update_k_blocking_dependent_params() {
     k_chunk_elems_ = k_blk_ * k_chunk_size_ * brgemm_batch_size_;
     current_lda_ = get_actual_lda();
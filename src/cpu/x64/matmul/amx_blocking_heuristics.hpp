@@ -159,6 +159,11 @@ public:
             const brgemm_matmul_conf_utils_t &bm_conf_utils,
             matmul_amx_blocking_params_t &best_blocking);
 
+    // Selects the number of M blocks in a chunk once the runtime value of M
+    // is known. Meant to be called at execution, so it must stay cheap.
+    static int get_runtime_M_chunk_size(
+            const brgemm_matmul_conf_t &bgmmc, dim_t M, int nthr);
+
 protected:
     float calculate_blocking_scores() const override;
 
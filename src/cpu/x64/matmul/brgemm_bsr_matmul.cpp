@@ -0,0 +1,367 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "common/bfloat16.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive_hashing.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/matmul/brgemm_bsr_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+
+namespace {
+
+// The block of columns is sized for a row of the destination to fit into a
+// few vector registers of the kernel.
+constexpr dim_t max_n_blk = 64;
+
+// Copies the rows of every block of `blk_k` rows of the weights into VNNI
+// groups of `vnni` rows, padding the last group of the block with zeros.
+template <typename data_t>
+void pack_vnni(data_t *out, const data_t *inp, dim_t K, dim_t N, dim_t blk_k,
+        dim_t blk_k_padded, dim_t vnni) {
+    const dim_t nb_k = K / blk_k;
+    const dim_t ngroups = blk_k_padded / vnni;
+    parallel_nd(nb_k, ngroups, [&](dim_t kb, dim_t g) {
+        data_t *o = out + (kb * blk_k_padded + g * vnni) * N;
+        for (dim_t v = 0; v < vnni; v++) {
+            const dim_t k = g * vnni + v;
+            const data_t *i = inp + (kb * blk_k + k) * N;
+            for (dim_t n = 0; n < N; n++)
+                o[n * vnni + v] = k < blk_k ? i[n] : data_t(0);
+        }
+    });
+}
+
+// Computes sums of the columns over every block of `blk_k` rows of the
+// weights, multiplied by the shift of 128 that the kernel applies to s8
+// values of the source.
+void compute_s8s8_comp(
+        int32_t *comp, const int8_t *wei, dim_t K, dim_t N, dim_t blk_k) {
+    parallel_nd(K / blk_k, [&](dim_t kb) {
+        int32_t *c = comp + kb * N;
+        for (dim_t n = 0; n < N; n++)
+            c[n] = 0;
+        for (dim_t k = 0; k < blk_k; k++) {
+            const int8_t *w = wei + (kb * blk_k + k) * N;
+            for (dim_t n = 0; n < N; n++)
+                c[n] += w[n];
+        }
+        for (dim_t n = 0; n < N; n++)
+            c[n] *= 128;
+    });
+}
+
+} // namespace
+
+status_t brgemm_bsr_matmul_t::pd_t::init(engine_t *engine) {
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md(0));
+    const memory_desc_wrapper dst_d(dst_md());
+    const auto src_dt = src_d.data_type();
+    const auto wei_dt = wei_d.data_type();
+    const auto dst_dt = dst_d.data_type();
+
+    VDISPATCH_MATMUL(src_d.is_sparse_desc() && !wei_d.is_sparse_desc()
+                    && !dst_d.is_sparse_desc(),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(src_d.encoding() == sparse_encoding::bsr,
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(utils::everyone_is(s32, src_d.metadata_type(0),
+                             src_d.metadata_type(1)),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    const bool dt_ok = utils::everyone_is(f32, src_dt, wei_dt, dst_dt)
+            || (utils::everyone_is(bf16, src_dt, wei_dt)
+                    && utils::one_of(dst_dt, f32, bf16))
+            || (utils::one_of(src_dt, u8, s8) && wei_dt == s8
+                    && utils::one_of(dst_dt, s32, f32));
+    VDISPATCH_MATMUL(dt_ok, VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(
+            !has_runtime_dims_or_strides(), VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_MATMUL(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(formats_ok(), VERBOSE_UNSUPPORTED_TAG);
+
+    if (src_dt == f32)
+        isa_ = mayiuse(avx512_core) ? avx512_core
+                : mayiuse(avx2)     ? avx2
+                                    : isa_undef;
+    else if (src_dt == bf16)
+        isa_ = mayiuse(avx512_core_bf16) ? avx512_core_bf16 : isa_undef;
+    else
+        isa_ = mayiuse(avx512_core_vnni) ? avx512_core_vnni
+                : mayiuse(avx2_vnni)     ? avx2_vnni
+                                         : isa_undef;
+    VDISPATCH_MATMUL(isa_ != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+
+    blk_m_ = src_d.block_dims()[0];
+    blk_k_ = src_d.block_dims()[1];
+    vnni_ = static_cast<dim_t>(data_type_vnni_granularity(wei_dt));
+    blk_k_padded_ = utils::rnd_up(blk_k_, vnni_);
+    acc_dt_ = utils::one_of(src_dt, u8, s8) ? s32 : f32;
+    n_blk_ = nstl::min(N(), max_n_blk);
+
+    CHECK(init_brgemm(brg_desc_[0], n_blk_));
+    if (N() % n_blk_ != 0) CHECK(init_brgemm(brg_desc_[1], N() % n_blk_));
+
+    init_scratchpad();
+    return status::success;
+}
+
+bool brgemm_bsr_matmul_t::pd_t::formats_ok() const {
+    return memory_desc_wrapper(weights_md()).matches_one_of_tag(format_tag::ab)
+            && memory_desc_wrapper(dst_md()).matches_one_of_tag(format_tag::ab);
+}
+
+status_t brgemm_bsr_matmul_t::pd_t::init_brgemm(brgemm_desc_t &brg, dim_t N) {
+    // Blocks of the source are dense matrices with rows of `blk_k_`
+    // elements, the weights have `N()` columns whether packed or not.
+    const dim_t LDC = use_acc_buf() ? n_blk_ : this->N();
+    CHECK(brgemm_desc_init(&brg, isa_, brgemm_addr, src_md()->data_type,
+            weights_md()->data_type, /* transA = */ false,
+            /* transB = */ false, brgemm_row_major, /* alpha = */ 1.f,
+            /* beta = */ 0.f, /* LDA = */ blk_k_, /* LDB = */ this->N(), LDC,
+            blk_m_, N, blk_k_));
+
+    brgemm_attr_t brgattr;
+    brgattr.max_bs = static_cast<int>(K() / blk_k_);
+    // Rows of the blocks aren't padded to the VNNI granularity, so the kernel
+    // must not read past the end of a row.
+    brgattr.wary_A_k_tail_read = blk_k_ % vnni_ != 0;
+    CHECK(brgemm_desc_set_attr(&brg, brgattr));
+    CHECK(brgemm_desc_finalize(&brg));
+    return status::success;
+}
+
+void brgemm_bsr_matmul_t::pd_t::init_scratchpad() {
+    const int nthr = dnnl_get_max_threads();
+    const dim_t nb_k = K() / blk_k_;
+
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch, nthr * nb_k);
+    if (pack_wei())
+        scratchpad.book(key_brgemm_primitive_buffer_b, packed_wei_size(), 1);
+    if (use_acc_buf())
+        scratchpad.book(key_brgemm_primitive_buffer, nthr * blk_m_ * n_blk_,
+                types::data_type_size(acc_dt_));
+    if (with_wei_comp())
+        scratchpad.template book<int32_t>(
+                key_brgemm_primitive_buffer_comp, nthr * n_blk_);
+}
+
+status_t brgemm_bsr_matmul_t::init(engine_t *engine) {
+    for (int i = 0; i < 2; i++) {
+        if (pd()->brg_desc_[i].bcast_dim == 0) continue;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->brg_desc_[i]));
+        CHECK(safe_ptr_assign(kernels_[i], ker));
+    }
+
+    // The packed copy depends on the weights and on the blocking only.
+    const auto *pd = this->pd();
+    if (pd->pack_wei())
+        packed_wei_layout_ = {pd->isa_,
+                (dim_t)primitive_hashing::get_md_hash(*pd->weights_md()),
+                pd->blk_k_, pd->blk_k_padded_, pd->vnni_,
+                pd->with_wei_comp()};
+    return status::success;
+}
+
+void brgemm_bsr_matmul_t::pack_weights(
+        const void *wei, char *wei_packed) const {
+    const auto *pd = this->pd();
+    if (types::data_type_size(pd->weights_md()->data_type) == 2)
+        pack_vnni(reinterpret_cast<uint16_t *>(wei_packed),
+                static_cast<const uint16_t *>(wei), pd->K(), pd->N(),
+                pd->blk_k_, pd->blk_k_padded_, pd->vnni_);
+    else
+        pack_vnni(reinterpret_cast<uint8_t *>(wei_packed),
+                static_cast<const uint8_t *>(wei), pd->K(), pd->N(),
+                pd->blk_k_, pd->blk_k_padded_, pd->vnni_);
+    if (pd->with_wei_comp())
+        compute_s8s8_comp(reinterpret_cast<int32_t *>(
+                                  wei_packed + pd->wei_comp_offset()),
+                static_cast<const int8_t *>(wei), pd->K(), pd->N(),
+                pd->blk_k_);
+}
+
+const char *brgemm_bsr_matmul_t::prepare_weights(const char *wei,
+        const memory_tracking::grantor_t &scratchpad,
+        packed_weights_cache::buffer_t &cached) const {
+    if (!pd()->pack_wei()) return wei;
+
+    const packed_weights_cache::key_t key(wei, packed_wei_layout_);
+    const bool use_cache = packed_weights_cache::is_enabled();
+    if (use_cache) {
+        cached = packed_weights_cache::get(key);
+        if (cached) return cached.get();
+    }
+
+    const uint64_t generation = packed_weights_cache::get_generation();
+    if (use_cache)
+        cached = packed_weights_cache::allocate(pd()->packed_wei_size());
+    char *wei_packed = cached
+            ? cached.get()
+            : scratchpad.template get<char>(key_brgemm_primitive_buffer_b);
+    pack_weights(wei, wei_packed);
+    if (cached) packed_weights_cache::add(key, cached, generation);
+    return wei_packed;
+}
+
+status_t brgemm_bsr_matmul_t::execute(const exec_ctx_t &ctx) const {
+    const auto *weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    const auto *src_values = CTX_IN_MEM(const char *, DNNL_ARG_SRC, 0);
+    const auto *src_indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
+    const auto *src_pointers = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 2);
+
+    status_t status = status::success;
+    auto dst = CTX_OUT_CLEAN_MEM(char *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const auto *pd = this->pd();
+    const dim_t M = pd->M();
+    const dim_t N = pd->N();
+    const dim_t K = pd->K();
+    const dim_t blk_m = pd->blk_m_;
+    const dim_t blk_k = pd->blk_k_;
+    const dim_t n_blk = pd->n_blk_;
+    const dim_t nb_k = K / blk_k;
+    const data_type_t dst_dt = pd->dst_md()->data_type;
+    const size_t blk_size
+            = blk_m * blk_k * types::data_type_size(pd->src_md()->data_type);
+    const size_t wei_dt_size
+            = types::data_type_size(pd->weights_md()->data_type);
+    const size_t dst_dt_size = types::data_type_size(dst_dt);
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    // Keeps the cached packed weights alive until the computations are done.
+    packed_weights_cache::buffer_t cached_wei;
+    const char *wei = prepare_weights(weights, scratchpad, cached_wei);
+    const int32_t *wei_comp = pd->with_wei_comp()
+            ? reinterpret_cast<const int32_t *>(wei + pd->wei_comp_offset())
+            : nullptr;
+    auto *batch_base = scratchpad.template get<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch);
+    char *acc_base = scratchpad.template get<char>(key_brgemm_primitive_buffer);
+    auto *comp_base = scratchpad.template get<int32_t>(
+            key_brgemm_primitive_buffer_comp);
+
+    auto compute = [&](int ithr, dim_t mb, dim_t nb) {
+        const dim_t n0 = nb * n_blk;
+        const dim_t n = nstl::min(n_blk, N - n0);
+        char *d = dst + (mb * blk_m * N + n0) * dst_dt_size;
+
+        const int32_t row_begin = src_pointers[mb];
+        const int bs = src_pointers[mb + 1] - row_begin;
+        if (bs == 0) {
+            for (dim_t i = 0; i < blk_m; i++)
+                memset(d + i * N * dst_dt_size, 0, n * dst_dt_size);
+            return;
+        }
+
+        auto *batch = batch_base + ithr * nb_k;
+        for (int i = 0; i < bs; i++) {
+            const dim_t j = row_begin + i;
+            const dim_t kb = src_indices[j];
+            batch[i].ptr.A = src_values + j * blk_size;
+            batch[i].ptr.B = wei
+                    + (kb * pd->blk_k_padded_ * N + n0 * pd->vnni_)
+                            * wei_dt_size;
+        }
+
+        const auto *kernel = kernels_[n < n_blk].get();
+        if (!pd->use_acc_buf()) {
+            brgemm_kernel_execute(kernel, bs, batch, d);
+            return;
+        }
+
+        char *acc = acc_base + ithr * blk_m * n_blk * sizeof(float);
+        brgemm_kernel_execute(kernel, bs, batch, acc);
+        if (wei_comp) {
+            // The compensation sums up over the blocks of the batch.
+            int32_t *comp = comp_base + ithr * n_blk;
+            for (dim_t j = 0; j < n; j++)
+                comp[j] = 0;
+            for (int i = 0; i < bs; i++) {
+                const int32_t *c
+                        = wei_comp + src_indices[row_begin + i] * N + n0;
+                for (dim_t j = 0; j < n; j++)
+                    comp[j] += c[j];
+            }
+            for (dim_t i = 0; i < blk_m; i++) {
+                int32_t *a = reinterpret_cast<int32_t *>(acc) + i * n_blk;
+                for (dim_t j = 0; j < n; j++)
+                    a[j] -= comp[j];
+            }
+        }
+        for (dim_t i = 0; i < blk_m; i++) {
+            char *d_row = d + i * N * dst_dt_size;
+            if (dst_dt == bf16) {
+                const float *a
+                        = reinterpret_cast<const float *>(acc) + i * n_blk;
+                cvt_float_to_bfloat16(
+                        reinterpret_cast<bfloat16_t *>(d_row), a, n);
+            } else if (dst_dt == f32) {
+                const int32_t *a
+                        = reinterpret_cast<const int32_t *>(acc) + i * n_blk;
+                float *o = reinterpret_cast<float *>(d_row);
+                for (dim_t j = 0; j < n; j++)
+                    o[j] = static_cast<float>(a[j]);
+            } else {
+                memcpy(d_row, acc + i * n_blk * sizeof(int32_t),
+                        n * sizeof(int32_t));
+            }
+        }
+    };
+
+    // Block rows have different numbers of non-zero blocks, hence different
+    // amounts of work, so they are distributed dynamically.
+    const dim_t nb_m = M / blk_m;
+    const dim_t nb_n = utils::div_up(N, n_blk);
+    parallel_dynamic_ext(0, nb_m * nb_n, [&](int ithr, dim_t start, dim_t end) {
+        dim_t mb {0}, nb {0};
+        utils::nd_iterator_init(start, mb, nb_m, nb, nb_n);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            compute(ithr, mb, nb);
+            utils::nd_iterator_step(mb, nb_m, nb, nb_n);
+        }
+    });
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
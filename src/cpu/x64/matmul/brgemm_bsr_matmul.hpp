@@ -0,0 +1,129 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_BRGEMM_BSR_MATMUL_HPP
+#define CPU_X64_MATMUL_BRGEMM_BSR_MATMUL_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/packed_weights_cache.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+// Matmul with a BSR-encoded source and dense weights. Every block row of the
+// source is multiplied by a single batch-reduce gemm call, with a batch made
+// of its non-zero blocks and the matching rows of the weights, so zero blocks
+// cost nothing. For bf16 and int8 the weights are repacked into the VNNI
+// layout first, with the rows of every block padded to the VNNI granularity.
+// The packed copy is taken from the packed weights cache when it is enabled.
+struct brgemm_bsr_matmul_t : public primitive_t {
+    struct pd_t : public dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_bsr_matmul:", isa_, ""),
+                brgemm_bsr_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        // Whether the weights are repacked into the VNNI layout.
+        bool pack_wei() const { return vnni_ > 1; }
+        // Whether the result is accumulated in a buffer and then converted.
+        // The kernel shifts s8 values of the source into the u8 range, which
+        // is compensated in the buffer.
+        bool use_acc_buf() const {
+            return dst_md()->data_type != acc_dt_
+                    || src_md()->data_type == data_type::s8;
+        }
+        // Whether sums of the columns of the weights are stored after the
+        // packed weights to compensate for the shift of the source.
+        bool with_wei_comp() const {
+            return brg_desc_[0].req_s8s8_compensation;
+        }
+        size_t wei_comp_offset() const {
+            return utils::rnd_up(K() / blk_k_ * blk_k_padded_ * N()
+                            * types::data_type_size(weights_md()->data_type),
+                    sizeof(int32_t));
+        }
+        size_t packed_wei_size() const {
+            return wei_comp_offset()
+                    + (with_wei_comp() ? K() / blk_k_ * N() * sizeof(int32_t)
+                                       : 0);
+        }
+
+        // Dimensions of the blocks of the source.
+        dim_t blk_m_ = 0;
+        dim_t blk_k_ = 0;
+        // Number of rows of a block of the weights in the packed layout.
+        dim_t blk_k_padded_ = 0;
+        // Number of columns of the destination computed by a kernel call.
+        dim_t n_blk_ = 0;
+        dim_t vnni_ = 1;
+        data_type_t acc_dt_ = data_type::undef;
+
+        cpu_isa_t isa_ = isa_undef;
+        // Kernels for a full block of columns and for the tail.
+        brgemm_desc_t brg_desc_[2];
+
+    private:
+        bool formats_ok() const;
+        status_t init_brgemm(brgemm_desc_t &brg, dim_t N);
+        void init_scratchpad();
+    };
+
+    brgemm_bsr_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    void pack_weights(const void *wei, char *wei_packed) const;
+    // Returns the weights in the layout expected by the kernels. A packed
+    // copy taken from the cache is kept alive by `cached`.
+    const char *prepare_weights(const char *wei,
+            const memory_tracking::grantor_t &scratchpad,
+            packed_weights_cache::buffer_t &cached) const;
+
+    std::unique_ptr<brgemm_kernel_t> kernels_[2];
+    // Describes the packed copy of the weights in the packed weights cache.
+    std::vector<dim_t> packed_wei_layout_;
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
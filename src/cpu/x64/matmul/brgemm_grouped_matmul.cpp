@@ -0,0 +1,293 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/bfloat16.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/math_utils.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/matmul_utils.hpp"
+
+#include "cpu/x64/matmul/brgemm_grouped_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+
+namespace {
+
+// The block of columns is sized for a row of the destination to fit into a
+// few vector registers of the kernel.
+constexpr dim_t max_n_blk = 64;
+// Groups with fewer rows are covered by a few calls of the kernels for
+// smaller power-of-two numbers of rows.
+constexpr dim_t max_m_blk = 32;
+
+// Copies `n` columns of the weights with the leading dimension `ld` into VNNI
+// groups of `vnni` rows with the leading dimension `n_blk`, padding the last
+// group with zeros.
+template <typename data_t>
+void pack_vnni_panel(data_t *out, const data_t *inp, dim_t K, dim_t K_padded,
+        dim_t ld, dim_t n, dim_t n_blk, dim_t vnni) {
+    for (dim_t k = 0; k < K_padded; k++) {
+        data_t *o = out + (k / vnni) * n_blk * vnni + k % vnni;
+        if (k < K) {
+            const data_t *i = inp + k * ld;
+            for (dim_t j = 0; j < n; j++)
+                o[j * vnni] = i[j];
+        } else {
+            for (dim_t j = 0; j < n; j++)
+                o[j * vnni] = data_t(0);
+        }
+    }
+}
+
+} // namespace
+
+status_t brgemm_grouped_matmul_t::pd_t::init(engine_t *engine) {
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md(0));
+    const memory_desc_wrapper dst_d(dst_md());
+    const auto src_dt = src_d.data_type();
+    const auto wei_dt = wei_d.data_type();
+    const auto dst_dt = dst_d.data_type();
+
+    VDISPATCH_MATMUL(src_d.is_sparse_desc() && dst_d.is_sparse_desc()
+                    && !wei_d.is_sparse_desc(),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(
+            utils::everyone_is(sparse_encoding::grouped, src_d.encoding(),
+                    dst_d.encoding()),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(src_d.metadata_type(0) == s32,
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    const bool dt_ok = utils::everyone_is(f32, src_dt, wei_dt, dst_dt)
+            || (utils::everyone_is(bf16, src_dt, wei_dt)
+                    && utils::one_of(dst_dt, f32, bf16))
+            || (src_dt == u8 && wei_dt == s8
+                    && utils::one_of(dst_dt, s32, f32));
+    VDISPATCH_MATMUL(dt_ok, VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(
+            !has_runtime_dims_or_strides(), VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_MATMUL(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(formats_ok(), VERBOSE_UNSUPPORTED_TAG);
+
+    if (src_dt == f32)
+        isa_ = mayiuse(avx512_core) ? avx512_core
+                : mayiuse(avx2)     ? avx2
+                                    : isa_undef;
+    else if (src_dt == bf16)
+        isa_ = mayiuse(avx512_core_bf16) ? avx512_core_bf16 : isa_undef;
+    else
+        isa_ = mayiuse(avx512_core_vnni) ? avx512_core_vnni
+                : mayiuse(avx2_vnni)     ? avx2_vnni
+                                         : isa_undef;
+    VDISPATCH_MATMUL(isa_ != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+
+    // No group has more rows than the whole source.
+    m_blk_ = dim_t(1) << math::ilog2q(nstl::min(M(), max_m_blk));
+    n_m_kernels_ = math::ilog2q(m_blk_) + 1;
+    assert(n_m_kernels_ <= max_m_kernels);
+    n_blk_ = nstl::min(N(), max_n_blk);
+    vnni_ = static_cast<dim_t>(data_type_vnni_granularity(wei_dt));
+    K_padded_ = utils::rnd_up(K(), vnni_);
+    acc_dt_ = src_dt == u8 ? s32 : f32;
+
+    for (int i = 0; i < n_m_kernels_; i++) {
+        CHECK(init_brgemm(brg_desc_[i][0], m_blk_ >> i, n_blk_));
+        if (N() % n_blk_ != 0)
+            CHECK(init_brgemm(brg_desc_[i][1], m_blk_ >> i, N() % n_blk_));
+    }
+
+    init_scratchpad();
+    return status::success;
+}
+
+bool brgemm_grouped_matmul_t::pd_t::formats_ok() const {
+    // The values of grouped tensors are always dense and row-major.
+    return memory_desc_wrapper(weights_md()).matches_one_of_tag(
+            format_tag::abc);
+}
+
+status_t brgemm_grouped_matmul_t::pd_t::init_brgemm(
+        brgemm_desc_t &brg, dim_t M, dim_t N) {
+    const dim_t LDB = pack_wei() ? n_blk_ : this->N();
+    const dim_t LDC = use_acc_buf() ? n_blk_ : this->N();
+    CHECK(brgemm_desc_init(&brg, isa_, brgemm_addr, src_md()->data_type,
+            weights_md()->data_type, /* transA = */ false,
+            /* transB = */ false, brgemm_row_major, /* alpha = */ 1.f,
+            /* beta = */ 0.f, /* LDA = */ K(), LDB, LDC, M, N, K()));
+
+    brgemm_attr_t brgattr;
+    brgattr.max_bs = 1;
+    // Rows of the source aren't padded to the VNNI granularity, so the
+    // kernel must not read past the end of a row.
+    brgattr.wary_A_k_tail_read = K() % vnni_ != 0;
+    CHECK(brgemm_desc_set_attr(&brg, brgattr));
+    CHECK(brgemm_desc_finalize(&brg));
+    return status::success;
+}
+
+void brgemm_grouped_matmul_t::pd_t::init_scratchpad() {
+    const int nthr = dnnl_get_max_threads();
+
+    auto scratchpad = scratchpad_registry().registrar();
+    if (pack_wei())
+        scratchpad.book(key_brgemm_primitive_buffer_b,
+                nthr * K_padded_ * n_blk_,
+                types::data_type_size(weights_md()->data_type));
+    if (use_acc_buf())
+        scratchpad.book(key_brgemm_primitive_buffer, nthr * m_blk_ * n_blk_,
+                types::data_type_size(acc_dt_));
+}
+
+status_t brgemm_grouped_matmul_t::init(engine_t *engine) {
+    for (int i = 0; i < pd()->n_m_kernels_; i++)
+        for (int j = 0; j < 2; j++) {
+            const auto &brg = pd()->brg_desc(i, j);
+            if (brg.bcast_dim == 0) continue;
+            brgemm_kernel_t *ker = nullptr;
+            CHECK(brgemm_kernel_create(&ker, brg));
+            CHECK(safe_ptr_assign(kernels_[i][j], ker));
+        }
+    return status::success;
+}
+
+status_t brgemm_grouped_matmul_t::execute(const exec_ctx_t &ctx) const {
+    const auto *weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    const auto *src = CTX_IN_MEM(const char *, DNNL_ARG_SRC, 0);
+    const auto *offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
+
+    status_t status = status::success;
+    auto dst = CTX_OUT_CLEAN_MEM(char *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const auto *pd = this->pd();
+    const dim_t G = pd->G();
+    const dim_t N = pd->N();
+    const dim_t K = pd->K();
+    // Offsets are data, so they can only be validated at execution.
+    if (!cpu::matmul::grouped_offsets_ok(offsets, G, pd->M()))
+        return status::invalid_arguments;
+
+    const dim_t m_blk = pd->m_blk_;
+    const dim_t n_blk = pd->n_blk_;
+    const data_type_t dst_dt = pd->dst_md()->data_type;
+    const size_t src_dt_size = types::data_type_size(pd->src_md()->data_type);
+    const size_t wei_dt_size
+            = types::data_type_size(pd->weights_md()->data_type);
+    const size_t dst_dt_size = types::data_type_size(dst_dt);
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    char *wei_packed_base
+            = scratchpad.template get<char>(key_brgemm_primitive_buffer_b);
+    char *acc_base = scratchpad.template get<char>(key_brgemm_primitive_buffer);
+
+    auto compute = [&](int ithr, dim_t g, dim_t nb) {
+        const dim_t m_begin = offsets[g];
+        const dim_t m_end = offsets[g + 1];
+        if (m_end <= m_begin) return;
+
+        const dim_t n0 = nb * n_blk;
+        const dim_t n = nstl::min(n_blk, N - n0);
+        const bool n_tail = n < n_blk;
+
+        const char *wei = weights + (g * K * N + n0) * wei_dt_size;
+        if (pd->pack_wei()) {
+            char *wei_packed = wei_packed_base
+                    + ithr * pd->K_padded_ * n_blk * wei_dt_size;
+            if (wei_dt_size == 2)
+                pack_vnni_panel(reinterpret_cast<uint16_t *>(wei_packed),
+                        reinterpret_cast<const uint16_t *>(wei), K,
+                        pd->K_padded_, N, n, n_blk, pd->vnni_);
+            else
+                pack_vnni_panel(reinterpret_cast<uint8_t *>(wei_packed),
+                        reinterpret_cast<const uint8_t *>(wei), K,
+                        pd->K_padded_, N, n, n_blk, pd->vnni_);
+            wei = wei_packed;
+        }
+        char *acc = acc_base + ithr * m_blk * n_blk * sizeof(float);
+
+        brgemm_batch_element_t batch;
+        batch.ptr.B = wei;
+        dim_t m = m_begin;
+        int m_idx = 0;
+        while (m < m_end) {
+            // Take the largest kernel that doesn't go past the group.
+            while ((m_blk >> m_idx) > m_end - m)
+                m_idx++;
+            const dim_t rows = m_blk >> m_idx;
+            const auto *kernel = kernels_[m_idx][n_tail].get();
+            char *d = dst + (m * N + n0) * dst_dt_size;
+            batch.ptr.A = src + m * K * src_dt_size;
+            m += rows;
+
+            if (!pd->use_acc_buf()) {
+                brgemm_kernel_execute(kernel, 1, &batch, d);
+                continue;
+            }
+
+            brgemm_kernel_execute(kernel, 1, &batch, acc);
+            for (dim_t i = 0; i < rows; i++) {
+                char *d_row = d + i * N * dst_dt_size;
+                if (dst_dt == bf16) {
+                    const float *a
+                            = reinterpret_cast<const float *>(acc) + i * n_blk;
+                    cvt_float_to_bfloat16(
+                            reinterpret_cast<bfloat16_t *>(d_row), a, n);
+                } else {
+                    const int32_t *a = reinterpret_cast<const int32_t *>(acc)
+                            + i * n_blk;
+                    float *o = reinterpret_cast<float *>(d_row);
+                    for (dim_t j = 0; j < n; j++)
+                        o[j] = static_cast<float>(a[j]);
+                }
+            }
+        }
+    };
+
+    // Groups have different numbers of rows, hence different amounts of work,
+    // so the work items of all groups are distributed dynamically.
+    const dim_t nb_n = utils::div_up(N, n_blk);
+    parallel_dynamic_ext(0, G * nb_n, [&](int ithr, dim_t start, dim_t end) {
+        dim_t g {0}, nb {0};
+        utils::nd_iterator_init(start, g, G, nb, nb_n);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            compute(ithr, g, nb);
+            utils::nd_iterator_step(g, G, nb, nb_n);
+        }
+    });
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
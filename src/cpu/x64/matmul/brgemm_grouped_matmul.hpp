@@ -0,0 +1,112 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_BRGEMM_GROUPED_MATMUL_HPP
+#define CPU_X64_MATMUL_BRGEMM_GROUPED_MATMUL_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+// Grouped matmul, e.g. the experts of a mixture of experts: the rows of the
+// source and the destination are split into groups by offsets, and every
+// group is multiplied by its own matrix of the weights. All groups are
+// computed in a single parallel region with work items made of a group and a
+// block of columns, so a block of the weights is loaded (and repacked into
+// the VNNI layout for bf16 and int8) once for all rows of its group. Groups
+// have arbitrary numbers of rows, which are covered by kernels for
+// power-of-two numbers of rows.
+struct brgemm_grouped_matmul_t : public primitive_t {
+    struct pd_t : public dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("brg_grouped_matmul:", isa_, ""),
+                brgemm_grouped_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        static constexpr int max_m_kernels = 6;
+
+        dim_t G() const { return weights_md()->dims[0]; }
+        // Whether the weights are repacked into the VNNI layout.
+        bool pack_wei() const { return vnni_ > 1; }
+        // Whether the result is accumulated in a buffer and then converted.
+        bool use_acc_buf() const {
+            return dst_md()->data_type != acc_dt_;
+        }
+        // Descriptor of the kernel for `m_blk_ >> m_idx` rows.
+        const brgemm_desc_t &brg_desc(int m_idx, bool n_tail) const {
+            return brg_desc_[m_idx][n_tail];
+        }
+
+        // The largest number of rows computed by a kernel call.
+        dim_t m_blk_ = 0;
+        int n_m_kernels_ = 0;
+        // Number of columns of the destination computed by a kernel call.
+        dim_t n_blk_ = 0;
+        dim_t vnni_ = 1;
+        // Number of rows of the weights in the packed layout.
+        dim_t K_padded_ = 0;
+        data_type_t acc_dt_ = data_type::undef;
+
+        cpu_isa_t isa_ = isa_undef;
+
+    private:
+        // Kernels for a full block of columns and for the tail.
+        brgemm_desc_t brg_desc_[max_m_kernels][2];
+
+        bool formats_ok() const;
+        status_t init_brgemm(brgemm_desc_t &brg, dim_t M, dim_t N);
+        void init_scratchpad();
+    };
+
+    brgemm_grouped_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> kernels_[pd_t::max_m_kernels][2];
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -17,6 +17,7 @@
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/memory_tracking.hpp"
+#include "common/primitive_hashing.hpp"
 #include "common/tag_traits.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
@@ -27,6 +28,7 @@
 
 #include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/injectors/jit_uni_binary_injector.hpp"
+#include "cpu/x64/matmul/amx_blocking_heuristics.hpp"
 #include "cpu/x64/matmul/brgemm_matmul.hpp"
 
 namespace dnnl {
@@ -423,6 +425,27 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
     if (bgmmc.use_buffer_b && !bgmmc.packed_sparse_weights)
         CHECK(create_brgemm_matmul_copy_b(copy_B_kernel_, &bgmmc));
 
+    // Packed B can be shared only if it depends on nothing but the weights,
+    // i.e. no compensations, zero points or scales are applied while packing.
+    const memory_desc_wrapper weights_d(pd()->weights_md());
+    const bool can_share_packed_B = bgmmc.use_buffer_b
+            && !bgmmc.packed_sparse_weights
+            && !bgmmc.s8s8_compensation_required && !bgmmc.has_zero_point_a
+            && !bgmmc.has_zero_point_b && !bgmmc.apply_scales_in_buffer_b
+            && !bgmmc.is_runtime_N && !bgmmc.is_runtime_K
+            && !weights_d.has_runtime_dims_or_strides()
+            && (bgmmc.batch == 1
+                    || bgmmc.bcast_B_desc.bcast_across_all_batch_dims);
+    if (can_share_packed_B) {
+        packed_B_layout_ = {isa,
+                (dim_t)primitive_hashing::get_md_hash(*pd()->weights_md()),
+                bgmmc.src_dt, bgmmc.wei_dt, bgmmc.orig_wei_dt, bgmmc.N,
+                bgmmc.K, bgmmc.LDB, bgmmc.N_blk, bgmmc.K_blk, bgmmc.wei_n_blk,
+                bgmmc.wei_k_blk, bgmmc.buffer_b_gb_stride, bgmmc.blocked_B,
+                bgmmc.transposed_B, bgmmc.is_bf32, bgmmc.is_tf32,
+                bgmmc.req_wei_vnni_downconvert, bgmmc.with_wei_decompression};
+    }
+
     if (bgmmc.use_buffer_a || bgmmc.use_buffer_a_tail_only)
         CHECK(create_brgemm_matmul_copy_a(copy_A_kernel_, &bgmmc));
 
@@ -492,6 +515,9 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
 
     brg_matmul_exec_ctx_t brgmm_ctx(ctx, pd(), oscales, src_zero_point,
             wei_zero_point, dst_zero_point, dst_scales, helper);
+    // Keeps the shared packed B alive until the computations are done.
+    const auto shared_packed_B = maybe_use_shared_packed_B(brgmm_ctx);
+    const bool copy_B = bgmmc.use_buffer_b && !shared_packed_B;
 
     const bool use_buffer_a
             = bgmmc.use_buffer_a || bgmmc.use_buffer_a_tail_only;
@@ -603,8 +629,7 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
                                                    .bcast_across_all_batch_dims);
                         for (int kb = kb_start; kb < kb_end; kb++) {
 
-                            if (bgmmc.use_buffer_b && mb == m_start
-                                    && !skip_copy_b)
+                            if (copy_B && mb == m_start && !skip_copy_b)
                                 copy_b_chunk_in_buffer(brgmm_ctx, b_batch_ptr,
                                         ithr, b, nb, kb);
 
@@ -1230,6 +1255,43 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
     }
 }
 
+template <cpu_isa_t isa>
+packed_weights_cache::buffer_t brgemm_matmul_t<isa>::maybe_use_shared_packed_B(
+        brg_matmul_exec_ctx_t &brgmm_ctx) const {
+    if (packed_B_layout_.empty() || !packed_weights_cache::is_enabled())
+        return packed_weights_cache::buffer_t();
+
+    const char *B_data_ptr = brgmm_ctx.get_data_B_batch_ptr(0);
+    const packed_weights_cache::key_t key(B_data_ptr, packed_B_layout_);
+    auto packed_B = packed_weights_cache::get(key);
+    if (packed_B) {
+        brgmm_ctx.set_shared_buf_B_ptr(packed_B.get());
+        return packed_B;
+    }
+
+    // The whole B is packed at once, a block of each N_blk columns and K_blk
+    // rows being placed at the same offset as in the scratchpad buffer.
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const uint64_t generation = packed_weights_cache::get_generation();
+    const dim_t num_K_blks = div_up(bgmmc.K, bgmmc.K_blk);
+    packed_B = packed_weights_cache::allocate(
+            bgmmc.num_N_blocks * num_K_blks * bgmmc.buffer_b_gb_stride);
+    if (!packed_B) return packed_B;
+    brgmm_ctx.set_shared_buf_B_ptr(packed_B.get());
+
+    const dim_t work_amount = (dim_t)bgmmc.num_N_blocks * bgmmc.num_K_blocks;
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        for (dim_t w = start; w < end; w++)
+            copy_b_chunk_in_buffer(brgmm_ctx, B_data_ptr, ithr, 0,
+                    w / bgmmc.num_K_blocks, w % bgmmc.num_K_blocks);
+    });
+
+    packed_weights_cache::add(key, packed_B, generation);
+    return packed_B;
+}
+
 template <cpu_isa_t isa>
 void brgemm_matmul_t<isa>::accumulate(
         char *result_ptr, const char *reduce_ptr, size_t size) const {
@@ -1381,8 +1443,16 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
         if (bgmmc.is_runtime_M) {
             M_ = helper.M();
-            M_chunks_ = M_ / bgmmc.M_chunk_elems;
-            M_chunk_tail_elements_ = M_ % bgmmc.M_chunk_elems;
+            // Blocking along M depends on the number of rows, so it's
+            // adjusted for every call.
+            using blocking_t = matmul_amx_blocking_params_micro_t;
+            const int nthr
+                    = nstl::min(dnnl_get_current_num_threads(), bgmmc.nthr);
+            M_chunk_size_
+                    = blocking_t::get_runtime_M_chunk_size(bgmmc, M_, nthr);
+            const dim_t M_chunk_elems = bgmmc.M_blk * M_chunk_size_;
+            M_chunks_ = M_ / M_chunk_elems;
+            M_chunk_tail_elements_ = M_ % M_chunk_elems;
             int tail = M_chunk_tail_elements_;
             dim_t m_idx = M_ - tail;
             int tail_idx = 0;
@@ -1430,6 +1500,7 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                     = is_batch_layout_trivial(dst_d_, bgmmc.batch);
         } else {
             M_ = bgmmc.M;
+            M_chunk_size_ = bgmmc.M_chunk_size;
             M_chunks_ = bgmmc.M_chunks;
             M_chunk_tail_ = bgmmc.num_M_blocks % get_M_chunk_size();
             M_chunk_tail_elements_ = M_ % bgmmc.M_chunk_elems;
@@ -1748,8 +1819,14 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
     }
 
     char *get_buf_B_ptr(int ithr, int k_blk_idx, int n_blk_idx, int gb) const {
-        UNUSED(n_blk_idx);
         if (!bgmmc_.use_buffer_b) return nullptr;
+        if (shared_buf_B_ptr_) {
+            const dim_t num_K_blks = div_up(bgmmc_.K, bgmmc_.K_blk);
+            const dim_t k_blk = k_blk_idx * bgmmc_.brgemm_batch_size + gb;
+            return shared_buf_B_ptr_
+                    + (n_blk_idx * num_K_blks + k_blk)
+                    * bgmmc_.buffer_b_gb_stride;
+        }
         int k_blk_local = k_blk_idx % get_K_chunk_size();
         return buf_B_ptr_ + ithr * bgmmc_.buffer_b_per_thread_sz
                 + k_blk_local * bgmmc_.buffer_b_k_brg_stride
@@ -2042,7 +2119,7 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
     }
     dim_t get_M() const { return M_; }
     int get_M_chunks() const { return M_chunks_; }
-    int get_M_chunk_size() const { return bgmmc_.M_chunk_size; }
+    int get_M_chunk_size() const { return M_chunk_size_; }
     int get_M_chunk_tail() const { return M_chunk_tail_; }
 
     int get_K_chunks() const { return K_chunks_; }
@@ -2207,6 +2284,10 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
     bool packed_sparse_weights() const { return bgmmc_.packed_sparse_weights; }
 
+    // Makes B be read from the packed copy of the whole weights instead of
+    // the per-thread scratchpad buffer.
+    void set_shared_buf_B_ptr(char *ptr) { shared_buf_B_ptr_ = ptr; }
+
     int get_current_K_pad(int current_K_iters) const {
         if (current_K_iters % bgmmc_.wei_k_blk == 0) return 0;
         return bgmmc_.extendable_k ? bgmmc_.wei_k_blk
@@ -2256,6 +2337,7 @@ private:
 
     char *buf_A_ptr_;
     char *buf_B_ptr_;
+    char *shared_buf_B_ptr_ = nullptr;
     char *buf_C_ptr_;
     char *buf_D_ptr_;
     char *buf_reduce_ptr_;
@@ -2290,6 +2372,7 @@ private:
 
     dim_t M_;
     int M_chunks_;
+    int M_chunk_size_;
     int M_chunk_tail_;
     int M_chunk_tail_elements_;
     int M_tail_block_start_;
@@ -17,7 +17,10 @@
 #ifndef CPU_X64_MATMUL_BRGEMM_MATMUL_HPP
 #define CPU_X64_MATMUL_BRGEMM_MATMUL_HPP
 
+#include <vector>
+
 #include "common/c_types_map.hpp"
+#include "common/packed_weights_cache.hpp"
 #include "common/primitive.hpp"
 #include "common/type_helpers.hpp"
 
@@ -98,6 +101,8 @@ private:
     void copy_b_chunk_in_buffer(const brg_matmul_exec_ctx_t &brgmm_ctx,
             const char *B_data_batch_ptr, int ithr, int b_idx, int n_blk_idx,
             int k_blk_idx) const;
+    packed_weights_cache::buffer_t maybe_use_shared_packed_B(
+            brg_matmul_exec_ctx_t &brgmm_ctx) const;
     void maybe_reduce_partial_results_and_apply_postops(
             const brg_matmul_exec_ctx_t &brgmm_ctx) const;
     void maybe_reduce_A(const brg_matmul_exec_ctx_t &brgmm_ctx, int ithr,
@@ -109,6 +114,9 @@ private:
             char *result_ptr, const char *reduce_ptr, size_t size) const;
 
     std::unique_ptr<brgemm_kernel_t> brg_kernels_[max_num_brg_kernels_matmul];
+    // Identifies the layout of packed B in the packed weights cache. Empty if
+    // packed B can't be shared with other primitives.
+    std::vector<dim_t> packed_B_layout_;
     brgemm_containers::brgemm_palette_container_t brgemm_palettes_ {
             max_num_brg_kernels_matmul};
 
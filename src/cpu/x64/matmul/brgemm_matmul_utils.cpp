@@ -805,6 +805,21 @@ float compute_blocking_heuristic_avx512(brgemm_matmul_conf_t &bgmmc,
         // TODO: expand to other data types.
         use_k_partitioning = use_k_partitioning && bm_conf_utils.is_f32();
 
+        // Enable k-partitioning for skinny shapes, e.g. batch-1 decode or
+        // LoRA down-projections: even the smallest m/n blocks leave threads
+        // idle. The number of threads in k-dim is reduced below if k is too
+        // short to be split.
+        // Note: parallel reduction is supported for non-batched problems
+        // without compensations only.
+        const dim_t max_bmn_parallel_min_blk
+                = static_cast<dim_t>(div_up(matmul.N, n_blk))
+                * div_up(matmul.M, min_m_blk);
+        const bool is_skinny
+                = matmul.batch == 1 && max_bmn_parallel_min_blk < nthr;
+        use_k_partitioning |= is_skinny
+                && one_of(true, bm_conf_utils.is_f32(), bm_conf_utils.is_bf16(),
+                        bm_conf_utils.is_f16());
+
         if (use_k_partitioning) {
             auto least_prime_factor = [](int n) {
                 assert(n > 0);
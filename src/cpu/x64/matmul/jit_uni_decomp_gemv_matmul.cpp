@@ -0,0 +1,623 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cassert>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/math_utils.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+
+#include "cpu/x64/matmul/jit_uni_decomp_gemv_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace Xbyak;
+
+struct decomp_gemv_kernel_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(decomp_gemv_kernel_t);
+
+    struct call_params_t {
+        const float *src;
+        // The first column of the block in the weights and in the per-column
+        // scales and products of the zero points with the scales.
+        const void *wei;
+        const float *scales;
+        const float *zs;
+        const float *src_sums;
+        const float *bias;
+        float *dst;
+    };
+
+    decomp_gemv_kernel_t(const decomp_gemv_conf_t &conf, int n_vregs)
+        : jit_generator_t(jit_name(), conf.isa)
+        , conf_(conf)
+        , n_vregs_(n_vregs) {}
+
+    ~decomp_gemv_kernel_t() override = default;
+
+    void operator()(const call_params_t *p) {
+        return jit_generator_t::operator()(p);
+    }
+
+protected:
+    const decomp_gemv_conf_t conf_;
+    const int n_vregs_;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_decomp_gemv_kernel_t : public decomp_gemv_kernel_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_decomp_gemv_kernel_t)
+
+    using Vmm = typename cpu_isa_traits_t<isa>::Vmm;
+
+    jit_uni_decomp_gemv_kernel_t(const decomp_gemv_conf_t &conf, int n_vregs)
+        : decomp_gemv_kernel_t(conf, n_vregs) {}
+    ~jit_uni_decomp_gemv_kernel_t() override = default;
+
+private:
+    static constexpr int vlen = cpu_isa_traits_t<isa>::vlen;
+    static constexpr int simd_w = vlen / sizeof(float);
+
+    Reg64 reg_param = abi_param1;
+
+    Reg64 reg_src = r8;
+    Reg64 reg_wei = r9;
+    Reg64 reg_scales = r10;
+    Reg64 reg_zs = r11;
+    Reg64 reg_sums = r12;
+    Reg64 reg_dst = r13;
+    Reg64 reg_bias = r14;
+    Reg64 reg_k = r15;
+    Reg64 reg_group = rax;
+    Reg64 reg_tmp = rbx;
+
+    // The registers used with xmm instructions come first, so that they are
+    // encodable without EVEX.
+    Vmm vmm_wei = Vmm(0);
+    Vmm vmm_scale = Vmm(1);
+    Vmm vmm_zs = Vmm(2);
+    Vmm vmm_int4_shift = Vmm(3);
+    Xmm xmm_wei = Xmm(0);
+    Xmm xmm_int4_dup = Xmm(4);
+    static constexpr int n_aux_vregs = 5;
+
+    // The source values, and the sums of the source groups in the epilogue.
+    Vmm vmm_src(int m) const { return Vmm(n_aux_vregs + m); }
+    // The result and the sums of the current group of rows of the weights.
+    Vmm vmm_acc(int m, int v) const {
+        return Vmm(n_aux_vregs + (int)conf_.M + m * n_vregs_ + v);
+    }
+    Vmm vmm_partial(int m, int v) const {
+        return Vmm(n_aux_vregs + (int)conf_.M * (1 + n_vregs_) + m * n_vregs_
+                + v);
+    }
+
+    bool is_int4() const { return utils::one_of(conf_.wei_dt, s4, u4); }
+    // Bytes of `n` columns of the weights.
+    dim_t wei_bytes(dim_t n) const { return is_int4() ? n / 2 : n; }
+
+    void load_params() {
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_wei, ptr[reg_param + PARAM_OFF(wei)]);
+        if (conf_.with_scales)
+            mov(reg_scales, ptr[reg_param + PARAM_OFF(scales)]);
+        if (conf_.with_zp) {
+            mov(reg_zs, ptr[reg_param + PARAM_OFF(zs)]);
+            mov(reg_sums, ptr[reg_param + PARAM_OFF(src_sums)]);
+        }
+        if (conf_.with_bias) mov(reg_bias, ptr[reg_param + PARAM_OFF(bias)]);
+        mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+#undef PARAM_OFF
+    }
+
+    void prepare_int4_tables() {
+        if (!is_int4()) return;
+
+        // Duplicates the bytes of the weights, one per nibble.
+        alignas(16) static const uint8_t dup_bytes[16]
+                = {0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7};
+        // Moves the low (even column) and the high (odd column) nibble of a
+        // duplicated byte to the top of its dword.
+        alignas(64) static const uint32_t shifts[16] = {28, 24, 28, 24, 28,
+                24, 28, 24, 28, 24, 28, 24, 28, 24, 28, 24};
+
+        mov(reg_tmp, reinterpret_cast<size_t>(dup_bytes));
+        uni_vmovdqu(xmm_int4_dup, ptr[reg_tmp]);
+        mov(reg_tmp, reinterpret_cast<size_t>(shifts));
+        uni_vmovdqu(vmm_int4_shift, ptr[reg_tmp]);
+    }
+
+    // Loads `simd_w` columns of a row of the weights as f32.
+    void load_wei(dim_t offt) {
+        switch (conf_.wei_dt) {
+            case s8: uni_vpmovsxbd(vmm_wei, ptr[reg_wei + offt]); break;
+            case u8: uni_vpmovzxbd(vmm_wei, ptr[reg_wei + offt]); break;
+            case s4:
+            case u4:
+                if (isa == avx512_core)
+                    vmovq(xmm_wei, qword[reg_wei + offt]);
+                else
+                    vmovd(xmm_wei, dword[reg_wei + offt]);
+                vpshufb(xmm_wei, xmm_wei, xmm_int4_dup);
+                vpmovzxbd(vmm_wei, xmm_wei);
+                vpsllvd(vmm_wei, vmm_wei, vmm_int4_shift);
+                if (conf_.wei_dt == s4)
+                    vpsrad(vmm_wei, vmm_wei, 28);
+                else
+                    vpsrld(vmm_wei, vmm_wei, 28);
+                break;
+            default: assert(!"unsupported data type");
+        }
+        uni_vcvtdq2ps(vmm_wei, vmm_wei);
+    }
+
+    // Loads `simd_w` values of a row of per-column parameters starting at
+    // column `v * simd_w`, or broadcasts a common one.
+    void load_param(const Vmm &vmm, const Reg64 &reg, bool per_n, int v) {
+        if (per_n)
+            uni_vmovups(vmm, ptr[reg + v * vlen]);
+        else
+            uni_vbroadcastss(vmm, ptr[reg]);
+    }
+
+    // Accumulates `k_unroll` rows of the weights into the partial sums.
+    void compute_rows(int k_unroll) {
+        const int M = (int)conf_.M;
+        const dim_t row_bytes = wei_bytes(conf_.N);
+        for (int k = 0; k < k_unroll; k++) {
+            for (int m = 0; m < M; m++)
+                uni_vbroadcastss(vmm_src(m),
+                        ptr[reg_src + (m * conf_.K + k) * sizeof(float)]);
+            for (int v = 0; v < n_vregs_; v++) {
+                load_wei(k * row_bytes + wei_bytes(v * simd_w));
+                for (int m = 0; m < M; m++)
+                    uni_vfmadd231ps(vmm_partial(m, v), vmm_wei, vmm_src(m));
+            }
+        }
+        add(reg_src, k_unroll * sizeof(float));
+        add(reg_wei, k_unroll * row_bytes);
+    }
+
+    // Applies the scales and the zero points of the current group to the
+    // partial sums and adds them to the result:
+    // sum_k(src * (wei - zp) * s) = s * sum_k(src * wei) - zp * s * sum_k(src)
+    void apply_group() {
+        const int M = (int)conf_.M;
+        if (conf_.with_zp)
+            for (int m = 0; m < M; m++)
+                uni_vbroadcastss(vmm_src(m),
+                        ptr[reg_sums + m * conf_.n_groups() * sizeof(float)]);
+
+        for (int v = 0; v < n_vregs_; v++) {
+            if (conf_.with_scales) {
+                if (conf_.scales_per_n || v == 0)
+                    load_param(vmm_scale, reg_scales, conf_.scales_per_n, v);
+                for (int m = 0; m < M; m++)
+                    uni_vfmadd231ps(
+                            vmm_acc(m, v), vmm_partial(m, v), vmm_scale);
+            } else {
+                for (int m = 0; m < M; m++)
+                    uni_vaddps(vmm_acc(m, v), vmm_acc(m, v),
+                            vmm_partial(m, v));
+            }
+            if (conf_.with_zp) {
+                if (conf_.zs_per_n || v == 0)
+                    load_param(vmm_zs, reg_zs, conf_.zs_per_n, v);
+                for (int m = 0; m < M; m++)
+                    uni_vfnmadd231ps(vmm_acc(m, v), vmm_zs, vmm_src(m));
+            }
+        }
+
+        if (conf_.with_scales && conf_.scales_per_k)
+            add(reg_scales, conf_.N * sizeof(float));
+        if (conf_.with_zp) {
+            add(reg_sums, sizeof(float));
+            if (conf_.zs_per_k) add(reg_zs, conf_.N * sizeof(float));
+        }
+    }
+
+    void store() {
+        for (int m = 0; m < (int)conf_.M; m++)
+            for (int v = 0; v < n_vregs_; v++) {
+                const Vmm acc = vmm_acc(m, v);
+                const dim_t offt = (m * conf_.N + v * simd_w) * sizeof(float);
+                if (conf_.with_bias)
+                    uni_vaddps(acc, acc, ptr[reg_bias + v * vlen]);
+                uni_vmovups(ptr[reg_dst + offt], acc);
+            }
+    }
+
+    void generate() override {
+        const int M = (int)conf_.M;
+        const dim_t k_group = conf_.k_group;
+        const int k_unroll = k_group % 4 == 0 ? 4 : k_group % 2 == 0 ? 2 : 1;
+
+        preamble();
+        load_params();
+        prepare_int4_tables();
+
+        for (int m = 0; m < M; m++)
+            for (int v = 0; v < n_vregs_; v++)
+                uni_vpxor(vmm_acc(m, v), vmm_acc(m, v), vmm_acc(m, v));
+
+        Label group_loop, k_loop;
+        mov(reg_group, conf_.n_groups());
+        L(group_loop);
+        {
+            for (int m = 0; m < M; m++)
+                for (int v = 0; v < n_vregs_; v++)
+                    uni_vpxor(vmm_partial(m, v), vmm_partial(m, v),
+                            vmm_partial(m, v));
+
+            mov(reg_k, k_group / k_unroll);
+            L(k_loop);
+            {
+                compute_rows(k_unroll);
+                dec(reg_k);
+                jnz(k_loop, T_NEAR);
+            }
+
+            apply_group();
+            dec(reg_group);
+            jnz(group_loop, T_NEAR);
+        }
+
+        store();
+        postamble();
+    }
+};
+
+status_t jit_uni_decomp_gemv_matmul_t::pd_t::init(engine_t *engine) {
+    const auto src_dt = src_md()->data_type;
+    const auto wei_dt = weights_md()->data_type;
+    const auto dst_dt = dst_md()->data_type;
+
+    VDISPATCH_MATMUL(is_dense_format_kind(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(utils::one_of(src_dt, f32, bf16, f16)
+                    && utils::one_of(wei_dt, s8, u8, s4, u4)
+                    && utils::one_of(dst_dt, f32, src_dt),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_MATMUL(IMPLICATION(utils::one_of(wei_dt, s8, u8),
+                             attr_.mayiconvert(wei_dt, src_dt)),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_MATMUL(platform::has_data_type_support(src_dt),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_MATMUL(
+            IMPLICATION(with_bias(), weights_md(1)->data_type == f32),
+            VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(IMPLICATION(with_bias(), is_bias_1xN()),
+            VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(ndims() == 2, VERBOSE_BAD_NDIMS, "dst", ndims());
+    VDISPATCH_MATMUL(!has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_MATMUL(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_MATMUL(M() <= max_M, VERBOSE_LARGE_SHAPES);
+    VDISPATCH_MATMUL(IMPLICATION(utils::one_of(wei_dt, s4, u4), N() % 2 == 0),
+            VERBOSE_SHAPE_RESTRICTION);
+    VDISPATCH_MATMUL(attr_ok(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(formats_ok(), VERBOSE_UNSUPPORTED_TAG);
+
+    CHECK(init_conf(engine));
+    init_scratchpad();
+
+    return status::success;
+}
+
+bool jit_uni_decomp_gemv_matmul_t::pd_t::formats_ok() const {
+    using namespace format_tag;
+    const bool bias_ok = IMPLICATION(with_bias(),
+            memory_desc_wrapper(weights_md(1)).matches_one_of_tag(ab));
+    return memory_desc_wrapper(src_md()).matches_one_of_tag(ab)
+            && memory_desc_wrapper(weights_md()).matches_one_of_tag(ab)
+            && memory_desc_wrapper(dst_md()).matches_one_of_tag(ab) && bias_ok;
+}
+
+bool jit_uni_decomp_gemv_matmul_t::pd_t::attr_ok() const {
+    using smask_t = primitive_attr_t::skip_mask_t;
+    const auto &scales = attr()->scales_;
+    const auto &zp = attr()->zero_points_;
+
+    if (!attr()->has_default_values(smask_t::scales_data_type
+                | smask_t::scales_groups | smask_t::zero_points_data_type
+                | smask_t::zero_points_groups | smask_t::fpmath_mode))
+        return false;
+    if (!zp.has_default_values(std::vector<int> {DNNL_ARG_WEIGHTS}))
+        return false;
+    if (!attr_scales_ok({DNNL_ARG_WEIGHTS})) return false;
+
+    // The rows of a group, or 0 if the quantization parameter is not defined
+    // or doesn't vary along K.
+    const auto group_k = [&](const quant_entry_t &e) -> dim_t {
+        if (e.has_default_values()) return 0;
+        const int mask = e.get_mask();
+        if (mask & ~3) return -1;
+        if (e.get_group(1) != 1) return -1;
+        if (!(mask & 1)) return 0;
+        const dim_t gK = e.get_group(0);
+        return gK > 0 && K() % gK == 0 ? gK : -1;
+    };
+
+    const auto &wei_scales = scales.get(DNNL_ARG_WEIGHTS);
+    const auto &wei_zp = zp.get(DNNL_ARG_WEIGHTS);
+    const dim_t scales_gK = group_k(wei_scales);
+    const dim_t zp_gK = group_k(wei_zp);
+    if (scales_gK < 0 || zp_gK < 0) return false;
+    if (scales_gK > 0 && zp_gK > 0 && scales_gK != zp_gK) return false;
+
+    if (!wei_scales.has_default_values()
+            && !scales.has_default_data_type(DNNL_ARG_WEIGHTS)
+            && !utils::one_of(wei_scales.get_data_type(), f32, bf16, f16))
+        return false;
+    if (!wei_zp.has_default_values()
+            && !zp.has_default_data_type(DNNL_ARG_WEIGHTS)
+            && !utils::one_of(wei_zp.get_data_type(), s32, s8, u8, s4, u4))
+        return false;
+
+    return true;
+}
+
+status_t jit_uni_decomp_gemv_matmul_t::pd_t::init_conf(engine_t *engine) {
+    auto &c = conf_;
+    const auto &scales = attr()->scales_.get(DNNL_ARG_WEIGHTS);
+    const auto &zp = attr()->zero_points_.get(DNNL_ARG_WEIGHTS);
+
+    if (mayiuse(avx512_core))
+        c.isa = avx512_core;
+    else if (mayiuse(avx2))
+        c.isa = avx2;
+    else
+        VDISPATCH_MATMUL(false, VERBOSE_UNSUPPORTED_ISA);
+
+    c.M = M();
+    c.N = N();
+    c.K = K();
+    c.src_dt = src_md()->data_type;
+    c.wei_dt = weights_md()->data_type;
+    c.dst_dt = dst_md()->data_type;
+
+    // Every row of the source takes a register for its values and two for
+    // every register of columns: the result and the sums of a group. Five
+    // more are needed to load and convert the weights and to load the scales
+    // and the zero points.
+    c.simd_w = isa_max_vlen(c.isa) / sizeof(float);
+    c.n_vregs = nstl::min<int>(
+            4, (isa_num_vregs(c.isa) - 5 - (int)c.M) / (2 * (int)c.M));
+    VDISPATCH_MATMUL(c.n_vregs > 0, VERBOSE_LARGE_SHAPES);
+    c.n_blk = c.n_vregs * c.simd_w;
+    c.N_jit = utils::rnd_dn(c.N, c.simd_w);
+    VDISPATCH_MATMUL(c.N_jit > 0, VERBOSE_SMALL_SHAPES);
+
+    c.with_scales = !scales.has_default_values();
+    c.scales_per_k = c.with_scales && (scales.get_mask() & 1);
+    c.scales_per_n = c.with_scales && (scales.get_mask() & 2);
+    c.scales_dt = attr()->scales_.has_default_data_type(DNNL_ARG_WEIGHTS)
+            ? f32
+            : scales.get_data_type();
+    c.with_zp = !zp.has_default_values();
+    c.zp_per_k = c.with_zp && (zp.get_mask() & 1);
+    c.zp_per_n = c.with_zp && (zp.get_mask() & 2);
+    c.zp_dt = attr()->zero_points_.has_default_data_type(DNNL_ARG_WEIGHTS)
+            ? s32
+            : zp.get_data_type();
+    c.zs_per_k = c.zp_per_k || c.scales_per_k;
+    c.zs_per_n = c.zp_per_n || c.scales_per_n;
+    c.with_bias = with_bias();
+
+    c.k_group = c.K;
+    if (c.scales_per_k)
+        c.k_group = scales.get_group(0);
+    else if (c.zp_per_k)
+        c.k_group = zp.get_group(0);
+
+    return status::success;
+}
+
+void jit_uni_decomp_gemv_matmul_t::pd_t::init_scratchpad() {
+    const auto &c = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+    if (c.src_dt != f32)
+        scratchpad.book<float>(key_matmul_src_trans, c.M * c.K);
+    if (c.scales_size() + c.zs_size() > 0)
+        scratchpad.book<float>(
+                key_precomputed_scales, c.scales_size() + c.zs_size());
+    if (c.with_zp)
+        scratchpad.book<float>(
+                key_brgemm_primitive_zp_comp_b, c.M * c.n_groups());
+    if (c.dst_dt != f32)
+        scratchpad.book<float>(key_matmul_dst_in_acc_dt, c.M * c.N);
+}
+
+jit_uni_decomp_gemv_matmul_t::jit_uni_decomp_gemv_matmul_t(const pd_t *apd)
+    : primitive_t(apd) {}
+jit_uni_decomp_gemv_matmul_t::~jit_uni_decomp_gemv_matmul_t() = default;
+
+status_t jit_uni_decomp_gemv_matmul_t::init(engine_t *engine) {
+    const auto &c = pd()->conf_;
+    const int n_vregs[2] = {c.N_jit >= c.n_blk ? c.n_vregs : 0,
+            (int)((c.N_jit % c.n_blk) / c.simd_w)};
+    for (int i = 0; i < 2; i++) {
+        if (n_vregs[i] == 0) continue;
+        if (c.isa == avx512_core) {
+            using kernel_t = jit_uni_decomp_gemv_kernel_t<avx512_core>;
+            kernels_[i].reset(new kernel_t(c, n_vregs[i]));
+        } else {
+            using kernel_t = jit_uni_decomp_gemv_kernel_t<avx2>;
+            kernels_[i].reset(new kernel_t(c, n_vregs[i]));
+        }
+        if (!kernels_[i]) return status::out_of_memory;
+        CHECK(kernels_[i]->create_kernel());
+    }
+    return status::success;
+}
+
+status_t jit_uni_decomp_gemv_matmul_t::execute(const exec_ctx_t &ctx) const {
+    const auto &c = pd()->conf_;
+
+    const auto *src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    const auto *wei = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
+    const auto *bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    const auto *scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS);
+    const auto *zp = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS);
+
+    status_t status = status::success;
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    const dim_t M = c.M, N = c.N, K = c.K;
+    const dim_t n_groups = c.n_groups();
+
+    // The source is small, so it's converted once rather than in the kernel
+    // for every block of columns.
+    const float *src_f32 = static_cast<const float *>(src);
+    if (c.src_dt != f32) {
+        auto *src_buf = scratchpad.get<float>(key_matmul_src_trans);
+        if (c.src_dt == bf16)
+            cvt_bfloat16_to_float(
+                    src_buf, static_cast<const bfloat16_t *>(src), M * K);
+        else
+            cvt_float16_to_float(
+                    src_buf, static_cast<const float16_t *>(src), M * K);
+        src_f32 = src_buf;
+    }
+
+    float *src_sums = nullptr;
+    if (c.with_zp) {
+        src_sums = scratchpad.get<float>(key_brgemm_primitive_zp_comp_b);
+        parallel_nd(M, n_groups, [&](dim_t m, dim_t g) {
+            const float *s = src_f32 + m * K + g * c.k_group;
+            float sum = 0.f;
+            for (dim_t k = 0; k < c.k_group; k++)
+                sum += s[k];
+            src_sums[m * n_groups + g] = sum;
+        });
+    }
+
+    // Index of the parameter of a group and a column in an array of the
+    // parameters of the given mask.
+    const auto param_idx = [&](bool per_k, bool per_n, dim_t g, dim_t n) {
+        return (per_k ? g * (per_n ? N : 1) : 0) + (per_n ? n : 0);
+    };
+
+    const float *scales_f32 = static_cast<const float *>(scales);
+    float *zs = nullptr;
+    if (c.scales_size() + c.zs_size() > 0) {
+        float *buf = scratchpad.get<float>(key_precomputed_scales);
+        if (c.scales_size() > 0) {
+            parallel_nd(c.scales_size(), [&](dim_t i) {
+                buf[i] = io::load_float_value(c.scales_dt, scales, i);
+            });
+            scales_f32 = buf;
+        }
+        zs = buf + c.scales_size();
+    }
+    if (c.with_zp) {
+        const dim_t zs_n = c.zs_per_n ? N : 1;
+        parallel_nd(c.zs_per_k ? n_groups : 1, zs_n, [&](dim_t g, dim_t n) {
+            float val = io::load_float_value(
+                    c.zp_dt, zp, param_idx(c.zp_per_k, c.zp_per_n, g, n));
+            if (c.with_scales)
+                val *= scales_f32[param_idx(
+                        c.scales_per_k, c.scales_per_n, g, n)];
+            zs[g * zs_n + n] = val;
+        });
+    }
+
+    float *dst_f32 = c.dst_dt == f32
+            ? static_cast<float *>(dst)
+            : scratchpad.get<float>(key_matmul_dst_in_acc_dt);
+
+    const dim_t n_full_blks = c.N_jit / c.n_blk;
+    const dim_t n_blks = utils::div_up(c.N_jit, c.n_blk);
+    parallel_nd(n_blks, [&](dim_t nb) {
+        const dim_t n = nb * c.n_blk;
+        const bool is_tail = nb == n_full_blks;
+
+        decomp_gemv_kernel_t::call_params_t p;
+        p.src = src_f32;
+        p.wei = static_cast<const char *>(wei)
+                + (utils::one_of(c.wei_dt, s4, u4) ? n / 2 : n);
+        p.scales = c.with_scales ? scales_f32 + (c.scales_per_n ? n : 0)
+                                 : nullptr;
+        p.zs = c.with_zp ? zs + (c.zs_per_n ? n : 0) : nullptr;
+        p.src_sums = src_sums;
+        p.bias = c.with_bias ? bias + n : nullptr;
+        p.dst = dst_f32 + n;
+        (*kernels_[is_tail])(&p);
+
+        if (c.dst_dt == f32) return;
+        const dim_t n_cols = is_tail ? c.N_jit - n : c.n_blk;
+        for (dim_t m = 0; m < M; m++) {
+            const float *from = dst_f32 + m * N + n;
+            if (c.dst_dt == bf16)
+                cvt_float_to_bfloat16(
+                        static_cast<bfloat16_t *>(dst) + m * N + n, from,
+                        n_cols);
+            else
+                cvt_float_to_float16(static_cast<float16_t *>(dst) + m * N + n,
+                        from, n_cols);
+        }
+    });
+
+    // Columns that don't fill a vector register.
+    parallel_nd(M, N - c.N_jit, [&](dim_t m, dim_t i) {
+        const dim_t n = c.N_jit + i;
+        float acc = 0.f;
+        for (dim_t g = 0; g < n_groups; g++) {
+            float sum = 0.f;
+            for (dim_t k = g * c.k_group; k < (g + 1) * c.k_group; k++)
+                sum += src_f32[m * K + k]
+                        * io::load_float_value(c.wei_dt, wei, k * N + n);
+            if (c.with_scales)
+                sum *= scales_f32[param_idx(
+                        c.scales_per_k, c.scales_per_n, g, n)];
+            if (c.with_zp)
+                sum -= zs[param_idx(c.zs_per_k, c.zs_per_n, g, n)]
+                        * src_sums[m * n_groups + g];
+            acc += sum;
+        }
+        if (c.with_bias) acc += bias[n];
+        io::store_float_value(c.dst_dt, acc, dst, m * N + n);
+    });
+
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
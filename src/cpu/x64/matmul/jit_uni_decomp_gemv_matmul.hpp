@@ -0,0 +1,128 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_JIT_UNI_DECOMP_GEMV_MATMUL_HPP
+#define CPU_X64_MATMUL_JIT_UNI_DECOMP_GEMV_MATMUL_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+struct decomp_gemv_conf_t {
+    cpu_isa_t isa;
+    dim_t M, N, K;
+    data_type_t src_dt, wei_dt, dst_dt;
+
+    int simd_w;
+    // Number of vector registers of columns computed by a kernel call.
+    int n_vregs;
+    dim_t n_blk;
+    // Number of columns computed by the kernels. The remaining columns don't
+    // fill a vector register and are computed outside of them.
+    dim_t N_jit;
+    // Rows of the weights reduced before scales and zero points are applied.
+    dim_t k_group;
+
+    bool with_scales, scales_per_n, scales_per_k;
+    data_type_t scales_dt;
+    bool with_zp, zp_per_n, zp_per_k;
+    data_type_t zp_dt;
+    // The zero points are applied as products with the scales, which vary
+    // along the dimensions of either of them.
+    bool zs_per_n, zs_per_k;
+    bool with_bias;
+
+    dim_t n_groups() const { return K / k_group; }
+    // Number of the scales converted to f32, or 0 if they are used as is.
+    dim_t scales_size() const {
+        if (!with_scales || scales_dt == data_type::f32) return 0;
+        return (scales_per_k ? n_groups() : 1) * (scales_per_n ? N : 1);
+    }
+    dim_t zs_size() const {
+        if (!with_zp) return 0;
+        return (zs_per_k ? n_groups() : 1) * (zs_per_n ? N : 1);
+    }
+};
+
+struct decomp_gemv_kernel_t;
+
+// Matmul with a few rows of the source and integer weights that are
+// decompressed on the fly, e.g. token generation of large language models.
+// The weights are read directly from the user layout: a kernel converts them
+// to f32 in registers and accumulates each group of rows of the weights
+// before applying the group scales and zero points, so the weights pass
+// through memory only once. The source, the scales and the zero points are
+// converted to f32 up front along with the sums of the source groups needed
+// to apply zero points.
+struct jit_uni_decomp_gemv_matmul_t : public primitive_t {
+    struct pd_t : public dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit_gemv:", conf_.isa, ""),
+                jit_uni_decomp_gemv_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        // The largest number of rows of the source this implementation is
+        // selected for.
+        static constexpr dim_t max_M = 4;
+
+        decomp_gemv_conf_t conf_ = decomp_gemv_conf_t();
+
+    private:
+        bool formats_ok() const;
+        bool attr_ok() const;
+        status_t init_conf(engine_t *engine);
+        void init_scratchpad();
+    };
+
+    jit_uni_decomp_gemv_matmul_t(const pd_t *apd);
+    ~jit_uni_decomp_gemv_matmul_t() override;
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // Kernels for a full block of columns and for the tail.
+    std::unique_ptr<decomp_gemv_kernel_t> kernels_[2];
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
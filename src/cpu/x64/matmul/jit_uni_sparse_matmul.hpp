@@ -53,6 +53,7 @@ struct jit_uni_sparse_matmul_t : public primitive_t {
             const bool problem_dt_correct
                     = utils::everyone_is(f32, src_type, wei_type, dst_type)
                     && src_d.is_sparse_desc() && !wei_d.is_sparse_desc()
+                    && src_d.encoding() == sparse_encoding::csr
                     && utils::everyone_is(s32, src_d.metadata_type(0),
                             src_d.metadata_type(1));
 
@@ -14,9 +14,16 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <utility>
+
 #include "common/memory_desc_wrapper.hpp"
+#include "common/utils.hpp"
 #include "common/verbose.hpp"
 
+#include "cpu/platform.hpp"
 #include "cpu/ref_io_helper.hpp"
 
 #include "cpu/x64/amx_tile_configure.hpp"
@@ -40,6 +47,77 @@ using namespace dnnl::impl::cpu::ukernel;
     VCONDCHECK(ukernel, create, check, brgemm, (cond), (status), msg, \
             ##__VA_ARGS__)
 
+namespace {
+// Alignment of packed tensors B.
+constexpr size_t packed_B_align = 64;
+
+// Packed copies of tensors B made on the calling thread. A tensor B is packed
+// the first time an object sees it, and later calls on the same thread reuse
+// the packed copy. The buffer is bounded by the L2 cache size, so the copies
+// stay close to the core; when a batch doesn't fit, older copies are dropped.
+struct packed_B_cache_t {
+    packed_B_cache_t() = default;
+    ~packed_B_cache_t() { dnnl::impl::free(buf_); }
+
+    // Returns the packed copy of `src` made by the object `id`, or nullptr.
+    const void *find(size_t id, const void *src) const {
+        const auto it = offsets_.find({id, src});
+        return it == offsets_.end() ? nullptr : buf_ + it->second;
+    }
+
+    // Makes room for `n` more packed tensors of `size` bytes each. If they
+    // don't fit the budget, all copies are dropped and room is made for
+    // `n_max` tensors instead. Previously returned pointers are invalidated.
+    status_t reserve(size_t n, size_t n_max, size_t size) {
+        const size_t budget = cpu::platform::get_per_core_cache_size(2);
+        if (used_ + n * size > nstl::max(budget, n_max * size)) {
+            clear();
+            n = n_max;
+        }
+        const size_t required = used_ + n * size;
+        if (required <= capacity_) return status::success;
+
+        char *buf = static_cast<char *>(
+                dnnl::impl::malloc(required, packed_B_align));
+        if (buf == nullptr) return status::out_of_memory;
+        if (used_ > 0) std::memcpy(buf, buf_, used_);
+        dnnl::impl::free(buf_);
+        buf_ = buf;
+        capacity_ = required;
+        return status::success;
+    }
+
+    // Takes the next slot of `size` bytes for the copy of `src`.
+    void *insert(size_t id, const void *src, size_t size) {
+        offsets_[{id, src}] = used_;
+        void *ptr = buf_ + used_;
+        used_ += size;
+        return ptr;
+    }
+
+    void clear() {
+        offsets_.clear();
+        used_ = 0;
+    }
+
+private:
+    std::map<std::pair<size_t, const void *>, size_t> offsets_;
+    char *buf_ = nullptr;
+    size_t capacity_ = 0;
+    size_t used_ = 0;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(packed_B_cache_t);
+};
+
+packed_B_cache_t &packed_B_cache() {
+    static thread_local packed_B_cache_t cache;
+    return cache;
+}
+
+// Distinguishes packed copies of the same tensor made by different objects.
+std::atomic<size_t> pack_B_id_counter(0);
+} // namespace
+
 dnnl_brgemm::~dnnl_brgemm() {
     brgemm_kernel_destroy(brgemm_kernel_);
 }
@@ -68,8 +146,27 @@ status_t brgemm_t::set_scales(int mask, int arg) {
     return status::success;
 }
 
+status_t brgemm_t::set_pack_B(pack_type_t in_pack_type, dim_t in_ldb) {
+    VCHECK_BRGEMM(utils::one_of(in_pack_type, pack_type::no_trans,
+                          pack_type::trans),
+            "B packing supports only \'no_trans\' and \'trans\' inputs.");
+    VCHECK_BRGEMM(utils::one_of(ldb_, 16, 32, 48, 64) && N_ <= ldb_,
+            "B packing supports only \'ldb\' of 16, 32, 48, or 64.");
+    VCHECK_BRGEMM(in_pack_type == pack_type::no_trans
+                    ? IMPLICATION(K_ > 1, in_ldb >= N_)
+                    : in_ldb >= K_,
+            "\'in_ldb\' is too small.");
+
+    pack_B_ = true;
+    B_in_pack_type_ = in_pack_type;
+    B_in_ld_ = in_ldb;
+    return status::success;
+}
+
 status_t brgemm_t::finalize() {
-    brgemm_batch_kind_t batch_kind = brgemm_batch_kind_t::brgemm_offs;
+    // Both offsets and pointers are turned into pointers at execution, which
+    // also allows to substitute packed tensors B.
+    brgemm_batch_kind_t batch_kind = brgemm_batch_kind_t::brgemm_addr;
 
     auto status = brgemm_desc_init(&brgemm_desc_, cpu_isa_t::isa_undef,
             batch_kind, a_dt_, b_dt_, /* transA = */ false,
@@ -127,6 +224,14 @@ status_t brgemm_t::finalize() {
     status = brgemm_init_tiles(brgemm_desc_, palette_);
     palette_initialized_ = (status == status::success);
 
+    if (pack_B_) {
+        pack_B_transform_.reset(new transform_t(
+                K_, N_, B_in_pack_type_, B_in_ld_, ldb_, b_dt_, b_dt_));
+        packed_B_size_ = utils::rnd_up(
+                pack_B_transform_->get_out_size(), packed_B_align);
+        pack_B_id_ = ++pack_B_id_counter;
+    }
+
     return status::success;
 }
 
@@ -177,6 +282,12 @@ status_t brgemm_t::generate() {
     VCHECK_BRGEMM_STATUS(
             status, status == status::success, "brgemm_kernel_create failed");
 
+    if (pack_B_) {
+        status = pack_B_transform_->generate();
+        VCHECK_BRGEMM_STATUS(status, status == status::success,
+                "B packing kernel generation failed");
+    }
+
     // Generate a verbose info string at the point where configuration is done.
     if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
         create_verbose_info();
@@ -187,17 +298,88 @@ status_t brgemm_t::generate() {
 status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
         const dim_t *A_B_offsets, void *C_ptr, void *scratchpad_ptr) const {
     const auto batch_size = brgemm_desc_.brgattr.max_bs;
+    const auto *A_base = static_cast<const char *>(A_ptr);
+    const auto *B_base = static_cast<const char *>(B_ptr);
+    std::vector<brgemm_batch_element_t> v_batch_element(batch_size);
+    for (int i = 0; i < batch_size; i++) {
+        v_batch_element[i].ptr.A = A_base + A_B_offsets[2 * i];
+        v_batch_element[i].ptr.B = B_base + A_B_offsets[2 * i + 1];
+    }
+    return execute_batch(v_batch_element, C_ptr, scratchpad_ptr);
+}
+
+status_t brgemm_t::execute(const void *const *A_ptrs,
+        const void *const *B_ptrs, void *C_ptr, void *scratchpad_ptr) const {
+    const auto batch_size = brgemm_desc_.brgattr.max_bs;
+    std::vector<brgemm_batch_element_t> v_batch_element(batch_size);
+    for (int i = 0; i < batch_size; i++) {
+        v_batch_element[i].ptr.A = A_ptrs[i];
+        v_batch_element[i].ptr.B = B_ptrs[i];
+    }
+    return execute_batch(v_batch_element, C_ptr, scratchpad_ptr);
+}
+
+status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
+        const dim_t *A_B_offsets, const void *C_ptr, void *D_ptr,
+        void *scratchpad_ptr, const attr_params_t *attr_params) const {
+    const auto batch_size = brgemm_desc_.brgattr.max_bs;
+    const auto *A_base = static_cast<const char *>(A_ptr);
+    const auto *B_base = static_cast<const char *>(B_ptr);
     std::vector<brgemm_batch_element_t> v_batch_element(batch_size);
     for (int i = 0; i < batch_size; i++) {
-        v_batch_element[i].offset.A = A_B_offsets[2 * i];
-        v_batch_element[i].offset.B = A_B_offsets[2 * i + 1];
+        v_batch_element[i].ptr.A = A_base + A_B_offsets[2 * i];
+        v_batch_element[i].ptr.B = B_base + A_B_offsets[2 * i + 1];
     }
+    return execute_batch(
+            v_batch_element, C_ptr, D_ptr, scratchpad_ptr, attr_params);
+}
+
+status_t brgemm_t::execute(const void *const *A_ptrs,
+        const void *const *B_ptrs, const void *C_ptr, void *D_ptr,
+        void *scratchpad_ptr, const attr_params_t *attr_params) const {
+    const auto batch_size = brgemm_desc_.brgattr.max_bs;
+    std::vector<brgemm_batch_element_t> v_batch_element(batch_size);
+    for (int i = 0; i < batch_size; i++) {
+        v_batch_element[i].ptr.A = A_ptrs[i];
+        v_batch_element[i].ptr.B = B_ptrs[i];
+    }
+    return execute_batch(
+            v_batch_element, C_ptr, D_ptr, scratchpad_ptr, attr_params);
+}
 
+// Points every batch element to the packed copy of its tensor B made on the
+// calling thread. Tensors B seen for the first time are packed here.
+status_t brgemm_t::pack_B(std::vector<brgemm_batch_element_t> &batch) const {
+    if (!pack_B_) return status::success;
+
+    auto &cache = packed_B_cache();
+    size_t n_new = 0;
+    for (const auto &batch_element : batch)
+        n_new += cache.find(pack_B_id_, batch_element.ptr.B) == nullptr;
+    if (n_new > 0) CHECK(cache.reserve(n_new, batch.size(), packed_B_size_));
+
+    for (auto &batch_element : batch) {
+        const void *packed_B_ptr = cache.find(pack_B_id_, batch_element.ptr.B);
+        if (packed_B_ptr == nullptr) {
+            void *ptr = cache.insert(
+                    pack_B_id_, batch_element.ptr.B, packed_B_size_);
+            CHECK(pack_B_transform_->execute(batch_element.ptr.B, ptr));
+            packed_B_ptr = ptr;
+        }
+        batch_element.ptr.B = packed_B_ptr;
+    }
+    return status::success;
+}
+
+status_t brgemm_t::execute_batch(std::vector<brgemm_batch_element_t> &batch,
+        void *C_ptr, void *scratchpad_ptr) const {
+    CHECK(pack_B(batch));
+
+    const auto batch_size = brgemm_desc_.brgattr.max_bs;
     if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
         double start_ms = get_msec();
-        brgemm_kernel_execute(brgemm_kernel_, batch_size, A_ptr, B_ptr,
-                v_batch_element.data(), C_ptr, scratchpad_ptr,
-                /* dynamic_values = */ nullptr);
+        brgemm_kernel_execute(brgemm_kernel_, batch_size, batch.data(), C_ptr,
+                scratchpad_ptr, /* dynamic_values = */ nullptr);
         double duration_ms = get_msec() - start_ms;
 
         stringstream_t ss;
@@ -205,22 +387,21 @@ status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
         VPROF(start_ms, ukernel, exec, VERBOSE_profile, ss.str().c_str(),
                 duration_ms);
     } else {
-        brgemm_kernel_execute(brgemm_kernel_, batch_size, A_ptr, B_ptr,
-                v_batch_element.data(), C_ptr, scratchpad_ptr,
-                /* dynamic_values = */ nullptr);
+        brgemm_kernel_execute(brgemm_kernel_, batch_size, batch.data(), C_ptr,
+                scratchpad_ptr, /* dynamic_values = */ nullptr);
     }
     return status::success;
 }
 
-status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
-        const dim_t *A_B_offsets, const void *C_ptr, void *D_ptr,
-        void *scratchpad_ptr, const attr_params_t *attr_params) const {
+status_t brgemm_t::execute_batch(std::vector<brgemm_batch_element_t> &batch,
+        const void *C_ptr, void *D_ptr, void *scratchpad_ptr,
+        const attr_params_t *attr_params) const {
     if (attr_params == nullptr) return status::invalid_arguments;
 
     if (!brgemm_desc_.are_post_ops_applicable()) {
         if (C_ptr == D_ptr) {
-            return execute(A_ptr, B_ptr, A_B_offsets, const_cast<void *>(C_ptr),
-                    scratchpad_ptr);
+            return execute_batch(
+                    batch, const_cast<void *>(C_ptr), scratchpad_ptr);
         } else {
             VCHECK_BRGEMM_STATUS(status::runtime_error, false,
                     "the kernel won't return correct results with this "
@@ -228,12 +409,9 @@ status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
         }
     }
 
+    CHECK(pack_B(batch));
+
     const auto batch_size = brgemm_desc_.brgattr.max_bs;
-    std::vector<brgemm_batch_element_t> v_batch_element(batch_size);
-    for (int i = 0; i < batch_size; i++) {
-        v_batch_element[i].offset.A = A_B_offsets[2 * i];
-        v_batch_element[i].offset.B = A_B_offsets[2 * i + 1];
-    }
 
     brgemm_post_ops_data_t post_ops_data;
     // Note: this member is used to compute an offset from the base DST address.
@@ -304,10 +482,9 @@ status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
 
     if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
         double start_ms = get_msec();
-        brgemm_kernel_execute_postops(brgemm_kernel_, batch_size, A_ptr, B_ptr,
-                v_batch_element.data(), const_cast<void *>(C_ptr), D_ptr,
-                post_ops_data, scratchpad_ptr,
-                /* dynamic_values = */ nullptr);
+        brgemm_kernel_execute_postops(brgemm_kernel_, batch_size,
+                batch.data(), const_cast<void *>(C_ptr), D_ptr, post_ops_data,
+                scratchpad_ptr, /* dynamic_values = */ nullptr);
         double duration_ms = get_msec() - start_ms;
 
         stringstream_t ss;
@@ -315,10 +492,9 @@ status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
         VPROF(start_ms, ukernel, exec, VERBOSE_profile, ss.str().c_str(),
                 duration_ms);
     } else {
-        brgemm_kernel_execute_postops(brgemm_kernel_, batch_size, A_ptr, B_ptr,
-                v_batch_element.data(), const_cast<void *>(C_ptr), D_ptr,
-                post_ops_data, scratchpad_ptr,
-                /* dynamic_values = */ nullptr);
+        brgemm_kernel_execute_postops(brgemm_kernel_, batch_size,
+                batch.data(), const_cast<void *>(C_ptr), D_ptr, post_ops_data,
+                scratchpad_ptr, /* dynamic_values = */ nullptr);
     }
     return status::success;
 }
@@ -412,6 +588,14 @@ status_t dnnl_brgemm_set_D_scales(brgemm_t *brgemm, int d_scale_mask) {
     return status::success;
 }
 
+status_t dnnl_brgemm_set_pack_B(
+        brgemm_t *brgemm, pack_type_t in_pack_type, dim_t in_ldb) {
+    if (brgemm == nullptr) return status::invalid_arguments;
+
+    CHECK(brgemm->set_pack_B(in_pack_type, in_ldb));
+    return status::success;
+}
+
 status_t dnnl_brgemm_finalize(brgemm_t *brgemm) {
     if (brgemm == nullptr) return status::invalid_arguments;
 
@@ -448,6 +632,9 @@ status_t dnnl_brgemm_set_hw_context(const brgemm_t *brgemm) {
 }
 
 status_t dnnl_brgemm_release_hw_context() {
+    // Tensors B may change once the calls of the region are done.
+    packed_B_cache().clear();
+
     if (mayiuse(avx512_core_amx)) {
         VCHECK_BRGEMM(amx_tile_release() == status::success,
                 "amx_tile_release failed");
@@ -478,6 +665,28 @@ status_t dnnl_brgemm_execute_postops(const brgemm_t *brgemm, const void *A_ptr,
     return status::success;
 }
 
+status_t dnnl_brgemm_execute_ptrs(const brgemm_t *brgemm,
+        const void *const *A_ptrs, const void *const *B_ptrs, void *C_ptr,
+        void *scratchpad_ptr) {
+    if (utils::any_null(brgemm, A_ptrs, B_ptrs))
+        return status::invalid_arguments;
+
+    CHECK(brgemm->execute(A_ptrs, B_ptrs, C_ptr, scratchpad_ptr));
+    return status::success;
+}
+
+status_t dnnl_brgemm_execute_ptrs_postops(const brgemm_t *brgemm,
+        const void *const *A_ptrs, const void *const *B_ptrs,
+        const void *C_ptr, void *D_ptr, void *scratchpad_ptr,
+        const attr_params_t *attr_params) {
+    if (utils::any_null(brgemm, A_ptrs, B_ptrs))
+        return status::invalid_arguments;
+
+    CHECK(brgemm->execute(A_ptrs, B_ptrs, C_ptr, D_ptr, scratchpad_ptr,
+            attr_params));
+    return status::success;
+}
+
 status_t dnnl_brgemm_destroy(brgemm_t *brgemm) {
     delete brgemm;
     return status::success;
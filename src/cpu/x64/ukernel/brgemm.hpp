@@ -17,12 +17,16 @@
 #ifndef CPU_X64_UKERNEL_BRGEMM_HPP
 #define CPU_X64_UKERNEL_BRGEMM_HPP
 
+#include <memory>
+#include <vector>
+
 #include "cpu/ukernel/c_types_map.hpp"
 
 #include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/brgemm/brgemm_types.hpp"
 
 #include "cpu/x64/ukernel/attr_params.hpp"
+#include "cpu/x64/ukernel/transform.hpp"
 
 #ifdef DNNL_EXPERIMENTAL_UKERNEL
 
@@ -57,6 +61,10 @@ struct dnnl_brgemm : public dnnl::impl::c_compatible {
 
     dnnl::impl::status_t set_scales(int mask, int arg);
 
+    dnnl::impl::status_t set_pack_B(
+            dnnl::impl::cpu::ukernel::pack_type_t in_pack_type,
+            dnnl::impl::dim_t in_ldb);
+
     dnnl::impl::status_t finalize();
 
     static dnnl::impl::status_t get_B_pack_type(
@@ -78,6 +86,13 @@ struct dnnl_brgemm : public dnnl::impl::c_compatible {
             const dnnl::impl::dim_t *A_B_offsets, const void *C_ptr,
             void *D_ptr, void *scratchpad_ptr,
             const dnnl::impl::cpu::ukernel::attr_params_t *attr_params) const;
+    dnnl::impl::status_t execute(const void *const *A_ptrs,
+            const void *const *B_ptrs, void *C_ptr,
+            void *scratchpad_ptr) const;
+    dnnl::impl::status_t execute(const void *const *A_ptrs,
+            const void *const *B_ptrs, const void *C_ptr, void *D_ptr,
+            void *scratchpad_ptr,
+            const dnnl::impl::cpu::ukernel::attr_params_t *attr_params) const;
 
 private:
     // User's inputs.
@@ -99,6 +114,30 @@ private:
 
     bool palette_initialized_ = false;
     char palette_[dnnl::impl::cpu::x64::AMX_PALETTE_SIZE] = {};
+
+    // Packing of B on execution, set by `set_pack_B()`. Packed tensors are
+    // kept in a thread-local buffer and reused by later calls on the thread
+    // until `dnnl_brgemm_release_hw_context()`.
+    bool pack_B_ = false;
+    dnnl::impl::cpu::ukernel::pack_type_t B_in_pack_type_
+            = dnnl::impl::cpu::ukernel::pack_type::undef;
+    dnnl::impl::dim_t B_in_ld_ = 0;
+    std::unique_ptr<dnnl_transform> pack_B_transform_;
+    size_t packed_B_size_ = 0;
+    size_t pack_B_id_ = 0;
+
+    // Both flavors of execution end up here with a batch of pointers. Tensors
+    // B are packed first if requested.
+    dnnl::impl::status_t execute_batch(
+            std::vector<dnnl::impl::cpu::x64::brgemm_batch_element_t> &batch,
+            void *C_ptr, void *scratchpad_ptr) const;
+    dnnl::impl::status_t execute_batch(
+            std::vector<dnnl::impl::cpu::x64::brgemm_batch_element_t> &batch,
+            const void *C_ptr, void *D_ptr, void *scratchpad_ptr,
+            const dnnl::impl::cpu::ukernel::attr_params_t *attr_params) const;
+    dnnl::impl::status_t pack_B(
+            std::vector<dnnl::impl::cpu::x64::brgemm_batch_element_t> &batch)
+            const;
 };
 
 namespace dnnl {
@@ -122,6 +161,9 @@ status_t dnnl_brgemm_set_B_scales(dnnl_brgemm *brgemm, int b_scale_mask);
 
 status_t dnnl_brgemm_set_D_scales(dnnl_brgemm *brgemm, int d_scale_mask);
 
+status_t dnnl_brgemm_set_pack_B(dnnl_brgemm *brgemm,
+        dnnl::impl::cpu::ukernel::pack_type_t in_pack_type, dim_t in_ldb);
+
 status_t dnnl_brgemm_finalize(dnnl_brgemm *brgemm);
 
 status_t dnnl_brgemm_get_B_pack_type(
@@ -149,6 +191,15 @@ status_t dnnl_brgemm_execute_postops(const dnnl_brgemm *brgemm,
         const void *C_ptr, void *D_ptr, void *scratchpad_ptr,
         const dnnl_ukernel_attr_params *attr_params);
 
+status_t dnnl_brgemm_execute_ptrs(const dnnl_brgemm *brgemm,
+        const void *const *A_ptrs, const void *const *B_ptrs, void *C_ptr,
+        void *scratchpad_ptr);
+
+status_t dnnl_brgemm_execute_ptrs_postops(const dnnl_brgemm *brgemm,
+        const void *const *A_ptrs, const void *const *B_ptrs,
+        const void *C_ptr, void *D_ptr, void *scratchpad_ptr,
+        const dnnl_ukernel_attr_params *attr_params);
+
 status_t dnnl_brgemm_destroy(dnnl_brgemm *brgemm);
 
 } // namespace ukernel
@@ -136,6 +136,14 @@ status_t transform_t::execute(const void *src, void *dst) const {
     return status::success;
 }
 
+size_t transform_t::get_out_size() const {
+    const auto &kernel_conf = bmc_;
+    const dim_t n_blks = utils::div_up(kernel_conf.N, kernel_conf.N_blk);
+    const dim_t k_blks = utils::div_up(kernel_conf.K, kernel_conf.K_blk);
+    return n_blks * k_blks * kernel_conf.K_blk * kernel_conf.N_blk
+            * kernel_conf.a_dt_sz;
+}
+
 status_t transform_t::create_verbose_info() {
 #if defined(DISABLE_VERBOSE)
     return status::success;
@@ -39,6 +39,9 @@ struct dnnl_transform : public dnnl::impl::c_compatible {
     // Executes a transform kernel.
     dnnl::impl::status_t execute(const void *src, void *dst) const;
 
+    // Returns the size of the output buffer in bytes.
+    size_t get_out_size() const;
+
 private:
     // User's inputs.
     dnnl::impl::dim_t K_, N_;
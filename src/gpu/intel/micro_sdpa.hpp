@@ -110,6 +110,8 @@ struct micro_sdpa_t : public gpu_primitive_t {
         status_t init(impl::engine_t *engine) {
             using namespace data_type;
 
+            VDISPATCH_SDPA(!with_block_table(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "paged keys and values");
             VCHECK_SDPA_COND(
                     utils::everyone_is(4, qry_md()->ndims, key_md()->ndims,
                             val_md()->ndims, dst_md()->ndims),
@@ -47,6 +47,8 @@ struct ref_sdpa_t : public gpu_primitive_t {
             /* Reference SDPA is only enabled on-demand, for testing. */
             bool enable_ref = gpu_utils::dev_getenv("enable_ref_sdpa", false);
             VDISPATCH_SDPA(enable_ref, VERBOSE_SKIP_PRIMITIVE_IMPL);
+            VDISPATCH_SDPA(!with_block_table(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "paged keys and values");
 
             VDISPATCH_SDPA(attr()->has_default_values(smask_t::scales),
                     VERBOSE_UNSUPPORTED_ATTR);
@@ -65,6 +65,7 @@ pass::pass_registry_t dnnl_backend_t::register_passes() {
     DNNL_BACKEND_REGISTER_PATTERN_CALL(reorder_fusion, pass_registry);
     DNNL_BACKEND_REGISTER_PATTERN_CALL(shuffle_fusion, pass_registry);
     DNNL_BACKEND_REGISTER_PATTERN_CALL(reduction_fusion, pass_registry);
+    DNNL_BACKEND_REGISTER_PATTERN_CALL(gather_fusion, pass_registry);
     DNNL_BACKEND_REGISTER_PATTERN_CALL(groupnorm_fusion, pass_registry);
     DNNL_BACKEND_REGISTER_PATTERN_CALL(mlp, pass_registry);
 
@@ -88,6 +88,43 @@ inline bool is_constant_cache_enabled(const dnnl::engine &eng) {
     return cache && cache->get_capacity() != 0;
 }
 
+inline bool is_constant_cache_backed(const dnnl::engine &eng) {
+    auto cache = graph::get_constant_tensor_cache(
+            eng.get()->kind(), eng.get()->index());
+    return cache && cache->is_backed();
+}
+
+inline graph::constant_tensor_cache_t::cached_t dnnl_constant_cache_load(
+        const dnnl::engine &eng, graph::constant_tensor_cache_t::key_t key,
+        size_t size) {
+    auto cache = graph::get_constant_tensor_cache(
+            eng.get()->kind(), eng.get()->index());
+    assertm(cache,
+            "no available constant cache for specified engine kind and index");
+    return cache->load_from_backing_store(
+            eng.get(), dnnl_backend_t::get_singleton().get_id(), key, size);
+}
+
+inline void dnnl_constant_cache_store(const dnnl::engine &eng,
+        graph::constant_tensor_cache_t::key_t key,
+        const graph::constant_tensor_cache_t::cached_t &buffer) {
+    auto cache = graph::get_constant_tensor_cache(
+            eng.get()->kind(), eng.get()->index());
+    assertm(cache,
+            "no available constant cache for specified engine kind and index");
+    cache->store_to_backing_store(
+            dnnl_backend_t::get_singleton().get_id(), key, buffer);
+}
+
+inline void dnnl_constant_cache_set_cost(const dnnl::engine &eng,
+        graph::constant_tensor_cache_t::key_t key, double cost) {
+    auto cache = graph::get_constant_tensor_cache(
+            eng.get()->kind(), eng.get()->index());
+    assertm(cache,
+            "no available constant cache for specified engine kind and index");
+    cache->set_cost(dnnl_backend_t::get_singleton().get_id(), key, cost);
+}
+
 inline void dnnl_constant_cache_retain(const dnnl::engine &eng) {
     auto cache = graph::get_constant_tensor_cache(
             eng.get()->kind(), eng.get()->index());
@@ -211,6 +211,73 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_permute, 1,
                 .SET_EXECUTABLE_CREATOR(executable_creator<memory_reparser_t>)
                 .SET_ARG_INDICES_GETTER(memory_reparser_t))
 
+DNNL_GRAPH_OP_SCHEMA(dnnl_paged_cache_load, 1,
+        op_schema_t()
+                .set_num_inputs(2)
+                .set_num_outputs(1)
+                .set_input(0, "cache")
+                .set_input(1, "block_table")
+                .set_output(0, "output")
+                .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                // Analysis rules
+                .set_shape_inference_function(
+                        infer_paged_cache_load_output_shape)
+                .SET_LAYOUT_PROPAGATOR(layout_propagator_for_paged_cache_load)
+                .SET_EXECUTABLE_CREATOR(
+                        executable_creator<paged_cache_load_executable_t>)
+                .SET_ARG_INDICES_GETTER(paged_cache_load_executable_t))
+
+// The table may be fused with the dequantization of its rows, in which case
+// the scales and the zero points are the optional inputs or attributes of the
+// op, and with the sum of the rows gathered along the last dimension of the
+// indices.
+DNNL_GRAPH_OP_SCHEMA(dnnl_gather, 1,
+        op_schema_t()
+                .set_inputs_option(op_schema_t::param_num_option::variadic)
+                .set_num_inputs(std::set<size_t>({2, 4}))
+                .set_num_outputs(2)
+                .set_input(0, "src")
+                .set_input(1, "indices")
+                .set_input(2, "scales") // optional
+                .set_input(3, "zps") // optional
+                .set_output(0, "dst")
+                .set_output(1, "scratchpad")
+                .set_attr(
+                        op_attr::qtype, false, attribute_kind::s, "per_tensor")
+                .set_attr(op_attr::scales, false, attribute_kind::fs,
+                        std::vector<float>())
+                .set_attr(op_attr::zps, false, attribute_kind::is,
+                        std::vector<int64_t>())
+                .set_attr(op_attr::with_runtime_scales, false,
+                        attribute_kind::b, false)
+                .set_attr(op_attr::with_runtime_zps, false, attribute_kind::b,
+                        false)
+                .set_attr(op_attr::with_sum, false, attribute_kind::b, false)
+                .set_attr(op_attr::keep_dims, false, attribute_kind::b, false)
+                .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                // Analysis rules
+                .set_shape_inference_function(infer_dnnl_gather_output_shape)
+                .SET_LAYOUT_PROPAGATOR(layout_propagator_for_gather)
+                .SET_EXECUTABLE_CREATOR(executable_creator<gather_executable_t>)
+                .SET_ARG_INDICES_GETTER(gather_executable_t))
+
+DNNL_GRAPH_OP_SCHEMA(dnnl_rotary_embedding, 1,
+        op_schema_t()
+                .set_num_inputs(3)
+                .set_num_outputs(1)
+                .set_input(0, "src")
+                .set_input(1, "cos")
+                .set_input(2, "sin")
+                .set_output(0, "dst")
+                .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                // Analysis rules
+                .set_shape_inference_function(
+                        infer_rotary_embedding_output_shape)
+                .SET_LAYOUT_PROPAGATOR(layout_propagator_for_rotary_embedding)
+                .SET_EXECUTABLE_CREATOR(
+                        executable_creator<rotary_embedding_executable_t>)
+                .SET_ARG_INDICES_GETTER(rotary_embedding_executable_t))
+
 DNNL_GRAPH_OP_SCHEMA(dnnl_to_group, 1,
         op_schema_t()
                 .set_num_inputs(1)
@@ -602,6 +602,44 @@ status_t infer_dnnl_sdpa_output_shape(op_t *n,
     return status::success;
 }
 
+status_t infer_dnnl_gather_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto src = logical_tensor_wrapper_t(inputs[0]);
+    auto indices = logical_tensor_wrapper_t(inputs[1]);
+    auto out0 = logical_tensor_wrapper_t(outputs[0]);
+
+    VCHECK_INVALID_SHAPE((src.ndims() >= 1 && indices.ndims() >= 1),
+            "%s, src and indices should have at least 1 dim, given src dims: "
+            "%d, indices dims: %d",
+            op_t::kind2str(n->get_kind()).c_str(), src.ndims(),
+            indices.ndims());
+
+    // The rows gathered with the indices of the last dimension are summed up
+    // when the op is fused with a reduction.
+    dims output_dims = indices.vdims();
+    if (n->has_attr(op_attr::with_sum)
+            && n->get_attr<bool>(op_attr::with_sum)) {
+        const bool keep_dims = n->has_attr(op_attr::keep_dims)
+                && n->get_attr<bool>(op_attr::keep_dims);
+        if (keep_dims)
+            output_dims.back() = 1;
+        else
+            output_dims.pop_back();
+    }
+    const dims src_dims = src.vdims();
+    output_dims.insert(output_dims.end(), src_dims.begin() + 1, src_dims.end());
+
+    if (out0.ndims() != -1) {
+        VCHECK_INVALID_SHAPE(validate(output_dims, out0.vdims()),
+                "%s, inferred out shape and output shape are not compatible",
+                op_t::kind2str(n->get_kind()).c_str());
+    }
+
+    set_shape_and_strides(*outputs[0], output_dims);
+    return status::success;
+}
+
 status_t infer_dnnl_host_scalar_output_shape(op_t *n,
         std::vector<logical_tensor_t *> &inputs,
         std::vector<logical_tensor_t *> &outputs) {
@@ -79,7 +79,10 @@ namespace op_kind {
     X(dnnl_convtranspose_bwd_weights, Dnnl_convtranspose_bwd_weights) \
     X(dnnl_groupnorm, Dnnl_groupnorm) \
     X(dnnl_gen_index, Dnnl_gen_index) \
+    X(dnnl_gather, Dnnl_gather) \
     X(dnnl_mask, Dnnl_mask) \
+    X(dnnl_paged_cache_load, Dnnl_paged_cache_load) \
+    X(dnnl_rotary_embedding, Dnnl_rotary_embedding) \
     X(dnnl_sdpa, Dnnl_sdpa) \
     X(dnnl_host_scalar, Dnnl_host_scalar)
 
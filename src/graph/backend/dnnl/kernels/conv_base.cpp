@@ -80,9 +80,16 @@ status_t conv_base_t::execute_impl(const stream_t *g_stream,
                         c_grantor.get(mem_offkey.second));
             }
         } else {
-            c_buffer = std::make_shared<dnnl_constant_buffer_t>(
-                    memory_planner_.total_internal_persistent_size(), p_engine_,
-                    g_alloc_);
+            size_t backing_key = 0;
+            c_buffer = load_constant_buffer(inputs, const_md_hash_,
+                    memory_planner_.total_internal_persistent_size(),
+                    backing_key);
+            const bool is_mapped = bool(c_buffer);
+            if (!is_mapped) {
+                c_buffer = std::make_shared<dnnl_constant_buffer_t>(
+                        memory_planner_.total_internal_persistent_size(),
+                        p_engine_, g_alloc_);
+            }
             grantor_t c_grantor = memory_planner_.internal_persistent_grantor(
                     c_buffer->data<char>());
             for (auto &mem_offkey : res->get_mems_use_internal_persistent()) {
@@ -90,10 +97,15 @@ status_t conv_base_t::execute_impl(const stream_t *g_stream,
                         c_grantor.get(mem_offkey.second));
             }
 
-            for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
-                if (!subgraph_->is_constant_[i]) continue;
-                subgraph_->execs_[i]->execute(
-                        p_stream, res->get_exec_args()[i]);
+            if (!is_mapped) {
+                const double start_ms = get_msec();
+                for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
+                    if (!subgraph_->is_constant_[i]) continue;
+                    subgraph_->execs_[i]->execute(
+                            p_stream, res->get_exec_args()[i]);
+                }
+                store_constant_buffer(p_stream, backing_key, c_buffer);
+                set_constant_buffer_cost(encoded_key, get_msec() - start_ms);
             }
 
             c_promise.set_value(c_buffer);
@@ -14,8 +14,12 @@
  * limitations under the License.
  *******************************************************************************/
 
+#include <cstring>
+
 #include "graph/backend/dnnl/kernels/kernel_base.hpp"
 #include "graph/backend/dnnl/dnnl_constant_tensor_cache.hpp"
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+#include "graph/interface/partition_hashing.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -25,6 +29,21 @@ namespace dnnl_impl {
 status_t kernel_base_t::compile(const dnnl_partition_impl_t *part,
         const engine_t *aengine, const std::vector<logical_tensor_t> &inputs,
         const std::vector<logical_tensor_t> &outputs) {
+    const dnnl_version_t *version = dnnl_version();
+    size_t seed = 0;
+    seed = hash_combine(seed, static_cast<size_t>(version->major));
+    seed = hash_combine(seed, static_cast<size_t>(version->minor));
+    seed = hash_combine(seed, static_cast<size_t>(version->patch));
+    seed = hash_combine(seed, std::string(version->hash));
+    seed = hash_combine(
+            seed, static_cast<size_t>(dnnl_get_effective_cpu_isa()));
+    const auto &fpmath = part->get_fpmath_mode();
+    seed = hash_combine(seed, static_cast<size_t>(fpmath.mode_));
+    seed = hash_combine(seed, static_cast<size_t>(fpmath.apply_to_int_));
+    for (const auto &op : part->get_ops())
+        seed = hash_combine(seed, partition_hashing::get_op_hash(*op));
+    backing_key_seed_ = seed;
+
     auto ret = compile_impl(part, aengine, inputs, outputs);
     if (ret != status::success) return ret;
     return prepare_inplace_pairs_impl();
@@ -56,6 +75,53 @@ size_t kernel_base_t::encode_constant_cache_key(
     return encoded_cache_key;
 }
 
+constant_tensor_cache_t::cached_t kernel_base_t::load_constant_buffer(
+        const std::vector<tensor_t> &inputs, size_t cache_key, size_t size,
+        size_t &backing_key) const {
+    backing_key = 0;
+    if (!is_constant_cache_backed(p_engine_)) return nullptr;
+
+    // Hash the content of constant inputs. This is done once per process on
+    // a constant cache miss, which is still cheaper than recomputing the
+    // constant tensors.
+    size_t key = hash_combine(backing_key_seed_, cache_key);
+    key = hash_combine(key, size);
+    for (const auto &in : inputs) {
+        const logical_tensor_wrapper_t ltw(in.get_logical_tensor());
+        if (!ltw.is_constant()) continue;
+
+        const auto *data = static_cast<const uint8_t *>(in.get_data_handle());
+        const size_t nbytes = ltw.size();
+        uint64_t h = 0xcbf29ce484222325ULL; // FNV-1a offset basis
+        size_t i = 0;
+        for (; i + sizeof(uint64_t) <= nbytes; i += sizeof(uint64_t)) {
+            uint64_t w;
+            std::memcpy(&w, data + i, sizeof(w));
+            h = (h ^ w) * 0x100000001b3ULL;
+        }
+        for (; i < nbytes; i++)
+            h = (h ^ data[i]) * 0x100000001b3ULL;
+        key = hash_combine(key, nbytes);
+        key = hash_combine(key, (size_t)h);
+    }
+    backing_key = key;
+    return dnnl_constant_cache_load(p_engine_, backing_key, size);
+}
+
+void kernel_base_t::store_constant_buffer(dnnl::stream &p_stream,
+        size_t backing_key,
+        const constant_tensor_cache_t::cached_t &buffer) const {
+    if (!is_constant_cache_backed(p_engine_)) return;
+    // The constant tensors must be computed before they are written.
+    p_stream.wait();
+    dnnl_constant_cache_store(p_engine_, backing_key, buffer);
+}
+
+void kernel_base_t::set_constant_buffer_cost(
+        size_t encoded_key, double cost) const {
+    dnnl_constant_cache_set_cost(p_engine_, encoded_key, cost);
+}
+
 const std::vector<inplace_pair_t> &kernel_base_t::get_inplace_pairs() const {
     return inplace_pairs_;
 };
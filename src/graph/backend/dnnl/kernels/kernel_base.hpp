@@ -21,8 +21,11 @@
 #include <memory>
 #include <vector>
 
+#include "common/verbose.hpp"
+
 #include "graph/backend/dnnl/subgraph.hpp"
 #include "graph/interface/c_types_map.hpp"
+#include "graph/interface/constant_tensor_cache.hpp"
 #include "graph/interface/logical_tensor.hpp"
 
 // required for dnnl::engine
@@ -113,12 +116,32 @@ struct kernel_base_t {
     size_t encode_constant_cache_key(
             const std::vector<tensor_t> &inputs, size_t cache_key) const;
 
+    // The backing store of the constant tensor cache is shared between
+    // processes, so it's keyed by the content of constant inputs instead of
+    // their addresses. Returns an empty pointer if the store is disabled or
+    // doesn't hold the buffer, in which case the buffer should be computed
+    // and stored with `backing_key`.
+    constant_tensor_cache_t::cached_t load_constant_buffer(
+            const std::vector<tensor_t> &inputs, size_t cache_key, size_t size,
+            size_t &backing_key) const;
+    void store_constant_buffer(dnnl::stream &p_stream, size_t backing_key,
+            const constant_tensor_cache_t::cached_t &buffer) const;
+    // Records the time in milliseconds spent to compute the constant buffer,
+    // which is used by the cost-aware eviction of the constant tensor cache.
+    void set_constant_buffer_cost(size_t encoded_key, double cost) const;
+
     const std::vector<inplace_pair_t> &get_inplace_pairs() const;
 
 protected:
     std::vector<inplace_pair_t> inplace_pairs_;
     dnnl::engine p_engine_;
     std::shared_ptr<subgraph_t> subgraph_;
+
+private:
+    // Identifies the library build, the CPU ISA and the partition with its
+    // attributes, so that the backing store doesn't hand out a buffer
+    // computed by a different library or for a different partition.
+    size_t backing_key_seed_ = 0;
 };
 
 using kernel_ptr = std::shared_ptr<kernel_base_t>;
@@ -54,11 +54,16 @@ public:
         const engine_kind_t ekind = g_engine->kind();
         bool enable_decomp = false;
         bool enable_ukernel = false;
+        bool enable_primitive = false;
 
         if (ekind == engine_kind::cpu) {
             enable_decomp = enable_decomp_kernel();
+            enable_primitive = true;
         } else if (ekind == engine_kind::gpu) {
             enable_ukernel = !force_primitive();
+            // On GPU, the primitive is tried only as a fallback of the v1
+            // ukernel kernel.
+            enable_primitive = enable_ukernel;
         } else {
             assert(!"unknown engine kind");
             return status::invalid_arguments;
@@ -74,7 +79,9 @@ public:
             ret = kernel->compile_impl(part, g_engine, inputs, outputs);
         }
 
-        if (ret != status::success && enable_ukernel) {
+        // On CPU, the primitive is tried before the decomposition kernel and
+        // only accepts optimized implementations unless forced.
+        if (ret != status::success && enable_primitive) {
             kernel = std::make_shared<sdp_primitive_kernel_t<quantized>>();
             ret = kernel->compile_impl(part, g_engine, inputs, outputs);
         }
@@ -523,6 +523,8 @@ impl::status_t sdp_decomp_config_t::record_input_offset(
         const auto &op_kind = cur_op->get_kind();
         VCHECK_SDP_DECOMP(op_kind != graph::op_kind::GenIndex,
                 status::unimplemented, "Not support implicit causal mask");
+        VCHECK_SDP_DECOMP(op_kind != graph::op_kind::PagedCacheLoad,
+                status::unimplemented, "Not support paged key and value");
         VCHECK_SDP_DECOMP(op_kind != graph::op_kind::DynamicDequantize,
                 status::unimplemented,
                 "Decomposed kernel does not support dynamic quantization");
@@ -45,9 +45,9 @@ status_t sdp_primitive_kernel_t<quantized>::compile_impl(
         const dnnl_partition_impl_t *part, const engine_t *g_engine,
         const std::vector<logical_tensor_t> &inputs,
         const std::vector<logical_tensor_t> &outputs) {
-// sdp_primitive_kernel_t only supports Intel GPU.
+// sdp_primitive_kernel_t only supports Intel GPU among the GPU vendors.
 #if defined(DNNL_WITH_SYCL) && DNNL_GPU_VENDOR != DNNL_VENDOR_INTEL
-    return status::unimplemented;
+    if (g_engine->kind() == engine_kind::gpu) return status::unimplemented;
 #endif
     p_engine_ = make_dnnl_engine(*g_engine);
     g_alloc_
@@ -149,7 +149,7 @@ void sdp_primitive_kernel_t<quantized>::prepare_args_set(
 
 template <bool quantized>
 status_t sdp_primitive_kernel_t<quantized>::get_prim_exec_args(
-        exec_args_t &args, memory (&mem_storage)[10],
+        exec_args_t &args, memory (&mem_storage)[11],
         const execution_args_set_t *res) const {
     bool ok = res->find_value_mem_map(cfg_.q_.get(), mem_storage[0])
             && res->find_value_mem_map(cfg_.k_.get(), mem_storage[1])
@@ -177,6 +177,10 @@ status_t sdp_primitive_kernel_t<quantized>::get_prim_exec_args(
         ok = ok
                 && res->find_value_mem_map(
                         cfg_.v_zero_points_.get(), mem_storage[9]);
+    if (cfg_.block_table_)
+        ok = ok
+                && res->find_value_mem_map(
+                        cfg_.block_table_.get(), mem_storage[10]);
 
     VCONDCHECK(graph, exec, check, sdp_primitive_kernel, ok,
             status::runtime_error,
@@ -192,6 +196,7 @@ status_t sdp_primitive_kernel_t<quantized>::get_prim_exec_args(
     memory_arg_t mem_arg_v_scale = {mem_storage[7].get(true), true};
     memory_arg_t mem_arg_k_zero_points = {mem_storage[8].get(true), true};
     memory_arg_t mem_arg_v_zero_points = {mem_storage[9].get(true), true};
+    memory_arg_t mem_arg_block_table = {mem_storage[10].get(true), true};
 
     args.clear();
     args[DNNL_ARG_QUERIES] = mem_arg_q;
@@ -204,6 +209,7 @@ status_t sdp_primitive_kernel_t<quantized>::get_prim_exec_args(
     args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_VALUES] = mem_arg_v_scale;
     args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_KEYS] = mem_arg_k_zero_points;
     args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES] = mem_arg_v_zero_points;
+    args[DNNL_ARG_BLOCK_TABLE] = mem_arg_block_table;
 
     return status::success;
 }
@@ -218,16 +224,31 @@ status_t sdp_primitive_kernel_t<quantized>::execute_impl(
     execution_args_set_t *res = res_cache.get_or_add(
             reinterpret_cast<size_t>(this), resource_ctor_);
 
-    // Micro kernel doesn't use scratchpad memory, here we force-set size as
-    // zero to avoid redundant memory allocation and deallocation.
-    temporary_scratchpad_t scratchpad(0, p_engine_, *g_alloc_);
+    // Micro kernel doesn't use scratchpad memory, while CPU implementations
+    // keep their per-thread buffers there. The size is zero for the former to
+    // avoid redundant memory allocation and deallocation.
+    temporary_scratchpad_t scratchpad(
+            cfg_.sdpa_pd_->scratchpad_size(scratchpad_mode::user), p_engine_,
+            *g_alloc_);
     prepare_args_set(res, inputs, outputs, scratchpad);
 
-    memory mem_storage[10];
+    memory mem_storage[11];
     exec_args_t args;
     CHECK(get_prim_exec_args(args, mem_storage, res));
     exec_ctx_t ctx(p_stream.get(), std::move(args));
 
+    std::unique_ptr<memory_storage_t> scratchpad_storage;
+    if (scratchpad.size() > 0) {
+        memory_storage_t *storage = nullptr;
+        CHECK(p_engine_.get()->create_memory_storage(&storage,
+                memory_flags_t::use_runtime_ptr, scratchpad.size(),
+                scratchpad.get_buffer()));
+        scratchpad_storage.reset(storage);
+    }
+    auto scratchpad_grantor = cfg_.sdpa_pd_->scratchpad_registry().grantor(
+            scratchpad_storage.get(), ctx);
+    ctx.set_scratchpad_grantor(&scratchpad_grantor);
+
     return cfg_.sdpa_prim_->execute(ctx);
 }
 
@@ -253,7 +274,7 @@ status_t sdp_primitive_kernel_t<quantized>::sycl_execute_impl(
     temporary_scratchpad_t scratchpad(0, p_engine_, *g_alloc_);
     prepare_args_set(res, inputs, outputs, scratchpad);
 
-    memory mem_storage[10];
+    memory mem_storage[11];
     exec_args_t args;
     CHECK(get_prim_exec_args(args, mem_storage, res));
     exec_ctx_t ctx(p_stream.get(), std::move(args));
@@ -299,7 +320,7 @@ status_t sdp_primitive_kernel_t<quantized>::ocl_execute_impl(
     temporary_scratchpad_t scratchpad(0, p_engine_, *g_alloc_);
     prepare_args_set(res, inputs, outputs, scratchpad);
 
-    memory mem_storage[10];
+    memory mem_storage[11];
     exec_args_t args;
     CHECK(get_prim_exec_args(args, mem_storage, res));
     exec_ctx_t ctx(p_stream.get(), std::move(args));
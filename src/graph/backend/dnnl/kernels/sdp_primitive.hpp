@@ -72,7 +72,7 @@ public:
             const std::vector<tensor_t> &outputs,
             const scratchpad_t &scratchpad);
 
-    status_t get_prim_exec_args(exec_args_t &args, memory (&mem_storage)[10],
+    status_t get_prim_exec_args(exec_args_t &args, memory (&mem_storage)[11],
             const execution_args_set_t *res) const;
 
     status_t execute_impl(const stream_t *g_stream,
@@ -16,9 +16,15 @@
 
 #include "graph/backend/dnnl/kernels/sdp_primitive_config.hpp"
 #include "graph/backend/dnnl/fusion_info.hpp"
+#include "graph/backend/dnnl/utils.hpp"
+#include "graph/utils/utils.hpp"
 
 #include "common/compiler_workarounds.hpp"
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+#include "cpu/ref_sdpa.hpp"
+#endif
+
 #define VCHECK_SDP_PRIMITIVE(cond, status, msg, ...) \
     VCONDCHECK(graph, create, check, sdp_primitive_kernel_t, (cond), status, \
             msg, ##__VA_ARGS__);
@@ -35,6 +41,27 @@ op_ptr sdp_primitive_config_t::get_post_op(const op_ptr &op) const {
     return consumers[0].get_op().shared_from_this();
 }
 
+std::shared_ptr<value_t> sdp_primitive_config_t::locate_paged_cache(
+        std::shared_ptr<value_t> &val, std::vector<int32_t> &perm) const {
+    auto cur = val;
+    std::vector<int64_t> permutation;
+    if (cur->has_producer()
+            && cur->get_producer().get_kind() == op_kind::dnnl_permute) {
+        permutation = cur->get_producer().get_attr<std::vector<int64_t>>(
+                op_attr::permutation);
+        cur = cur->get_producer().get_input_value(0);
+    }
+    if (!cur->has_producer()
+            || cur->get_producer().get_kind()
+                    != op_kind::dnnl_paged_cache_load)
+        return nullptr;
+
+    auto &load = cur->get_producer();
+    val = load.get_input_value(0);
+    perm = dnnl_impl::utils::cast_to_int32(permutation);
+    return load.get_input_value(1);
+}
+
 status_t sdp_primitive_config_t::locate_io(std::shared_ptr<subgraph_t> &sg,
         const std::vector<logical_tensor_t> &inputs,
         const std::vector<logical_tensor_t> &outputs) {
@@ -113,6 +140,15 @@ status_t sdp_primitive_config_t::locate_io(std::shared_ptr<subgraph_t> &sg,
     k_ = mm1->get_input_value(1);
     v_ = mm2->get_input_value(1);
 
+    // Paged keys and values are read in place through the block table, which
+    // has to be shared between them.
+    auto k_block_table = locate_paged_cache(k_, k_perm_);
+    auto v_block_table = locate_paged_cache(v_, v_perm_);
+    VCHECK_SDP_PRIMITIVE(k_block_table == v_block_table, status::unimplemented,
+            "keys and values should be both loaded from paged caches with "
+            "the same block table");
+    block_table_ = k_block_table;
+
     if (quantized_) {
         // The input order of fused matmul is: src_0, src_1, scale, zero points
         if (mm1->num_inputs() > 2) k_scale_ = mm1->get_input_value(2);
@@ -195,8 +231,10 @@ status_t sdp_primitive_config_t::initial_check(
             }
         }
     }
-    // Dispatch f32 implicit causal mask cases into the f32 ukernel impl.
-    if (is_f32 && !has_genindex) {
+    // Dispatch f32 implicit causal mask cases into the f32 ukernel impl. CPU
+    // implementations handle f32 without this restriction.
+    const bool is_gpu = sg->p_engine_->get_kind() == dnnl::engine::kind::gpu;
+    if (is_gpu && is_f32 && !has_genindex) {
         VCHECK_SDP_PRIMITIVE(false, status::unimplemented,
                 "only implicit causal mask for f32 sdpa");
     }
@@ -355,6 +393,13 @@ status_t sdp_primitive_config_t::init(std::shared_ptr<subgraph_t> &sg,
     auto md_k = make_dnnl_memory_desc(k_->get_logical_tensor());
     auto md_v = make_dnnl_memory_desc(v_->get_logical_tensor());
     auto md_dst = make_dnnl_memory_desc(dst_->get_logical_tensor());
+    if (!k_perm_.empty()) md_k = md_k.permute_axes(k_perm_);
+    if (!v_perm_.empty()) md_v = md_v.permute_axes(v_perm_);
+
+    dnnl::memory::desc md_block_table;
+    if (block_table_)
+        md_block_table
+                = make_dnnl_memory_desc(block_table_->get_logical_tensor());
 
     dnnl::memory::desc md_mask;
     if (attn_mask_)
@@ -387,7 +432,22 @@ status_t sdp_primitive_config_t::init(std::shared_ptr<subgraph_t> &sg,
     CHECK(create_sdpa_pd(sdpa_pd_, p_engine.get(), md_q.get(), md_k.get(),
             md_v.get(), md_dst.get(), md_mask.get(), scale_dt, invert_scale_,
             kv_head_number_, mask_type_, softmax_alg, attr.get(), qk_attr.get(),
-            vs_attr.get()));
+            vs_attr.get(), block_table_ ? md_block_table.get() : nullptr));
+
+    // The reference CPU implementation is slower than the decomposition
+    // kernel, so it's only used when the primitive is forced.
+    bool is_cpu_ref = false;
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    is_cpu_ref = dynamic_cast<const cpu::ref_sdpa_t::pd_t *>(sdpa_pd_.get())
+            != nullptr;
+#endif
+    const bool force_prim = graph::utils::getenv_int_internal(
+                                    "GRAPH_SDPA_FORCE_PRIMITIVE", 0)
+            > 0;
+    VCONDCHECK(graph, create, dispatch, sdp,
+            !(is_cpu_ref && !force_prim),
+            status::unimplemented,
+            "reference sdp primitive is skipped on cpu, falling back\n");
 
     auto status = sdpa_pd_->create_primitive(sdpa_prim_, p_engine.get());
 
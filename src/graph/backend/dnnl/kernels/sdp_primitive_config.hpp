@@ -59,6 +59,13 @@ public:
     std::shared_ptr<value_t> k_zero_points_ = nullptr;
     std::shared_ptr<value_t> v_zero_points_ = nullptr;
 
+    // Set when keys and values are loaded from a paged cache. `k_` and `v_`
+    // are the caches then, and the permutations map them to the layout
+    // expected by the matmuls.
+    std::shared_ptr<value_t> block_table_ = nullptr;
+    std::vector<int32_t> k_perm_;
+    std::vector<int32_t> v_perm_;
+
     bool invert_scale_ = false;
     bool quantized_ = false;
     attn_mask_type_t mask_type_ = attn_mask_type::undef;
@@ -72,6 +79,11 @@ public:
 private:
     op_ptr get_post_op(const op_ptr &op) const;
 
+    // Replaces `val` with the cache if it's loaded from a paged cache, and
+    // returns the block table, or nullptr otherwise.
+    std::shared_ptr<value_t> locate_paged_cache(
+            std::shared_ptr<value_t> &val, std::vector<int32_t> &perm) const;
+
 public:
     status_t locate_io(std::shared_ptr<subgraph_t> &sg,
             const std::vector<logical_tensor_t> &inputs,
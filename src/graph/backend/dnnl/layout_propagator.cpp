@@ -1709,6 +1709,121 @@ status_t layout_propagator_for_mask(std::shared_ptr<op_t> &op,
     return status;
 }
 
+status_t layout_propagator_for_paged_cache_load(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+        pd_cache_t &pd_cache, subgraph_rewriter_t &rewriter) {
+    UNUSED(mgr);
+    UNUSED(pd_cache);
+    UNUSED(rewriter);
+    VCHECK_LAYOUT_PROPAGATOR(p_engine.get_kind() == dnnl::engine::kind::cpu,
+            status::unimplemented, "paged cache load is only supported on cpu");
+    // Fused sdpa reads the pages in place, so the cache and the block table
+    // are kept as given and the gathered tensor is plain.
+    for (size_t i = 0; i < op->num_inputs(); i++) {
+        const auto &in_lt = op->get_input_value(i)->get_logical_tensor();
+        VCHECK_LAYOUT_PROPAGATOR(ltw(in_lt).is_strided(),
+                status::unimplemented,
+                "paged cache load only supports strided inputs");
+    }
+    const auto &out_lt = op->get_output_value(0)->get_logical_tensor();
+    dnnl::memory::desc dst_md(ltw(out_lt).vdims(),
+            static_cast<dnnl::memory::data_type>(ltw(out_lt).data_type()),
+            dnnl::memory::format_tag::abcd);
+    value_ptr dst_val = op->get_output_value(0);
+    status_t status = fill_layout_info(dst_val, dst_md);
+    return status;
+}
+
+status_t layout_propagator_for_gather(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+        pd_cache_t &pd_cache, subgraph_rewriter_t &rewriter) {
+    UNUSED(mgr);
+    UNUSED(pd_cache);
+    UNUSED(rewriter);
+    VCHECK_LAYOUT_PROPAGATOR(p_engine.get_kind() == dnnl::engine::kind::cpu,
+            status::unimplemented, "gather is only supported on cpu");
+    // The rows of the table are copied as contiguous chunks of memory, while
+    // the rows themselves may be apart from each other, e.g. for a table
+    // sliced out of a larger one.
+    // Checks that the dimensions starting from `first_dim` are dense.
+    const auto is_dense_from = [](const logical_tensor_t &lt,
+                                       size_t first_dim) {
+        if (!ltw(lt).is_strided()) return false;
+        const dims lt_dims = ltw(lt).vdims();
+        const dims lt_strides = ltw(lt).vstrides();
+        const dims dense_strides = get_dense_strides(lt_dims);
+        for (size_t i = first_dim; i < lt_dims.size(); i++) {
+            if (lt_dims[i] != 1 && lt_strides[i] != dense_strides[i])
+                return false;
+        }
+        return true;
+    };
+    const auto &src_lt = op->get_input_value(0)->get_logical_tensor();
+    VCHECK_LAYOUT_PROPAGATOR(is_dense_from(src_lt, 1), status::unimplemented,
+            "gather only supports src with dense rows");
+    for (size_t i = 1; i < op->num_inputs(); i++) {
+        const auto &in_lt = op->get_input_value(i)->get_logical_tensor();
+        VCHECK_LAYOUT_PROPAGATOR(is_dense_from(in_lt, 0),
+                status::unimplemented,
+                "gather only supports dense indices, scales and zero points");
+    }
+
+    // Accumulators are taken from the scratchpad.
+    const size_t scratchpad_size
+            = gather_executable_t::get_scratchpad_size(op.get());
+    const dnnl::memory::desc scratchpad_md = scratchpad_size
+            ? dnnl::memory::desc({static_cast<dim_t>(scratchpad_size)},
+                    dnnl::memory::data_type::u8, dnnl::memory::format_tag::a)
+            : dnnl::memory::desc();
+    status_t status
+            = fill_layout_info(op->get_output_value(1), scratchpad_md);
+    if (status != status::success) return status;
+
+    value_ptr dst_val = op->get_output_value(0);
+    const auto &out_lt = dst_val->get_logical_tensor();
+    if (!ltw(out_lt).is_any()) {
+        VCHECK_LAYOUT_PROPAGATOR(is_dense_from(out_lt, 0),
+                status::unimplemented, "gather only supports dense outputs");
+        return status::success;
+    }
+    const dims out_dims = ltw(out_lt).vdims();
+    dnnl::memory::desc dst_md(out_dims,
+            static_cast<dnnl::memory::data_type>(ltw(out_lt).data_type()),
+            get_dense_strides(out_dims));
+    status = fill_layout_info(dst_val, dst_md);
+    return status;
+}
+
+status_t layout_propagator_for_rotary_embedding(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+        pd_cache_t &pd_cache, subgraph_rewriter_t &rewriter) {
+    UNUSED(mgr);
+    UNUSED(pd_cache);
+    UNUSED(rewriter);
+    VCHECK_LAYOUT_PROPAGATOR(p_engine.get_kind() == dnnl::engine::kind::cpu,
+            status::unimplemented,
+            "rotary embedding is only supported on cpu");
+    for (size_t i = 0; i < op->num_inputs(); i++) {
+        const auto &in_lt = op->get_input_value(i)->get_logical_tensor();
+        VCHECK_LAYOUT_PROPAGATOR(ltw(in_lt).is_strided(),
+                status::unimplemented,
+                "rotary embedding only supports strided inputs");
+    }
+    // The output takes the layout of the input so that the rotation can be
+    // computed in place, e.g. on the destination of a fused matmul.
+    value_ptr dst_val = op->get_output_value(0);
+    const auto &out_lt = dst_val->get_logical_tensor();
+    if (!ltw(out_lt).is_any()) {
+        VCHECK_LAYOUT_PROPAGATOR(ltw(out_lt).is_strided(),
+                status::unimplemented,
+                "rotary embedding only supports strided outputs");
+        return status::success;
+    }
+    const auto &src_lt = op->get_input_value(0)->get_logical_tensor();
+    status_t status = fill_layout_info(dst_val, make_dnnl_memory_desc(src_lt));
+    return status;
+}
+
 status_t layout_propagator_for_sdpa(std::shared_ptr<op_t> &op,
         const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
         pd_cache_t &pd_cache, subgraph_rewriter_t &rewriter) {
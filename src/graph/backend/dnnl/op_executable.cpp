@@ -13,6 +13,8 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  *******************************************************************************/
+#include <algorithm>
+#include <cstring>
 #include <map>
 #include <memory>
 #include <string>
@@ -25,7 +27,9 @@
 
 #include <graph/utils/utils.hpp>
 
+#include "common/bfloat16.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
 #include "common/stream.hpp"
 
 #include "graph/backend/dnnl/common.hpp"
@@ -1816,6 +1820,279 @@ void genindex_executable_t ::execute(const stream &stream,
     stream.get()->after_exec_hook();
 }
 
+void paged_cache_load_executable_t::execute(const stream &stream,
+        const std::unordered_map<int, memory> &args) const {
+    const auto it_cache = args.find(DNNL_ARG_SRC_0);
+    const auto it_bt = args.find(DNNL_ARG_SRC_1);
+    const auto it_dst = args.find(DNNL_ARG_DST);
+    if (it_cache == args.end() || it_bt == args.end() || it_dst == args.end())
+        return;
+
+    const auto cache_ptr
+            = static_cast<const char *>(it_cache->second.get_data_handle());
+    const auto bt_ptr
+            = static_cast<const int32_t *>(it_bt->second.get_data_handle());
+    auto dst_ptr = static_cast<char *>(it_dst->second.get_data_handle());
+
+    const dim_t H = cache_dims_[1], page_size = cache_dims_[2],
+                D = cache_dims_[3];
+    stream.get()->before_exec_hook();
+    dnnl::impl::parallel_nd(mb_, H, max_pages_, page_size,
+            [&](dim_t mb, dim_t h, dim_t p, dim_t t) {
+                const dim_t page
+                        = bt_ptr[mb * bt_strides_[0] + p * bt_strides_[1]];
+                char *dst = dst_ptr
+                        + (mb * dst_strides_[0] + h * dst_strides_[1]
+                                  + (p * page_size + t) * dst_strides_[2])
+                                * data_size_;
+                // No pointer is formed into the cache for an absent page.
+                if (page < 0 || page >= cache_dims_[0]) {
+                    for (dim_t d = 0; d < D; d++)
+                        std::memset(dst + d * dst_strides_[3] * data_size_, 0,
+                                data_size_);
+                    return;
+                }
+                const char *src = cache_ptr
+                        + (page * cache_strides_[0] + h * cache_strides_[1]
+                                  + t * cache_strides_[2])
+                                * data_size_;
+                for (dim_t d = 0; d < D; d++)
+                    std::memcpy(dst + d * dst_strides_[3] * data_size_,
+                            src + d * cache_strides_[3] * data_size_,
+                            data_size_);
+            });
+    stream.get()->after_exec_hook();
+}
+
+static float load_float(data_type_t dt, const void *ptr, dim_t off) {
+    switch (dt) {
+        case impl::data_type::bf16:
+            return static_cast<const dnnl::impl::bfloat16_t *>(ptr)[off];
+        case impl::data_type::f16:
+            return static_cast<const dnnl::impl::float16_t *>(ptr)[off];
+        case impl::data_type::s32:
+            return static_cast<float>(static_cast<const int32_t *>(ptr)[off]);
+        case impl::data_type::s8:
+            return static_cast<const int8_t *>(ptr)[off];
+        case impl::data_type::u8:
+            return static_cast<const uint8_t *>(ptr)[off];
+        case impl::data_type::s4:
+        case impl::data_type::u4: {
+            // Two elements are packed into a byte, the first one in the
+            // lower half.
+            const uint8_t byte = static_cast<const uint8_t *>(ptr)[off / 2];
+            const int val = (off % 2) ? byte >> 4 : byte & 0xf;
+            if (dt == impl::data_type::s4 && val >= 8) return val - 16;
+            return val;
+        }
+        default: return static_cast<const float *>(ptr)[off];
+    }
+}
+
+static void store_float(data_type_t dt, void *ptr, dim_t off, float val) {
+    switch (dt) {
+        case impl::data_type::bf16:
+            static_cast<dnnl::impl::bfloat16_t *>(ptr)[off] = val;
+            break;
+        case impl::data_type::f16:
+            static_cast<dnnl::impl::float16_t *>(ptr)[off] = val;
+            break;
+        default: static_cast<float *>(ptr)[off] = val;
+    }
+}
+
+void rotary_embedding_executable_t::execute(const stream &stream,
+        const std::unordered_map<int, memory> &args) const {
+    const auto it_src = args.find(DNNL_ARG_SRC_0);
+    const auto it_cos = args.find(DNNL_ARG_SRC_1);
+    const auto it_sin = args.find(DNNL_ARG_SRC_2);
+    const auto it_dst = args.find(DNNL_ARG_DST);
+    if (it_src == args.end() || it_cos == args.end() || it_sin == args.end()
+            || it_dst == args.end())
+        return;
+
+    const void *src_ptr = it_src->second.get_data_handle();
+    const void *cos_ptr = it_cos->second.get_data_handle();
+    const void *sin_ptr = it_sin->second.get_data_handle();
+    void *dst_ptr = it_dst->second.get_data_handle();
+
+    const dim_t S = dims_[ndims_ - 2], D = dims_[ndims_ - 1], half = D / 2;
+    dim_t outer = 1;
+    for (int d = 0; d < ndims_ - 2; d++)
+        outer *= dims_[d];
+
+    stream.get()->before_exec_hook();
+    dnnl::impl::parallel_nd(outer, S, [&](dim_t o, dim_t s) {
+        dim_t src_off = s * src_strides_[ndims_ - 2];
+        dim_t dst_off = s * dst_strides_[ndims_ - 2];
+        for (int d = ndims_ - 3; d >= 0; d--) {
+            const dim_t idx = o % dims_[d];
+            o /= dims_[d];
+            src_off += idx * src_strides_[d];
+            dst_off += idx * dst_strides_[d];
+        }
+        const dim_t src_ds = src_strides_[ndims_ - 1];
+        const dim_t dst_ds = dst_strides_[ndims_ - 1];
+        for (dim_t i = 0; i < half; i++) {
+            const dim_t j = i + half;
+            const float x0 = load_float(src_dt_, src_ptr, src_off + i * src_ds);
+            const float x1 = load_float(src_dt_, src_ptr, src_off + j * src_ds);
+            const float c0 = load_float(table_dt_, cos_ptr,
+                    s * cos_strides_[0] + i * cos_strides_[1]);
+            const float c1 = load_float(table_dt_, cos_ptr,
+                    s * cos_strides_[0] + j * cos_strides_[1]);
+            const float s0 = load_float(table_dt_, sin_ptr,
+                    s * sin_strides_[0] + i * sin_strides_[1]);
+            const float s1 = load_float(table_dt_, sin_ptr,
+                    s * sin_strides_[0] + j * sin_strides_[1]);
+            store_float(
+                    src_dt_, dst_ptr, dst_off + i * dst_ds, x0 * c0 - x1 * s0);
+            store_float(
+                    src_dt_, dst_ptr, dst_off + j * dst_ds, x1 * c1 + x0 * s1);
+        }
+    });
+    stream.get()->after_exec_hook();
+}
+
+template <typename T>
+static void accumulate_scaled(
+        const T *row, dim_t n, float scale, float zp, float *acc) {
+    PRAGMA_OMP_SIMD()
+    for (dim_t e = 0; e < n; e++)
+        acc[e] += (static_cast<float>(row[e]) - zp) * scale;
+}
+
+size_t gather_executable_t::get_scratchpad_size(const op_t *op) {
+    if (!accumulates_rows(op)) return 0;
+    const auto &src_lt = op->get_input_value(0)->get_logical_tensor();
+    size_t row_size = 1;
+    for (int i = 1; i < src_lt.ndims; i++)
+        row_size *= static_cast<size_t>(src_lt.dims[i]);
+    return dnnl_get_max_threads() * row_size * sizeof(float);
+}
+
+void gather_executable_t::accumulate_row(
+        const void *src, dim_t r, float scale, float zp, float *acc) const {
+    const dim_t off = r * row_stride_;
+    switch (src_dt_) {
+        case impl::data_type::f32:
+            accumulate_scaled(static_cast<const float *>(src) + off, row_size_,
+                    scale, zp, acc);
+            break;
+        case impl::data_type::bf16:
+            accumulate_scaled(
+                    static_cast<const dnnl::impl::bfloat16_t *>(src) + off,
+                    row_size_, scale, zp, acc);
+            break;
+        case impl::data_type::f16:
+            accumulate_scaled(
+                    static_cast<const dnnl::impl::float16_t *>(src) + off,
+                    row_size_, scale, zp, acc);
+            break;
+        case impl::data_type::s8:
+            accumulate_scaled(static_cast<const int8_t *>(src) + off,
+                    row_size_, scale, zp, acc);
+            break;
+        case impl::data_type::u8:
+            accumulate_scaled(static_cast<const uint8_t *>(src) + off,
+                    row_size_, scale, zp, acc);
+            break;
+        default:
+            // int4 elements are unpacked one by one as a row may start in the
+            // middle of a byte.
+            for (dim_t e = 0; e < row_size_; e++)
+                acc[e] += (load_float(src_dt_, src, off + e) - zp) * scale;
+    }
+}
+
+void gather_executable_t::execute(const stream &stream,
+        const std::unordered_map<int, memory> &args) const {
+    const auto it_src = args.find(DNNL_ARG_SRC_0);
+    const auto it_idx = args.find(DNNL_ARG_SRC_1);
+    const auto it_dst = args.find(DNNL_ARG_DST);
+    if (it_src == args.end() || it_idx == args.end() || it_dst == args.end())
+        return;
+
+    const void *src_ptr = it_src->second.get_data_handle();
+    const auto *indices
+            = static_cast<const int32_t *>(it_idx->second.get_data_handle());
+    void *dst_ptr = it_dst->second.get_data_handle();
+
+    const void *scales_ptr = nullptr;
+    if (with_runtime_scales_) {
+        const auto it = args.find(DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC_0);
+        if (it == args.end()) return;
+        scales_ptr = it->second.get_data_handle();
+    }
+    const void *zps_ptr = nullptr;
+    if (with_runtime_zps_) {
+        const auto it = args.find(DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_SRC_0);
+        if (it == args.end()) return;
+        zps_ptr = it->second.get_data_handle();
+    }
+
+    // A row of accumulators per thread, the number of threads is limited by
+    // the scratchpad booked at compilation.
+    float *acc_base = nullptr;
+    int max_nthr = 0;
+    if (!copy_rows_) {
+        const auto it = args.find(DNNL_ARG_SCRATCHPAD);
+        if (it == args.end()) return;
+        acc_base = static_cast<float *>(it->second.get_data_handle());
+        const size_t acc_size = it->second.get_desc().get_size();
+        max_nthr = static_cast<int>(std::min<size_t>(
+                dnnl_get_current_num_threads(),
+                row_size_ ? acc_size / (row_size_ * sizeof(float)) : 1));
+        if (max_nthr == 0) return;
+    }
+    const size_t dst_dt_size = dnnl::memory::data_type_size(
+            static_cast<dnnl::memory::data_type>(dst_dt_));
+    const size_t row_bytes = row_size_ * dst_dt_size;
+
+    stream.get()->before_exec_hook();
+    dnnl::impl::parallel(max_nthr, [&](int ithr, int nthr) {
+        dim_t start = 0, end = 0;
+        dnnl::impl::balance211(n_bags_, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        float *acc = acc_base + ithr * row_size_;
+        for (dim_t b = start; b < end; b++) {
+            char *dst_row = static_cast<char *>(dst_ptr) + b * row_bytes;
+            if (copy_rows_) {
+                const dim_t r = indices[b];
+                if (r < 0 || r >= n_rows_)
+                    std::memset(dst_row, 0, row_bytes);
+                else
+                    std::memcpy(dst_row,
+                            static_cast<const char *>(src_ptr)
+                                    + r * row_stride_ * dst_dt_size,
+                            row_bytes);
+                continue;
+            }
+
+            std::fill(acc, acc + row_size_, 0.f);
+            for (dim_t j = 0; j < bag_size_; j++) {
+                const dim_t r = indices[b * bag_size_ + j];
+                if (r < 0 || r >= n_rows_) continue;
+                const dim_t q = per_row_ ? r : 0;
+                float scale = 1.f, zp = 0.f;
+                if (with_runtime_scales_)
+                    scale = load_float(scales_dt_, scales_ptr, q);
+                else if (!scales_.empty())
+                    scale = scales_[q];
+                if (with_runtime_zps_)
+                    zp = load_float(zps_dt_, zps_ptr, q);
+                else if (!zps_.empty())
+                    zp = zps_[q];
+                accumulate_row(src_ptr, r, scale, zp, acc);
+            }
+            for (dim_t e = 0; e < row_size_; e++)
+                store_float(dst_dt_, dst_row, e, acc[e]);
+        }
+    });
+    stream.get()->after_exec_hook();
+}
+
 static void get_arg_indices_for_post_ops(const op_t *op, fusion_info_mgr_t &mgr,
         arg_indices_t &indices, size_t &base_index) {
     const fusion_info_t &fusion_info
@@ -2436,6 +2713,57 @@ arg_indices_t genindex_executable_t::get_arg_indices(
     return arg_indices;
 }
 
+arg_indices_t paged_cache_load_executable_t::get_arg_indices(
+        const op_t *op, fusion_info_mgr_t &mgr) {
+    UNUSED(op);
+    UNUSED(mgr);
+
+    arg_indices_t arg_indices;
+    arg_indices.insert({DNNL_ARG_SRC_0, indices_t {input, 0}});
+    arg_indices.insert({DNNL_ARG_SRC_1, indices_t {input, 1}});
+    arg_indices.insert({DNNL_ARG_DST, indices_t {output, 0}});
+
+    return arg_indices;
+}
+
+arg_indices_t gather_executable_t::get_arg_indices(
+        const op_t *op, fusion_info_mgr_t &mgr) {
+    UNUSED(mgr);
+
+    arg_indices_t arg_indices;
+    size_t index = 0;
+    arg_indices.insert({DNNL_ARG_SRC_0, indices_t {input, index++}});
+    arg_indices.insert({DNNL_ARG_SRC_1, indices_t {input, index++}});
+    if (op->has_attr(op_attr::with_runtime_scales)
+            && op->get_attr<bool>(op_attr::with_runtime_scales)) {
+        arg_indices.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC_0,
+                indices_t {input, index++}});
+    }
+    if (op->has_attr(op_attr::with_runtime_zps)
+            && op->get_attr<bool>(op_attr::with_runtime_zps)) {
+        arg_indices.insert({DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_SRC_0,
+                indices_t {input, index++}});
+    }
+    arg_indices.insert({DNNL_ARG_DST, indices_t {output, 0}});
+    arg_indices.insert({DNNL_ARG_SCRATCHPAD, indices_t {output, 1}});
+
+    return arg_indices;
+}
+
+arg_indices_t rotary_embedding_executable_t::get_arg_indices(
+        const op_t *op, fusion_info_mgr_t &mgr) {
+    UNUSED(op);
+    UNUSED(mgr);
+
+    arg_indices_t arg_indices;
+    arg_indices.insert({DNNL_ARG_SRC_0, indices_t {input, 0}});
+    arg_indices.insert({DNNL_ARG_SRC_1, indices_t {input, 1}});
+    arg_indices.insert({DNNL_ARG_SRC_2, indices_t {input, 2}});
+    arg_indices.insert({DNNL_ARG_DST, indices_t {output, 0}});
+
+    return arg_indices;
+}
+
 arg_indices_t sdpa_executable_t::get_arg_indices(
         const op_t *op, fusion_info_mgr_t &mgr) {
     UNUSED(mgr);
@@ -533,7 +533,8 @@ struct conv_fwd_executable_t : public op_executable_t {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
         prim_ = dnnl::convolution_forward(desc);
         if (op->has_attr(op_attr::with_sum))
-            with_sum_ = op->get_attr<bool>(op_attr::with_sum);
+            with_sum_ = op->has_attr(op_attr::with_sum)
+                && op->get_attr<bool>(op_attr::with_sum);
     }
 
     void execute(const stream &stream,
@@ -712,7 +713,8 @@ struct deconv_fwd_executable_t : public op_executable_t {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
         prim_ = dnnl::deconvolution_forward(desc);
         if (op->has_attr(op_attr::with_sum))
-            with_sum_ = op->get_attr<bool>(op_attr::with_sum);
+            with_sum_ = op->has_attr(op_attr::with_sum)
+                && op->get_attr<bool>(op_attr::with_sum);
     }
 
     void execute(const stream &stream,
@@ -895,7 +897,8 @@ struct matmul_executable_t : public op_executable_t {
         }
 
         if (op->has_attr(op_attr::with_sum))
-            with_sum_ = op->get_attr<bool>(op_attr::with_sum);
+            with_sum_ = op->has_attr(op_attr::with_sum)
+                && op->get_attr<bool>(op_attr::with_sum);
     }
 
     void execute(const stream &stream,
@@ -1097,7 +1100,8 @@ struct binary_executable_t : public op_executable_t {
         prim_ = dnnl::binary(desc);
 
         if (op->has_attr(op_attr::with_sum))
-            with_sum_ = op->get_attr<bool>(op_attr::with_sum);
+            with_sum_ = op->has_attr(op_attr::with_sum)
+                && op->get_attr<bool>(op_attr::with_sum);
     }
 
     void execute(const stream &stream,
@@ -1447,7 +1451,8 @@ struct reorder_executable_t : public op_executable_t {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
         prim_ = dnnl::reorder(desc);
         if (op->has_attr(op_attr::with_sum))
-            with_sum_ = op->get_attr<bool>(op_attr::with_sum);
+            with_sum_ = op->has_attr(op_attr::with_sum)
+                && op->get_attr<bool>(op_attr::with_sum);
     }
 
     void execute(const stream &stream,
@@ -2266,7 +2271,8 @@ struct resampling_executable_t : public op_executable_t {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
         prim_ = dnnl::resampling_forward(desc);
         if (op->has_attr(op_attr::with_sum))
-            with_sum_ = op->get_attr<bool>(op_attr::with_sum);
+            with_sum_ = op->has_attr(op_attr::with_sum)
+                && op->get_attr<bool>(op_attr::with_sum);
     }
 
     void execute(const stream &stream,
@@ -2593,7 +2599,8 @@ struct reduction_executable_t : public op_executable_t {
         prim_ = dnnl::reduction(desc);
 
         if (op->has_attr(op_attr::with_sum))
-            with_sum_ = op->get_attr<bool>(op_attr::with_sum);
+            with_sum_ = op->has_attr(op_attr::with_sum)
+                && op->get_attr<bool>(op_attr::with_sum);
     }
 
     void execute(const stream &stream,
@@ -2866,6 +2873,308 @@ private:
 #endif
 };
 
+// Gathers the pages of a paged cache into a contiguous tensor. Entries of the
+// block table pointing outside of the cache mark absent pages, which are
+// filled with zeros. Only used when the op isn't fused into sdpa, and only
+// for CPU.
+struct paged_cache_load_executable_t : public op_executable_t {
+    DECLARE_ARG_INDICES_GETTER;
+
+    paged_cache_load_executable_t(std::shared_ptr<op_t> &op,
+            const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+            pd_cache_t &pd_cache) {
+        UNUSED(p_engine);
+        UNUSED(mgr);
+        UNUSED(pd_cache);
+        using ltw = logical_tensor_wrapper_t;
+        const auto &cache_lt = op->get_input_value(0)->get_logical_tensor();
+        const auto &bt_lt = op->get_input_value(1)->get_logical_tensor();
+        const auto &dst_lt = op->get_output_value(0)->get_logical_tensor();
+        for (int i = 0; i < 4; i++) {
+            cache_dims_[i] = cache_lt.dims[i];
+            cache_strides_[i] = cache_lt.layout.strides[i];
+            dst_strides_[i] = dst_lt.layout.strides[i];
+        }
+        for (int i = 0; i < 2; i++)
+            bt_strides_[i] = bt_lt.layout.strides[i];
+        mb_ = bt_lt.dims[0];
+        max_pages_ = bt_lt.dims[1];
+        data_size_ = static_cast<dim_t>(ltw(dst_lt).data_type_size());
+    }
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override;
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps) const override {
+        assertm(stream.get_engine().get_kind() == engine::kind::cpu,
+                "paged cache load is only implemented for cpu");
+        auto strm_t = stream.get();
+        auto *sycl_stream_impl = dnnl::impl::utils::downcast<
+                dnnl::impl::xpu::sycl::stream_impl_t *>(strm_t->impl());
+
+        strm_t->before_exec_hook();
+        if (!deps.empty()) { sycl_stream_impl->sycl_ctx().set_deps(deps); }
+
+        execute(stream, args);
+
+        // return output event
+        ::sycl::event return_event = sycl_stream_impl->get_output_event();
+        strm_t->after_exec_hook();
+        return return_event;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps) const override {
+        UNUSED(stream);
+        UNUSED(args);
+        UNUSED(deps);
+        assertm(false, "paged cache load is only implemented for cpu");
+        throw std::runtime_error("Unimplement");
+    }
+#endif
+
+    status_t reset_engine(const dnnl::engine &p_engine) override {
+        UNUSED(p_engine);
+        return status::success;
+    }
+
+private:
+    dim_t mb_ = 0, max_pages_ = 0, data_size_ = 0;
+    dims_t cache_dims_, cache_strides_, dst_strides_, bt_strides_;
+};
+
+// Copies the rows of the table selected by the indices, i.e. the rows of the
+// first dimension of the table. The rows of an int8 or int4 table may be
+// dequantized on the fly with per-tensor or per-row scales and zero points,
+// and the rows selected by the indices of the last dimension may be summed up
+// as an embedding bag. Out-of-range indices select rows of zeros. Only
+// implemented for CPU.
+struct gather_executable_t : public op_executable_t {
+    DECLARE_ARG_INDICES_GETTER;
+
+    gather_executable_t(std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+            fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
+        UNUSED(p_engine);
+        UNUSED(mgr);
+        UNUSED(pd_cache);
+        const auto &src_lt = op->get_input_value(0)->get_logical_tensor();
+        const auto &idx_lt = op->get_input_value(1)->get_logical_tensor();
+        const auto &dst_lt = op->get_output_value(0)->get_logical_tensor();
+        n_rows_ = src_lt.dims[0];
+        row_size_ = 1;
+        for (int i = 1; i < src_lt.ndims; i++)
+            row_size_ *= src_lt.dims[i];
+        row_stride_ = src_lt.layout.strides[0];
+        src_dt_ = src_lt.data_type;
+        dst_dt_ = dst_lt.data_type;
+
+        dim_t n_indices = 1;
+        for (int i = 0; i < idx_lt.ndims; i++)
+            n_indices *= idx_lt.dims[i];
+        with_sum_ = op->has_attr(op_attr::with_sum)
+                && op->get_attr<bool>(op_attr::with_sum);
+        bag_size_ = with_sum_ ? idx_lt.dims[idx_lt.ndims - 1] : 1;
+        n_bags_ = bag_size_ > 0 ? n_indices / bag_size_ : 0;
+
+        per_row_ = op->has_attr(op_attr::qtype)
+                && op->get_attr<std::string>(op_attr::qtype) == "per_channel";
+        size_t index = 2;
+        with_runtime_scales_ = op->has_attr(op_attr::with_runtime_scales)
+                && op->get_attr<bool>(op_attr::with_runtime_scales);
+        if (with_runtime_scales_) {
+            scales_dt_ = op->get_input_value(index++)
+                                 ->get_logical_tensor()
+                                 .data_type;
+        } else if (op->has_attr(op_attr::scales)) {
+            scales_ = op->get_attr<std::vector<float>>(op_attr::scales);
+        }
+        with_runtime_zps_ = op->has_attr(op_attr::with_runtime_zps)
+                && op->get_attr<bool>(op_attr::with_runtime_zps);
+        if (with_runtime_zps_) {
+            zps_dt_ = op->get_input_value(index++)
+                              ->get_logical_tensor()
+                              .data_type;
+        } else if (op->has_attr(op_attr::zps)) {
+            const auto &zps = op->get_attr<std::vector<int64_t>>(op_attr::zps);
+            zps_.assign(zps.begin(), zps.end());
+        }
+        copy_rows_ = !accumulates_rows(op.get());
+    }
+
+    // Rows are accumulated in f32 when they are dequantized, summed up or
+    // converted, otherwise they are copied as they are.
+    static bool accumulates_rows(const op_t *op) {
+        const auto get_bool = [&](op_attr_t attr) {
+            return op->has_attr(attr) && op->get_attr<bool>(attr);
+        };
+        const bool with_dequant = get_bool(op_attr::with_runtime_scales)
+                || get_bool(op_attr::with_runtime_zps)
+                || (op->has_attr(op_attr::scales)
+                        && !op->get_attr<std::vector<float>>(op_attr::scales)
+                                    .empty())
+                || (op->has_attr(op_attr::zps)
+                        && !op->get_attr<std::vector<int64_t>>(op_attr::zps)
+                                    .empty());
+        return with_dequant || get_bool(op_attr::with_sum)
+                || op->get_input_value(0)->get_logical_tensor().data_type
+                != op->get_output_value(0)->get_logical_tensor().data_type;
+    }
+
+    // A row of f32 accumulators per thread.
+    static size_t get_scratchpad_size(const op_t *op);
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override;
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps) const override {
+        assertm(stream.get_engine().get_kind() == engine::kind::cpu,
+                "gather is only implemented for cpu");
+        auto strm_t = stream.get();
+        auto *sycl_stream_impl = dnnl::impl::utils::downcast<
+                dnnl::impl::xpu::sycl::stream_impl_t *>(strm_t->impl());
+
+        strm_t->before_exec_hook();
+        if (!deps.empty()) { sycl_stream_impl->sycl_ctx().set_deps(deps); }
+
+        execute(stream, args);
+
+        // return output event
+        ::sycl::event return_event = sycl_stream_impl->get_output_event();
+        strm_t->after_exec_hook();
+        return return_event;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps) const override {
+        UNUSED(stream);
+        UNUSED(args);
+        UNUSED(deps);
+        assertm(false, "gather is only implemented for cpu");
+        throw std::runtime_error("Unimplement");
+    }
+#endif
+
+    status_t reset_engine(const dnnl::engine &p_engine) override {
+        UNUSED(p_engine);
+        return status::success;
+    }
+
+private:
+    // Accumulates the dequantized row `r` of the table into `acc`.
+    void accumulate_row(
+            const void *src, dim_t r, float scale, float zp, float *acc) const;
+
+    // The sizes and the stride of the rows are in elements.
+    dim_t n_rows_ = 0, row_size_ = 0, row_stride_ = 0;
+    dim_t n_bags_ = 0, bag_size_ = 1;
+    bool with_sum_ = false, copy_rows_ = false;
+    data_type_t src_dt_ = impl::data_type::undef,
+                dst_dt_ = impl::data_type::undef;
+    // The scales and the zero points are given either for each row or for
+    // the whole table, at runtime or as attributes of the op.
+    bool per_row_ = false;
+    bool with_runtime_scales_ = false, with_runtime_zps_ = false;
+    data_type_t scales_dt_ = impl::data_type::undef,
+                zps_dt_ = impl::data_type::undef;
+    std::vector<float> scales_, zps_;
+};
+
+// Rotates the pairs of elements of the last dimension that are half of it
+// apart by the angles given with their cosines and sines:
+//   dst[i] = src[i] * cos[i] - src[i + D / 2] * sin[i]
+//   dst[i + D / 2] = src[i + D / 2] * cos[i + D / 2] + src[i] * sin[i + D / 2]
+// Both elements of a pair are read before they are written, so the rotation
+// can be computed in place. Only implemented for CPU.
+struct rotary_embedding_executable_t : public op_executable_t {
+    DECLARE_ARG_INDICES_GETTER;
+
+    rotary_embedding_executable_t(std::shared_ptr<op_t> &op,
+            const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+            pd_cache_t &pd_cache) {
+        UNUSED(p_engine);
+        UNUSED(mgr);
+        UNUSED(pd_cache);
+        const auto &src_lt = op->get_input_value(0)->get_logical_tensor();
+        const auto &cos_lt = op->get_input_value(1)->get_logical_tensor();
+        const auto &sin_lt = op->get_input_value(2)->get_logical_tensor();
+        const auto &dst_lt = op->get_output_value(0)->get_logical_tensor();
+        ndims_ = src_lt.ndims;
+        for (int i = 0; i < ndims_; i++) {
+            dims_[i] = src_lt.dims[i];
+            src_strides_[i] = src_lt.layout.strides[i];
+            dst_strides_[i] = dst_lt.layout.strides[i];
+        }
+        // Only the last two dimensions of the tables are different from 1.
+        for (int i = 0; i < 2; i++) {
+            cos_strides_[i] = cos_lt.layout.strides[cos_lt.ndims - 2 + i];
+            sin_strides_[i] = sin_lt.layout.strides[sin_lt.ndims - 2 + i];
+        }
+        src_dt_ = src_lt.data_type;
+        table_dt_ = cos_lt.data_type;
+    }
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override;
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps) const override {
+        assertm(stream.get_engine().get_kind() == engine::kind::cpu,
+                "rotary embedding is only implemented for cpu");
+        auto strm_t = stream.get();
+        auto *sycl_stream_impl = dnnl::impl::utils::downcast<
+                dnnl::impl::xpu::sycl::stream_impl_t *>(strm_t->impl());
+
+        strm_t->before_exec_hook();
+        if (!deps.empty()) { sycl_stream_impl->sycl_ctx().set_deps(deps); }
+
+        execute(stream, args);
+
+        // return output event
+        ::sycl::event return_event = sycl_stream_impl->get_output_event();
+        strm_t->after_exec_hook();
+        return return_event;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps) const override {
+        UNUSED(stream);
+        UNUSED(args);
+        UNUSED(deps);
+        assertm(false, "rotary embedding is only implemented for cpu");
+        throw std::runtime_error("Unimplement");
+    }
+#endif
+
+    status_t reset_engine(const dnnl::engine &p_engine) override {
+        UNUSED(p_engine);
+        return status::success;
+    }
+
+private:
+    int ndims_ = 0;
+    dims_t dims_, src_strides_, dst_strides_;
+    dim_t cos_strides_[2], sin_strides_[2];
+    data_type_t src_dt_ = impl::data_type::undef,
+                table_dt_ = impl::data_type::undef;
+};
+
 struct sdpa_executable_t : public op_executable_t {
     DECLARE_ARG_INDICES_GETTER;
 
@@ -884,6 +884,17 @@ static status_t gen_index_handler(
     return status::success;
 }
 
+// Same as common_handler, but for the internal ops executed without a
+// primitive, which have no scratchpad output.
+template <op_kind::kind_t op_kind>
+static status_t no_scratchpad_handler(
+        const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
+    auto new_op = std::make_shared<op_t>(static_cast<op_kind_t>(op_kind));
+    new_op->merge_attributes(op->get_attributes());
+    rewriter.replace_op(op, new_op);
+    return status::success;
+}
+
 #define ITEM(kind, func) \
     { \
         graph::op_kind::kind, handler_func { (func) } \
@@ -996,6 +1007,11 @@ static const std::unordered_map<graph::op_kind_t, handler_func> handler_table {
         ITEM(SquaredDifference, squared_difference_handler),
         ITEM(Select, select_handler),
         ITEM(GenIndex, gen_index_handler),
+        ITEM(Gather, common_handler<op_kind::kDnnl_gather>),
+        ITEM(PagedCacheLoad,
+                no_scratchpad_handler<op_kind::kDnnl_paged_cache_load>),
+        ITEM(RotaryEmbedding,
+                no_scratchpad_handler<op_kind::kDnnl_rotary_embedding>),
         // utility
         ITEM(Wildcard, dummy_handler),
         ITEM(End, dummy_handler),
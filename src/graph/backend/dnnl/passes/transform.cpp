@@ -3897,7 +3897,14 @@ impl::status_t fuse_dst_transpose_to_predecessor(
                                 == op_kind::dnnl_reshape
                         || is_layout_reorder(&cur_op->get_output_value(0)
                                                       ->get_consumers()[0]
-                                                      .get_op()))) {
+                                                      .get_op())
+                        // the rotation is then computed in place on the
+                        // transposed destination
+                        || cur_op->get_output_value(0)
+                                        ->get_consumers()[0]
+                                        .get_op()
+                                        .get_kind()
+                                == op_kind::dnnl_rotary_embedding)) {
             transpose_ops.emplace_back(cur_op);
         }
     }
@@ -3957,6 +3964,157 @@ impl::status_t fuse_dst_transpose_to_predecessor(
     return impl::status::success;
 }
 
+status_t fuse_dequant_to_gather(std::shared_ptr<subgraph_t> &sg) {
+    // The dequantization of the whole table is replaced by the dequantization
+    // of the gathered rows, so the scales and the zero points must be either
+    // common to the table or given for each row of it.
+    const auto is_row_wise = [](const op_t &op) {
+        const auto &qtype = op.get_attr<std::string>(op_attr::qtype);
+        if (qtype == "per_tensor") return true;
+        if (qtype != "per_channel") return false;
+        const int64_t ndims
+                = op.get_input_value(0)->get_logical_tensor().ndims;
+        int64_t axis = op.get_attr<int64_t>(op_attr::axis);
+        if (axis < 0) axis += ndims;
+        return axis == 0;
+    };
+
+    std::vector<std::pair<op_ptr, op_ptr>> fuse_groups;
+    for (const auto &cur_op : sg->get_ops()) {
+        if (cur_op->get_kind() != op_kind::dnnl_gather) continue;
+
+        auto in_val = cur_op->get_input_value(0);
+        if (!in_val->has_producer() || in_val->get_consumers().size() != 1)
+            continue;
+        op_t &mul_scales = in_val->get_producer();
+        if (mul_scales.get_kind() != op_kind::dnnl_mul_scales
+                || !is_row_wise(mul_scales))
+            continue;
+
+        auto table_val = mul_scales.get_input_value(0);
+        if (table_val->has_producer()
+                && table_val->get_producer().get_kind()
+                        == op_kind::dnnl_sub_zps) {
+            op_t &sub_zps = table_val->get_producer();
+            if (table_val->get_consumers().size() != 1
+                    || !is_row_wise(sub_zps))
+                continue;
+            table_val = sub_zps.get_input_value(0);
+        }
+
+        // Only integer tables are dequantized on the fly, and the shape of
+        // the table is needed to locate its rows.
+        const auto &table_lt = table_val->get_logical_tensor();
+        if (!impl::utils::one_of(table_lt.data_type, impl::data_type::s8,
+                    impl::data_type::u8, impl::data_type::s4,
+                    impl::data_type::u4)
+                || ltw(table_lt).has_zero_dim()
+                || ltw(table_lt).is_shape_unknown())
+            continue;
+
+        fuse_groups.emplace_back(cur_op, mul_scales.shared_from_this());
+    }
+
+    if (fuse_groups.empty()) return status::success;
+
+    subgraph_rewriter_t rewriter(sg);
+    for (auto &fuse_ops : fuse_groups) {
+        op_ptr &gather = fuse_ops.first;
+        op_ptr &mul_scales = fuse_ops.second;
+        op_ptr sub_zps;
+        auto table_val = mul_scales->get_input_value(0);
+        if (table_val->has_producer()) {
+            sub_zps = table_val->get_producer().shared_from_this();
+            table_val = sub_zps->get_input_value(0);
+        }
+
+        gather->get_input_value(0)->remove_consumer(*gather, 0);
+        table_val->remove_consumer(sub_zps ? *sub_zps : *mul_scales, 0);
+        gather->connect_input(0, table_val);
+        gather->set_attr<std::string>(op_attr::qtype,
+                mul_scales->get_attr<std::string>(op_attr::qtype));
+
+        if (mul_scales->has_attr(op_attr::with_runtime_scales)
+                && mul_scales->get_attr<bool>(op_attr::with_runtime_scales)) {
+            auto scales = mul_scales->get_input_value(1);
+            scales->remove_consumer(*mul_scales, 1);
+            gather->connect_input(gather->num_inputs(), scales);
+            gather->set_attr<bool>(op_attr::with_runtime_scales, true);
+        } else {
+            gather->set_attr<std::vector<float>>(op_attr::scales,
+                    mul_scales->get_attr<std::vector<float>>(op_attr::scales));
+        }
+        rewriter.to_remove(mul_scales);
+
+        if (!sub_zps) continue;
+        if (sub_zps->has_attr(op_attr::with_runtime_zps)
+                && sub_zps->get_attr<bool>(op_attr::with_runtime_zps)) {
+            auto zps = sub_zps->get_input_value(1);
+            zps->remove_consumer(*sub_zps, 1);
+            gather->connect_input(gather->num_inputs(), zps);
+            gather->set_attr<bool>(op_attr::with_runtime_zps, true);
+        } else {
+            gather->set_attr<std::vector<int64_t>>(op_attr::zps,
+                    sub_zps->get_attr<std::vector<int64_t>>(op_attr::zps));
+        }
+        rewriter.to_remove(sub_zps);
+    }
+
+    rewriter.run();
+    return status::success;
+}
+
+status_t fuse_reduction_to_gather(std::shared_ptr<subgraph_t> &sg) {
+    std::vector<op_ptr> fusible_reductions;
+    for (const auto &cur_op : sg->get_ops()) {
+        if (cur_op->get_kind() != op_kind::dnnl_gather
+                || (cur_op->has_attr(op_attr::with_sum)
+                        && cur_op->get_attr<bool>(op_attr::with_sum)))
+            continue;
+
+        auto out_val = cur_op->get_output_value(0);
+        auto consumers = out_val->get_consumers();
+        if (consumers.size() != 1) continue;
+        op_t &reduction = consumers[0].get_op();
+        if (reduction.get_kind() != op_kind::dnnl_reduction
+                || reduction.num_inputs() != 1
+                || !reduction.has_attr(op_attr::axes)
+                || reduction.get_attr<int64_t>(op_attr::alg_kind)
+                        != static_cast<int64_t>(
+                                dnnl::algorithm::reduction_sum))
+            continue;
+        if (reduction.has_attr(op_attr::fusion_info_key)
+                && reduction.get_attr<int64_t>(op_attr::fusion_info_key)
+                        != -1)
+            continue;
+
+        // Only the rows selected by the last dimension of the indices, i.e.
+        // a bag, can be summed up.
+        const auto &axes
+                = reduction.get_attr<std::vector<int64_t>>(op_attr::axes);
+        const int64_t ndims = out_val->get_logical_tensor().ndims;
+        const int64_t bag_axis
+                = cur_op->get_input_value(1)->get_logical_tensor().ndims - 1;
+        if (axes.size() != 1
+                || (axes[0] < 0 ? axes[0] + ndims : axes[0]) != bag_axis)
+            continue;
+
+        cur_op->set_attr<bool>(op_attr::with_sum, true);
+        cur_op->set_attr<bool>(op_attr::keep_dims,
+                reduction.has_attr(op_attr::keep_dims)
+                        && reduction.get_attr<bool>(op_attr::keep_dims));
+        fusible_reductions.emplace_back(reduction.shared_from_this());
+    }
+
+    if (fusible_reductions.empty()) return status::success;
+
+    subgraph_rewriter_t rewriter(sg);
+    for (auto &reduction : fusible_reductions)
+        rewriter.fuse_op_to_predecessor(reduction);
+    rewriter.run();
+    return status::success;
+}
+
 impl::status_t fuse_reshape_for_gqa(std::shared_ptr<subgraph_t> &sg) {
     std::vector<op_ptr> reshape_ops;
     dnnl_dim_t head_num;
@@ -207,6 +207,14 @@ impl::status_t fuse_src_transpose_to_matmul(std::shared_ptr<subgraph_t> &sg);
 impl::status_t fuse_dst_transpose_to_predecessor(
         std::shared_ptr<subgraph_t> &sg);
 
+// This pass will fuse the dequantization of the table to gather if the scales
+// and the zero points are per-tensor or given for each row of the table
+status_t fuse_dequant_to_gather(std::shared_ptr<subgraph_t> &sg);
+
+// This pass will fuse the sum of the gathered rows along the last dimension of
+// the indices to gather, i.e. an embedding bag
+status_t fuse_reduction_to_gather(std::shared_ptr<subgraph_t> &sg);
+
 // This pass will fuse all the reshape to its lead op for GQA.
 impl::status_t fuse_reshape_for_gqa(std::shared_ptr<subgraph_t> &sg);
 
@@ -0,0 +1,139 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "graph/backend/dnnl/internal_ops.hpp"
+#include "graph/backend/dnnl/kernels/kernels.hpp"
+#include "graph/backend/dnnl/patterns/fusions.hpp"
+#include "graph/backend/dnnl/patterns/pattern_matcher_pass.hpp"
+#include "graph/backend/dnnl/patterns/utils.hpp"
+
+#include "graph/utils/pm/pbuilder.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+namespace pattern {
+
+namespace pm = graph::utils::pm;
+using in_edges_t = pm::in_edges_t;
+using pb_graph_t = pm::pb_graph_t;
+using FCreatePattern = graph::pass::FCreatePattern;
+
+namespace {
+// The rows of the table are dequantized after they are gathered, which needs
+// the scales and the zero points to be common or given for each row.
+bool check_row_wise_dequant(op_t *graph_op) {
+    const auto &qtype = graph_op->get_attr<std::string>(op_attr::qtype);
+    if (qtype == "per_tensor") return true;
+    if (qtype != "per_channel") return false;
+    const int32_t ndims
+            = graph_op->get_input_value(0)->get_logical_tensor().ndims;
+    int64_t axis = graph_op->get_attr<int64_t>(op_attr::axis);
+    if (axis < 0) axis += ndims;
+    return ndims > 0 && axis == 0;
+}
+
+// Only the sum of the rows gathered with the indices of the last dimension,
+// i.e. an embedding bag, is fused.
+bool check_bag_sum(op_t *graph_op) {
+    const auto &axes = graph_op->get_attr<std::vector<int64_t>>(op_attr::axes);
+    if (axes.size() != 1) return false;
+    auto in_val = graph_op->get_input_value(0);
+    if (!in_val->has_producer()) return false;
+    const int32_t ndims = in_val->get_logical_tensor().ndims;
+    const int32_t indices_ndims = in_val->get_producer()
+                                          .get_input_value(1)
+                                          ->get_logical_tensor()
+                                          .ndims;
+    if (ndims <= 0 || indices_ndims <= 0) return false;
+    const int64_t axis = axes[0] < 0 ? axes[0] + ndims : axes[0];
+    return axis == indices_ndims - 1;
+}
+
+void append_optional_bag_sum(
+        const std::shared_ptr<pb_graph_t> &pgraph, pm::pb_op_t *pgather) {
+    auto popt_sum_graph = std::make_shared<pb_graph_t>();
+    pm::pb_op_t *psum = popt_sum_graph->append_op(graph::op_kind::ReduceSum);
+    psum->append_decision_function(check_bag_sum);
+    popt_sum_graph->create_input_port(0, psum, 0);
+    popt_sum_graph->create_output_port(0, psum, 0);
+    pgraph->append_optional(
+            popt_sum_graph, in_edges_t {in_edge(0, pgather, 0)});
+}
+} // namespace
+
+DNNL_BACKEND_REGISTER_PATTERN_DEF_BEGIN(gather_fusion)
+
+/*
+    table   indices
+        \     /
+        gather
+          |
+      ReduceSum
+*/
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, fp_gather_reduction_cpu)
+        .set_priority(8.5f)
+        .set_kind(partition_kind_t::misc_post_ops)
+        .set_engine_kind(engine_kind::cpu)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    pm::pb_op_t *pgather
+                            = pgraph->append_op(graph::op_kind::Gather);
+                    pm::pb_op_t *psum
+                            = pgraph->append_op(graph::op_kind::ReduceSum,
+                                    in_edges_t {in_edge(0, pgather, 0)});
+                    psum->append_decision_function(check_bag_sum);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<larger_partition_kernel_t>();
+        });
+
+/*
+        x8/x4 table
+            |
+ [dynamic_]dequantize   indices
+             \          /
+                gather
+                  |
+             [ReduceSum]*
+*/
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, x8_gather_reduction_cpu)
+        .set_priority(8.6f)
+        .set_kind(partition_kind_t::misc_quantized_post_ops)
+        .set_engine_kind(engine_kind::cpu)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    pm::pb_op_t *pdequant = pgraph->append_alternation(
+                            {graph::op_kind::Dequantize,
+                                    graph::op_kind::DynamicDequantize});
+                    pdequant->append_decision_function(check_row_wise_dequant);
+                    pm::pb_op_t *pgather
+                            = pgraph->append_op(graph::op_kind::Gather,
+                                    in_edges_t {in_edge(0, pdequant, 0)});
+                    append_optional_bag_sum(pgraph, pgather);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<larger_partition_kernel_t>();
+        });
+
+DNNL_BACKEND_REGISTER_PATTERN_DEF_END
+
+} // namespace pattern
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
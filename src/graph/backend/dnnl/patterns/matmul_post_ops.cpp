@@ -138,6 +138,60 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(
             return std::make_shared<float_matmul>();
         });
 
+/*
+              \   /
+              matmul
+                |
+             [bias]*
+                |
+            [Reshape]*
+                |
+            transpose
+                |     cos  sin
+                |    /    /
+          rotary_embedding
+                |
+*/
+// Projections of queries and keys with the rotation of the positional
+// embedding, producing them in the head-major layout consumed by sdpa. When
+// the transpose directly follows the matmul, the matmul writes the transposed
+// layout and the rotation is computed in place on its destination. Otherwise
+// the rotation reads the transposed view of the matmul destination.
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(
+        dnnl, fp_matmul_transpose_rotary_embedding_cpu)
+        .set_priority(9.2f)
+        .set_kind(partition_kind_t::matmul_post_ops)
+        .set_engine_kind(engine_kind::cpu)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    pm::pb_op_t *pmatmul
+                            = pgraph->append_op(graph::op_kind::MatMul);
+
+                    // Optional bias_add
+                    auto popt_bias = optional_bias_add(pgraph, pmatmul, false);
+
+                    // Optional reshape splitting the heads
+                    auto popt_reshape_graph = std::make_shared<pb_graph_t>();
+                    pm::pb_op_t *preshape = popt_reshape_graph->append_op(
+                            graph::op_kind::StaticReshape);
+                    popt_reshape_graph->create_input_port(0, preshape, 0);
+                    popt_reshape_graph->create_output_port(0, preshape, 0);
+                    auto popt_reshape
+                            = pgraph->append_optional(popt_reshape_graph,
+                                    in_edges_t {in_edge(0, popt_bias, 0)});
+
+                    // transpose
+                    auto ptranspose = pgraph->append_op(
+                            graph::op_kind::StaticTranspose,
+                            in_edges_t {in_edge(0, popt_reshape, 0)});
+
+                    pgraph->append_op(graph::op_kind::RotaryEmbedding,
+                            in_edges_t {in_edge(0, ptranspose, 0)});
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<float_matmul>();
+        });
+
 /*
                     [quant_weight]*
         |                  |
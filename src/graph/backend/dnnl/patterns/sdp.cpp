@@ -156,6 +156,51 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_sdp_gemma_fusion_cpu)
             return std::make_shared<sdp_base_t<>>();
         });
 
+/*
+    [key cache] [block table] [value cache]
+              \     /     \     /
+ [query]  PagedCacheLoad  PagedCacheLoad
+      \     /                   |
+       MatMul                    |
+         |                       |
+  [scale and masks]*             |
+         |                       |
+      Softmax                    |
+           \                    /
+                   MatMul
+                     |
+    [StaticTranspose + StaticReshape/Reorder]*
+                     |
+                  [output]
+*/
+// Keys and values are gathered from pages of fixed size through the block
+// table. The sdpa primitive reads the pages in place instead.
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_sdp_paged_kv_fusion_cpu)
+        .set_priority(22.0f)
+        .set_kind(partition_kind_t::sdp)
+        .set_engine_kind(engine_kind::cpu)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    auto load_key = pgraph->append_op(
+                            graph::op_kind::PagedCacheLoad);
+                    auto matmul_qk = pgraph->append_op(graph::op_kind::MatMul,
+                            {in_edge(1, load_key, 0)});
+                    auto optional_scale_and_mask
+                            = optional_scale_and_masks(pgraph, matmul_qk);
+                    auto softmax = pgraph->append_op(graph::op_kind::SoftMax,
+                            {in_edge(0, optional_scale_and_mask, 0)});
+                    auto load_value = pgraph->append_op(
+                            graph::op_kind::PagedCacheLoad);
+                    auto matmul_v = pgraph->append_op(graph::op_kind::MatMul,
+                            {in_edge(0, softmax, 0),
+                                    in_edge(1, load_value, 0)});
+                    // Optional transpose + reshape/reorder
+                    optional_transpose_reshape(pgraph, matmul_v, 0);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<sdp_base_t<>>();
+        });
+
 // for implicit causal mask, gpu only supports f16/bf16 dtype
 DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_sdp_fusion_gpu)
         .set_priority(21.0f)
@@ -14,9 +14,23 @@
  * limitations under the License.
  *******************************************************************************/
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define DNNL_GRAPH_CONSTANT_CACHE_USE_MMAP
+#endif
+
 #include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 #include <unordered_map>
 
@@ -65,9 +79,57 @@ static size_t get_timestamp() {
     return std::chrono::steady_clock::now().time_since_epoch().count();
 }
 
+namespace {
+
+// A backing store file holds a header padded to a page, so the mapped data
+// keeps the alignment expected by the memory planner, followed by the data.
+struct backing_header_t {
+    char magic[8];
+    uint64_t key;
+    uint64_t size;
+};
+
+constexpr size_t backing_data_offset = 4096;
+const char backing_magic[8] = {'O', 'N', 'E', 'D', 'N', 'N', 'C', 'T'};
+
+std::string backing_path(const std::string &dir, c_key_t key) {
+    char name[32];
+    snprintf(name, sizeof(name), "%016" PRIx64 ".const", (uint64_t)key);
+    return dir + "/" + name;
+}
+
+#ifdef DNNL_GRAPH_CONSTANT_CACHE_USE_MMAP
+class mapped_constant_buffer_t : public constant_buffer_t {
+public:
+    mapped_constant_buffer_t(size_t size, impl::engine_t *eng, void *map,
+            size_t map_size)
+        : constant_buffer_t(size, eng,
+                static_cast<char *>(map) + backing_data_offset)
+        , map_(map)
+        , map_size_(map_size) {}
+
+    ~mapped_constant_buffer_t() override { munmap(map_, map_size_); }
+
+private:
+    void *map_;
+    size_t map_size_;
+};
+#endif
+
+} // namespace
+
 constant_tensor_cache_t::constant_tensor_cache_t(
         size_t capacity_in_bytes, const std::string &name)
-    : name_(name), capacity_in_bytes_(capacity_in_bytes), counter_(1) {
+    : name_(name)
+    , capacity_in_bytes_(capacity_in_bytes)
+    , counter_(1)
+    , eviction_policy_(dnnl_graph_constant_tensor_cache_eviction_none)
+    , inflation_(0.0)
+    , size_in_bytes_(0)
+    , hits_(0)
+    , misses_(0)
+    , evictions_(0)
+    , evicted_bytes_(0) {
     constant_map_ = impl::utils::make_unique<
             std::unordered_map<c_key_t, timed_entry_t>>();
 }
@@ -140,7 +202,7 @@ constant_tensor_cache_t::~constant_tensor_cache_t() {
 status_t constant_tensor_cache_t::set_capacity(size_t capacity) {
     lock_write();
     capacity_in_bytes_ = capacity;
-    evict(get_size()); // completely flushed cache
+    clear(); // completely flushed cache
     unlock_write();
     return status::success;
 }
@@ -149,6 +211,153 @@ size_t constant_tensor_cache_t::get_capacity() {
     return capacity_in_bytes_.load();
 }
 
+status_t constant_tensor_cache_t::set_eviction_policy(
+        eviction_policy_t policy) {
+    switch (policy) {
+        case dnnl_graph_constant_tensor_cache_eviction_none:
+        case dnnl_graph_constant_tensor_cache_eviction_lru:
+        case dnnl_graph_constant_tensor_cache_eviction_greedy_dual_size: break;
+        default: return status::invalid_arguments;
+    }
+    lock_write();
+    eviction_policy_ = policy;
+    unlock_write();
+    return status::success;
+}
+
+constant_tensor_cache_t::eviction_policy_t
+constant_tensor_cache_t::get_eviction_policy() const {
+    return eviction_policy_.load();
+}
+
+void constant_tensor_cache_t::set_cost(
+        key_t backend_id, key_t backend_specific_key, double cost) {
+    c_key_t key = combine_key(backend_id, backend_specific_key);
+
+    lock_read();
+    auto it = constant_map().find(key);
+    if (it != constant_map().end()) {
+        it->second.cost_.store(cost, std::memory_order_relaxed);
+        it->second.priority_.store(get_priority(cost, it->second.size_),
+                std::memory_order_relaxed);
+    }
+    unlock_read();
+}
+
+constant_tensor_cache_t::stats_t constant_tensor_cache_t::get_stats() const {
+    stats_t stats;
+    stats.hits = hits_.load(std::memory_order_relaxed);
+    stats.misses = misses_.load(std::memory_order_relaxed);
+    stats.evictions = evictions_.load(std::memory_order_relaxed);
+    stats.evicted_bytes = evicted_bytes_.load(std::memory_order_relaxed);
+    stats.size_bytes = get_size();
+    return stats;
+}
+
+status_t constant_tensor_cache_t::set_backing_dir(const std::string &dir) {
+#ifndef DNNL_GRAPH_CONSTANT_CACHE_USE_MMAP
+    if (!dir.empty()) return status::unimplemented;
+#endif
+    lock_write();
+    backing_dir_ = dir;
+    unlock_write();
+    return status::success;
+}
+
+std::string constant_tensor_cache_t::get_backing_dir() {
+    lock_read();
+    std::string dir = backing_dir_;
+    unlock_read();
+    return dir;
+}
+
+bool constant_tensor_cache_t::is_backed() {
+    lock_read();
+    bool backed = !backing_dir_.empty() && capacity_in_bytes_ != 0;
+    unlock_read();
+    return backed;
+}
+
+constant_tensor_cache_t::cached_t
+constant_tensor_cache_t::load_from_backing_store(impl::engine_t *eng,
+        key_t backend_id, key_t backend_specific_key, size_t size) {
+#ifdef DNNL_GRAPH_CONSTANT_CACHE_USE_MMAP
+    const std::string dir = get_backing_dir();
+    if (dir.empty() || !size || eng->kind() != engine_kind::cpu)
+        return nullptr;
+
+    const c_key_t key = combine_key(backend_id, backend_specific_key);
+    const std::string path = backing_path(dir, key);
+    bool is_symlink = false;
+    if (check_for_symlinks(path.c_str(), &is_symlink) != status::success
+            || is_symlink)
+        return nullptr;
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return nullptr;
+
+    cached_t buffer;
+    const size_t map_size = backing_data_offset + size;
+    struct stat finfo;
+    if (fstat(fd, &finfo) == 0 && (size_t)finfo.st_size == map_size) {
+        // MAP_SHARED lets all processes mapping the file use the same
+        // physical pages.
+        void *map = mmap(nullptr, map_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (map != MAP_FAILED) {
+            backing_header_t header;
+            std::memcpy(&header, map, sizeof(header));
+            if (std::memcmp(header.magic, backing_magic, sizeof(backing_magic))
+                            == 0
+                    && header.key == key && header.size == size) {
+                buffer = std::make_shared<mapped_constant_buffer_t>(
+                        size, eng, map, map_size);
+            } else {
+                munmap(map, map_size);
+            }
+        }
+    }
+    ::close(fd);
+    return buffer;
+#else
+    return nullptr;
+#endif
+}
+
+void constant_tensor_cache_t::store_to_backing_store(key_t backend_id,
+        key_t backend_specific_key, const cached_t &buffer) {
+#ifdef DNNL_GRAPH_CONSTANT_CACHE_USE_MMAP
+    const std::string dir = get_backing_dir();
+    if (dir.empty() || !buffer || !buffer->size()) return;
+
+    const c_key_t key = combine_key(backend_id, backend_specific_key);
+    backing_header_t header;
+    std::memcpy(header.magic, backing_magic, sizeof(backing_magic));
+    header.key = key;
+    header.size = buffer->size();
+    std::vector<char> padded_header(backing_data_offset, 0);
+    std::memcpy(padded_header.data(), &header, sizeof(header));
+
+    // The data is written into a temporary file which is renamed afterwards,
+    // so concurrent processes never map a partially written buffer.
+    const std::string path = backing_path(dir, key);
+    const std::string tmp_path = path + ".tmp."
+            + std::to_string((uint64_t)getpid()) + "."
+            + std::to_string(std::hash<std::thread::id>()(
+                    std::this_thread::get_id()));
+    FILE *fp = impl::fopen(tmp_path.c_str(), "wb");
+    if (!fp) return;
+    bool ok = fwrite(padded_header.data(), 1, padded_header.size(), fp)
+                    == padded_header.size()
+            && fwrite(buffer->data<char>(), 1, buffer->size(), fp)
+                    == buffer->size();
+    ok = fclose(fp) == 0 && ok;
+    if (!ok || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+        VWARN(graph, constant_tensor_cache, "cannot write %s", path.c_str());
+    }
+#endif
+}
+
 c_key_t constant_tensor_cache_t::combine_key(
         c_key_t backend_id, c_key_t backend_specific_key) {
     size_t key = (backend_specific_key << BACKEND_ID_LENGTH)
@@ -173,6 +382,7 @@ c_value_t constant_tensor_cache_t::get_or_add(c_key_t backend_id,
     auto e = get(key);
     if (e.valid()) {
         unlock_read();
+        hits_.fetch_add(1, std::memory_order_relaxed);
         return e;
     }
 
@@ -198,6 +408,10 @@ c_value_t constant_tensor_cache_t::get_or_add(c_key_t backend_id,
         add(key, size, value);
     }
     unlock_write();
+    if (e.valid())
+        hits_.fetch_add(1, std::memory_order_relaxed);
+    else
+        misses_.fetch_add(1, std::memory_order_relaxed);
     return e;
 }
 
@@ -215,6 +429,7 @@ void constant_tensor_cache_t::remove_if_exist(
         // bound and cause OOM in user application.
         auto &item = constant_map().at(key);
         item.value_.get()->notify_evict();
+        size_in_bytes_ -= item.size_;
         constant_map().erase(key);
         unlock_write();
     }
@@ -222,29 +437,32 @@ void constant_tensor_cache_t::remove_if_exist(
 
 // Get the total size of all cached buffers
 size_t constant_tensor_cache_t::get_size() const {
-    size_t total_size = 0;
-    for (const auto &pair : constant_map()) {
-        total_size += pair.second.value_.get()->size();
-    }
-    return total_size;
+    return size_in_bytes_.load(std::memory_order_relaxed);
 }
 
 void constant_tensor_cache_t::add(
         const c_key_t &key, size_t size, const c_value_t &constant) {
-    size_t current_size = get_size();
+    if (size > capacity_in_bytes_) return;
 
-    // No enough capacity to cache the new tensor, ignore the new tensor
-    // directly
-    if (current_size + size > capacity_in_bytes_) { return; }
+    size_t current_size = get_size();
+    if (current_size + size > capacity_in_bytes_) {
+        // No enough capacity to cache the new tensor, ignore the new tensor
+        // directly if eviction is disabled or impossible
+        if (eviction_policy_ == dnnl_graph_constant_tensor_cache_eviction_none)
+            return;
+        if (!evict(current_size + size - capacity_in_bytes_)) return;
+    }
 
     // Cache tensors
     size_t timestamp = get_timestamp();
 
     auto res = constant_map().emplace(std::piecewise_construct,
             std::forward_as_tuple(key),
-            std::forward_as_tuple(constant, timestamp));
+            std::forward_as_tuple(
+                    constant, size, timestamp, get_priority(0.0, size)));
     UNUSED(res);
     assert(res.second);
+    size_in_bytes_ += size;
 }
 
 c_value_t constant_tensor_cache_t::get(const c_key_t &key) {
@@ -253,40 +471,79 @@ c_value_t constant_tensor_cache_t::get(const c_key_t &key) {
 
     size_t timestamp = get_timestamp();
     it->second.timestamp_.store(timestamp);
+    // A hit restores the priority of the entry relatively to the current
+    // inflation value.
+    it->second.priority_.store(
+            get_priority(it->second.cost_.load(std::memory_order_relaxed),
+                    it->second.size_),
+            std::memory_order_relaxed);
     // Return the entry
     return it->second.value_;
 }
 
+void constant_tensor_cache_t::clear() {
+    constant_map().clear();
+    size_in_bytes_ = 0;
+}
+
 // Evict n size of cached buffers
-void constant_tensor_cache_t::evict(size_t n) {
+bool constant_tensor_cache_t::evict(size_t n) {
     using v_t = std::unordered_map<c_key_t, timed_entry_t>::value_type;
-    if (n == get_size()) {
-        constant_map().clear();
-        return;
+    const bool use_gds = eviction_policy_
+            == dnnl_graph_constant_tensor_cache_eviction_greedy_dual_size;
+
+    // Buffers which are still being computed can't be evicted, since waiting
+    // for them under the write lock would block all the users of the cache.
+    std::vector<v_t *> candidates;
+    size_t evictable_size = 0;
+    for (auto &pair : constant_map()) {
+        if (pair.second.value_.wait_for(std::chrono::seconds(0))
+                != std::future_status::ready)
+            continue;
+        candidates.push_back(&pair);
+        evictable_size += pair.second.size_;
     }
+    if (evictable_size < n) return false;
+
+    // By default, load() and operator T use sequentially consistent memory
+    // ordering, which enforces writing the timestamps into registers in the
+    // same exact order they are read from the CPU cache line. Since eviction
+    // is performed under a write lock, this order is not important, therefore
+    // we can safely use the weakest memory ordering (relaxed). The least
+    // recently used item goes first among items of the same priority.
+    std::sort(candidates.begin(), candidates.end(),
+            [&](const v_t *left, const v_t *right) {
+                if (use_gds) {
+                    const double l_priority = left->second.priority_.load(
+                            std::memory_order_relaxed);
+                    const double r_priority = right->second.priority_.load(
+                            std::memory_order_relaxed);
+                    if (l_priority != r_priority)
+                        return l_priority < r_priority;
+                }
+                return left->second.timestamp_.load(std::memory_order_relaxed)
+                        < right->second.timestamp_.load(
+                                std::memory_order_relaxed);
+            });
 
     size_t evicted_size = 0;
-    while (evicted_size < n) {
-        // We evict the least recently used items
-        auto it = std::min_element(constant_map().begin(), constant_map().end(),
-                [&](const v_t &left, const v_t &right) {
-                    // By default, load() and operator T use sequentially
-                    // consistent memory ordering, which enforces writing the
-                    // timestamps into registers in the same exact order they
-                    // are read from the CPU cache line. Since eviction is
-                    // performed under a write lock, this order is not
-                    // important, therefore we can safely use the weakest memory
-                    // ordering (relaxed).
-                    return left.second.timestamp_.load(
-                                   std::memory_order_relaxed)
-                            < right.second.timestamp_.load(
-                                    std::memory_order_relaxed);
-                });
-        evicted_size += it->second.value_.get()->size();
-        auto res = constant_map().erase(it->first);
+    for (size_t i = 0; i < candidates.size() && evicted_size < n; i++) {
+        auto &entry = candidates[i]->second;
+        if (use_gds)
+            inflation_.store(entry.priority_.load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+        // Notify backend that this buffer is evicted, see remove_if_exist().
+        const cached_t &buffer = entry.value_.get();
+        if (buffer) buffer->notify_evict();
+        evicted_size += entry.size_;
+        evictions_.fetch_add(1, std::memory_order_relaxed);
+        evicted_bytes_.fetch_add(entry.size_, std::memory_order_relaxed);
+        size_in_bytes_ -= entry.size_;
+        auto res = constant_map().erase(candidates[i]->first);
         UNUSED(res);
         assert(res);
     }
+    return true;
 }
 
 // copy from src/common/engine.cpp
@@ -338,6 +595,21 @@ public:
     std::unordered_map<impl::engine_kind_t, size_t> &get_user_capacities() {
         return user_capacities;
     }
+    // The backing directory may be changed by the user at any time, hence
+    // it's only accessed under the lock and returned by copy.
+    std::string get_backing_dir() {
+        std::lock_guard<std::mutex> lock(backing_dir_mutex);
+        return backing_dir;
+    }
+    void set_backing_dir(const std::string &dir) {
+        std::lock_guard<std::mutex> lock(backing_dir_mutex);
+        backing_dir = dir;
+    }
+    std::unordered_map<impl::engine_kind_t,
+            constant_tensor_cache_t::eviction_policy_t> &
+    get_eviction_policies() {
+        return eviction_policies;
+    }
 
 private:
     global_cache_manager_t() {
@@ -386,6 +658,18 @@ private:
             }
         }
 
+        // The value of ONEDNN_GRAPH_CONSTANT_TENSOR_CACHE_DIR is a path, which
+        // is case-sensitive, hence it's not queried with getenv_string_user.
+        char dir[1024];
+        for (const auto &prefix : {"ONEDNN_", "DNNL_"}) {
+            std::string name = std::string(prefix)
+                    + "GRAPH_CONSTANT_TENSOR_CACHE_DIR";
+            if (impl::getenv(name.c_str(), dir, sizeof(dir)) > 0) {
+                backing_dir = dir;
+                break;
+            }
+        }
+
         // create cache for all engine kinds and all devices in the
         // system, to avoid potential data race when modifying caches vector at
         // runtime in multiple threads.
@@ -408,6 +692,9 @@ private:
                         [](constant_tensor_cache_t *ptr) {
                             return ptr->release();
                         });
+                // Only host memory can be mapped from the backing store.
+                if (kind == impl::engine_kind::cpu)
+                    cache->set_backing_dir(backing_dir);
             }
             caches.insert({kind, std::move(cache_list)});
         }
@@ -421,6 +708,11 @@ private:
     std::unordered_map<impl::engine_kind_t, std::vector<cache_ptr>> caches;
     std::unordered_map<impl::engine_kind_t, size_t> default_capacities;
     std::unordered_map<impl::engine_kind_t, size_t> user_capacities;
+    std::string backing_dir;
+    std::mutex backing_dir_mutex;
+    std::unordered_map<impl::engine_kind_t,
+            constant_tensor_cache_t::eviction_policy_t>
+            eviction_policies;
 };
 
 constant_tensor_cache_t *get_constant_tensor_cache(
@@ -519,3 +811,89 @@ dnnl::impl::graph::status_t dnnl_graph_get_constant_tensor_cache_capacity(
 
     return dnnl::impl::graph::status::success;
 }
+
+dnnl::impl::graph::status_t dnnl_graph_set_constant_tensor_cache_dir(
+        dnnl_engine_kind_t eng_kind, const char *dir) {
+    using namespace dnnl::impl::graph;
+    const std::string dir_str = dir ? dir : "";
+    if (eng_kind != dnnl::impl::engine_kind::cpu)
+        return dir_str.empty() ? status::success : status::unimplemented;
+
+    auto &manager = global_cache_manager_t::get_instance();
+    manager.set_backing_dir(dir_str);
+    if (manager.get_caches().count(eng_kind)) {
+        for (auto &cache : manager.get_caches().at(eng_kind)) {
+            if (cache) CHECK(cache->set_backing_dir(dir_str));
+        }
+    }
+    return status::success;
+}
+
+dnnl::impl::graph::status_t dnnl_graph_get_constant_tensor_cache_dir(
+        dnnl_engine_kind_t eng_kind, const char **dir) {
+    using namespace dnnl::impl::graph;
+    if (dir == nullptr) return status::invalid_arguments;
+    // The returned string stays valid until the next query from the same
+    // thread, regardless of concurrent updates of the directory.
+    static thread_local std::string dir_copy;
+    dir_copy = eng_kind == dnnl::impl::engine_kind::cpu
+            ? global_cache_manager_t::get_instance().get_backing_dir()
+            : std::string();
+    *dir = dir_copy.c_str();
+    return status::success;
+}
+
+dnnl::impl::graph::status_t
+dnnl_graph_set_constant_tensor_cache_eviction_policy(
+        dnnl_engine_kind_t eng_kind,
+        dnnl_graph_constant_tensor_cache_eviction_policy_t policy) {
+    using namespace dnnl::impl::graph;
+    if (!dnnl::impl::utils::one_of(policy,
+                dnnl_graph_constant_tensor_cache_eviction_none,
+                dnnl_graph_constant_tensor_cache_eviction_lru,
+                dnnl_graph_constant_tensor_cache_eviction_greedy_dual_size))
+        return status::invalid_arguments;
+
+    auto &manager = global_cache_manager_t::get_instance();
+    if (manager.get_caches().count(eng_kind)) {
+        for (auto &cache : manager.get_caches().at(eng_kind)) {
+            if (cache) CHECK(cache->set_eviction_policy(policy));
+        }
+    }
+    manager.get_eviction_policies()[eng_kind] = policy;
+    return status::success;
+}
+
+dnnl::impl::graph::status_t
+dnnl_graph_get_constant_tensor_cache_eviction_policy(
+        dnnl_engine_kind_t eng_kind,
+        dnnl_graph_constant_tensor_cache_eviction_policy_t *policy) {
+    using namespace dnnl::impl::graph;
+    if (policy == nullptr) return status::invalid_arguments;
+    auto &policies = global_cache_manager_t::get_instance()
+                             .get_eviction_policies();
+    *policy = policies.count(eng_kind)
+            ? policies.at(eng_kind)
+            : dnnl_graph_constant_tensor_cache_eviction_none;
+    return status::success;
+}
+
+dnnl::impl::graph::status_t dnnl_graph_get_constant_tensor_cache_stats(
+        dnnl_engine_kind_t eng_kind,
+        dnnl_graph_constant_tensor_cache_stats_t *stats) {
+    using namespace dnnl::impl::graph;
+    if (stats == nullptr) return status::invalid_arguments;
+    *stats = dnnl_graph_constant_tensor_cache_stats_t();
+    auto &manager = global_cache_manager_t::get_instance();
+    if (manager.get_caches().count(eng_kind) == 0) return status::success;
+    for (auto &cache : manager.get_caches().at(eng_kind)) {
+        if (!cache) continue;
+        const auto device_stats = cache->get_stats();
+        stats->hits += device_stats.hits;
+        stats->misses += device_stats.misses;
+        stats->evictions += device_stats.evictions;
+        stats->evicted_bytes += device_stats.evicted_bytes;
+        stats->size_bytes += device_stats.size_bytes;
+    }
+    return status::success;
+}
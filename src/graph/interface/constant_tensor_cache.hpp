@@ -21,6 +21,7 @@
 #include <future>
 #include <limits>
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
 
@@ -28,6 +29,8 @@
 #include "common/engine.hpp"
 #include "common/rw_mutex.hpp"
 
+#include "oneapi/dnnl/dnnl_graph_types.h"
+
 #include "graph/interface/allocator.hpp"
 #include "graph/interface/c_types_map.hpp"
 
@@ -53,7 +56,7 @@ public:
     }
 
     virtual ~constant_buffer_t() {
-        free_func_(data_, eng_, alc_);
+        if (free_func_) free_func_(data_, eng_, alc_);
         eng_->release();
     };
 
@@ -75,6 +78,17 @@ public:
     virtual void notify_evict() {}
 
 protected:
+    // Wraps memory owned by a derived class, e.g. a file mapping.
+    constant_buffer_t(size_t size, impl::engine_t *eng, void *data)
+        : data_(data)
+        , size_(size)
+        , eng_(eng)
+        , alc_(nullptr)
+        , malloc_func_(nullptr)
+        , free_func_(nullptr) {
+        eng_->retain();
+    }
+
     void *data_;
     size_t size_;
     impl::engine_t *eng_;
@@ -89,6 +103,9 @@ struct constant_tensor_cache_t {
     using key_t = size_t;
     using cached_t = std::shared_ptr<constant_buffer_t>;
     using value_t = std::shared_future<cached_t>;
+    using eviction_policy_t
+            = dnnl_graph_constant_tensor_cache_eviction_policy_t;
+    using stats_t = dnnl_graph_constant_tensor_cache_stats_t;
 
     explicit constant_tensor_cache_t(
             size_t capacity_in_bytes, const std::string &name = "");
@@ -114,6 +131,36 @@ struct constant_tensor_cache_t {
 
     size_t get_size() const;
 
+    // When the cache is full, the eviction policy decides which buffers are
+    // evicted to make room for a new one. Only buffers which have been
+    // computed can be evicted.
+    status_t set_eviction_policy(eviction_policy_t policy);
+    eviction_policy_t get_eviction_policy() const;
+
+    // Records the time in milliseconds spent to compute the buffer. The
+    // GreedyDual-Size policy evicts buffers which are cheap to recompute per
+    // byte first. Buffers without a recorded cost are evicted in LRU order.
+    void set_cost(key_t backend_id, key_t backend_specific_key, double cost);
+
+    stats_t get_stats() const;
+
+    // The backing store keeps constant buffers in files of the given
+    // directory. A buffer found there is mapped read-only and shared, so
+    // processes on the same host hold one physical copy of it. Only host
+    // memory can be backed, and an empty directory disables the store.
+    status_t set_backing_dir(const std::string &dir);
+    std::string get_backing_dir();
+    bool is_backed();
+
+    // Returns a buffer mapped from the backing store, or an empty pointer on
+    // a miss. The key must not depend on the process, e.g. on data addresses.
+    cached_t load_from_backing_store(impl::engine_t *eng, key_t backend_id,
+            key_t backend_specific_key, size_t size);
+    // Writes the buffer to the backing store. Failures are not reported since
+    // the buffer remains valid in memory.
+    void store_to_backing_store(key_t backend_id, key_t backend_specific_key,
+            const cached_t &buffer);
+
     // The key_t is composed of two parts: backend id and backend specific key.
     // The backend id occupies 4 bits, and the backend specific key occupies the
     // remained 60 bits. So backends should ensure not encode any information in
@@ -123,7 +170,10 @@ struct constant_tensor_cache_t {
     static key_t combine_key(key_t backend_id, key_t backend_specific_key);
 
 private:
-    void evict(size_t n);
+    // Evicts at least n bytes of computed buffers. Nothing is evicted if
+    // there are not enough such buffers.
+    bool evict(size_t n);
+    void clear();
     value_t get(const key_t &key);
     void add(const key_t &key, size_t size, const value_t &constant);
 
@@ -141,11 +191,26 @@ private:
 
     struct timed_entry_t {
         value_t value_;
+        size_t size_;
         std::atomic<size_t> timestamp_;
-        timed_entry_t(const value_t &value, size_t timestamp)
-            : value_(value), timestamp_(timestamp) {}
+        // Computation time of the buffer and its GreedyDual-Size priority.
+        // Both are updated under a read lock, hence they are atomic.
+        std::atomic<double> cost_;
+        std::atomic<double> priority_;
+        timed_entry_t(const value_t &value, size_t size, size_t timestamp,
+                double priority)
+            : value_(value)
+            , size_(size)
+            , timestamp_(timestamp)
+            , cost_(0.0)
+            , priority_(priority) {}
     };
 
+    double get_priority(double cost, size_t size) const {
+        return inflation_.load(std::memory_order_relaxed)
+                + cost / static_cast<double>(size);
+    }
+
     std::unordered_map<key_t, timed_entry_t> &constant_map() {
         return *constant_map_;
     }
@@ -161,8 +226,18 @@ private:
     std::unique_ptr<std::unordered_map<key_t, timed_entry_t>> constant_map_;
     impl::utils::rw_mutex_t rw_mutex_;
     std::string name_;
+    std::string backing_dir_;
     std::atomic<size_t> capacity_in_bytes_;
     std::atomic<int32_t> counter_;
+    std::atomic<eviction_policy_t> eviction_policy_;
+    // The GreedyDual-Size inflation value, which is the priority of the last
+    // evicted buffer. It ages buffers which are not accessed anymore.
+    std::atomic<double> inflation_;
+    std::atomic<size_t> size_in_bytes_;
+    std::atomic<size_t> hits_;
+    std::atomic<size_t> misses_;
+    std::atomic<size_t> evictions_;
+    std::atomic<size_t> evicted_bytes_;
 };
 
 constant_tensor_cache_t *get_constant_tensor_cache(
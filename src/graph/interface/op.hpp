@@ -392,6 +392,7 @@ public:
             CASE(EluBackward);
             CASE(End);
             CASE(Exp);
+            CASE(Gather);
             CASE(GELU);
             CASE(GELUBackward);
             CASE(GenIndex);
@@ -417,6 +418,7 @@ public:
             CASE(Mish);
             CASE(MishBackward);
             CASE(Multiply);
+            CASE(PagedCacheLoad);
             CASE(Pow);
             CASE(PReLU);
             CASE(PReLUBackward);
@@ -432,6 +434,7 @@ public:
             CASE(ReLU);
             CASE(ReLUBackward);
             CASE(Reorder);
+            CASE(RotaryEmbedding);
             CASE(Round);
             CASE(Select);
             CASE(Sigmoid);
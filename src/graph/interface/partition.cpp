@@ -320,17 +320,35 @@ status_t DNNL_API dnnl_graph_compiled_partition_execute(
         outs.emplace_back(**(outputs + i));
     }
 
+    // A partition is submitted as a single task, so that an out-of-order
+    // stream can execute independent partitions concurrently.
+    auto get_regions = [](const std::vector<tensor_t> &tensors) {
+        using ltw = logical_tensor_wrapper_t;
+        std::vector<dnnl::impl::memory_region_t> regions;
+        for (const auto &t : tensors) {
+            if (!t.get_data_handle()) continue;
+            regions.push_back({t.get_data_handle(),
+                    ltw(t.get_logical_tensor()).size()});
+        }
+        return regions;
+    };
+    const auto in_regions = get_regions(ins);
+    const auto out_regions = get_regions(outs);
+    auto execute = [=]() {
+        return compiled_partition->execute(stream, ins, outs);
+    };
+
     if (get_verbose(dnnl::impl::verbose_t::exec_profile,
                 dnnl::impl::component_t::graph)) {
         stream->wait();
         double start_ms = dnnl::impl::get_msec();
-        CHECK(compiled_partition->execute(stream, ins, outs));
+        CHECK(stream->enqueue_task(execute, in_regions, out_regions));
         stream->wait();
         double duration_ms = dnnl::impl::get_msec() - start_ms;
         VPROF(start_ms, graph, exec, VERBOSE_profile,
                 compiled_partition->info(), duration_ms);
     } else {
-        CHECK(compiled_partition->execute(stream, ins, outs));
+        CHECK(stream->enqueue_task(execute, in_regions, out_regions));
     }
     return status::success;
 }
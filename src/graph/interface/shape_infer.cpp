@@ -1770,6 +1770,130 @@ status_t infer_groupnorm_output_shape(op_t *n,
     return status::success;
 }
 
+status_t infer_paged_cache_load_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto cache = logical_tensor_wrapper_t(inputs[0]);
+    auto block_table = logical_tensor_wrapper_t(inputs[1]);
+    auto out = logical_tensor_wrapper_t(outputs[0]);
+
+    // cache: [num_pages, num_heads, page_size, head_size]
+    // block_table: [batch_size, max_pages_per_sequence]
+    VCHECK_INVALID_SHAPE((cache.ndims() == 4),
+            "%s, the cache should have exactly 4 dims, given dims: %d ",
+            op_t::kind2str(n->get_kind()).c_str(), cache.ndims());
+    VCHECK_INVALID_SHAPE((block_table.ndims() == 2),
+            "%s, the block table should have exactly 2 dims, given dims: %d ",
+            op_t::kind2str(n->get_kind()).c_str(), block_table.ndims());
+
+    const dims cache_dims = cache.vdims();
+    const dims bt_dims = block_table.vdims();
+    const dim_t seq_len = (cache_dims[2] == DNNL_GRAPH_UNKNOWN_DIM
+                                  || bt_dims[1] == DNNL_GRAPH_UNKNOWN_DIM)
+            ? DNNL_GRAPH_UNKNOWN_DIM
+            : cache_dims[2] * bt_dims[1];
+    // dst: [batch_size, num_heads, max_pages_per_sequence * page_size,
+    // head_size]
+    dims output_dims = {bt_dims[0], cache_dims[1], seq_len, cache_dims[3]};
+
+    if (!out.is_shape_unknown()) {
+        VCHECK_INVALID_SHAPE(validate(output_dims, out.vdims()),
+                "%s, inferred output shape and shape from logical tensor are "
+                "not compatible",
+                op_t::kind2str(n->get_kind()).c_str());
+        return status::success;
+    }
+
+    set_shape_and_strides(*outputs[0], output_dims);
+    return status::success;
+}
+
+status_t infer_gather_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto src = logical_tensor_wrapper_t(inputs[0]);
+    auto indices = logical_tensor_wrapper_t(inputs[1]);
+    auto out = logical_tensor_wrapper_t(outputs[0]);
+
+    VCHECK_INVALID_SHAPE((src.ndims() >= 1),
+            "%s, the src should have at least 1 dim, given dims: %d ",
+            op_t::kind2str(n->get_kind()).c_str(), src.ndims());
+    VCHECK_INVALID_SHAPE((indices.ndims() >= 1),
+            "%s, the indices should have at least 1 dim, given dims: %d ",
+            op_t::kind2str(n->get_kind()).c_str(), indices.ndims());
+
+    // dst: indices dims followed by the dims of a slice of src along the
+    // first dimension
+    dims output_dims = indices.vdims();
+    const dims src_dims = src.vdims();
+    output_dims.insert(output_dims.end(), src_dims.begin() + 1, src_dims.end());
+
+    if (!out.is_shape_unknown()) {
+        VCHECK_INVALID_SHAPE(validate(output_dims, out.vdims()),
+                "%s, inferred output shape and shape from logical tensor are "
+                "not compatible",
+                op_t::kind2str(n->get_kind()).c_str());
+        return status::success;
+    }
+
+    set_shape_and_strides(*outputs[0], output_dims);
+    return status::success;
+}
+
+status_t infer_rotary_embedding_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto src = logical_tensor_wrapper_t(inputs[0]);
+    const int ndims = src.ndims();
+    VCHECK_INVALID_SHAPE((ndims >= 2),
+            "%s, the src should have at least 2 dims, given dims: %d ",
+            op_t::kind2str(n->get_kind()).c_str(), ndims);
+
+    // src: [..., seq_len, head_size], cos and sin: [seq_len, head_size] with
+    // optional leading dimensions of 1.
+    const dims src_dims = src.vdims();
+    const dim_t head_size = src_dims[ndims - 1];
+    VCHECK_INVALID_SHAPE((head_size == DNNL_GRAPH_UNKNOWN_DIM
+                                 || head_size % 2 == 0),
+            "%s, the head size should be even, given head size: %d ",
+            op_t::kind2str(n->get_kind()).c_str(),
+            static_cast<int>(head_size));
+    for (size_t i = 1; i < inputs.size(); i++) {
+        auto table = logical_tensor_wrapper_t(inputs[i]);
+        const int t_ndims = table.ndims();
+        VCHECK_INVALID_SHAPE((t_ndims >= 2 && t_ndims <= ndims),
+                "%s, the cos and sin tables should have from 2 to %d dims, "
+                "given dims: %d ",
+                op_t::kind2str(n->get_kind()).c_str(), ndims, t_ndims);
+        const dims t_dims = table.vdims();
+        for (int d = 1; d <= 2; d++) {
+            const dim_t s = src_dims[ndims - d], t = t_dims[t_ndims - d];
+            VCHECK_INVALID_SHAPE((s == DNNL_GRAPH_UNKNOWN_DIM
+                                         || t == DNNL_GRAPH_UNKNOWN_DIM
+                                         || s == t),
+                    "%s, the last two dims of the cos and sin tables should "
+                    "match the src",
+                    op_t::kind2str(n->get_kind()).c_str());
+        }
+        for (int d = 0; d < t_ndims - 2; d++)
+            VCHECK_INVALID_SHAPE((t_dims[d] == 1),
+                    "%s, the leading dims of the cos and sin tables should be "
+                    "1",
+                    op_t::kind2str(n->get_kind()).c_str());
+    }
+
+    auto out = logical_tensor_wrapper_t(outputs[0]);
+    if (!out.is_shape_unknown()) {
+        VCHECK_INVALID_SHAPE(validate(src_dims, out.vdims()),
+                "%s, input and output shapes are not compatible",
+                op_t::kind2str(n->get_kind()).c_str());
+        return status::success;
+    }
+
+    set_shape_and_strides(*outputs[0], src_dims);
+    return status::success;
+}
+
 } // namespace graph
 } // namespace impl
 } // namespace dnnl
@@ -41,12 +41,14 @@ void check_correctness(const settings_t &s) {
     for_(const auto &i_batch_size : s.batch_size)
     for_(const auto &i_brgemm_attr : s.brgemm_attr)
     for_(const auto &i_batch_kind : s.batch_kind)
+    for_(const auto &i_pack_b : s.pack_b)
     for_(const auto &i_attr : s.attributes)
     for_(const auto &i_ctx_init : s.ctx_init)
     for (const auto &i_ctx_exe : s.ctx_exe) {
         const prb_t prb(s.prb_vdims, i_dt, i_stag, i_wtag, i_dtag, i_strides,
                 i_ld, i_bia_dt, i_alpha, i_beta, i_batch_size, i_brgemm_attr,
-                i_batch_kind, i_attr, i_ctx_init, i_ctx_exe, s.impl_filter);
+                i_batch_kind, i_pack_b, i_attr, i_ctx_init, i_ctx_exe,
+                s.impl_filter);
         if (s.pattern && !match_regex(prb.str(), s.pattern)) return;
         BENCHDNN_PRINT(1, "run: %s\n", prb.str());
 
@@ -150,6 +152,11 @@ static const std::string help_batch_kind
         = "STRING    (Default: addr)\n    Specifies BRGeMM batch kind. "
           "Supported values are: `addr`, `offs`.\n";
 
+static const std::string help_pack_b
+        = "BOOL    (Default: `false`)\n    Instructs the ukernel to pack "
+          "tensor B at execution instead of a separate transform call. "
+          "Applicable to the ukernel API only.\n";
+
 int bench(int argc, char **argv) {
     // BRGeMM kernel support is available on x86 Intel CPU only.
     if (is_gpu()) return OK;
@@ -177,6 +184,8 @@ int bench(int argc, char **argv) {
                         argv[0], "brgemm-attr", help_brgemm_attr)
                 || parse_vector_option(s.batch_kind, def.batch_kind, cstr2str,
                         argv[0], "batch-kind", help_batch_kind)
+                || parse_vector_option(s.pack_b, def.pack_b, str2bool, argv[0],
+                        "pack-b", help_pack_b)
                 || parse_attributes(s, def, argv[0])
                 || parse_test_pattern_match(s.pattern, argv[0])
                 || parse_perf_template(s.perf_template,
@@ -432,11 +432,6 @@ int init_kernel(kernel_args_t &kernel_args) {
                          brgemm, prb->attr.scales.get_mask(DNNL_ARG_DST)),
                 WARN);
     }
-    // This call is responsible whether the final configuration is supported
-    // or not.
-    st = dnnl_brgemm_finalize(brgemm);
-    SAFE(check_dnnl_status(st, prb, res), WARN);
-    if (res->state == SKIPPED) return OK;
 
     dnnl_pack_type_t pack_type = dnnl_pack_type_undef;
     DNN_SAFE(dnnl_brgemm_get_B_pack_type(
@@ -444,27 +439,40 @@ int init_kernel(kernel_args_t &kernel_args) {
             WARN);
     kernel_args.need_pack_ = pack_type == dnnl_pack_type_pack32;
 
+    // Create a memory desc based on user inputs and query strides to use
+    // them in a pack routine.
+    const dnnl_dims_t wei_dims = {prb->k * prb->batch_size, prb->n};
+    auto wei_md = dnn_mem_t::init_md(prb->ndims, wei_dims, prb->wei_dt(),
+            prb->wtag, prb->strides[STRIDES_WEI]);
+    const auto &wei_strides = query_md_strides(wei_md);
+    assert(query_md_ndims(wei_md) == 2);
+    // Choose `no_trans` for cases when K = 1 as less memory is required.
+    auto in_pack_type = wei_strides[1] > wei_strides[0]
+            ? dnnl_pack_type_trans
+            : dnnl_pack_type_no_trans;
+    // One of strides implicitly equals to `1`.
+    auto in_ld = MAX2(wei_strides[0], wei_strides[1]);
+
+    if (kernel_args.need_pack_ && prb->pack_b) {
+        st = dnnl_brgemm_set_pack_B(brgemm, in_pack_type, in_ld);
+        SAFE(check_dnnl_status(st, prb, res), WARN);
+        if (res->state == SKIPPED) return OK;
+    }
+
+    // This call is responsible whether the final configuration is supported
+    // or not.
+    st = dnnl_brgemm_finalize(brgemm);
+    SAFE(check_dnnl_status(st, prb, res), WARN);
+    if (res->state == SKIPPED) return OK;
+
     DNN_SAFE(dnnl_brgemm_generate(brgemm), WARN);
     DNN_SAFE(dnnl_brgemm_get_scratchpad_size(
                      brgemm, &kernel_args.scratchpad_size_),
             WARN);
 
-    if (kernel_args.need_pack_) {
-        // Create a memory desc based on user inputs and query strides to use
-        // them in a pack routine.
-        const dnnl_dims_t wei_dims = {prb->k * prb->batch_size, prb->n};
-        auto wei_md = dnn_mem_t::init_md(prb->ndims, wei_dims, prb->wei_dt(),
-                prb->wtag, prb->strides[STRIDES_WEI]);
-        const auto &wei_strides = query_md_strides(wei_md);
-        assert(query_md_ndims(wei_md) == 2);
-
+    // With `pack_b` the ukernel packs tensors B itself.
+    if (kernel_args.need_pack_ && !prb->pack_b) {
         auto &transform = kernel_args.transform_;
-        // Choose `no_trans` for cases when K = 1 as less memory is required.
-        auto in_pack_type = wei_strides[1] > wei_strides[0]
-                ? dnnl_pack_type_trans
-                : dnnl_pack_type_no_trans;
-        // One of strides implicitly equals to `1`.
-        auto in_ld = MAX2(wei_strides[0], wei_strides[1]);
         st = dnnl_transform_create(&transform, prb->k * prb->batch_size, prb->n,
                 in_pack_type, in_ld, prb->get_ldb(), prb->wei_dt(),
                 prb->wei_dt());
@@ -553,6 +561,14 @@ void skip_invalid_prb(const prb_t *prb, res_t *res) {
         res->reason = skip_reason::case_not_supported;
         return;
     }
+
+    if (prb->pack_b) {
+        BENCHDNN_PRINT(2, "%s\n",
+                "`pack-b` option is supported for ukernel API only.");
+        res->state = SKIPPED;
+        res->reason = skip_reason::case_not_supported;
+        return;
+    }
 #else
     if (!prb->attr.is_def()) {
         bool non_def_zps = !prb->attr.zero_points.is_def();
@@ -649,15 +665,27 @@ dnnl_status_t brgemm_kernel_execute_postops_wrapper(
 #else
 // A special wrapper needed to match internal benchdnn infrastructure.
 dnnl_status_t brgemm_kernel_execute_postops_wrapper(const_dnnl_brgemm_t brgemm,
-        const bool use_dst_as_acc, const void *src_ptr,
-        const void *wei_packed_ptr, const std::vector<dnnl_dim_t> &offsets,
-        void *acc_ptr, void *dst_ptr, void *scratchpad_ptr,
+        const std::string &batch_kind, const bool use_dst_as_acc,
+        const void *src_ptr, const void *wei_packed_ptr,
+        const std::vector<dnnl_dim_t> &offsets,
+        const std::vector<const void *> &src_ptrs,
+        const std::vector<const void *> &wei_ptrs, void *acc_ptr,
+        void *dst_ptr, void *scratchpad_ptr,
         const_dnnl_ukernel_attr_params_t attr_params,
         const dnnl_stream_t &stream,
         const std::vector<dnnl_exec_arg_t> &dnnl_args) {
 
     dnnl_status_t st = dnnl_runtime_error;
-    if (use_dst_as_acc) {
+    if (batch_kind == "addr") {
+        if (use_dst_as_acc) {
+            st = dnnl_brgemm_execute_ptrs(brgemm, src_ptrs.data(),
+                    wei_ptrs.data(), dst_ptr, scratchpad_ptr);
+        } else {
+            st = dnnl_brgemm_execute_ptrs_postops(brgemm, src_ptrs.data(),
+                    wei_ptrs.data(), acc_ptr, dst_ptr, scratchpad_ptr,
+                    attr_params);
+        }
+    } else if (use_dst_as_acc) {
         st = dnnl_brgemm_execute(brgemm, src_ptr, wei_packed_ptr,
                 offsets.data(), dst_ptr, scratchpad_ptr);
     } else {
@@ -1272,7 +1300,17 @@ int doit(const prb_t *prb, res_t *res) {
             ? (char *)mem_map.at(DNNL_ARG_SCRATCHPAD)
             : nullptr;
 
-    if (kernel_args.need_pack_) {
+    // With `pack_b` the ukernel takes tensors B from the user weights and
+    // packs them itself.
+    const bool ukernel_pack_b = kernel_args.need_pack_ && prb->pack_b;
+    int64_t wei_batch_offset = prb->get_wei_batch_offset();
+    if (ukernel_pack_b) {
+        const auto &wei_strides
+                = query_md_strides(mem_map.at(DNNL_ARG_WEIGHTS).md_);
+        wei_batch_offset = prb->k * wei_strides[0]
+                * dnnl_data_type_size(prb->wei_dt());
+        wei_packed_ptr = const_cast<char *>(wei_ptr);
+    } else if (kernel_args.need_pack_) {
         DNN_SAFE(dnnl_transform_execute(transform, wei_ptr, wei_packed_ptr),
                 WARN);
     } else {
@@ -1282,9 +1320,13 @@ int doit(const prb_t *prb, res_t *res) {
     }
 
     std::vector<dnnl_dim_t> offsets(2 * prb->batch_size);
+    std::vector<const void *> src_ptrs(prb->batch_size);
+    std::vector<const void *> wei_ptrs(prb->batch_size);
     for (dnnl_dim_t i = 0; i < prb->batch_size; i++) {
         offsets[2 * i + 0] = i * prb->get_src_batch_offset();
-        offsets[2 * i + 1] = i * prb->get_wei_batch_offset();
+        offsets[2 * i + 1] = i * wei_batch_offset;
+        src_ptrs[i] = src_ptr + offsets[2 * i + 0];
+        wei_ptrs[i] = wei_packed_ptr + offsets[2 * i + 1];
     }
 
     dnnl_ukernel_attr_params_t attr_params_ptr;
@@ -1325,10 +1367,17 @@ int doit(const prb_t *prb, res_t *res) {
 #else // !defined(DNNL_EXPERIMENTAL_UKERNEL)
     // `prb->use_dst_as_acc()=true` will make `dst_ptr=acc_ptr` and rest should
     // be handled by API.
-    DNN_SAFE(dnnl_brgemm_execute_postops(brgemm, src_ptr, wei_packed_ptr,
-                     offsets.data(), acc_ptr, dst_ptr, scratchpad_ptr,
-                     attr_params),
-            WARN);
+    if (prb->batch_kind == "addr") {
+        DNN_SAFE(dnnl_brgemm_execute_ptrs_postops(brgemm, src_ptrs.data(),
+                         wei_ptrs.data(), acc_ptr, dst_ptr, scratchpad_ptr,
+                         attr_params),
+                WARN);
+    } else if (prb->batch_kind == "offs") {
+        DNN_SAFE(dnnl_brgemm_execute_postops(brgemm, src_ptr, wei_packed_ptr,
+                         offsets.data(), acc_ptr, dst_ptr, scratchpad_ptr,
+                         attr_params),
+                WARN);
+    }
 #endif
     res->state = EXECUTED;
 
@@ -1345,9 +1394,10 @@ int doit(const prb_t *prb, res_t *res) {
             std::placeholders::_2);
 #else // !defined(DNNL_EXPERIMENTAL_UKERNEL)
     perf_function_t perf_func = std::bind(brgemm_kernel_execute_postops_wrapper,
-            kernel_args.brgemm_, prb->use_dst_as_acc(), src_ptr, wei_packed_ptr,
-            offsets, acc_ptr, dst_ptr, scratchpad_ptr, attr_params_ptr,
-            std::placeholders::_1, std::placeholders::_2);
+            kernel_args.brgemm_, prb->batch_kind, prb->use_dst_as_acc(),
+            src_ptr, wei_packed_ptr, offsets, src_ptrs, wei_ptrs, acc_ptr,
+            dst_ptr, scratchpad_ptr, attr_params_ptr, std::placeholders::_1,
+            std::placeholders::_2);
 #endif
 
     measure_perf(prb->ctx_exe, res, perf_func, args);
@@ -61,6 +61,7 @@ struct settings_t : public base_settings_t {
     std::vector<float> alpha {1.f}, beta {0.f};
     std::vector<std::string> brgemm_attr {std::string()};
     std::vector<std::string> batch_kind {"addr"};
+    std::vector<bool> pack_b {false};
 
     const char *perf_template_csv() const {
         static const std::string args;
@@ -77,7 +78,7 @@ struct prb_t : public prb_vdims_t {
             const std::vector<int64_t> &ld, dnnl_data_type_t bia_dt,
             float alpha, float beta, int batch_size,
             const std::string &brgemm_attr, const std::string &batch_kind,
-            const attr_t &attr, const thr_ctx_t &ctx_init,
+            bool pack_b, const attr_t &attr, const thr_ctx_t &ctx_init,
             const thr_ctx_t &ctx_exe, const impl_filter_t &impl_filter)
         : prb_vdims_t(prb_vdims)
         , dt(dt)
@@ -92,6 +93,7 @@ struct prb_t : public prb_vdims_t {
         , batch_size(batch_size)
         , brgemm_attr(brgemm_attr)
         , batch_kind(batch_kind)
+        , pack_b(pack_b)
         , attr(attr)
         , ctx_init(ctx_init)
         , ctx_exe(ctx_exe)
@@ -133,6 +135,7 @@ struct prb_t : public prb_vdims_t {
     int64_t batch_size;
     std::string brgemm_attr;
     std::string batch_kind;
+    bool pack_b;
 
     attr_t attr;
     thr_ctx_t ctx_init, ctx_exe;
@@ -101,6 +101,8 @@ std::string prb_t::set_repro_line() {
         s << "--brgemm-attr=" << brgemm_attr << " ";
     if (canonical || batch_kind != def.batch_kind[0])
         s << "--batch-kind=" << batch_kind << " ";
+    if (canonical || pack_b != def.pack_b[0])
+        s << "--pack-b=" << bool2str(pack_b) << " ";
 
     s << attr;
     s << static_cast<const prb_vdims_t &>(*this);
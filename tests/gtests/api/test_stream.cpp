@@ -21,6 +21,10 @@
 
 #include <tuple>
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
 namespace dnnl {
 
 static bool are_valid_flags(
@@ -30,7 +34,9 @@ static bool are_valid_flags(
     if (engine_kind == dnnl_gpu && (stream_flags & dnnl_stream_out_of_order))
         ok = false;
 #endif
-#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_OMP \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_TBB
     if (engine_kind == dnnl_cpu && (stream_flags & dnnl_stream_out_of_order))
         ok = false;
 #endif
@@ -135,6 +141,117 @@ TEST(stream_test_c_t, GetStream) {
     DNNL_CHECK(dnnl_stream_destroy(stream));
     DNNL_CHECK(dnnl_engine_destroy(engine));
 }
+
+TEST(stream_test_c_t, SetCpuNumaNodes) {
+    dnnl_engine_t engine;
+    DNNL_CHECK(dnnl_engine_create(&engine, dnnl_cpu, 0));
+
+    dnnl_stream_t stream;
+    DNNL_CHECK(dnnl_stream_create(&stream, engine, dnnl_stream_default_flags));
+
+    const int nodes[] = {0};
+    dnnl_status_t status = dnnl_stream_set_cpu_numa_nodes(stream, 1, nodes);
+    ASSERT_TRUE(status == dnnl_success || status == dnnl_unimplemented);
+    if (status == dnnl_success) {
+        // An empty list of nodes removes the binding.
+        DNNL_CHECK(dnnl_stream_set_cpu_numa_nodes(stream, 0, nullptr));
+
+        const int invalid_nodes[] = {-1};
+        ASSERT_EQ(dnnl_stream_set_cpu_numa_nodes(stream, 1, invalid_nodes),
+                dnnl_invalid_arguments);
+    }
+    ASSERT_EQ(dnnl_stream_set_cpu_numa_nodes(nullptr, 1, nodes),
+            dnnl_invalid_arguments);
+
+    DNNL_CHECK(dnnl_stream_wait(stream));
+    DNNL_CHECK(dnnl_stream_destroy(stream));
+    DNNL_CHECK(dnnl_engine_destroy(engine));
+}
+#endif
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP || DNNL_CPU_RUNTIME == DNNL_RUNTIME_TBB
+TEST(stream_test_cpp_t, OutOfOrderCpuDependencies) {
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng, stream::flags::out_of_order);
+
+    const memory::dim n = 1000;
+    memory::desc md({n}, memory::data_type::f32, memory::format_tag::a);
+    auto linear_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_linear, md, md,
+            2.f, 1.f);
+    eltwise_forward linear(linear_pd), linear_x(linear_pd);
+
+    // Two independent chains: a -> b -> c and x -> y. Buffers are reused
+    // between iterations, so the stream also has to respect write-after-read
+    // dependencies.
+    memory a(md, eng), b(md, eng), c(md, eng), x(md, eng), y(md, eng);
+    for (int iter = 0; iter < 10; iter++) {
+        float *a_ptr = a.map_data<float>();
+        float *x_ptr = x.map_data<float>();
+        for (memory::dim i = 0; i < n; i++) {
+            a_ptr[i] = (float)(i + iter);
+            x_ptr[i] = (float)(i - iter);
+        }
+        a.unmap_data(a_ptr);
+        x.unmap_data(x_ptr);
+
+        linear.execute(s, {{DNNL_ARG_SRC, a}, {DNNL_ARG_DST, b}});
+        linear_x.execute(s, {{DNNL_ARG_SRC, x}, {DNNL_ARG_DST, y}});
+        linear.execute(s, {{DNNL_ARG_SRC, b}, {DNNL_ARG_DST, c}});
+        s.wait();
+
+        float *c_ptr = c.map_data<float>();
+        float *y_ptr = y.map_data<float>();
+        for (memory::dim i = 0; i < n; i++) {
+            ASSERT_EQ(c_ptr[i], 2.f * (2.f * (float)(i + iter) + 1.f) + 1.f);
+            ASSERT_EQ(y_ptr[i], 2.f * (float)(i - iter) + 1.f);
+        }
+        c.unmap_data(c_ptr);
+        y.unmap_data(y_ptr);
+    }
+}
+#endif
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP && defined(__linux__)
+TEST(stream_test_cpp_t, CpuNumaNodesBinding) {
+    cpu_set_t old_set;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(old_set), &old_set), 0);
+
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng);
+    const int nodes[] = {0};
+    const dnnl_status_t status
+            = dnnl_stream_set_cpu_numa_nodes(s.get(), 1, nodes);
+    SKIP_IF(status == dnnl_unimplemented, "Thread binding is not supported.");
+    DNNL_CHECK(status);
+
+    const memory::dim n = 1000;
+    memory::desc md({n}, memory::data_type::f32, memory::format_tag::a);
+    auto relu = eltwise_forward(eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md, 0.f,
+            0.f));
+    memory src(md, eng), dst(md, eng);
+    relu.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    s.wait();
+
+    // The calling thread is the first thread of its team, so it's bound to a
+    // single CPU of the node.
+    cpu_set_t set;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(set), &set), 0);
+    ASSERT_EQ(CPU_COUNT(&set), 1);
+    int cpu = 0;
+    while (!CPU_ISSET(cpu, &set))
+        cpu++;
+    ASSERT_TRUE(CPU_ISSET(cpu, &old_set));
+
+    // The team is bound once rather than on every execution, so the restored
+    // affinity is kept while the CPUs of the stream don't change.
+    ASSERT_EQ(sched_setaffinity(0, sizeof(old_set), &old_set), 0);
+    relu.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    s.wait();
+    ASSERT_EQ(sched_getaffinity(0, sizeof(set), &set), 0);
+    ASSERT_TRUE(CPU_EQUAL(&set, &old_set));
+}
 #endif
 
 namespace {
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <string>
+
 #include <gtest/gtest.h>
 
 #include "oneapi/dnnl/dnnl_graph.h"
@@ -51,3 +53,69 @@ TEST(CAPI, ConstantTensorCacheCapacityControl) {
             dnnl_success);
     ASSERT_EQ(capacity, std::numeric_limits<size_t>::max() / (1024 * 1024));
 }
+
+TEST(CAPI, ConstantTensorCacheDirControl) {
+    const char *dir = nullptr;
+    ASSERT_EQ(dnnl_graph_get_constant_tensor_cache_dir(dnnl_cpu, &dir),
+            dnnl_success);
+    const std::string default_dir = dir;
+
+#if defined(__unix__) || defined(__APPLE__)
+    ASSERT_EQ(dnnl_graph_set_constant_tensor_cache_dir(dnnl_cpu, "."),
+            dnnl_success);
+    ASSERT_EQ(dnnl_graph_get_constant_tensor_cache_dir(dnnl_cpu, &dir),
+            dnnl_success);
+    ASSERT_STREQ(dir, ".");
+#endif
+
+    // negative test
+    ASSERT_EQ(dnnl_graph_get_constant_tensor_cache_dir(dnnl_cpu, nullptr),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_graph_set_constant_tensor_cache_dir(dnnl_gpu, "."),
+            dnnl_unimplemented);
+
+    // recover the default config
+    ASSERT_EQ(dnnl_graph_set_constant_tensor_cache_dir(
+                      dnnl_cpu, default_dir.c_str()),
+            dnnl_success);
+}
+
+TEST(CAPI, ConstantTensorCacheEvictionPolicyControl) {
+    using policy_t = dnnl_graph_constant_tensor_cache_eviction_policy_t;
+    const policy_t gds
+            = dnnl_graph_constant_tensor_cache_eviction_greedy_dual_size;
+    policy_t policy;
+    ASSERT_EQ(dnnl_graph_get_constant_tensor_cache_eviction_policy(
+                      dnnl_cpu, &policy),
+            dnnl_success);
+    ASSERT_EQ(policy, dnnl_graph_constant_tensor_cache_eviction_none);
+
+    // set and check the new policy
+    ASSERT_EQ(dnnl_graph_set_constant_tensor_cache_eviction_policy(
+                      dnnl_cpu, gds),
+            dnnl_success);
+    ASSERT_EQ(dnnl_graph_get_constant_tensor_cache_eviction_policy(
+                      dnnl_cpu, &policy),
+            dnnl_success);
+    ASSERT_EQ(policy, gds);
+
+    dnnl_graph_constant_tensor_cache_stats_t stats;
+    ASSERT_EQ(dnnl_graph_get_constant_tensor_cache_stats(dnnl_cpu, &stats),
+            dnnl_success);
+    ASSERT_EQ(stats.evictions == 0, stats.evicted_bytes == 0);
+
+    // negative test
+    ASSERT_EQ(dnnl_graph_get_constant_tensor_cache_eviction_policy(
+                      dnnl_cpu, nullptr),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_graph_set_constant_tensor_cache_eviction_policy(
+                      dnnl_cpu, static_cast<policy_t>(-1)),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_graph_get_constant_tensor_cache_stats(dnnl_cpu, nullptr),
+            dnnl_invalid_arguments);
+
+    // recover the default config
+    ASSERT_EQ(dnnl_graph_set_constant_tensor_cache_eviction_policy(
+                      dnnl_cpu, dnnl_graph_constant_tensor_cache_eviction_none),
+            dnnl_success);
+}
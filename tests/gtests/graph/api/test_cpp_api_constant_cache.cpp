@@ -37,3 +37,25 @@ TEST(APIConstantTensorCache, CapacityControl) {
             dnnl::engine::kind::cpu);
     ASSERT_EQ(capacity, std::numeric_limits<size_t>::max() / (1024 * 1024));
 }
+
+TEST(APIConstantTensorCache, EvictionPolicyControl) {
+    using policy = dnnl::graph::constant_tensor_cache_eviction_policy;
+
+    // set and check the new policy
+    dnnl::graph::set_constant_tensor_cache_eviction_policy(
+            dnnl::engine::kind::cpu, policy::lru);
+    ASSERT_EQ(dnnl::graph::get_constant_tensor_cache_eviction_policy(
+                      dnnl::engine::kind::cpu),
+            policy::lru);
+
+    auto stats = dnnl::graph::get_constant_tensor_cache_stats(
+            dnnl::engine::kind::cpu);
+    ASSERT_EQ(stats.evictions == 0, stats.evicted_bytes == 0);
+
+    // recover the default config
+    dnnl::graph::set_constant_tensor_cache_eviction_policy(
+            dnnl::engine::kind::cpu, policy::none);
+    ASSERT_EQ(dnnl::graph::get_constant_tensor_cache_eviction_policy(
+                      dnnl::engine::kind::cpu),
+            policy::none);
+}
@@ -116,6 +116,9 @@ TEST(APIOp, CreateAllOps) {
             op::kind::GroupNorm,
             op::kind::GenIndex,
             op::kind::GreaterEqual,
+            op::kind::PagedCacheLoad,
+            op::kind::RotaryEmbedding,
+            op::kind::Gather,
     };
     // clang-format on
 
@@ -110,3 +110,97 @@ TEST(test_constant_cache, NoEvictWhenCacheFull) {
     // ignore since we use no_evict policy
     ASSERT_FALSE(cache.get_or_add(0, 3, 3, c_promise3_2.get_future()).valid());
 }
+
+namespace {
+// Returns a computed buffer of the given size.
+graph::constant_tensor_cache_t::value_t make_ready_value(size_t size) {
+    graph::engine_t &engine = *get_engine();
+    auto p_engine = dnnl_impl::make_dnnl_engine(engine);
+    auto g_alloc = static_cast<graph::allocator_t *>(engine.get_allocator());
+    std::promise<graph::constant_tensor_cache_t::cached_t> c_promise;
+    c_promise.set_value(std::make_shared<dnnl_impl::dnnl_constant_buffer_t>(
+            size, p_engine, g_alloc));
+    return c_promise.get_future();
+}
+} // namespace
+
+TEST(test_constant_cache, LruEviction) {
+    graph::constant_tensor_cache_t cache(6);
+    ASSERT_EQ(cache.set_eviction_policy(
+                      dnnl_graph_constant_tensor_cache_eviction_lru),
+            graph::status::success);
+    for (size_t key = 1; key <= 3; key++)
+        ASSERT_FALSE(cache.get_or_add(0, key, 2, make_ready_value(2)).valid());
+    ASSERT_EQ(cache.get_size(), 6U);
+
+    // buffer 1 is used again, so buffer 2 becomes the least recently used one
+    ASSERT_TRUE(cache.get_or_add(0, 1, 2, make_ready_value(2)).valid());
+    ASSERT_FALSE(cache.get_or_add(0, 4, 2, make_ready_value(2)).valid());
+    ASSERT_EQ(cache.get_size(), 6U);
+    for (size_t key : {1, 3, 4})
+        ASSERT_TRUE(cache.get_or_add(0, key, 2, make_ready_value(2)).valid());
+
+    auto stats = cache.get_stats();
+    ASSERT_EQ(stats.hits, 4U);
+    ASSERT_EQ(stats.misses, 4U);
+    ASSERT_EQ(stats.evictions, 1U);
+    ASSERT_EQ(stats.evicted_bytes, 2U);
+    ASSERT_EQ(stats.size_bytes, 6U);
+
+    // a tensor larger than the capacity is never cached and evicts nothing
+    ASSERT_FALSE(cache.get_or_add(0, 5, 7, make_ready_value(7)).valid());
+    ASSERT_EQ(cache.get_stats().evictions, 1U);
+    ASSERT_EQ(cache.get_size(), 6U);
+}
+
+TEST(test_constant_cache, GreedyDualSizeEviction) {
+    const auto gds = dnnl_graph_constant_tensor_cache_eviction_greedy_dual_size;
+    graph::constant_tensor_cache_t cache(6);
+    ASSERT_EQ(cache.set_eviction_policy(gds), graph::status::success);
+    for (size_t key = 1; key <= 3; key++)
+        ASSERT_FALSE(cache.get_or_add(0, key, 2, make_ready_value(2)).valid());
+    cache.set_cost(0, 1, 10.0);
+    cache.set_cost(0, 2, 1.0);
+
+    // buffer 3 has no recorded cost, so it goes first although it's the most
+    // recently used one
+    ASSERT_FALSE(cache.get_or_add(0, 4, 2, make_ready_value(2)).valid());
+    cache.set_cost(0, 4, 5.0);
+    ASSERT_FALSE(cache.get_or_add(0, 3, 2, make_ready_value(2)).valid());
+    cache.set_cost(0, 3, 20.0);
+
+    // buffer 2 is the cheapest to recompute per byte, buffer 1 is the least
+    // recently used one
+    for (size_t key : {1, 3, 4})
+        ASSERT_TRUE(cache.get_or_add(0, key, 2, make_ready_value(2)).valid());
+
+    auto stats = cache.get_stats();
+    ASSERT_EQ(stats.hits, 3U);
+    ASSERT_EQ(stats.misses, 5U);
+    ASSERT_EQ(stats.evictions, 2U);
+    ASSERT_EQ(stats.evicted_bytes, 4U);
+    ASSERT_EQ(stats.size_bytes, 6U);
+}
+
+TEST(test_constant_cache, NoEvictPendingBuffers) {
+    graph::constant_tensor_cache_t cache(4);
+    ASSERT_EQ(cache.set_eviction_policy(
+                      dnnl_graph_constant_tensor_cache_eviction_lru),
+            graph::status::success);
+
+    std::promise<graph::constant_tensor_cache_t::cached_t> c_promise;
+    ASSERT_FALSE(cache.get_or_add(0, 1, 2, c_promise.get_future()).valid());
+    ASSERT_FALSE(cache.get_or_add(0, 2, 2, make_ready_value(2)).valid());
+
+    // only buffer 2 has been computed, which isn't enough to make room
+    ASSERT_FALSE(cache.get_or_add(0, 3, 4, make_ready_value(4)).valid());
+    ASSERT_EQ(cache.get_size(), 4U);
+    ASSERT_EQ(cache.get_stats().evictions, 0U);
+
+    // buffer 1 is the least recently used one, it can be evicted once ready
+    c_promise.set_value(make_ready_value(2).get());
+    ASSERT_FALSE(cache.get_or_add(0, 4, 2, make_ready_value(2)).valid());
+    ASSERT_TRUE(cache.get_or_add(0, 2, 2, make_ready_value(2)).valid());
+    ASSERT_TRUE(cache.get_or_add(0, 4, 2, make_ready_value(2)).valid());
+    ASSERT_EQ(cache.get_stats().evictions, 1U);
+}
@@ -0,0 +1,241 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <map>
+#include <vector>
+
+#include "interface/c_types_map.hpp"
+
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+#include "graph/unit/utils.hpp"
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+
+namespace {
+// Compiles and executes the only partition of the graph with the tensors
+// given for the ids of the logical tensors.
+void compile_and_execute(graph::graph_t &g, const std::string &pass_name,
+        std::map<size_t, test_tensor_t *> &tensors, size_t expected_ops) {
+    graph::engine_t *engine = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    graph::pass::pass_base_ptr apass = get_pass(pass_name);
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+    ASSERT_EQ(part->get_ops().size(), expected_ops);
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> lt_ins, lt_outs;
+    std::vector<graph::tensor_t> ts_ins, ts_outs;
+    for (const auto &lt : p.get_inputs()) {
+        lt_ins.emplace_back(&lt);
+        ts_ins.emplace_back(tensors.at(lt.id)->get());
+    }
+    for (const auto &lt : p.get_outputs()) {
+        lt_outs.emplace_back(&lt);
+        ts_outs.emplace_back(tensors.at(lt.id)->get());
+    }
+    ASSERT_EQ(p.compile(&cp, lt_ins, lt_outs, engine), graph::status::success);
+    ASSERT_EQ(cp.execute(strm, ts_ins, ts_outs), graph::status::success);
+    strm->wait();
+}
+} // namespace
+
+TEST(test_gather_execute, Gather) {
+    SKIP_IF(get_test_engine_kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+    graph::engine_t *engine = get_engine();
+
+    const std::vector<float> table {0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f,
+            8.f, 9.f, 10.f, 11.f, 12.f, 13.f, 14.f};
+    // The third index is out of range and selects a row of zeros.
+    const std::vector<int32_t> indices {4, 0, 7, 2};
+    const std::vector<float> ref_dst {12.f, 13.f, 14.f, 0.f, 1.f, 2.f, 0.f,
+            0.f, 0.f, 6.f, 7.f, 8.f};
+
+    graph::op_t gather(0, graph::op_kind::Gather, "gather");
+    graph::logical_tensor_t table_lt
+            = utils::logical_tensor_init(0, {5, 3}, graph::data_type::f32);
+    graph::logical_tensor_t indices_lt
+            = utils::logical_tensor_init(1, {2, 2}, graph::data_type::s32);
+    graph::logical_tensor_t dst_lt
+            = utils::logical_tensor_init(2, {2, 2, 3}, graph::data_type::f32);
+    gather.add_input(table_lt);
+    gather.add_input(indices_lt);
+    gather.add_output(dst_lt);
+
+    graph::graph_t g(engine->kind());
+    ASSERT_EQ(g.add_op(&gather), graph::status::success);
+    g.finalize();
+
+    test_tensor_t table_ts(table_lt, engine, table);
+    test_tensor_t indices_ts(indices_lt, engine, indices);
+    test_tensor_t dst_ts(dst_lt, engine);
+    std::map<size_t, test_tensor_t *> tensors {
+            {0, &table_ts}, {1, &indices_ts}, {2, &dst_ts}};
+    compile_and_execute(g, "gather_pass", tensors, 1);
+
+    const auto dst = dst_ts.as_vec_type<float>();
+    ASSERT_EQ(dst.size(), ref_dst.size());
+    for (size_t i = 0; i < dst.size(); i++)
+        ASSERT_FLOAT_EQ(dst[i], ref_dst[i]);
+}
+
+TEST(test_gather_execute, DequantizeGatherReduceSum) {
+    SKIP_IF(get_test_engine_kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+    graph::engine_t *engine = get_engine();
+
+    const int64_t rows = 6, cols = 4, bags = 3, bag_size = 2;
+    std::vector<int8_t> table(rows * cols);
+    for (size_t i = 0; i < table.size(); i++)
+        table[i] = static_cast<int8_t>(static_cast<int>(i * 7 % 23) - 11);
+    const std::vector<float> scales {0.5f, 0.25f, 1.f, 2.f, 0.125f, 1.5f};
+    const std::vector<int64_t> zps {0, 1, -2, 3, 0, -1};
+    const std::vector<int32_t> indices {5, 1, 0, 0, 3, 4};
+
+    for (bool with_sum : {false, true}) {
+        graph::op_t dequant(0, graph::op_kind::Dequantize, "dequant");
+        dequant.set_attr<std::string>(graph::op_attr::qtype, "per_channel");
+        dequant.set_attr<int64_t>(graph::op_attr::axis, 0);
+        dequant.set_attr<std::vector<float>>(graph::op_attr::scales, scales);
+        dequant.set_attr<std::vector<int64_t>>(graph::op_attr::zps, zps);
+        graph::op_t gather(1, graph::op_kind::Gather, "gather");
+        graph::op_t reduce(2, graph::op_kind::ReduceSum, "reduce");
+        reduce.set_attr<std::vector<int64_t>>(graph::op_attr::axes, {-2});
+        reduce.set_attr<bool>(graph::op_attr::keep_dims, false);
+
+        graph::logical_tensor_t table_lt = utils::logical_tensor_init(
+                0, {rows, cols}, graph::data_type::s8);
+        graph::logical_tensor_t deq_lt = utils::logical_tensor_init(
+                1, {rows, cols}, graph::data_type::f32);
+        graph::logical_tensor_t indices_lt = utils::logical_tensor_init(
+                2, {bags, bag_size}, graph::data_type::s32);
+        graph::logical_tensor_t gather_lt = utils::logical_tensor_init(
+                3, {bags, bag_size, cols}, graph::data_type::f32);
+        graph::logical_tensor_t sum_lt = utils::logical_tensor_init(
+                4, {bags, cols}, graph::data_type::f32);
+        dequant.add_input(table_lt);
+        dequant.add_output(deq_lt);
+        gather.add_input(deq_lt);
+        gather.add_input(indices_lt);
+        gather.add_output(gather_lt);
+        reduce.add_input(gather_lt);
+        reduce.add_output(sum_lt);
+
+        graph::graph_t g(engine->kind());
+        ASSERT_EQ(g.add_op(&dequant), graph::status::success);
+        ASSERT_EQ(g.add_op(&gather), graph::status::success);
+        if (with_sum) {
+            ASSERT_EQ(g.add_op(&reduce), graph::status::success);
+        }
+        g.finalize();
+
+        const auto &dst_lt = with_sum ? sum_lt : gather_lt;
+        test_tensor_t table_ts(table_lt, engine, table);
+        test_tensor_t indices_ts(indices_lt, engine, indices);
+        test_tensor_t dst_ts(dst_lt, engine);
+        std::map<size_t, test_tensor_t *> tensors {
+                {0, &table_ts}, {2, &indices_ts}, {dst_lt.id, &dst_ts}};
+        compile_and_execute(g, "x8_gather_reduction_cpu", tensors,
+                with_sum ? 3U : 2U);
+
+        std::vector<float> ref_dst(
+                (with_sum ? bags : bags * bag_size) * cols, 0.f);
+        for_(int64_t b = 0; b < bags; b++)
+        for_(int64_t j = 0; j < bag_size; j++)
+        for (int64_t c = 0; c < cols; c++) {
+            const int32_t r = indices[b * bag_size + j];
+            const float val = (table[r * cols + c] - zps[r]) * scales[r];
+            const int64_t row = with_sum ? b : b * bag_size + j;
+            ref_dst[row * cols + c] += val;
+        }
+        const auto dst = dst_ts.as_vec_type<float>();
+        ASSERT_EQ(dst.size(), ref_dst.size());
+        for (size_t i = 0; i < dst.size(); i++)
+            ASSERT_FLOAT_EQ(dst[i], ref_dst[i]);
+    }
+}
+
+TEST(test_gather_execute, DynamicDequantizeInt4Gather) {
+    SKIP_IF(get_test_engine_kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+    graph::engine_t *engine = get_engine();
+
+    // Each row of the table takes 3 bytes with 2 elements per byte, the first
+    // one in the lower half.
+    const int64_t rows = 4, cols = 6;
+    std::vector<uint8_t> table(rows * cols / 2);
+    for (size_t i = 0; i < table.size(); i++)
+        table[i] = static_cast<uint8_t>(i * 37 + 11);
+    const auto table_elem = [&](int64_t i) {
+        const int v = (i % 2) ? table[i / 2] >> 4 : table[i / 2] & 0xf;
+        return v >= 8 ? v - 16 : v;
+    };
+    const std::vector<float> scales {0.5f};
+    const std::vector<int32_t> indices {2, 3, 0};
+
+    graph::op_t dequant(0, graph::op_kind::DynamicDequantize, "dequant");
+    dequant.set_attr<std::string>(graph::op_attr::qtype, "per_tensor");
+    dequant.set_attr<int64_t>(graph::op_attr::axis, 0);
+    graph::op_t gather(1, graph::op_kind::Gather, "gather");
+
+    graph::logical_tensor_t table_lt = utils::logical_tensor_init(
+            0, {rows, cols}, graph::data_type::s4);
+    graph::logical_tensor_t scales_lt
+            = utils::logical_tensor_init(1, {1}, graph::data_type::f32);
+    graph::logical_tensor_t deq_lt = utils::logical_tensor_init(
+            2, {rows, cols}, graph::data_type::f32);
+    graph::logical_tensor_t indices_lt
+            = utils::logical_tensor_init(3, {3}, graph::data_type::s32);
+    graph::logical_tensor_t dst_lt
+            = utils::logical_tensor_init(4, {3, cols}, graph::data_type::f32);
+    dequant.add_input(table_lt);
+    dequant.add_input(scales_lt);
+    dequant.add_output(deq_lt);
+    gather.add_input(deq_lt);
+    gather.add_input(indices_lt);
+    gather.add_output(dst_lt);
+
+    graph::graph_t g(engine->kind());
+    ASSERT_EQ(g.add_op(&dequant), graph::status::success);
+    ASSERT_EQ(g.add_op(&gather), graph::status::success);
+    g.finalize();
+
+    test_tensor_t table_ts(table_lt, engine, table);
+    test_tensor_t scales_ts(scales_lt, engine, scales);
+    test_tensor_t indices_ts(indices_lt, engine, indices);
+    test_tensor_t dst_ts(dst_lt, engine);
+    std::map<size_t, test_tensor_t *> tensors {{0, &table_ts},
+            {1, &scales_ts}, {3, &indices_ts}, {4, &dst_ts}};
+    compile_and_execute(g, "x8_gather_reduction_cpu", tensors, 2);
+
+    const auto dst = dst_ts.as_vec_type<float>();
+    ASSERT_EQ(dst.size(), static_cast<size_t>(3 * cols));
+    for_(size_t i = 0; i < indices.size(); i++)
+    for (int64_t c = 0; c < cols; c++) {
+        const float ref = table_elem(indices[i] * cols + c) * scales[0];
+        ASSERT_FLOAT_EQ(dst[i * cols + c], ref);
+    }
+}
@@ -14,8 +14,17 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
+#include <cstdio>
 #include <functional>
 #include <random>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <dirent.h>
+#include <stdlib.h>
+#include <unistd.h>
+#endif
 
 #include "interface/c_types_map.hpp"
 
@@ -4342,6 +4351,152 @@ TEST(test_matmul_execute, MatmulTransposeReorder) {
     }
 }
 
+TEST(test_matmul_execute, MatmulTransposeRotaryEmbedding) {
+    graph::engine_t *engine = get_engine();
+    graph::stream_t *strm = get_stream();
+    SKIP_IF(engine->kind() != graph::engine_kind::cpu,
+            "Skip rotary embedding test for non-CPU device.");
+
+    const int64_t B = 2, S = 3, H = 2, E = 8, D = 4;
+    // Heads either come from the matmul batch dimensions, in which case the
+    // matmul writes the transposed layout, or are split from the columns by
+    // a reshape.
+    for (bool with_reshape : {false, true}) {
+        std::vector<int64_t> src_shape = with_reshape
+                ? std::vector<int64_t> {B, S, E}
+                : std::vector<int64_t> {B, S, H, E};
+        std::vector<int64_t> weight_shape = with_reshape
+                ? std::vector<int64_t> {E, H * D}
+                : std::vector<int64_t> {E, D};
+        std::vector<int64_t> dst_shape = with_reshape
+                ? std::vector<int64_t> {B, S, H * D}
+                : std::vector<int64_t> {B, S, H, D};
+        std::vector<int64_t> reshape_shape {B, S, H, D};
+        std::vector<int64_t> transpose_order {0, 2, 1, 3};
+        std::vector<int64_t> transpose_shape {B, H, S, D};
+        std::vector<int64_t> table_shape {S, D};
+
+        std::vector<float> src_data(product(src_shape));
+        std::vector<float> weight_data(product(weight_shape));
+        std::vector<float> cos_data(product(table_shape));
+        std::vector<float> sin_data(product(table_shape));
+
+        std::default_random_engine generator(7);
+        std::uniform_real_distribution<float> f32_distribution(-1.0f, 1.0f);
+        std::generate(src_data.begin(), src_data.end(),
+                [&]() { return f32_distribution(generator); });
+        std::generate(weight_data.begin(), weight_data.end(),
+                [&]() { return f32_distribution(generator); });
+        for (int64_t s = 0; s < S; s++)
+            for (int64_t d = 0; d < D; d++) {
+                const float freq = std::pow(100.f, -2.f * (d % (D / 2)) / D);
+                const float angle = s * freq;
+                cos_data[s * D + d] = std::cos(angle);
+                sin_data[s * D + d] = std::sin(angle);
+            }
+
+        graph::op_t matmul_op(1, graph::op_kind::MatMul, "matmul_op");
+        graph::op_t reshape_op(2, graph::op_kind::StaticReshape, "reshape_op");
+        reshape_op.set_attr(graph::op_attr::shape, reshape_shape);
+        reshape_op.set_attr(graph::op_attr::special_zero, false);
+        graph::op_t transpose_op(
+                3, graph::op_kind::StaticTranspose, "transpose_op");
+        transpose_op.set_attr(graph::op_attr::order, transpose_order);
+        graph::op_t rope_op(4, graph::op_kind::RotaryEmbedding, "rope_op");
+
+        graph::logical_tensor_t src_lt = utils::logical_tensor_init(
+                0, src_shape, graph::data_type::f32);
+        graph::logical_tensor_t weight_lt = utils::logical_tensor_init(
+                1, weight_shape, graph::data_type::f32);
+        graph::logical_tensor_t dst_lt = utils::logical_tensor_init(
+                2, dst_shape, graph::data_type::f32);
+        graph::logical_tensor_t reshape_lt = utils::logical_tensor_init(
+                3, reshape_shape, graph::data_type::f32);
+        graph::logical_tensor_t transpose_lt = utils::logical_tensor_init(
+                4, transpose_shape, graph::data_type::f32);
+        graph::logical_tensor_t cos_lt = utils::logical_tensor_init(
+                5, table_shape, graph::data_type::f32);
+        graph::logical_tensor_t sin_lt = utils::logical_tensor_init(
+                6, table_shape, graph::data_type::f32);
+        graph::logical_tensor_t rope_lt = utils::logical_tensor_init(
+                7, transpose_shape, graph::data_type::f32);
+
+        matmul_op.add_input(src_lt);
+        matmul_op.add_input(weight_lt);
+        matmul_op.add_output(dst_lt);
+        if (with_reshape) {
+            reshape_op.add_input(dst_lt);
+            reshape_op.add_output(reshape_lt);
+            transpose_op.add_input(reshape_lt);
+        } else {
+            transpose_op.add_input(dst_lt);
+        }
+        transpose_op.add_output(transpose_lt);
+        rope_op.add_input(transpose_lt);
+        rope_op.add_input(cos_lt);
+        rope_op.add_input(sin_lt);
+        rope_op.add_output(rope_lt);
+
+        graph::graph_t g(engine->kind());
+        g.add_op(&matmul_op);
+        if (with_reshape) g.add_op(&reshape_op);
+        g.add_op(&transpose_op);
+        g.add_op(&rope_op);
+        g.finalize();
+
+        graph::pass::pass_base_ptr apass
+                = get_pass("fp_matmul_transpose_rotary_embedding_cpu");
+        apass->run(g);
+        ASSERT_EQ(g.get_num_partitions(), 1U);
+        auto part = g.get_partitions()[0];
+
+        graph::partition_t p;
+        p.init(part);
+        graph::compiled_partition_t cp(p);
+
+        std::vector<const graph::logical_tensor_t *> lt_ins {
+                &src_lt, &weight_lt, &cos_lt, &sin_lt};
+        std::vector<const graph::logical_tensor_t *> lt_outs {&rope_lt};
+        ASSERT_EQ(p.compile(&cp, lt_ins, lt_outs, engine),
+                graph::status::success);
+
+        test_tensor_t src_ts(src_lt, engine, src_data);
+        test_tensor_t weight_ts(weight_lt, engine, weight_data);
+        test_tensor_t cos_ts(cos_lt, engine, cos_data);
+        test_tensor_t sin_ts(sin_lt, engine, sin_data);
+        test_tensor_t dst_ts(rope_lt, engine);
+        cp.execute(strm,
+                {src_ts.get(), weight_ts.get(), cos_ts.get(), sin_ts.get()},
+                {dst_ts.get()});
+        strm->wait();
+        std::vector<float> dst_data = dst_ts.as_vec_type<float>();
+
+        // reference: project, rotate and store in [B, H, S, D]
+        for_(int64_t b = 0; b < B; b++)
+        for_(int64_t h = 0; h < H; h++)
+        for (int64_t s = 0; s < S; s++) {
+            std::vector<float> proj(D, 0.f);
+            for_(int64_t d = 0; d < D; d++)
+            for (int64_t e = 0; e < E; e++) {
+                const int64_t src_off = with_reshape
+                        ? (b * S + s) * E + e
+                        : ((b * S + s) * H + h) * E + e;
+                const int64_t wei_off
+                        = with_reshape ? e * H * D + h * D + d : e * D + d;
+                proj[d] += src_data[src_off] * weight_data[wei_off];
+            }
+            for (int64_t d = 0; d < D; d++) {
+                const float rotated = d < D / 2 ? -proj[d + D / 2]
+                                                : proj[d - D / 2];
+                const float ref = proj[d] * cos_data[s * D + d]
+                        + rotated * sin_data[s * D + d];
+                ASSERT_NEAR(dst_data[((b * H + h) * S + s) * D + d], ref,
+                        1e-5f);
+            }
+        }
+    }
+}
+
 TEST(test_matmul_execute_subgraph_int8, QuantWeiMatmulBiasTransposeReorder) {
     graph::engine_t *engine = get_engine();
     graph::stream_t *strm = get_stream();
@@ -8183,3 +8338,146 @@ TEST(test_matmul_execute_subgraph_int8, NoShareCachedWeight) {
     dnnl::graph::set_constant_tensor_cache_capacity(
             static_cast<engine::kind>(engine->kind()), 0);
 }
+
+#if defined(__unix__) || defined(__APPLE__)
+namespace {
+std::vector<std::string> list_backing_files(const std::string &dir) {
+    std::vector<std::string> files;
+    DIR *d = opendir(dir.c_str());
+    if (!d) return files;
+    while (struct dirent *e = readdir(d)) {
+        const std::string name = e->d_name;
+        const std::string ext = ".const";
+        if (name.size() > ext.size()
+                && name.compare(name.size() - ext.size(), ext.size(), ext)
+                        == 0)
+            files.push_back(dir + "/" + name);
+    }
+    closedir(d);
+    return files;
+}
+} // namespace
+
+TEST(test_matmul_execute_subgraph_int8, BackedCachedWeight) {
+    graph::engine_t *engine = get_engine();
+    graph::stream_t *strm = get_stream();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu,
+            "the backing store is only supported on cpu");
+
+    char dir_template[] = "/tmp/dnnl_graph_const_XXXXXX";
+    ASSERT_NE(mkdtemp(dir_template), nullptr);
+    const std::string dir = dir_template;
+
+    std::vector<int64_t> src_shape = {8, 64};
+    std::vector<int64_t> weight_shape = {64, 32};
+    std::vector<int64_t> dst_shape = {8, 32};
+    std::vector<float> scale_wei(weight_shape.back(), 1 / 127.f);
+    std::vector<int64_t> zp_wei(weight_shape.back(), 0);
+
+    graph::op_t dqdata_op(1, graph::op_kind::Dequantize, "dqdata_op");
+    dqdata_op.set_attr<std::string>(graph::op_attr::qtype, "per_tensor");
+    dqdata_op.set_attr<std::vector<int64_t>>(graph::op_attr::zps, {0});
+    dqdata_op.set_attr<std::vector<float>>(graph::op_attr::scales, {1 / 255.f});
+    dqdata_op.set_attr<int64_t>(graph::op_attr::axis, 0);
+
+    graph::op_t dqweight_op(2, graph::op_kind::Dequantize, "dqweight_op");
+    dqweight_op.set_attr<std::string>(graph::op_attr::qtype, "per_channel");
+    dqweight_op.set_attr<std::vector<int64_t>>(graph::op_attr::zps, zp_wei);
+    dqweight_op.set_attr<std::vector<float>>(graph::op_attr::scales, scale_wei);
+    dqweight_op.set_attr<int64_t>(graph::op_attr::axis, 1);
+
+    graph::op_t matmul_op(3, graph::op_kind::MatMul, "matmul_op");
+
+    auto src_u8
+            = utils::logical_tensor_init(1, src_shape, graph::data_type::u8);
+    auto src_f32_dq
+            = utils::logical_tensor_init(2, src_shape, graph::data_type::f32);
+    auto weight_s8
+            = utils::logical_tensor_init(4, weight_shape, graph::data_type::s8);
+    weight_s8.property = graph::property_type::constant;
+    auto weight_f32_dq = utils::logical_tensor_init(
+            5, weight_shape, graph::data_type::f32);
+    auto dst_f32
+            = utils::logical_tensor_init(7, dst_shape, graph::data_type::f32);
+
+    dqdata_op.add_input(src_u8);
+    dqdata_op.add_output(src_f32_dq);
+    dqweight_op.add_input(weight_s8);
+    dqweight_op.add_output(weight_f32_dq);
+    matmul_op.add_input(src_f32_dq);
+    matmul_op.add_input(weight_f32_dq);
+    matmul_op.add_output(dst_f32);
+
+    graph::graph_t g(engine->kind());
+    g.add_op(&dqdata_op);
+    g.add_op(&dqweight_op);
+    g.add_op(&matmul_op);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("x8x8x_matmul_post_ops");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    graph::partition_t p;
+    p.init(g.get_partitions()[0]);
+
+    std::default_random_engine generator(7);
+    std::uniform_real_distribution<float> s8_distribution(-127.0f, 128.0f);
+    std::uniform_real_distribution<float> u8_distribution(0.0f, 255.0f);
+    std::vector<int8_t> weight_data(product(weight_shape));
+    std::generate(weight_data.begin(), weight_data.end(),
+            [&]() { return static_cast<int8_t>(s8_distribution(generator)); });
+    std::vector<uint8_t> src_data(product(src_shape));
+    std::generate(src_data.begin(), src_data.end(),
+            [&]() { return static_cast<uint8_t>(u8_distribution(generator)); });
+
+    auto run = [&](const std::vector<int8_t> &wei) {
+        std::vector<const graph::logical_tensor_t *> lt_ins {
+                &src_u8, &weight_s8};
+        std::vector<const graph::logical_tensor_t *> lt_outs {&dst_f32};
+        graph::compiled_partition_t cp(p);
+        EXPECT_EQ(p.compile(&cp, lt_ins, lt_outs, engine),
+                graph::status::success);
+        test_tensor_t src_ts(src_u8, engine, src_data);
+        test_tensor_t wei_ts(weight_s8, engine, wei);
+        test_tensor_t dst_ts(dst_f32, engine);
+        EXPECT_EQ(cp.execute(strm, {src_ts.get(), wei_ts.get()},
+                          {dst_ts.get()}),
+                graph::status::success);
+        strm->wait();
+        return dst_ts.as_vec_type<float>();
+    };
+
+    const auto kind = static_cast<engine::kind>(engine->kind());
+    dnnl::graph::set_constant_tensor_cache_capacity(kind, 1024);
+    dnnl::graph::set_constant_tensor_cache_dir(kind, dir);
+    ASSERT_EQ(dnnl::graph::get_constant_tensor_cache_dir(kind), dir);
+
+    // The first execution computes the constant buffer and stores it.
+    const auto ref = run(weight_data);
+    ASSERT_EQ(list_backing_files(dir).size(), 1U);
+
+    // Dropping the in-memory cache makes the next execution map the stored
+    // buffer instead of computing a new one.
+    dnnl::graph::set_constant_tensor_cache_capacity(kind, 0);
+    dnnl::graph::set_constant_tensor_cache_capacity(kind, 1024);
+    ASSERT_EQ(run(weight_data), ref);
+    ASSERT_EQ(list_backing_files(dir).size(), 1U);
+
+    // The store is keyed by the content of constant inputs, so new weights
+    // don't hit the stored buffer.
+    dnnl::graph::set_constant_tensor_cache_capacity(kind, 0);
+    dnnl::graph::set_constant_tensor_cache_capacity(kind, 1024);
+    std::vector<int8_t> new_weight_data(weight_data.size());
+    std::transform(weight_data.begin(), weight_data.end(),
+            new_weight_data.begin(),
+            [](int8_t v) { return static_cast<int8_t>(v / 2); });
+    ASSERT_NE(run(new_weight_data), ref);
+    ASSERT_EQ(list_backing_files(dir).size(), 2U);
+
+    dnnl::graph::set_constant_tensor_cache_dir(kind, "");
+    dnnl::graph::set_constant_tensor_cache_capacity(kind, 0);
+    for (const auto &f : list_backing_files(dir))
+        std::remove(f.c_str());
+    rmdir(dir.c_str());
+}
+#endif
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
 #include <random>
 
@@ -1595,3 +1597,234 @@ TEST(test_sdp_decomp_execute, MultithreaSdpDecompCorr_CPU) {
         t2.join();
     }
 }
+
+// Keys and values are loaded from paged caches of [pages, heads, page_size,
+// head_size] through block tables of [batch, max_pages]. The ids of the
+// inputs are: query 0, key cache 1, block table 2, scale 5, value cache 8,
+// and block table for values 9 if it isn't shared.
+static void construct_paged_kv_sdp(graph::graph_t *agraph, dim_t batch,
+        dim_t num_head, dim_t q_len, dim_t head_size, dim_t num_pages,
+        dim_t page_size, dim_t max_pages, bool shared_block_table) {
+    const auto dt = graph::data_type::f32;
+    const dim_t kv_len = page_size * max_pages;
+    const dims q_shape = {batch, num_head, q_len, head_size};
+    const dims kv_shape = {batch, num_head, kv_len, head_size};
+    const dims cache_shape = {num_pages, num_head, page_size, head_size};
+    const dims bt_shape = {batch, max_pages};
+    const dims score_shape = {batch, num_head, q_len, kv_len};
+
+    auto query = utils::logical_tensor_init(0, q_shape, dt);
+    auto key_cache = utils::logical_tensor_init(1, cache_shape, dt);
+    auto key_bt
+            = utils::logical_tensor_init(2, bt_shape, graph::data_type::s32);
+    auto key = utils::logical_tensor_init(3, kv_shape, dt);
+    auto score = utils::logical_tensor_init(4, score_shape, dt);
+    auto scale = utils::logical_tensor_init(5, {1}, dt);
+    auto scaled_score = utils::logical_tensor_init(6, score_shape, dt);
+    auto probs = utils::logical_tensor_init(7, score_shape, dt);
+    auto value_cache = utils::logical_tensor_init(8, cache_shape, dt);
+    auto value_bt = shared_block_table
+            ? key_bt
+            : utils::logical_tensor_init(9, bt_shape, graph::data_type::s32);
+    auto value = utils::logical_tensor_init(10, kv_shape, dt);
+    auto output = utils::logical_tensor_init(11, q_shape, dt);
+
+    graph::op_t load_key {0, graph::op_kind::PagedCacheLoad, "load_key"};
+    load_key.add_input(key_cache);
+    load_key.add_input(key_bt);
+    load_key.add_output(key);
+
+    graph::op_t matmul_qk {1, graph::op_kind::MatMul, "matmul_qk"};
+    matmul_qk.set_attr<bool>(graph::op_attr::transpose_b, true);
+    matmul_qk.add_input(query);
+    matmul_qk.add_input(key);
+    matmul_qk.add_output(score);
+
+    graph::op_t scale_div {2, graph::op_kind::Divide, "scale_div"};
+    scale_div.set_attr(graph::op_attr::auto_broadcast, std::string("numpy"));
+    scale_div.add_input(score);
+    scale_div.add_input(scale);
+    scale_div.add_output(scaled_score);
+
+    graph::op_t softmax {3, graph::op_kind::SoftMax, "softmax"};
+    softmax.set_attr(graph::op_attr::axis, (int64_t)3);
+    softmax.add_input(scaled_score);
+    softmax.add_output(probs);
+
+    graph::op_t load_value {4, graph::op_kind::PagedCacheLoad, "load_value"};
+    load_value.add_input(value_cache);
+    load_value.add_input(value_bt);
+    load_value.add_output(value);
+
+    graph::op_t matmul_v {5, graph::op_kind::MatMul, "matmul_v"};
+    matmul_v.add_input(probs);
+    matmul_v.add_input(value);
+    matmul_v.add_output(output);
+
+    agraph->add_op(&load_key);
+    agraph->add_op(&matmul_qk);
+    agraph->add_op(&scale_div);
+    agraph->add_op(&softmax);
+    agraph->add_op(&load_value);
+    agraph->add_op(&matmul_v);
+}
+
+// Gathers a paged cache into [batch, heads, max_pages * page_size, head_size]
+// with zeros for absent pages, as PagedCacheLoad does.
+static std::vector<float> gather_paged_cache(const std::vector<float> &cache,
+        const std::vector<int32_t> &bt, dim_t batch, dim_t num_head,
+        dim_t head_size, dim_t num_pages, dim_t page_size, dim_t max_pages) {
+    const dim_t kv_len = page_size * max_pages;
+    std::vector<float> dst(batch * num_head * kv_len * head_size, 0.f);
+    for_(dim_t b = 0; b < batch; b++)
+    for_(dim_t h = 0; h < num_head; h++)
+    for (dim_t t = 0; t < kv_len; t++) {
+        const dim_t page = bt[b * max_pages + t / page_size];
+        if (page < 0 || page >= num_pages) continue;
+        for (dim_t d = 0; d < head_size; d++)
+            dst[((b * num_head + h) * kv_len + t) * head_size + d]
+                    = cache[((page * num_head + h) * page_size
+                                    + t % page_size)
+                                    * head_size
+                            + d];
+    }
+    return dst;
+}
+
+static std::vector<float> ref_sdp(const std::vector<float> &q,
+        const std::vector<float> &k, const std::vector<float> &v, float scale,
+        dim_t batch, dim_t num_head, dim_t q_len, dim_t kv_len,
+        dim_t head_size) {
+    std::vector<float> dst(batch * num_head * q_len * head_size, 0.f);
+    std::vector<float> probs(kv_len);
+    for_(dim_t bh = 0; bh < batch * num_head; bh++)
+    for (dim_t i = 0; i < q_len; i++) {
+        const float *qi = &q[(bh * q_len + i) * head_size];
+        float max_score = -INFINITY;
+        for (dim_t t = 0; t < kv_len; t++) {
+            const float *kt = &k[(bh * kv_len + t) * head_size];
+            float s = 0.f;
+            for (dim_t d = 0; d < head_size; d++)
+                s += qi[d] * kt[d];
+            probs[t] = s / scale;
+            max_score = std::max(max_score, probs[t]);
+        }
+        float sum = 0.f;
+        for (dim_t t = 0; t < kv_len; t++) {
+            probs[t] = std::exp(probs[t] - max_score);
+            sum += probs[t];
+        }
+        float *o = &dst[(bh * q_len + i) * head_size];
+        for_(dim_t t = 0; t < kv_len; t++)
+        for (dim_t d = 0; d < head_size; d++)
+            o[d] += probs[t] / sum * v[(bh * kv_len + t) * head_size + d];
+    }
+    return dst;
+}
+
+TEST(test_sdp_paged_execute, F32PagedKv_CPU) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    const dim_t batch = 2, num_head = 2, q_len = 4, head_size = 16,
+                num_pages = 8, page_size = 8, max_pages = 3,
+                kv_len = page_size * max_pages;
+    const float scale = 4.f;
+
+    std::vector<float> query(batch * num_head * q_len * head_size);
+    std::vector<float> key_cache(num_pages * num_head * page_size * head_size);
+    std::vector<float> value_cache(key_cache.size());
+    for (size_t i = 0; i < query.size(); i++)
+        query[i] = static_cast<float>((i * 37) % 17 - 8) / 16.f;
+    for (size_t i = 0; i < key_cache.size(); i++) {
+        key_cache[i] = static_cast<float>((i * 29) % 13 - 6) / 8.f;
+        value_cache[i] = static_cast<float>((i * 31) % 11 - 5) / 4.f;
+    }
+
+    // Pages of a sequence aren't contiguous in the cache. With separate block
+    // tables the sdpa primitive isn't used, so the loads run as gathers,
+    // which fill the absent page of the values (-1) with zeros.
+    const std::vector<int32_t> key_bt = {5, 0, 7, 2, 6, 1};
+    const std::vector<int32_t> value_bt = {5, 0, -1, 2, 6, 1};
+
+    for (bool shared_block_table : {true, false}) {
+        const auto &v_bt = shared_block_table ? key_bt : value_bt;
+        const auto ref = ref_sdp(query,
+                gather_paged_cache(key_cache, key_bt, batch, num_head,
+                        head_size, num_pages, page_size, max_pages),
+                gather_paged_cache(value_cache, v_bt, batch, num_head,
+                        head_size, num_pages, page_size, max_pages),
+                scale, batch, num_head, q_len, kv_len, head_size);
+
+        graph::graph_t g(eng->kind());
+        construct_paged_kv_sdp(&g, batch, num_head, q_len, head_size,
+                num_pages, page_size, max_pages, shared_block_table);
+        g.finalize();
+
+        graph::pass::pass_base_ptr apass
+                = get_pass("float_sdp_paged_kv_fusion_cpu");
+        apass->run(g);
+        ASSERT_EQ(g.get_num_partitions(), 1U);
+        auto part = g.get_partitions()[0];
+
+        graph::partition_t p;
+        p.init(part);
+
+        auto partition_inputs = p.get_inputs();
+        auto partition_outputs = p.get_outputs();
+        // A shared block table is listed once per load.
+        ASSERT_EQ(partition_inputs.size(), 6U);
+        ASSERT_EQ(partition_outputs.size(), 1U);
+
+        std::vector<const graph::logical_tensor_t *> inputs, outputs;
+        std::vector<test_tensor_t> inputs_ts;
+        for (auto &lt : partition_inputs) {
+            inputs.emplace_back(&lt);
+            switch (lt.id) {
+                case 0: inputs_ts.emplace_back(lt, eng, query); break;
+                case 1: inputs_ts.emplace_back(lt, eng, key_cache); break;
+                case 2: inputs_ts.emplace_back(lt, eng, key_bt); break;
+                case 5:
+                    inputs_ts.emplace_back(lt, eng, std::vector<float> {scale});
+                    break;
+                case 8: inputs_ts.emplace_back(lt, eng, value_cache); break;
+                case 9: inputs_ts.emplace_back(lt, eng, value_bt); break;
+                default: FAIL() << "unexpected input " << lt.id;
+            }
+        }
+        for (auto &lt : partition_outputs) {
+            lt = utils::logical_tensor_init(
+                    lt.id, lt.data_type, graph::layout_type::strided);
+            outputs.emplace_back(&lt);
+        }
+
+        // The primitive is used when forced or when there is an optimized
+        // implementation, the gathers are used otherwise.
+        for (const char *force_prim : {"1", "0"}) {
+            custom_setenv("_ONEDNN_GRAPH_SDPA_FORCE_PRIMITIVE", force_prim, 1);
+            graph::compiled_partition_t cp(p);
+            ASSERT_EQ(p.compile(&cp, inputs, outputs, eng),
+                    graph::status::success);
+
+            std::vector<test_tensor_t> outputs_ts;
+            for (auto &lt : outputs) {
+                graph::logical_tensor_t compiled_output;
+                cp.query_logical_tensor(lt->id, &compiled_output);
+                outputs_ts.emplace_back(compiled_output, eng);
+            }
+            ASSERT_EQ(
+                    cp.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                            test_tensor_t::to_graph_tensor(outputs_ts)),
+                    graph::status::success);
+            strm->wait();
+
+            ASSERT_TRUE(allclose<float>(outputs_ts[0].as_vec_type<float>(),
+                    ref, /*rtol*/ 1e-4f, /*atol*/ 1e-5f))
+                    << "shared block table: " << shared_block_table
+                    << ", forced primitive: " << force_prim;
+        }
+    }
+}
@@ -33,6 +33,8 @@
 /// @param attr Primitive attributes (can be NULL).
 /// @param kq_attr Attribute for the Key/Query matmul operation(can be NULL).
 /// @param vs_attr Attribute for the Value/Score matmul operation(can be NULL).
+/// @param block_table_desc Block table memory descriptor for paged keys and
+///     values (can be NULL).
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 
@@ -44,7 +46,8 @@ dnnl_status_t DNNL_API sdpa_primitive_desc_create(
         bool invert_scale, dnnl_dim_t kv_head_number, int attn_mask_type,
         dnnl_alg_kind_t softmax_alg, const_dnnl_primitive_attr_t attr,
         const_dnnl_primitive_attr_t kq_attr,
-        const_dnnl_primitive_attr_t vs_attr);
+        const_dnnl_primitive_attr_t vs_attr,
+        const_dnnl_memory_desc_t block_table_desc);
 
 namespace dnnl {
 namespace impl {
@@ -64,7 +67,8 @@ struct sdpa : public dnnl::primitive {
                 memory::dim kv_head_number, int attn_mask_type, int softmax_alg,
                 const primitive_attr &attr = default_attr(),
                 const primitive_attr &kq_attr = default_attr(),
-                const primitive_attr &vs_attr = default_attr()) {
+                const primitive_attr &vs_attr = default_attr(),
+                const memory::desc *block_table_desc = nullptr) {
 
             dnnl_primitive_desc_t pd = nullptr;
             dnnl_status_t status = sdpa_primitive_desc_create(&pd,
@@ -73,7 +77,7 @@ struct sdpa : public dnnl::primitive {
                     optional_arg(attn_mask_desc), (dnnl_data_type_t)scale_dt,
                     invert_scale, kv_head_number, attn_mask_type,
                     (dnnl_alg_kind_t)softmax_alg, attr.get(), kq_attr.get(),
-                    vs_attr.get());
+                    vs_attr.get(), optional_arg(block_table_desc));
 
             dnnl::error::wrap_c_api(status,
                     "could not create a primitive descriptor for a sdpa "
@@ -160,4 +160,67 @@ CPU_INSTANTIATE_TEST_SUITE_P(Case, test_parallel_nd_t,
                 np_t {{4, 1, 4, 5, 2}}, np_t {{4, 3, 0, 3, 0, 1}},
                 np_t {{2, 1, 3, 1, 2, 1}}, np_t {{4, 1, 4, 3, 2, 2}}));
 
+TEST(test_parallel_dynamic, Test) {
+    // The work per item grows with the index, so threads which get the
+    // beginning of the range finish early and have to steal.
+    const ptrdiff_t size = 1000;
+    std::vector<int> visits(size, 0);
+    impl::parallel_dynamic(0, size, [&](ptrdiff_t start, ptrdiff_t end) {
+        ASSERT_TRUE(0 <= start && start < end && end <= size);
+        for (ptrdiff_t i = start; i < end; i++) {
+            volatile float acc = 0;
+            for (ptrdiff_t j = 0; j < i * 10; j++)
+                acc = acc + 1.f;
+            visits[i]++;
+        }
+    });
+    for (ptrdiff_t i = 0; i < size; ++i)
+        ASSERT_EQ(visits[i], 1);
+}
+
+class test_parallel_nd_dynamic_t : public test_nd_t {
+protected:
+    void emit_parallel_nd_dynamic() {
+        switch ((int)p.dims.size()) {
+            case 1:
+                impl::parallel_nd_dynamic(p.dims[0], [&](ptrdiff_t d0) {
+                    ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
+                    data[d0] = d0;
+                });
+                break;
+            case 2:
+                impl::parallel_nd_dynamic(
+                        p.dims[0], p.dims[1], [&](ptrdiff_t d0, ptrdiff_t d1) {
+                            ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
+                            ASSERT_TRUE(0 <= d1 && d1 < p.dims[1]);
+                            const ptrdiff_t idx = d0 * p.dims[1] + d1;
+                            data[idx] = idx;
+                        });
+                break;
+            case 3:
+                impl::parallel_nd_dynamic(p.dims[0], p.dims[1], p.dims[2],
+                        [&](ptrdiff_t d0, ptrdiff_t d1, ptrdiff_t d2) {
+                            ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
+                            ASSERT_TRUE(0 <= d1 && d1 < p.dims[1]);
+                            ASSERT_TRUE(0 <= d2 && d2 < p.dims[2]);
+                            const ptrdiff_t idx
+                                    = (d0 * p.dims[1] + d1) * p.dims[2] + d2;
+                            data[idx] = idx;
+                        });
+                break;
+            default: ASSERT_TRUE(false);
+        }
+    }
+};
+
+TEST_P(test_parallel_nd_dynamic_t, Test) {
+    emit_parallel_nd_dynamic();
+    CheckID();
+}
+
+CPU_INSTANTIATE_TEST_SUITE_P(Case, test_parallel_nd_dynamic_t,
+        ::testing::Values(np_t {{0}}, np_t {{1}}, np_t {{1000}},
+                np_t {{0, 0}}, np_t {{1, 2}}, np_t {{10, 100}},
+                np_t {{0, 1, 0}}, np_t {{1, 2, 1}}, np_t {{4, 40, 10}}));
+
 } // namespace dnnl
@@ -25,6 +25,7 @@
 #include "oneapi/dnnl/dnnl_sycl.hpp"
 #endif
 
+#include <algorithm>
 #include <memory>
 #include <random>
 
@@ -1822,3 +1823,318 @@ GPU_TEST_P(sdpa_test_t, perf) {
               << "/" << compute(magnitude_cast<gigaops>(total_flops), qtime)
               << "|" << std::endl;
 }
+
+struct sdpa_cpu_dims_t {
+    memory::dim mb;
+    memory::dim head_num;
+    memory::dim kv_head_num;
+    memory::dim seq_len;
+    memory::dim query_num;
+    memory::dim head_size;
+
+    // Data type of queries and output.
+    memory::data_type dt;
+    // Data type of keys and values. Integer types are quantized per token.
+    memory::data_type kvdt;
+
+    bool with_key_transposed;
+    mask_type mask;
+
+    // Number of tokens in a page of keys and values, 0 if they aren't paged.
+    memory::dim page_size;
+};
+
+// Compares the CPU implementations against a direct computation. Inputs are
+// small multiples of 1/4 so that they are exact in every data type. Paged keys
+// and values are scattered over shuffled pages, and one page of the last batch
+// is left absent.
+class sdpa_cpu_test_t : public ::testing::TestWithParam<sdpa_cpu_dims_t> {};
+
+CPU_TEST_P(sdpa_cpu_test_t, compare) {
+#ifdef DNNL_TEST_WITH_ENGINE_PARAM
+    SKIP_IF(get_test_engine_kind() != dnnl::engine::kind::cpu,
+            "This test requires CPU engine");
+#endif
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "SDPA CPU tests require cpus.");
+    const auto p = GetParam();
+    dnnl::engine eng(engine::kind::cpu, 0);
+    dnnl::stream strm(eng);
+
+    const memory::dim MB = p.mb, H = p.head_num, HKV = p.kv_head_num;
+    const memory::dim K = p.seq_len, Q = p.query_num, D = p.head_size;
+    const bool quantized = p.kvdt == mdt::s8 || p.kvdt == mdt::u8;
+    const bool with_mask
+            = p.mask == mask_type::oneD || p.mask == mask_type::twoD;
+
+    // Keys and values are generated per batch and stored in pages, which
+    // are the batches themselves when they aren't paged.
+    const bool paged = p.page_size > 0;
+    const memory::dim PS = paged ? p.page_size : K;
+    const memory::dim NP = K / PS;
+    const memory::dim P = paged ? MB * NP + 1 : MB;
+
+    const memory::dims q_sz = {MB, H, Q, D};
+    const memory::dims k_sz = {MB, HKV, D, K};
+    const memory::dims v_sz = {MB, HKV, K, D};
+    const memory::dims msk_sz
+            = {1, 1, p.mask == mask_type::oneD ? 1 : Q, K};
+    const memory::dims k_scales_sz = {MB, HKV, 1, K};
+    const memory::dims v_scales_sz = {MB, HKV, K, 1};
+    const memory::dims k_pages_sz = {P, HKV, D, PS};
+    const memory::dims v_pages_sz = {P, HKV, PS, D};
+    const memory::dims k_scales_pages_sz = {P, HKV, 1, PS};
+    const memory::dims v_scales_pages_sz = {P, HKV, PS, 1};
+    const memory::dims bt_sz = {MB, NP};
+
+    auto gen = [](int lo, int hi) {
+        std::uniform_int_distribution<int> dist(lo, hi);
+        return static_cast<float>(dist(get_generator()));
+    };
+    auto fill = [&](std::vector<float> &v, memory::dim n, int lo, int hi,
+                        float mult) {
+        v.resize(n);
+        for (auto &e : v)
+            e = gen(lo, hi) * mult;
+    };
+
+    std::vector<float> q_data, k_data, v_data, msk_data;
+    std::vector<float> k_scales, v_scales, k_zp, v_zp;
+    fill(q_data, product(q_sz), -4, 4, 0.25f);
+    fill(msk_data, product(msk_sz), -4, 0, 0.5f);
+    if (quantized) {
+        const int lo = p.kvdt == mdt::u8 ? 0 : -8;
+        fill(k_data, product(k_sz), lo, 8, 1.f);
+        fill(v_data, product(v_sz), lo, 8, 1.f);
+        fill(k_scales, product(k_scales_sz), 1, 4, 0.125f);
+        fill(v_scales, product(v_scales_sz), 1, 4, 0.125f);
+        fill(k_zp, product(k_scales_sz), 0, 3, 1.f);
+        fill(v_zp, product(v_scales_sz), 0, 3, 1.f);
+    } else {
+        fill(k_data, product(k_sz), -4, 4, 0.25f);
+        fill(v_data, product(v_sz), -4, 4, 0.25f);
+    }
+
+    std::vector<int> block_table(MB * NP);
+    for (memory::dim i = 0; i < MB * NP; i++)
+        block_table[i] = static_cast<int>(i);
+    if (paged) {
+        std::shuffle(block_table.begin(), block_table.end(), get_generator());
+        if (NP > 1) block_table[MB * NP - 1] = -1;
+    }
+    auto absent = [&](memory::dim mb, memory::dim k) {
+        return block_table[mb * NP + k / PS] < 0;
+    };
+
+    // Scatters tensors generated per batch into pages.
+    auto to_pages = [&](const std::vector<float> &data,
+                            const memory::dims &dims, bool keys_inner) {
+        const memory::dim inner = product(dims) / (MB * HKV * K);
+        std::vector<float> pages(P * HKV * inner * PS, 0.f);
+        for_(memory::dim mb = 0; mb < MB; mb++)
+        for_(memory::dim h = 0; h < HKV; h++)
+        for_(memory::dim k = 0; k < K; k++)
+        for (memory::dim i = 0; i < inner; i++) {
+            if (absent(mb, k)) continue;
+            const memory::dim page = block_table[mb * NP + k / PS];
+            const memory::dim t = k % PS;
+            if (keys_inner)
+                pages[((page * HKV + h) * inner + i) * PS + t]
+                        = data[((mb * HKV + h) * inner + i) * K + k];
+            else
+                pages[((page * HKV + h) * PS + t) * inner + i]
+                        = data[((mb * HKV + h) * K + k) * inner + i];
+        }
+        return pages;
+    };
+
+    // Creates memory of the requested type initialized from f32 data.
+    auto make_mem = [&](const memory::dims &dims, mdt dt,
+                            memory::format_tag tag,
+                            const std::vector<float> &data) {
+        memory f32_mem({dims, mdt::f32, memory::format_tag::abcd}, eng);
+        write_to_dnnl_memory(data.data(), f32_mem);
+        memory mem({dims, dt, tag}, eng);
+        dnnl::reorder(f32_mem, mem).execute(strm, f32_mem, mem);
+        strm.wait();
+        return mem;
+    };
+
+    const auto abcd = memory::format_tag::abcd;
+    auto q_mem = make_mem(q_sz, p.dt, abcd, q_data);
+    auto k_mem = make_mem(k_pages_sz, p.kvdt,
+            p.with_key_transposed ? memory::format_tag::abdc : abcd,
+            to_pages(k_data, k_sz, true));
+    auto v_mem = make_mem(v_pages_sz, p.kvdt, abcd,
+            to_pages(v_data, v_sz, false));
+    auto msk_mem = make_mem(msk_sz, mdt::f32, abcd, msk_data);
+    memory dst_mem({q_sz, p.dt, abcd}, eng);
+
+    const float scale = static_cast<float>(D) / 4.f;
+    memory scale_mem({{1}, mdt::f32, memory::format_tag::a}, eng);
+    write_to_dnnl_memory(&scale, scale_mem);
+
+    primitive_attr attr, kq_attr, vs_attr;
+    const int k_mask = 1 << 3 | 1 << 1 | 1 << 0;
+    const int v_mask = 1 << 2 | 1 << 1 | 1 << 0;
+    memory k_scales_mem, v_scales_mem, k_zp_mem, v_zp_mem;
+    if (quantized) {
+        kq_attr.set_scales(DNNL_ARG_WEIGHTS, k_mask, {}, mdt::f32);
+        kq_attr.set_zero_points(DNNL_ARG_WEIGHTS, k_mask, {}, mdt::s32);
+        vs_attr.set_scales(DNNL_ARG_WEIGHTS, v_mask, {}, mdt::f32);
+        vs_attr.set_zero_points(DNNL_ARG_WEIGHTS, v_mask, {}, mdt::s32);
+        k_scales_mem = make_mem(k_scales_pages_sz, mdt::f32, abcd,
+                to_pages(k_scales, k_scales_sz, true));
+        v_scales_mem = make_mem(v_scales_pages_sz, mdt::f32, abcd,
+                to_pages(v_scales, v_scales_sz, false));
+        k_zp_mem = make_mem(k_scales_pages_sz, mdt::s32, abcd,
+                to_pages(k_zp, k_scales_sz, true));
+        v_zp_mem = make_mem(v_scales_pages_sz, mdt::s32, abcd,
+                to_pages(v_zp, v_scales_sz, false));
+    }
+
+    memory bt_mem({bt_sz, mdt::s32, memory::format_tag::ab}, eng);
+    write_to_dnnl_memory(block_table.data(), bt_mem);
+    const auto bt_md = bt_mem.get_desc();
+
+    const auto msk_md = msk_mem.get_desc();
+    using dnnl::impl::sdpa;
+    sdpa::primitive_desc sdpa_pd;
+    try {
+        sdpa_pd = sdpa::primitive_desc(eng, q_mem.get_desc(), k_mem.get_desc(),
+                v_mem.get_desc(), with_mask ? &msk_md : nullptr, mdt::f32,
+                dst_mem.get_desc(), /* invert_scale = */ true, HKV,
+                to_attn_mask_type(p.mask),
+                dnnl::impl::alg_kind::softmax_accurate_inf_as_zero, attr,
+                kq_attr, vs_attr, paged ? &bt_md : nullptr);
+    } catch (const dnnl::error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Unimplemented: " << e.what();
+        else
+            throw;
+    }
+
+    std::unordered_map<int, memory> args = {{DNNL_ARG_QUERIES, q_mem},
+            {DNNL_ARG_KEYS, k_mem}, {DNNL_ARG_VALUES, v_mem},
+            {DNNL_ARG_SCALE, scale_mem}, {DNNL_ARG_DST, dst_mem}};
+    if (with_mask) args[DNNL_ARG_ATTN_MASK] = msk_mem;
+    if (paged) args[DNNL_ARG_BLOCK_TABLE] = bt_mem;
+    if (quantized) {
+        args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_KEYS] = k_scales_mem;
+        args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_KEYS] = k_zp_mem;
+        args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_VALUES] = v_scales_mem;
+        args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES] = v_zp_mem;
+    }
+    sdpa(sdpa_pd).execute(strm, args);
+    strm.wait();
+
+    memory dst_f32_mem({q_sz, mdt::f32, abcd}, eng);
+    dnnl::reorder(dst_mem, dst_f32_mem).execute(strm, dst_mem, dst_f32_mem);
+    strm.wait();
+    const float *dst = static_cast<const float *>(dst_f32_mem.map_data());
+
+    auto key = [&](memory::dim mb, memory::dim h, memory::dim i,
+                       memory::dim k) {
+        float v = k_data[((mb * HKV + h) * D + i) * K + k];
+        if (!quantized) return v;
+        const auto s_off = (mb * HKV + h) * K + k;
+        return (v - k_zp[s_off]) * k_scales[s_off];
+    };
+    auto val = [&](memory::dim mb, memory::dim h, memory::dim k,
+                       memory::dim i) {
+        float v = v_data[((mb * HKV + h) * K + k) * D + i];
+        if (!quantized) return v;
+        const auto s_off = (mb * HKV + h) * K + k;
+        return (v - v_zp[s_off]) * v_scales[s_off];
+    };
+
+    const float tol = p.dt == mdt::f32 ? 1e-4f : 2e-2f;
+    std::vector<double> s(K);
+    for_(memory::dim mb = 0; mb < MB; mb++)
+    for_(memory::dim h = 0; h < H; h++)
+    for (memory::dim q = 0; q < Q; q++) {
+        const memory::dim kv_h = h / (H / HKV);
+        memory::dim nk = K;
+        if (p.mask == mask_type::causal_tl) nk = std::min(K, q + 1);
+        if (p.mask == mask_type::causal_br)
+            nk = std::max<memory::dim>(0, std::min(K, q + K - Q + 1));
+
+        double s_max = -INFINITY;
+        for (memory::dim k = 0; k < nk; k++) {
+            if (absent(mb, k)) {
+                s[k] = -INFINITY;
+                continue;
+            }
+            double acc = 0;
+            for (memory::dim i = 0; i < D; i++)
+                acc += q_data[((mb * H + h) * Q + q) * D + i]
+                        * key(mb, kv_h, i, k);
+            s[k] = acc / scale;
+            if (with_mask)
+                s[k] += msk_data[(p.mask == mask_type::oneD ? 0 : q) * K + k];
+            s_max = std::max(s_max, s[k]);
+        }
+        double s_sum = 0;
+        for (memory::dim k = 0; k < nk; k++) {
+            s[k] = s_max == -INFINITY ? 0 : std::exp(s[k] - s_max);
+            s_sum += s[k];
+        }
+        for (memory::dim i = 0; i < D; i++) {
+            double acc = 0;
+            for (memory::dim k = 0; k < nk; k++)
+                if (!absent(mb, k)) acc += s[k] * val(mb, kv_h, k, i);
+            const double gold = s_sum > 0 ? acc / s_sum : 0;
+            const float got = dst[((mb * H + h) * Q + q) * D + i];
+            ASSERT_NEAR(got, gold, tol * std::max(1.0, std::fabs(gold)))
+                    << "mb: " << mb << " h: " << h << " q: " << q
+                    << " i: " << i;
+        }
+    }
+    dst_f32_mem.unmap_data(const_cast<float *>(dst));
+}
+
+// clang-format off
+CPU_INSTANTIATE_TEST_SUITE_P(AllMaskTypes,
+    sdpa_cpu_test_t,
+                        //   mb, hd_num, kv_hd_num, seq_len, qry_num, hd_size,       dt,      kvdt,   key_transposed,     mask, page_size
+    testing::Values(
+                    sdpa_cpu_dims_t{ 2,  2,  2, 100, 37, 32,  mdt::f32,  mdt::f32,   no_key_transposed, mask_type::no_mask, 0 },
+                    sdpa_cpu_dims_t{ 2,  2,  2, 100, 37, 32,  mdt::f32,  mdt::f32,   no_key_transposed, mask_type::oneD, 0 },
+                    sdpa_cpu_dims_t{ 2,  2,  2, 100, 37, 32,  mdt::f32,  mdt::f32, with_key_transposed, mask_type::twoD, 0 },
+                    sdpa_cpu_dims_t{ 2,  2,  2, 100, 37, 32,  mdt::f32,  mdt::f32,   no_key_transposed, mask_type::causal_tl, 0 },
+                    sdpa_cpu_dims_t{ 2,  2,  2,  37, 100, 32,  mdt::f32,  mdt::f32,   no_key_transposed, mask_type::causal_tl, 0 },
+                    sdpa_cpu_dims_t{ 2,  2,  2, 100, 37, 32,  mdt::f32,  mdt::f32, with_key_transposed, mask_type::causal_br, 0 },
+                    sdpa_cpu_dims_t{ 2,  2,  2,  37, 100, 32,  mdt::f32,  mdt::f32,   no_key_transposed, mask_type::causal_br, 0 },
+                    sdpa_cpu_dims_t{ 1,  2,  2, 129,  1, 64,  mdt::f32,  mdt::f32,   no_key_transposed, mask_type::causal_br, 0 }
+    ));
+
+CPU_INSTANTIATE_TEST_SUITE_P(DataTypes,
+    sdpa_cpu_test_t,
+                        //   mb, hd_num, kv_hd_num, seq_len, qry_num, hd_size,       dt,      kvdt,   key_transposed,     mask, page_size
+    testing::Values(
+                    sdpa_cpu_dims_t{ 1,  2,  2,  80, 33, 64, mdt::bf16, mdt::bf16, with_key_transposed, mask_type::causal_tl, 0 },
+                    sdpa_cpu_dims_t{ 1,  2,  2,  80, 33, 64,  mdt::f16,  mdt::f16,   no_key_transposed, mask_type::twoD, 0 },
+                    sdpa_cpu_dims_t{ 1,  2,  2,  80, 33, 64,  mdt::f32,   mdt::s8,   no_key_transposed, mask_type::twoD, 0 },
+                    sdpa_cpu_dims_t{ 1,  2,  2,  80, 33, 64, mdt::bf16,   mdt::u8, with_key_transposed, mask_type::causal_br, 0 }
+    ));
+
+CPU_INSTANTIATE_TEST_SUITE_P(GQA,
+    sdpa_cpu_test_t,
+                        //   mb, hd_num, kv_hd_num, seq_len, qry_num, hd_size,       dt,      kvdt,   key_transposed,     mask, page_size
+    testing::Values(
+                    sdpa_cpu_dims_t{ 2,  8,  2,  70, 20, 32,  mdt::f32,  mdt::f32,   no_key_transposed, mask_type::causal_tl, 0 },
+                    sdpa_cpu_dims_t{ 2,  8,  2,  70, 20, 32,  mdt::f32,   mdt::s8, with_key_transposed, mask_type::oneD, 0 }
+    ));
+
+// Decoding with keys and values in a paged cache.
+CPU_INSTANTIATE_TEST_SUITE_P(PagedKV,
+    sdpa_cpu_test_t,
+                        //   mb, hd_num, kv_hd_num, seq_len, qry_num, hd_size,       dt,      kvdt,   key_transposed,     mask, page_size
+    testing::Values(
+                    sdpa_cpu_dims_t{ 3,  2,  2, 128,  1, 64,  mdt::f32,  mdt::f32,   no_key_transposed, mask_type::no_mask, 16 },
+                    sdpa_cpu_dims_t{ 3,  2,  2, 128,  1, 64,  mdt::f32,  mdt::f32, with_key_transposed, mask_type::twoD, 32 },
+                    sdpa_cpu_dims_t{ 2,  8,  2,  96,  1, 32, mdt::bf16, mdt::bf16, with_key_transposed, mask_type::causal_br, 16 },
+                    sdpa_cpu_dims_t{ 2,  8,  2,  96,  4, 32,  mdt::f32,   mdt::s8,   no_key_transposed, mask_type::oneD, 24 },
+                    sdpa_cpu_dims_t{ 2,  2,  2,  40,  1, 32,  mdt::f32,  mdt::f32,   no_key_transposed, mask_type::no_mask, 40 }
+    ));
+// clang-format on
@@ -0,0 +1,199 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+#include "src/common/dnnl_thread.hpp"
+#include "tests/test_isa_common.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+namespace {
+// Fills a tensor of any layout and data type with small integers, so that the
+// gradients are exact in f32 regardless of the order of the accumulation even
+// for the large minibatch processed in chunks.
+void fill(memory m, const memory::desc &plain_md, int seed) {
+    engine eng = m.get_engine();
+    memory plain(plain_md, eng);
+    const auto n = plain_md.get_size() / sizeof(float);
+    auto *ptr = static_cast<float *>(plain.get_data_handle());
+    for (size_t i = 0; i < n; i++) {
+        const int v = static_cast<int>((i * 13 + seed * 7) % 5) - 2;
+        ptr[i] = static_cast<float>(v);
+    }
+    stream s(eng);
+    reorder(plain, m).execute(s, plain, m);
+    s.wait();
+}
+
+void compare(memory got, memory ref,
+        const memory::desc &plain_md, float eps) {
+    engine eng = ref.get_engine();
+    stream s(eng);
+    memory g(plain_md, eng), r(plain_md, eng);
+    reorder(got, g).execute(s, got, g);
+    reorder(ref, r).execute(s, ref, r);
+    s.wait();
+    const auto n = plain_md.get_size() / sizeof(float);
+    const auto *g_ptr = static_cast<const float *>(g.get_data_handle());
+    const auto *r_ptr = static_cast<const float *>(r.get_data_handle());
+    for (size_t i = 0; i < n; i++)
+        ASSERT_NEAR(g_ptr[i], r_ptr[i], eps * (std::fabs(r_ptr[i]) + 1.f))
+                << "i: " << i;
+}
+
+// Returns a minibatch processed by the fused primitive in two chunks. The
+// budget follows the one of the implementation: half of the last level cache
+// of the cores in use, filled with images of src, diff_src and diff_dst.
+memory::dim chunked_mb(memory::dim c, memory::dim sp, dt data_type) {
+    const size_t image_size
+            = 3 * c * sp * sp * memory::data_type_size(data_type);
+    const size_t budget = impl::cpu::platform::get_per_core_cache_size(3)
+            * dnnl_get_max_threads() / 2;
+    return 2 * std::max<memory::dim>((memory::dim)(budget / image_size), 1);
+}
+} // namespace
+
+struct conv_bwd_test_params_t {
+    // {mb, ic, oc, spatial}
+    memory::dims dims;
+    dt data_type;
+};
+
+class convolution_backward_test_t
+    : public ::testing::TestWithParam<conv_bwd_test_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Convolution backward is supported on CPU only.");
+        SKIP_IF(unsupported_data_type(GetParam().data_type),
+                "Engine does not support this data type.");
+        Test();
+    }
+
+    void Test() {
+        const auto p = GetParam();
+        const memory::dim ic = p.dims[1], oc = p.dims[2], sp = p.dims[3];
+        const memory::dim mb
+                = p.dims[0] > 0 ? p.dims[0] : chunked_mb(ic, sp, p.data_type);
+        const auto d = p.data_type;
+
+        engine eng = get_test_engine();
+        stream s(eng);
+
+        const memory::dims src_dims {mb, ic, sp, sp}, wei_dims {oc, ic, 3, 3},
+                bia_dims {oc}, dst_dims {mb, oc, sp, sp};
+        memory::desc src_md(src_dims, d, tag::any);
+        memory::desc wei_md(wei_dims, d, tag::any);
+        memory::desc bia_md(bia_dims, d, tag::any);
+        memory::desc dst_md(dst_dims, d, tag::any);
+        const memory::dims strides {1, 1}, padding {1, 1};
+
+        auto fwd_pd = convolution_forward::primitive_desc(eng,
+                prop_kind::forward_training, algorithm::convolution_direct,
+                src_md, wei_md, bia_md, dst_md, strides, padding, padding);
+        auto bwd_pd = convolution_backward::primitive_desc(eng,
+                algorithm::convolution_direct, src_md, src_md, wei_md, wei_md,
+                bia_md, dst_md, strides, padding, padding, fwd_pd);
+        ASSERT_EQ(bwd_pd.get_prop_kind(), prop_kind::backward);
+
+        // The nested primitives pick optimized layouts for `any`.
+        const std::string impl_name = bwd_pd.impl_info_str();
+        ASSERT_EQ(impl_name.find("ref_fused_convolution_bwd"), 0U);
+#if DNNL_X64
+        const bool has_jit = d == dt::f32
+                ? dnnl::mayiuse(cpu_isa::avx2)
+                : dnnl::mayiuse(cpu_isa::avx512_core_bf16);
+        if (has_jit) {
+            ASSERT_EQ(impl_name.find("ref:"), std::string::npos) << impl_name;
+        }
+#endif
+
+        // The reference primitives use the layouts chosen by the fused one.
+        const auto diff_src_md = bwd_pd.diff_src_desc();
+        const auto diff_wei_md = bwd_pd.diff_weights_desc();
+        const auto diff_bia_md = bwd_pd.diff_bias_desc();
+        const auto diff_dst_md = bwd_pd.diff_dst_desc();
+        const auto bwd_src_md = bwd_pd.src_desc();
+        const auto bwd_wei_md = bwd_pd.weights_desc();
+        auto bwd_d_pd = convolution_backward_data::primitive_desc(eng,
+                algorithm::convolution_direct, diff_src_md, bwd_wei_md,
+                diff_dst_md, strides, padding, padding, fwd_pd);
+        auto bwd_w_pd = convolution_backward_weights::primitive_desc(eng,
+                algorithm::convolution_direct, bwd_src_md, diff_wei_md,
+                diff_bia_md, diff_dst_md, strides, padding, padding, fwd_pd);
+
+        const memory::desc plain_src_md(src_dims, dt::f32, tag::abcd);
+        const memory::desc plain_wei_md(wei_dims, dt::f32, tag::abcd);
+        const memory::desc plain_bia_md(bia_dims, dt::f32, tag::a);
+        const memory::desc plain_dst_md(dst_dims, dt::f32, tag::abcd);
+
+        memory src(bwd_src_md, eng), wei(bwd_wei_md, eng),
+                diff_dst(diff_dst_md, eng);
+        fill(src, plain_src_md, 1);
+        fill(wei, plain_wei_md, 2);
+        fill(diff_dst, plain_dst_md, 3);
+
+        memory diff_src(diff_src_md, eng), diff_wei(diff_wei_md, eng),
+                diff_bia(diff_bia_md, eng);
+        convolution_backward(bwd_pd).execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DIFF_DST, diff_dst},
+                        {DNNL_ARG_DIFF_SRC, diff_src},
+                        {DNNL_ARG_DIFF_WEIGHTS, diff_wei},
+                        {DNNL_ARG_DIFF_BIAS, diff_bia}});
+
+        memory ref_diff_src(diff_src_md, eng), ref_diff_wei(diff_wei_md, eng),
+                ref_diff_bia(diff_bia_md, eng);
+        convolution_backward_data(bwd_d_pd).execute(s,
+                {{DNNL_ARG_WEIGHTS, wei}, {DNNL_ARG_DIFF_DST, diff_dst},
+                        {DNNL_ARG_DIFF_SRC, ref_diff_src}});
+        convolution_backward_weights(bwd_w_pd).execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_DIFF_DST, diff_dst},
+                        {DNNL_ARG_DIFF_WEIGHTS, ref_diff_wei},
+                        {DNNL_ARG_DIFF_BIAS, ref_diff_bia}});
+        s.wait();
+
+        // A low precision weights gradient of the chunks is accumulated in
+        // f32 and rounded once, the same as in the reference.
+        const float eps = d == dt::f32 ? 1e-3f : 1e-2f;
+        compare(diff_src, ref_diff_src, plain_src_md, eps);
+        compare(diff_wei, ref_diff_wei, plain_wei_md, eps);
+        compare(diff_bia, ref_diff_bia, plain_bia_md, eps);
+    }
+};
+
+TEST_P(convolution_backward_test_t, TestsConvolution) {}
+
+// A zero minibatch is replaced with one processed in two chunks.
+INSTANTIATE_TEST_SUITE_P(TestConvolutionBackward,
+        convolution_backward_test_t,
+        ::testing::Values(
+                conv_bwd_test_params_t {{2, 16, 32, 7}, dt::f32},
+                conv_bwd_test_params_t {{1, 3, 8, 5}, dt::f32},
+                conv_bwd_test_params_t {{0, 16, 16, 14}, dt::f32},
+                conv_bwd_test_params_t {{0, 16, 16, 14}, dt::bf16}));
+
+} // namespace dnnl
@@ -0,0 +1,146 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct gemm_batch_test_params_t {
+    char transa;
+    char transb;
+    float alpha;
+    float beta;
+    memory::dim batch_size;
+    memory::dim ld_pad; // added to the leading dimensions
+};
+
+class gemm_batch_test_t
+    : public ::testing::TestWithParam<gemm_batch_test_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "GEMM batch is only supported on CPU.");
+        Test();
+    }
+
+    void Test() {
+        const auto &p = GetParam();
+        const bool tr_a = p.transa == 'T' || p.transa == 't';
+        const bool tr_b = p.transb == 'T' || p.transb == 't';
+
+        // A handful of shapes repeat across the batch, every 7th problem has
+        // its own.
+        const memory::dim n = p.batch_size;
+        std::vector<memory::dim> M(n), N(n), K(n), lda(n), ldb(n), ldc(n);
+        for (memory::dim i = 0; i < n; i++) {
+            const bool unique = i % 7 == 6;
+            M[i] = unique ? 1 + i % 29 : 4 + 4 * (i % 3);
+            N[i] = unique ? 1 + i % 23 : 16 + (i % 2);
+            K[i] = unique ? 1 + i % 31 : 8 * (1 + i % 3);
+            lda[i] = (tr_a ? M[i] : K[i]) + p.ld_pad;
+            ldb[i] = (tr_b ? K[i] : N[i]) + p.ld_pad;
+            ldc[i] = N[i] + p.ld_pad;
+        }
+
+        std::vector<std::vector<float>> a(n), b(n), c(n), c_ref(n);
+        std::vector<const float *> a_ptrs(n), b_ptrs(n);
+        std::vector<float *> c_ptrs(n);
+        for (memory::dim i = 0; i < n; i++) {
+            a[i].resize((tr_a ? K[i] : M[i]) * lda[i]);
+            b[i].resize((tr_b ? N[i] : K[i]) * ldb[i]);
+            c[i].resize(M[i] * ldc[i]);
+            for (size_t j = 0; j < a[i].size(); j++)
+                a[i][j] = (float)((i + 3 * j) % 11) - 5.f;
+            for (size_t j = 0; j < b[i].size(); j++)
+                b[i][j] = (float)((2 * i + j) % 7) - 3.f;
+            for (size_t j = 0; j < c[i].size(); j++)
+                c[i][j] = (float)((i + j) % 5) - 2.f;
+            c_ref[i] = c[i];
+            a_ptrs[i] = a[i].data();
+            b_ptrs[i] = b[i].data();
+            c_ptrs[i] = c[i].data();
+        }
+
+        for_(memory::dim i = 0; i < n; i++)
+        for_(memory::dim m = 0; m < M[i]; m++)
+        for (memory::dim j = 0; j < N[i]; j++) {
+            float acc = 0.f;
+            for (memory::dim k = 0; k < K[i]; k++) {
+                const float va = tr_a ? a[i][k * lda[i] + m]
+                                      : a[i][m * lda[i] + k];
+                const float vb = tr_b ? b[i][j * ldb[i] + k]
+                                      : b[i][k * ldb[i] + j];
+                acc += va * vb;
+            }
+            float &dst = c_ref[i][m * ldc[i] + j];
+            dst = p.alpha * acc + (p.beta == 0.f ? 0.f : p.beta * dst);
+        }
+
+        ASSERT_EQ(sgemm_batch(n, p.transa, p.transb, M.data(), N.data(),
+                          K.data(), p.alpha, a_ptrs.data(), lda.data(),
+                          b_ptrs.data(), ldb.data(), p.beta, c_ptrs.data(),
+                          ldc.data()),
+                status::success);
+
+        for_(memory::dim i = 0; i < n; i++)
+        for_(memory::dim m = 0; m < M[i]; m++)
+        for (memory::dim j = 0; j < ldc[i]; j++) {
+            const float ref = c_ref[i][m * ldc[i] + j];
+            const float got = c[i][m * ldc[i] + j];
+            ASSERT_NEAR(got, ref, 1e-5f * (1.f + std::fabs(ref)))
+                    << "problem " << i << " m " << m << " n " << j;
+        }
+    }
+};
+
+TEST_P(gemm_batch_test_t, TestsGemmBatch) {}
+
+INSTANTIATE_TEST_SUITE_P(TestGemmBatch, gemm_batch_test_t,
+        ::testing::Values(gemm_batch_test_params_t {'N', 'N', 1.f, 0.f, 1, 0},
+                gemm_batch_test_params_t {'N', 'N', 1.f, 0.f, 300, 0},
+                gemm_batch_test_params_t {'n', 'n', 0.5f, 1.f, 300, 3},
+                gemm_batch_test_params_t {'N', 'N', 2.f, -1.5f, 1000, 1},
+                gemm_batch_test_params_t {'T', 'N', 1.f, 0.f, 300, 2},
+                gemm_batch_test_params_t {'N', 'T', 1.f, 1.f, 300, 0},
+                gemm_batch_test_params_t {'T', 'T', -1.f, 0.5f, 5, 1}));
+
+TEST(gemm_batch_test_t, TestsGemmBatchInvalidArguments) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "GEMM batch is only supported on CPU.");
+    const memory::dim M = 2, N = 3, K = 4, lda = K, ldb = N, ldc = N - 1;
+    std::vector<float> a(M * K), b(K * N), c(M * N);
+    const float *a_ptr = a.data(), *b_ptr = b.data();
+    float *c_ptr = c.data();
+
+    EXPECT_EQ(sgemm_batch(0, 'N', 'N', nullptr, nullptr, nullptr, 1.f,
+                      nullptr, nullptr, nullptr, nullptr, 0.f, nullptr,
+                      nullptr),
+            status::success);
+    EXPECT_EQ(sgemm_batch(1, 'N', 'N', &M, &N, &K, 1.f, &a_ptr, &lda, &b_ptr,
+                      &ldb, 0.f, &c_ptr, &ldc),
+            status::invalid_arguments);
+    EXPECT_EQ(sgemm_batch(1, 'P', 'N', &M, &N, &K, 1.f, &a_ptr, &lda, &b_ptr,
+                      &ldb, 0.f, &c_ptr, &N),
+            status::invalid_arguments);
+}
+
+} // namespace dnnl
@@ -15,6 +15,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <cmath>
+#include <string>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -706,6 +710,291 @@ HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, DepthwiseFusion) {
     }
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, PoolingFusionPostop) {
+    dnnl::post_ops ops;
+    algorithm alg = algorithm::undef;
+    memory::dim kernel = -1;
+    memory::dim stride = -1;
+    memory::dim padding = -1;
+
+    ops.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+    ops.append_pooling(algorithm::pooling_max, 3, 2, 1);
+    ASSERT_EQ(ops.kind(1), primitive::kind::pooling);
+    ops.get_params_pooling(1, alg, kernel, stride, padding);
+    ASSERT_EQ(alg, algorithm::pooling_max);
+    ASSERT_EQ(kernel, 3);
+    ASSERT_EQ(stride, 2);
+    ASSERT_EQ(padding, 1);
+
+    EXPECT_ANY_THROW(ops.get_params_pooling(0, alg, kernel, stride, padding));
+    EXPECT_ANY_THROW(ops.append_pooling(algorithm::eltwise_relu, 2, 2, 0));
+    EXPECT_ANY_THROW(ops.append_pooling(algorithm::pooling_max, 2, 0, 0));
+    EXPECT_ANY_THROW(ops.append_pooling(algorithm::pooling_max, 2, 2, 2));
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, PoolingFusion) {
+    auto engine_kind = get_test_engine_kind();
+    SKIP_IF(engine_kind != engine::kind::cpu,
+            "Pooling fusion is only supported on CPU engine");
+
+    engine e {engine_kind, 0};
+    stream s(e);
+
+    // The nchw case goes through the nspc-based implementation on AVX-512
+    // which must not be handed the pooling post-op.
+    for (auto t : {tag::nhwc, tag::nchw}) {
+        const memory::dim mb = 2, ic = 8, oc = 16, ih = 40, iw = 12;
+        memory::desc src_md {{mb, ic, ih, iw}, data_type::f32, t};
+        memory::desc wei_md {{oc, ic, 3, 3}, data_type::f32, tag::any};
+        memory::desc conv_dst_md {{mb, oc, ih, iw}, data_type::f32, t};
+
+        memory src(src_md, e);
+        {
+            auto *ptr = static_cast<float *>(src.get_data_handle());
+            for (memory::dim i = 0; i < mb * ic * ih * iw; i++)
+                ptr[i] = static_cast<float>((i * 7) % 13) - 6.f;
+        }
+
+        const struct {
+            algorithm alg;
+            memory::dim kernel, stride, padding;
+        } cases[] = {{algorithm::pooling_max, 2, 2, 0},
+                {algorithm::pooling_avg_exclude_padding, 3, 2, 1},
+                {algorithm::pooling_avg_include_padding, 3, 1, 1}};
+
+        for (const auto &c : cases) {
+            dnnl::post_ops conv_ops;
+            conv_ops.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+            dnnl::primitive_attr conv_attr;
+            conv_attr.set_post_ops(conv_ops);
+
+            dnnl::post_ops fused_ops = conv_ops;
+            fused_ops.append_pooling(c.alg, c.kernel, c.stride, c.padding);
+            fused_ops.append_eltwise(algorithm::eltwise_linear, 2.f, 1.f);
+            dnnl::primitive_attr fused_attr;
+            fused_attr.set_post_ops(fused_ops);
+
+            // Reference: separate convolution and pooling primitives.
+            auto conv_pd = convolution_forward::primitive_desc(e,
+                    prop_kind::forward_inference, algorithm::convolution_direct,
+                    src_md, wei_md, conv_dst_md, {1, 1}, {1, 1}, {1, 1},
+                    conv_attr);
+            memory wei(conv_pd.weights_desc(), e);
+            {
+                auto *ptr = static_cast<float *>(wei.get_data_handle());
+                const auto n
+                        = conv_pd.weights_desc().get_size() / sizeof(float);
+                for (size_t i = 0; i < n; i++)
+                    ptr[i] = static_cast<float>((i * 5) % 7) - 3.f;
+            }
+            memory conv_dst(conv_pd.dst_desc(), e);
+            convolution_forward(conv_pd).execute(s,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                            {DNNL_ARG_DST, conv_dst}});
+
+            const memory::dim oh
+                    = (ih + 2 * c.padding - c.kernel) / c.stride + 1;
+            const memory::dim ow
+                    = (iw + 2 * c.padding - c.kernel) / c.stride + 1;
+            memory::desc dst_md {{mb, oc, oh, ow}, data_type::f32, t};
+            dnnl::post_ops pool_ops;
+            pool_ops.append_eltwise(algorithm::eltwise_linear, 2.f, 1.f);
+            dnnl::primitive_attr pool_attr;
+            pool_attr.set_post_ops(pool_ops);
+            const memory::dim pad_r_h
+                    = (oh - 1) * c.stride + c.kernel - ih - c.padding;
+            const memory::dim pad_r_w
+                    = (ow - 1) * c.stride + c.kernel - iw - c.padding;
+            auto pool_pd = pooling_forward::primitive_desc(e,
+                    prop_kind::forward_inference, c.alg, conv_dst_md, dst_md,
+                    {c.stride, c.stride}, {c.kernel, c.kernel}, {0, 0},
+                    {c.padding, c.padding}, {pad_r_h, pad_r_w}, pool_attr);
+            memory ref_dst(dst_md, e);
+            pooling_forward(pool_pd).execute(
+                    s, {{DNNL_ARG_SRC, conv_dst}, {DNNL_ARG_DST, ref_dst}});
+
+            auto fused_pd = convolution_forward::primitive_desc(e,
+                    prop_kind::forward_inference, algorithm::convolution_direct,
+                    src_md, wei_md, conv_dst_md, {1, 1}, {1, 1}, {1, 1},
+                    fused_attr);
+            ASSERT_EQ(fused_pd.dst_desc(), dst_md);
+            ASSERT_EQ(fused_pd.weights_desc(), conv_pd.weights_desc());
+            memory dst(dst_md, e);
+            convolution_forward(fused_pd).execute(s,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                            {DNNL_ARG_DST, dst}});
+            s.wait();
+
+            const auto *ref
+                    = static_cast<const float *>(ref_dst.get_data_handle());
+            const auto *got = static_cast<const float *>(dst.get_data_handle());
+            for (memory::dim i = 0; i < mb * oc * oh * ow; i++)
+                ASSERT_NEAR(got[i], ref[i], 1e-4f * (std::fabs(ref[i]) + 1.f));
+        }
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, ConvolutionWeightsDecompression) {
+    auto engine_kind = get_test_engine_kind();
+    SKIP_IF(engine_kind != engine::kind::cpu,
+            "Convolution weights decompression is only supported on CPU "
+            "engine");
+    SKIP_IF(unsupported_data_type(data_type::bf16),
+            "Engine does not support bf16 data type");
+
+    engine e {engine_kind, 0};
+    stream s(e);
+
+    const memory::dim mb = 2, ic = 32, oc = 32, ih = 10, iw = 10;
+    const memory::dim ic_group = 8;
+    memory::desc src_f32_md {{mb, ic, ih, iw}, data_type::f32, tag::nhwc};
+    memory::desc src_md {{mb, ic, ih, iw}, data_type::bf16, tag::nhwc};
+    memory::desc dst_md {{mb, oc, ih, iw}, data_type::f32, tag::nhwc};
+
+    // Small integers and powers of two keep every product exact in bf16.
+    memory src_f32(src_f32_md, e);
+    {
+        auto *ptr = static_cast<float *>(src_f32.get_data_handle());
+        for (memory::dim i = 0; i < mb * ic * ih * iw; i++)
+            ptr[i] = static_cast<float>((i * 7) % 9) - 4.f;
+    }
+    memory src(src_md, e);
+    reorder(src_f32, src).execute(s, src_f32, src);
+
+    // `plain` selects the user layout of the integer weights: `any`, oihw,
+    // or ohwi (with a leading groups dimension for grouped convolutions).
+    const struct {
+        memory::dim groups, k;
+        int plain;
+    } shapes[] = {{1, 3, 0}, {1, 3, 1}, {1, 1, 2}, {2, 3, 0}, {2, 1, 2}};
+
+    for_(const auto &sh : shapes)
+    for (auto wei_dt : {data_type::s8, data_type::u8, data_type::s4,
+                 data_type::u4}) {
+        const bool with_groups = sh.groups > 1;
+        const bool is_int4
+                = wei_dt == data_type::s4 || wei_dt == data_type::u4;
+        const bool is_signed
+                = wei_dt == data_type::s8 || wei_dt == data_type::s4;
+        const memory::dim ocg = oc / sh.groups, icg = ic / sh.groups;
+        const memory::dim n_ic_groups = icg / ic_group, ks = sh.k * sh.k;
+        const memory::dim pad = sh.k / 2;
+        const memory::dims wei_dims = with_groups
+                ? memory::dims {sh.groups, ocg, icg, sh.k, sh.k}
+                : memory::dims {oc, ic, sh.k, sh.k};
+        const tag plain_tags[2][3] = {{tag::any, tag::abcd, tag::acdb},
+                {tag::any, tag::abcde, tag::abdec}};
+        const tag wei_tag = plain_tags[with_groups][sh.plain];
+
+        memory scales({{oc * n_ic_groups}, data_type::f32, tag::a}, e);
+        memory zero_points({{oc * n_ic_groups}, data_type::s8, tag::a}, e);
+        auto *sc = static_cast<float *>(scales.get_data_handle());
+        auto *zp = static_cast<int8_t *>(zero_points.get_data_handle());
+        for (memory::dim i = 0; i < oc * n_ic_groups; i++) {
+            sc[i] = 1.f / static_cast<float>(1 << (i % 3));
+            zp[i] = static_cast<int8_t>(i % 5 - (is_signed ? 2 : 0));
+        }
+
+        dnnl::primitive_attr attr;
+        const int qmask = with_groups ? (1 << 0) + (1 << 1) + (1 << 2)
+                                      : (1 << 0) + (1 << 1);
+        attr.set_scales(DNNL_ARG_WEIGHTS, qmask, {1, ic_group});
+        attr.set_zero_points(
+                DNNL_ARG_WEIGHTS, qmask, {1, ic_group}, data_type::s8);
+        memory::desc wei_md {wei_dims, wei_dt, wei_tag};
+
+        // Integer weights are only accepted when fpmath applies to them.
+        EXPECT_ANY_THROW(convolution_forward::primitive_desc(e,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                src_md, wei_md, dst_md, {1, 1}, {pad, pad}, {pad, pad},
+                attr));
+
+        attr.set_fpmath_mode(fpmath_mode::bf16, true);
+        auto pd = convolution_forward::primitive_desc(e,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                src_md, wei_md, dst_md, {1, 1}, {pad, pad}, {pad, pad},
+                attr);
+        const std::string impl = pd.impl_info_str();
+#if DNNL_X64
+        ASSERT_EQ(impl.find("brg"), 0U)
+                << impl << " groups: " << sh.groups << " k: " << sh.k;
+#endif
+
+        // Integer values are written into the weights layout chosen by the
+        // implementation, the dequantized ones into an oihw reference.
+        memory wei(pd.weights_desc(), e);
+        const memory::dims strides = pd.weights_desc().get_strides();
+        ASSERT_EQ(strides.size(), wei_dims.size()) << impl;
+        memory::desc wei_ref_md {wei_dims, data_type::f32,
+                with_groups ? tag::abcde : tag::abcd};
+        memory wei_ref(wei_ref_md, e);
+        auto *w = static_cast<uint8_t *>(wei.get_data_handle());
+        auto *w_ref = static_cast<float *>(wei_ref.get_data_handle());
+        std::fill(w, w + pd.weights_desc().get_size(), uint8_t(0));
+        for_(memory::dim g = 0; g < sh.groups; g++)
+        for_(memory::dim o = 0; o < ocg; o++)
+        for_(memory::dim i = 0; i < icg; i++)
+        for (memory::dim k = 0; k < ks; k++) {
+            const memory::dim ref_off = ((g * ocg + o) * icg + i) * ks + k;
+            const int range = is_int4 ? 8 : 15;
+            const int v = is_signed
+                    ? static_cast<int>((ref_off * 5) % range) - range / 2
+                    : static_cast<int>((ref_off * 5) % range);
+            const memory::dim pos[] = {g, o, i, k / sh.k, k % sh.k};
+            memory::dim off = 0;
+            for (size_t d = 0; d < wei_dims.size(); d++)
+                off += pos[d + !with_groups] * strides[d];
+            if (is_int4) {
+                const int shift = 4 * static_cast<int>(off % 2);
+                w[off / 2] = static_cast<uint8_t>(
+                        w[off / 2] | ((v & 0xf) << shift));
+            } else {
+                w[off] = static_cast<uint8_t>(v);
+            }
+            const memory::dim q_off
+                    = (g * ocg + o) * n_ic_groups + i / ic_group;
+            w_ref[ref_off] = static_cast<float>(v - zp[q_off]) * sc[q_off];
+        }
+
+        // Reference: bf16 convolution on weights dequantized in advance.
+        memory::desc wei_bf16_md {wei_dims, data_type::bf16,
+                with_groups ? tag::abcde : tag::abcd};
+        memory wei_bf16(wei_bf16_md, e);
+        reorder(wei_ref, wei_bf16).execute(s, wei_ref, wei_bf16);
+        auto ref_pd = convolution_forward::primitive_desc(e,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                src_md, wei_bf16_md, dst_md, {1, 1}, {pad, pad}, {pad, pad});
+        memory ref_dst(dst_md, e);
+        convolution_forward(ref_pd).execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei_bf16},
+                        {DNNL_ARG_DST, ref_dst}});
+
+        memory dst(dst_md, e);
+        convolution_forward(pd).execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst},
+                        {DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, scales},
+                        {DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS,
+                                zero_points}});
+        s.wait();
+
+        const auto *ref = static_cast<const float *>(ref_dst.get_data_handle());
+        const auto *got = static_cast<const float *>(dst.get_data_handle());
+        for (memory::dim i = 0; i < mb * oc * ih * iw; i++)
+            ASSERT_NEAR(got[i], ref[i], 1e-4f * (std::fabs(ref[i]) + 1.f))
+                    << impl << " groups: " << sh.groups << " k: " << sh.k;
+    }
+
+    // Groups must split the input channels evenly.
+    dnnl::primitive_attr bad_attr;
+    bad_attr.set_fpmath_mode(fpmath_mode::bf16, true);
+    bad_attr.set_scales(DNNL_ARG_WEIGHTS, (1 << 0) + (1 << 1), {1, 12});
+    memory::desc wei_any_md {{oc, ic, 3, 3}, data_type::s8, tag::any};
+    EXPECT_ANY_THROW(convolution_forward::primitive_desc(e,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            src_md, wei_any_md, dst_md, {1, 1}, {1, 1}, {1, 1}, bad_attr));
+}
+
 HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, InnerProdBlockedWeights) {
     auto engine_kind = get_test_engine_kind();
     bool skip_test = !DNNL_X64 || (DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE)
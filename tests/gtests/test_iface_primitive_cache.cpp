@@ -101,6 +101,32 @@ TEST(primitive_cache_test, TestSizeGreaterCapacity) {
     ASSERT_EQ(get_primitive_cache_size(), 10);
 }
 
+TEST(primitive_cache_test, TestSetShards) {
+    set_primitive_cache_shards(4);
+    ASSERT_EQ(get_primitive_cache_shards(), 4);
+    EXPECT_ANY_THROW(set_primitive_cache_shards(0));
+    ASSERT_EQ(get_primitive_cache_shards(), 4);
+    set_primitive_cache_shards(1);
+}
+
+TEST(primitive_cache_test, TestShardedEviction) {
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(22);
+    set_primitive_cache_shards(4);
+    fill_primitive_cache(30);
+    ASSERT_LE(get_primitive_cache_size(), 22);
+
+    // Redistributing entries keeps the cache within its capacity.
+    set_primitive_cache_shards(3);
+    ASSERT_LE(get_primitive_cache_size(), 22);
+    set_primitive_cache_capacity(5);
+    ASSERT_LE(get_primitive_cache_size(), 5);
+
+    set_primitive_cache_shards(1);
+    set_primitive_cache_capacity(0);
+    ASSERT_EQ(get_primitive_cache_size(), 0);
+}
+
 TEST(primitive_cache_test, TestCacheHit) {
     set_primitive_cache_capacity(0);
     set_primitive_cache_capacity(2);
@@ -116,6 +142,119 @@ TEST(primitive_cache_test, TestCacheHit) {
 #endif
     ASSERT_EQ(get_primitive_cache_size(), 2);
 }
+
+TEST(primitive_cache_test, TestAsyncCreation) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(16);
+
+    engine eng(get_test_engine_kind(), 0);
+    std::vector<primitive_desc> pds;
+    for (int i = 0; i < 8; i++) {
+        auto md = memory::desc({i + 1, 1, 1, 1}, dt::f32, tag::nchw);
+        pds.push_back(eltwise_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::eltwise_relu, md, md,
+                0.f, 0.f));
+    }
+
+    precompile_primitives(pds);
+    ASSERT_EQ(get_primitive_cache_size(), 8);
+
+    primitive_future f(pds[0]);
+    auto p = f.get_primitive();
+    ASSERT_FALSE(f.is_ready());
+    ASSERT_EQ(p.get_kind(), primitive::kind::eltwise);
+    // The primitive can be retrieved only once.
+    EXPECT_ANY_THROW(f.get_primitive());
+    ASSERT_EQ(get_primitive_cache_size(), 8);
+
+    auto md = memory::desc({9, 1, 1, 1}, dt::f32, tag::nchw);
+    auto relu_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md, 0.f,
+            0.f);
+    primitive_future f_new(relu_pd);
+    auto relu = eltwise_forward(relu_pd);
+    ASSERT_EQ(f_new.get_primitive().get_kind(), primitive::kind::eltwise);
+    ASSERT_EQ(get_primitive_cache_size(), 9);
+}
+
+// RNN primitives use the global scratchpad, which is thread-local. The
+// primitive taken from the future is executed and destroyed on a thread
+// which didn't create it.
+TEST(primitive_cache_test, TestAsyncCreationGlobalScratchpad) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    if (get_test_engine_kind() != engine::kind::cpu) return;
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(16);
+
+    engine eng(get_test_engine_kind(), 0);
+    stream s(eng);
+
+    auto make_pd = [&](memory::dim T, memory::dim N, memory::dim C,
+                           scratchpad_mode mode = scratchpad_mode::library) {
+        primitive_attr attr;
+        attr.set_scratchpad_mode(mode);
+        return vanilla_rnn_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::eltwise_tanh,
+                rnn_direction::unidirectional_left2right,
+                memory::desc({T, N, C}, dt::f32, tag::tnc), memory::desc(),
+                memory::desc({1, 1, C, 1, C}, dt::f32, tag::ldigo),
+                memory::desc({1, 1, C, 1, C}, dt::f32, tag::ldigo),
+                memory::desc({1, 1, 1, C}, dt::f32, tag::ldgo),
+                memory::desc({T, N, C}, dt::f32, tag::tnc), memory::desc(),
+                attr);
+    };
+    auto execute = [&](const primitive &p,
+                           const vanilla_rnn_forward::primitive_desc &pd) {
+        std::unordered_map<int, memory> args;
+        for (int arg : {DNNL_ARG_SRC_LAYER, DNNL_ARG_WEIGHTS_LAYER,
+                     DNNL_ARG_WEIGHTS_ITER, DNNL_ARG_BIAS}) {
+            memory m(pd.query_md(query::exec_arg_md, arg), eng);
+            auto *ptr = static_cast<float *>(m.get_data_handle());
+            const size_t n = m.get_desc().get_size() / sizeof(float);
+            for (size_t i = 0; i < n; i++)
+                ptr[i] = static_cast<float>((i * 7 + arg) % 11) / 16.f;
+            args.emplace(arg, m);
+        }
+        memory dst(pd.dst_layer_desc(), eng);
+        args.emplace(DNNL_ARG_DST_LAYER, dst);
+        p.execute(s, args);
+        s.wait();
+        const auto *ptr = static_cast<const float *>(dst.get_data_handle());
+        return std::vector<float>(
+                ptr, ptr + dst.get_desc().get_size() / sizeof(float));
+    };
+
+    // The sizes are only reported in the user mode, the primitives under test
+    // take their scratchpad from the library.
+    const auto small_md
+            = make_pd(2, 2, 4, scratchpad_mode::user).scratchpad_desc();
+    const auto big_md
+            = make_pd(8, 16, 64, scratchpad_mode::user).scratchpad_desc();
+    ASSERT_GT(small_md.get_size(), 0U);
+    ASSERT_GT(big_md.get_size(), small_md.get_size());
+
+    auto small_pd = make_pd(2, 2, 4);
+    auto big_pd = make_pd(8, 16, 64);
+
+    auto small = vanilla_rnn_forward(small_pd);
+    const auto small_ref = execute(small, small_pd);
+
+    {
+        primitive_future f(big_pd);
+        auto big = f.get_primitive();
+        const auto big_dst = execute(big, big_pd);
+        ASSERT_EQ(big_dst, execute(vanilla_rnn_forward(big_pd), big_pd));
+    }
+
+    // Destroying the primitive taken from the future doesn't release the
+    // scratchpad of the calling thread.
+    ASSERT_EQ(execute(small, small_pd), small_ref);
+}
 #endif
 
 } // namespace dnnl
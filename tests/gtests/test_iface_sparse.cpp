@@ -19,6 +19,8 @@
 
 #include "oneapi/dnnl/dnnl.hpp"
 
+#include "tests/test_isa_common.hpp"
+
 namespace dnnl {
 
 using dt = memory::data_type;
@@ -33,6 +35,18 @@ TEST(iface_sparse_test_t, TestSparseMDCreation) {
             md = memory::desc::csr({64, 128}, dt::f32, nnz, dt::s32, dt::s32));
     // COO.
     ASSERT_NO_THROW(md = memory::desc::coo({64, 128}, dt::f32, nnz, dt::s32));
+    // BSR.
+    ASSERT_NO_THROW(md = memory::desc::bsr(
+                            {64, 128}, dt::f32, nnz, {4, 4}, dt::s32, dt::s32));
+    // Dimensions must be divisible by the dimensions of a block.
+    ASSERT_ANY_THROW(md = memory::desc::bsr({64, 128}, dt::f32, nnz, {3, 4},
+                             dt::s32, dt::s32));
+    // Grouped.
+    ASSERT_NO_THROW(
+            md = memory::desc::grouped({64, 128}, dt::f32, 0, 4, dt::s32));
+    // Only the first dimension can vary across groups.
+    ASSERT_ANY_THROW(
+            md = memory::desc::grouped({64, 128}, dt::f32, 1, 4, dt::s32));
     // Packed.
     ASSERT_NO_THROW(md = memory::desc::packed({64, 128}, dt::f32, nnz));
 }
@@ -83,6 +97,31 @@ TEST(iface_sparse_test_t, TestSparseMDComparison) {
             md2 = memory::desc::coo({64, 128}, dt::f32, nnz + 1, dt::s32));
     ASSERT_NE(md1, md2);
 
+    // BSR.
+
+    // Different block dimensions.
+    ASSERT_NO_THROW(md1 = memory::desc::bsr(
+                            {64, 128}, dt::f32, nnz, {4, 4}, dt::s32, dt::s32));
+    ASSERT_NO_THROW(md2 = memory::desc::bsr({64, 128}, dt::f32, nnz, {16, 1},
+                            dt::s32, dt::s32));
+    ASSERT_NE(md1, md2);
+
+    // Same dimensions and nnz as CSR.
+    ASSERT_NO_THROW(
+            md1 = memory::desc::csr({64, 128}, dt::f32, nnz, dt::s32, dt::s32));
+    ASSERT_NO_THROW(md2 = memory::desc::bsr(
+                            {64, 128}, dt::f32, nnz, {1, 1}, dt::s32, dt::s32));
+    ASSERT_NE(md1, md2);
+
+    // Grouped.
+
+    // Different number of groups.
+    ASSERT_NO_THROW(
+            md1 = memory::desc::grouped({64, 128}, dt::f32, 0, 4, dt::s32));
+    ASSERT_NO_THROW(
+            md2 = memory::desc::grouped({64, 128}, dt::f32, 0, 8, dt::s32));
+    ASSERT_NE(md1, md2);
+
     // Packed.
 
     // Equal memory descriptors.
@@ -130,6 +169,29 @@ TEST(iface_sparse_test_t, TestSparseMDQueries) {
     ASSERT_EQ(md.get_data_type(1), indices_dt);
     ASSERT_EQ(md.get_data_type(2), indices_dt);
 
+    // BSR.
+    ASSERT_NO_THROW(md = memory::desc::bsr(dims, data_type, nnz, {4, 4},
+                            indices_dt, pointers_dt));
+    ASSERT_EQ(md.get_dims(), dims);
+    ASSERT_EQ(md.get_data_type(), data_type);
+    ASSERT_EQ(md.get_format_kind(), memory::format_kind::sparse);
+
+    ASSERT_EQ(md.get_nnz(), nnz);
+    ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::bsr);
+    ASSERT_EQ(md.get_data_type(1), indices_dt);
+    ASSERT_EQ(md.get_data_type(2), pointers_dt);
+
+    // Grouped.
+    ASSERT_NO_THROW(md = memory::desc::grouped(dims, data_type, 0, 4, dt::s32));
+    ASSERT_EQ(md.get_dims(), dims);
+    ASSERT_EQ(md.get_data_type(), data_type);
+    ASSERT_EQ(md.get_format_kind(), memory::format_kind::sparse);
+
+    ASSERT_EQ(md.get_nnz(), dims[0] * dims[1]);
+    ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::grouped);
+    ASSERT_EQ(md.get_data_type(1), dt::s32);
+    ASSERT_EQ(md.get_num_handles(), 2);
+
     // Packed.
     ASSERT_NO_THROW(md = memory::desc::packed(dims, data_type, nnz));
     ASSERT_EQ(md.get_dims(), dims);
@@ -178,6 +240,36 @@ TEST(iface_sparse_test_t, TestSparseMDSize) {
     ASSERT_EQ(md.get_size(1), exp_indices_size);
     ASSERT_EQ(md.get_size(2), exp_indices_size);
 
+    // BSR.
+    ASSERT_NO_THROW(md = memory::desc::bsr(
+                            {64, 128}, dt::f32, nnz, {4, 2}, dt::s32, dt::s32));
+    // Size of values, `nnz` is the number of blocks.
+    exp_values_size = nnz * 4 * 2 * memory::data_type_size(md.get_data_type());
+    ASSERT_EQ(md.get_size(), exp_values_size);
+    ASSERT_EQ(md.get_size(0), exp_values_size);
+
+    // Size of indices.
+    exp_indices_size = nnz * memory::data_type_size(md.get_data_type(1));
+    ASSERT_EQ(md.get_size(1), exp_indices_size);
+
+    // Size of pointers, one per block row plus one.
+    exp_pointers_size = (md.get_dims()[0] / 4 + 1)
+            * memory::data_type_size(md.get_data_type(2));
+    ASSERT_EQ(md.get_size(2), exp_pointers_size);
+
+    // Grouped.
+    ASSERT_NO_THROW(
+            md = memory::desc::grouped({64, 128}, dt::f32, 0, 4, dt::s32));
+    // Size of values, all of them are stored.
+    exp_values_size = 64 * 128 * memory::data_type_size(md.get_data_type());
+    ASSERT_EQ(md.get_size(), exp_values_size);
+    ASSERT_EQ(md.get_size(0), exp_values_size);
+
+    // Size of offsets, one per group plus one.
+    const size_t exp_offsets_size
+            = (4 + 1) * memory::data_type_size(md.get_data_type(1));
+    ASSERT_EQ(md.get_size(1), exp_offsets_size);
+
     // Packed.
 
     // The user-created memory descriptor for packed encoding cannot
@@ -405,4 +497,242 @@ TEST(iface_sparse_test_t, TestSparseMemoryMapUnmap) {
     ASSERT_NO_THROW(mem.unmap_data(mapped_col_indices, 2));
 }
 
+namespace {
+// Values in matmul tests are small integers, so the results are exact up to
+// the rounding of the destination.
+void store_value(dt t, void *ptr, size_t off, float v) {
+    switch (t) {
+        case dt::f32: static_cast<float *>(ptr)[off] = v; break;
+        case dt::bf16: static_cast<bfloat16_t *>(ptr)[off] = v; break;
+        case dt::u8: static_cast<uint8_t *>(ptr)[off] = (uint8_t)v; break;
+        case dt::s8: static_cast<int8_t *>(ptr)[off] = (int8_t)v; break;
+        default: assert(!"unexpected data type");
+    }
+}
+
+float load_value(dt t, const void *ptr, size_t off) {
+    switch (t) {
+        case dt::f32: return static_cast<const float *>(ptr)[off];
+        case dt::bf16: return (float)static_cast<const bfloat16_t *>(ptr)[off];
+        case dt::s32: return (float)static_cast<const int32_t *>(ptr)[off];
+        default: assert(!"unexpected data type"); return 0.f;
+    }
+}
+} // namespace
+
+HANDLE_EXCEPTIONS_FOR_TEST(iface_sparse_test_t, TestSparseBsrMatmul) {
+    engine eng = get_test_engine();
+
+    const bool is_unimplemented = (eng.get_kind() == engine::kind::gpu
+            || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL);
+    if (is_unimplemented) return;
+
+    struct cfg_t {
+        dt src_dt, wei_dt, dst_dt;
+        memory::dims block_dims;
+    };
+    // clang-format off
+    const std::vector<cfg_t> cfgs = {
+        {dt::f32, dt::f32, dt::f32, {4, 4}},
+        {dt::f32, dt::f32, dt::f32, {16, 1}},
+        {dt::bf16, dt::bf16, dt::f32, {1, 4}},
+        {dt::bf16, dt::bf16, dt::bf16, {2, 1}},
+        {dt::u8, dt::s8, dt::s32, {4, 4}},
+        {dt::u8, dt::s8, dt::f32, {16, 1}},
+        {dt::s8, dt::s8, dt::s32, {4, 4}},
+        {dt::s8, dt::s8, dt::f32, {1, 4}},
+    };
+    // clang-format on
+
+    const memory::dim M = 32, K = 64, N = 80;
+    stream strm(eng);
+    for (const auto &c : cfgs) {
+        const memory::dim blk_m = c.block_dims[0];
+        const memory::dim blk_k = c.block_dims[1];
+
+        // Every fourth block is non-zero, except for the second block row
+        // which is empty.
+        std::vector<float> src(M * K, 0.f), values;
+        std::vector<int32_t> indices, pointers = {0};
+        for (memory::dim mb = 0; mb < M / blk_m; mb++) {
+            for (memory::dim kb = 0; kb < K / blk_k; kb++) {
+                if (mb == 1 || (mb + 3 * kb) % 4 != 0) continue;
+                indices.push_back((int32_t)kb);
+                for_(memory::dim i = 0; i < blk_m; i++)
+                for (memory::dim j = 0; j < blk_k; j++) {
+                    // Negative values check the handling of the s8
+                    // source, which the kernel shifts into the u8 range.
+                    const float v = (float)((mb * 7 + kb * 5 + i * 3 + j) % 9)
+                            - (c.src_dt == dt::s8 ? 4.f : 0.f);
+                    values.push_back(v);
+                    src[(mb * blk_m + i) * K + kb * blk_k + j] = v;
+                }
+            }
+            pointers.push_back((int32_t)indices.size());
+        }
+
+        const memory::dim nnz = (memory::dim)indices.size();
+        auto src_md = memory::desc::bsr(
+                {M, K}, c.src_dt, nnz, c.block_dims, dt::s32, dt::s32);
+        memory::desc wei_md({K, N}, c.wei_dt, memory::format_tag::ab);
+        memory::desc dst_md({M, N}, c.dst_dt, memory::format_tag::ab);
+        auto pd = matmul::primitive_desc(
+                eng, src_md, wei_md, dst_md, primitive_attr(), true);
+        // Data types other than f32 require support from the ISA.
+        if (!pd) {
+            ASSERT_NE(c.src_dt, dt::f32);
+            continue;
+        }
+
+        std::vector<uint8_t> values_buf(src_md.get_size(0));
+        for (size_t i = 0; i < values.size(); i++)
+            store_value(c.src_dt, values_buf.data(), i, values[i]);
+        memory src_mem(src_md, eng,
+                {values_buf.data(), indices.data(), pointers.data()});
+        memory wei_mem(wei_md, eng);
+        memory dst_mem(dst_md, eng);
+
+        const std::string impl = pd.impl_info_str();
+#if DNNL_X64
+        if (c.src_dt != dt::f32 || dnnl::mayiuse(cpu_isa::avx2)) {
+            ASSERT_EQ(impl.find("brg_bsr_matmul"), 0U) << impl;
+        }
+#endif
+
+        std::vector<float> wei(K * N);
+        auto fill_wei = [&](float sign) {
+            for (memory::dim i = 0; i < K * N; i++) {
+                wei[i] = sign * (float)(i % 7 - 3);
+                store_value(
+                        c.wei_dt, wei_mem.get_data_handle(), i, wei[i]);
+            }
+        };
+        auto check = [&](const std::vector<float> &exp_wei) {
+            matmul(pd).execute(strm,
+                    {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                            {DNNL_ARG_DST, dst_mem}});
+            strm.wait();
+
+            const void *dst = dst_mem.get_data_handle();
+            for_(memory::dim m = 0; m < M; m++)
+            for (memory::dim n = 0; n < N; n++) {
+                float exp = 0.f;
+                for (memory::dim k = 0; k < K; k++)
+                    exp += src[m * K + k] * exp_wei[k * N + n];
+                const float tol = c.dst_dt == dt::bf16
+                        ? 1e-2f * std::fabs(exp)
+                        : 0.f;
+                ASSERT_NEAR(load_value(c.dst_dt, dst, m * N + n), exp, tol)
+                        << impl << " m=" << m << " n=" << n;
+            }
+        };
+
+        fill_wei(1.f);
+        check(wei);
+        if (c.src_dt == dt::f32) continue;
+
+        // Weights are packed once when the packed weights cache is enabled,
+        // so an update isn't seen until the cache entry is invalidated.
+        const int old_capacity = get_packed_weights_cache_capacity();
+        set_packed_weights_cache_capacity(4);
+        check(wei);
+        const auto old_wei = wei;
+        fill_wei(-1.f);
+        check(old_wei);
+        packed_weights_cache_invalidate(wei_mem.get_data_handle());
+        check(wei);
+        set_packed_weights_cache_capacity(old_capacity);
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(iface_sparse_test_t, TestSparseGroupedMatmul) {
+    engine eng = get_test_engine();
+
+    const bool is_unimplemented = (eng.get_kind() == engine::kind::gpu
+            || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL);
+    if (is_unimplemented) return;
+
+    struct cfg_t {
+        dt src_dt, wei_dt, dst_dt;
+    };
+    const std::vector<cfg_t> cfgs = {
+            {dt::f32, dt::f32, dt::f32},
+            {dt::bf16, dt::bf16, dt::f32},
+            {dt::bf16, dt::bf16, dt::bf16},
+            {dt::u8, dt::s8, dt::s32},
+            {dt::u8, dt::s8, dt::f32},
+    };
+
+    // Groups of different sizes, including an empty one. K isn't a multiple
+    // of the VNNI granularity and N isn't a multiple of the block of columns.
+    const std::vector<int32_t> offsets = {0, 5, 5, 42, 43};
+    const memory::dim G = (memory::dim)offsets.size() - 1;
+    const memory::dim M = offsets.back(), K = 67, N = 80;
+
+    stream strm(eng);
+    for (const auto &c : cfgs) {
+        auto src_md = memory::desc::grouped({M, K}, c.src_dt, 0, G, dt::s32);
+        memory::desc wei_md({G, K, N}, c.wei_dt, memory::format_tag::abc);
+        auto dst_md = memory::desc::grouped({M, N}, c.dst_dt, 0, G, dt::s32);
+
+        // The number of groups must match the weights.
+        memory::desc bad_wei_md(
+                {G + 1, K, N}, c.wei_dt, memory::format_tag::abc);
+        ASSERT_ANY_THROW(matmul::primitive_desc(
+                eng, src_md, bad_wei_md, dst_md, primitive_attr()));
+
+        auto pd = matmul::primitive_desc(
+                eng, src_md, wei_md, dst_md, primitive_attr(), true);
+        // Data types other than f32 require support from the ISA.
+        if (!pd) {
+            ASSERT_NE(c.src_dt, dt::f32);
+            continue;
+        }
+
+        std::vector<float> src(M * K), wei(G * K * N);
+        std::vector<uint8_t> src_buf(src_md.get_size(0));
+        for (memory::dim i = 0; i < M * K; i++) {
+            src[i] = (float)(i % 5);
+            store_value(c.src_dt, src_buf.data(), i, src[i]);
+        }
+        std::vector<int32_t> offsets_buf = offsets;
+        memory src_mem(src_md, eng, {src_buf.data(), offsets_buf.data()});
+        memory wei_mem(wei_md, eng);
+        for (memory::dim i = 0; i < G * K * N; i++) {
+            wei[i] = (float)(i % 7 - 3);
+            store_value(c.wei_dt, wei_mem.get_data_handle(), i, wei[i]);
+        }
+        std::vector<uint8_t> dst_buf(dst_md.get_size(0));
+        memory dst_mem(dst_md, eng, {dst_buf.data(), offsets_buf.data()});
+
+        matmul(pd).execute(strm,
+                {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                        {DNNL_ARG_DST, dst_mem}});
+        strm.wait();
+
+        for_(memory::dim g = 0; g < G; g++)
+        for_(memory::dim m = offsets[g]; m < offsets[g + 1]; m++)
+        for (memory::dim n = 0; n < N; n++) {
+            float exp = 0.f;
+            for (memory::dim k = 0; k < K; k++)
+                exp += src[m * K + k] * wei[(g * K + k) * N + n];
+            const float tol = c.dst_dt == dt::bf16 ? 1e-2f * std::fabs(exp)
+                                                   : 0.f;
+            ASSERT_NEAR(load_value(c.dst_dt, dst_buf.data(), m * N + n), exp,
+                    tol)
+                    << "g=" << g << " m=" << m << " n=" << n;
+        }
+
+        // Decreasing offsets and offsets past the rows are rejected.
+        for (const auto &bad_offsets : {std::vector<int32_t> {0, 5, 3, 42, 43},
+                     std::vector<int32_t> {0, 5, 5, 42, 44},
+                     std::vector<int32_t> {-1, 5, 5, 42, 43}}) {
+            offsets_buf = bad_offsets;
+            ASSERT_ANY_THROW(matmul(pd).execute(strm,
+                    {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                            {DNNL_ARG_DST, dst_mem}}));
+        }
+    }
+}
+
 } // namespace dnnl
@@ -19,6 +19,9 @@
 
 #include "oneapi/dnnl/dnnl.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <string>
 #include <vector>
 
 namespace dnnl {
@@ -389,6 +392,100 @@ HANDLE_EXCEPTIONS_FOR_TEST_P(
     ASSERT_EQ(impl_info_no_postops, impl_info_with_postops);
 }
 
+// Weights decompression with scales and zero points grouped along K is
+// handled by the fused gemv kernel for small M.
+class decomp_gemv_test_t
+    : public ::testing::TestWithParam<memory::data_type> {};
+
+HANDLE_EXCEPTIONS_FOR_TEST_P(decomp_gemv_test_t, TestGroupedScalesAndZp) {
+    using dt = memory::data_type;
+    auto engine_kind = get_test_engine_kind();
+    SKIP_IF(!DNNL_X64 || engine_kind != engine::kind::cpu,
+            "The fused gemv kernel is x64 CPU specific");
+    SKIP_IF(get_effective_cpu_isa() < cpu_isa::avx2,
+            "The fused gemv kernel requires AVX2");
+
+    const auto wei_dt = GetParam();
+    const bool is_int4 = wei_dt == dt::s4 || wei_dt == dt::u4;
+    const auto zp_dt = wei_dt == dt::s4 ? dt::s8
+            : wei_dt == dt::u4          ? dt::u8
+                                        : wei_dt;
+    const memory::dim M = 2, K = 256, N = 64, G = 32;
+
+    engine e {engine_kind, 0};
+    stream s(e);
+
+    primitive_attr attr;
+    attr.set_fpmath_mode(fpmath_mode::strict, true);
+    attr.set_scales(DNNL_ARG_WEIGHTS, (1 << 0) + (1 << 1), {G, 1}, dt::f32);
+    attr.set_zero_points(
+            DNNL_ARG_WEIGHTS, (1 << 0) + (1 << 1), {G, 1}, zp_dt);
+
+    memory::desc src_md({M, K}, dt::f32, tag::ab);
+    memory::desc wei_md({K, N}, wei_dt, tag::ab);
+    memory::desc dst_md({M, N}, dt::f32, tag::ab);
+    auto pd = matmul::primitive_desc(e, src_md, wei_md, dst_md, attr);
+    ASSERT_EQ(std::string(pd.impl_info_str()).find("jit_gemv:"), 0U)
+            << pd.impl_info_str();
+
+    memory src_m(src_md, e), wei_m(wei_md, e), dst_m(dst_md, e);
+    memory sc_m({{K / G, N}, dt::f32, tag::ab}, e);
+    memory zp_m({{K / G, N}, zp_dt, tag::ab}, e);
+
+    auto *src = static_cast<float *>(src_m.get_data_handle());
+    auto *wei = static_cast<uint8_t *>(wei_m.get_data_handle());
+    auto *sc = static_cast<float *>(sc_m.get_data_handle());
+    auto *zp = static_cast<uint8_t *>(zp_m.get_data_handle());
+    for (memory::dim i = 0; i < M * K; i++)
+        src[i] = static_cast<float>(i % 13) / 8.f - 0.75f;
+    for (size_t i = 0; i < wei_md.get_size(); i++)
+        wei[i] = static_cast<uint8_t>((i * 37 + 11) % 251);
+    for (memory::dim i = 0; i < K / G * N; i++) {
+        sc[i] = static_cast<float>(i % 5 + 1) / 4.f;
+        zp[i] = static_cast<uint8_t>(i % 7);
+    }
+
+    // Reads the weights as integers, int4 values are packed two per byte
+    // with the even element in the low half.
+    auto wei_value = [&](memory::dim idx) -> int {
+        if (!is_int4) {
+            return wei_dt == dt::s8 ? static_cast<int8_t>(wei[idx])
+                                    : static_cast<int>(wei[idx]);
+        }
+        const int v = (wei[idx / 2] >> (4 * (idx % 2))) & 0xf;
+        return wei_dt == dt::s4 && v > 7 ? v - 16 : v;
+    };
+    auto zp_value = [&](memory::dim idx) -> int {
+        return zp_dt == dt::s8 ? static_cast<int8_t>(zp[idx])
+                               : static_cast<int>(zp[idx]);
+    };
+
+    matmul(pd).execute(s,
+            {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_WEIGHTS, wei_m},
+                    {DNNL_ARG_DST, dst_m},
+                    {DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, sc_m},
+                    {DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS, zp_m}});
+    s.wait();
+
+    const auto *dst = static_cast<const float *>(dst_m.get_data_handle());
+    for (memory::dim m = 0; m < M; m++)
+        for (memory::dim n = 0; n < N; n++) {
+            float ref = 0.f;
+            for (memory::dim k = 0; k < K; k++) {
+                const memory::dim g = (k / G) * N + n;
+                ref += src[m * K + k] * sc[g]
+                        * static_cast<float>(
+                                wei_value(k * N + n) - zp_value(g));
+            }
+            const float eps = 1e-3f * std::max(1.f, std::fabs(ref));
+            ASSERT_NEAR(dst[m * N + n], ref, eps) << "m: " << m << " n: " << n;
+        }
+}
+
+INSTANTIATE_TEST_SUITE_P(Int8AndInt4, decomp_gemv_test_t,
+        ::testing::Values(memory::data_type::s8, memory::data_type::u8,
+                memory::data_type::s4, memory::data_type::u4));
+
 /********************************* TEST CASES *********************************/
 
 using iface = matmul_iface_test_t;
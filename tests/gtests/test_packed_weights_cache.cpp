@@ -0,0 +1,155 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+namespace {
+// Fills a tensor with small integers, exact in every data type used, via a
+// plain f32 copy which is kept for the reference. Non-negative values are
+// used for the source so that it fits u8.
+void fill(memory m, memory plain, int seed, bool is_src) {
+    const auto n = plain.get_desc().get_size() / sizeof(float);
+    auto *ptr = static_cast<float *>(plain.get_data_handle());
+    for (size_t i = 0; i < n; i++) {
+        const int v = static_cast<int>((i * 13 + seed * 7) % 17);
+        ptr[i] = static_cast<float>(is_src ? v : v - 8);
+    }
+    stream s(m.get_engine());
+    reorder(plain, m).execute(s, plain, m);
+    s.wait();
+}
+
+matmul::primitive_desc make_pd(const engine &eng, const memory &src,
+        const memory &wei, memory::dim M) {
+    const auto K = wei.get_desc().get_dims()[0];
+    const auto N = wei.get_desc().get_dims()[1];
+    memory::desc src_md({M, K}, src.get_desc().get_data_type(), tag::ab);
+    memory::desc dst_md({M, N}, dt::f32, tag::ab);
+    return matmul::primitive_desc(eng, src_md, wei.get_desc(), dst_md);
+}
+
+// Computes the product with the given M using the first rows of `src` and
+// compares it against a naive reference on the plain f32 copies.
+void check_matmul(const engine &eng, const memory &src, const memory &wei,
+        const memory &src_plain, const memory &wei_plain, memory::dim M) {
+    const auto K = wei.get_desc().get_dims()[0];
+    const auto N = wei.get_desc().get_dims()[1];
+    stream s(eng);
+    auto pd = make_pd(eng, src, wei, M);
+    memory src_m(pd.src_desc(), eng, src.get_data_handle());
+    memory dst_m(pd.dst_desc(), eng);
+    matmul(pd).execute(s,
+            {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst_m}});
+    s.wait();
+
+    const auto *a = static_cast<const float *>(src_plain.get_data_handle());
+    const auto *b = static_cast<const float *>(wei_plain.get_data_handle());
+    const auto *c = static_cast<const float *>(dst_m.get_data_handle());
+    for_(memory::dim m = 0; m < M; m++)
+    for (memory::dim n = 0; n < N; n++) {
+        float ref = 0.f;
+        for (memory::dim k = 0; k < K; k++)
+            ref += a[m * K + k] * b[k * N + n];
+        ASSERT_NEAR(c[m * N + n], ref, 1e-4f * (std::fabs(ref) + 1.f))
+                << "m: " << m << " n: " << n;
+    }
+}
+} // namespace
+
+TEST(packed_weights_cache_test, TestSetCapacity) {
+    const int old_capacity = get_packed_weights_cache_capacity();
+    set_packed_weights_cache_capacity(4);
+    ASSERT_EQ(get_packed_weights_cache_capacity(), 4);
+    EXPECT_ANY_THROW(set_packed_weights_cache_capacity(-1));
+    ASSERT_EQ(get_packed_weights_cache_capacity(), 4);
+    set_packed_weights_cache_capacity(old_capacity);
+}
+
+class packed_weights_cache_test_t
+    : public ::testing::TestWithParam<std::vector<dt>> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Packed weights cache is supported on CPU only.");
+        const auto src_dt = GetParam()[0], wei_dt = GetParam()[1];
+        SKIP_IF(unsupported_data_type(src_dt, wei_dt),
+                "Engine does not support this data type.");
+        Test(src_dt, wei_dt);
+    }
+
+    void Test(dt src_dt, dt wei_dt) {
+        engine eng = get_test_engine();
+        const memory::dim max_M = 37, K = 144, N = 100;
+        memory src({{max_M, K}, src_dt, tag::ab}, eng);
+        memory wei({{K, N}, wei_dt, tag::ab}, eng);
+        memory src_plain({{max_M, K}, dt::f32, tag::ab}, eng);
+        memory wei_plain({{K, N}, dt::f32, tag::ab}, eng);
+        memory old_wei_plain({{K, N}, dt::f32, tag::ab}, eng);
+        fill(src, src_plain, 1, true);
+        fill(wei, old_wei_plain, 2, false);
+
+        // Only brgemm matmul packs plain weights into the cache.
+        const std::string impl_name
+                = make_pd(eng, src, wei, max_M).impl_info_str();
+        SKIP_IF(impl_name.find("brg_matmul") != 0,
+                "Weights are not packed by the implementation.");
+
+        const int old_capacity = get_packed_weights_cache_capacity();
+        set_packed_weights_cache_capacity(4);
+        check_matmul(eng, src, wei, src_plain, old_wei_plain, max_M);
+
+        // Later executions read the cached copy instead of packing the
+        // weights, so an update isn't seen until the copy is invalidated.
+        fill(wei, wei_plain, 3, false);
+        check_matmul(eng, src, wei, src_plain, old_wei_plain, max_M);
+        packed_weights_cache_invalidate(wei.get_data_handle());
+        check_matmul(eng, src, wei, src_plain, wei_plain, max_M);
+        check_matmul(eng, src, wei, src_plain, wei_plain, 5);
+
+        fill(wei, wei_plain, 4, false);
+        packed_weights_cache_invalidate();
+        check_matmul(eng, src, wei, src_plain, wei_plain, max_M);
+
+        // Without the cache the weights are repacked on every execution.
+        set_packed_weights_cache_capacity(0);
+        fill(wei, wei_plain, 5, false);
+        check_matmul(eng, src, wei, src_plain, wei_plain, max_M);
+        set_packed_weights_cache_capacity(old_capacity);
+    }
+};
+
+TEST_P(packed_weights_cache_test_t, TestSharedWeights) {}
+
+// f32 matmul with plain weights is dispatched to gemm, which reads them in
+// place.
+INSTANTIATE_TEST_SUITE_P(TestPackedWeightsCache, packed_weights_cache_test_t,
+        ::testing::Values(std::vector<dt> {dt::bf16, dt::bf16},
+                std::vector<dt> {dt::u8, dt::s8}));
+
+} // namespace dnnl
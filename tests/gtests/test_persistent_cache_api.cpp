@@ -14,6 +14,16 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <dirent.h>
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -61,6 +71,82 @@ HANDLE_EXCEPTIONS_FOR_TEST(
     }
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST(
+        persistent_cache_api_test_t, TestPersistentCacheDir) {
+    const std::string old_dir = get_persistent_cache_dir();
+
+    ASSERT_NO_THROW(set_persistent_cache_dir("."));
+    ASSERT_EQ(get_persistent_cache_dir(), ".");
+
+    ASSERT_NO_THROW(set_persistent_cache_dir(""));
+    ASSERT_TRUE(get_persistent_cache_dir().empty());
+
+    set_persistent_cache_dir(old_dir);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+namespace {
+std::vector<std::string> list_blobs(const std::string &dir) {
+    std::vector<std::string> files;
+    DIR *d = opendir(dir.c_str());
+    if (!d) return files;
+    while (struct dirent *e = readdir(d)) {
+        const std::string name = e->d_name;
+        if (name != "." && name != "..") files.push_back(dir + "/" + name);
+    }
+    closedir(d);
+    return files;
+}
+} // namespace
+
+HANDLE_EXCEPTIONS_FOR_TEST(
+        persistent_cache_api_test_t, TestPersistentCacheDirBlobs) {
+    char dir_template[] = "/tmp/dnnl_persistent_cache_XXXXXX";
+    ASSERT_NE(mkdtemp(dir_template), nullptr);
+    const std::string dir = dir_template;
+    const std::string old_dir = get_persistent_cache_dir();
+    set_persistent_cache_dir(dir);
+
+    // Every creation goes through the persistent cache when the primitive
+    // cache is disabled.
+    const int old_capacity = get_primitive_cache_capacity();
+    set_primitive_cache_capacity(0);
+
+    engine e = get_test_engine();
+    auto pd = convolution_forward::primitive_desc {e,
+            prop_kind::forward_training, algorithm::convolution_direct,
+            {{2, 16, 16, 16}, memory::data_type::f32, memory::format_tag::nchw},
+            {{16, 16, 3, 3}, memory::data_type::f32, memory::format_tag::oihw},
+            {{2, 16, 14, 14}, memory::data_type::f32, memory::format_tag::nchw},
+            {1, 1}, {0, 0}, {0, 0}};
+    auto p = convolution_forward(pd);
+    auto blobs = list_blobs(dir);
+
+    if (pd.get_cache_blob_id().empty()) {
+        // Primitives without cache blob support, e.g. all CPU ones, are
+        // created as usual and leave the directory untouched.
+        ASSERT_TRUE(blobs.empty());
+    } else {
+        ASSERT_EQ(blobs.size(), 1U);
+        const auto cache_blob = p.get_cache_blob();
+        ASSERT_EQ(convolution_forward(pd).get_cache_blob(), cache_blob);
+        ASSERT_EQ(list_blobs(dir), blobs);
+
+        // A corrupted blob is ignored and creation falls back to compiling
+        // the kernels.
+        std::ofstream(blobs[0], std::ios::binary | std::ios::trunc)
+                << "ONEDNNPC corrupted";
+        ASSERT_EQ(convolution_forward(pd).get_cache_blob(), cache_blob);
+    }
+
+    set_primitive_cache_capacity(old_capacity);
+    set_persistent_cache_dir(old_dir);
+    for (const auto &f : list_blobs(dir))
+        unlink(f.c_str());
+    rmdir(dir.c_str());
+}
+#endif
+
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
 HANDLE_EXCEPTIONS_FOR_TEST(
         persistent_cache_api_test_t, TestPersistentCacheAPIEngine) {
@@ -0,0 +1,187 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl_ukernel.hpp"
+
+namespace dnnl {
+
+using namespace dnnl::ukernel;
+using dt = memory::data_type;
+
+class ukernel_brgemm_test_t : public ::testing::Test {
+protected:
+    static constexpr memory::dim M = 4, N = 32, K = 64, batch_size = 3;
+
+    void SetUp() override {
+        pack_ = brgemm::get_B_pack_type(dt::u8, dt::s8);
+        if (pack_ == pack_type::undef) return;
+
+        A_.resize(batch_size);
+        B_.resize(batch_size);
+        for (memory::dim b = 0; b < batch_size; b++) {
+            A_[b].resize(M * K);
+            B_[b].resize(K * N);
+            for (memory::dim i = 0; i < M * K; i++)
+                A_[b][i] = static_cast<uint8_t>((i * 3 + b) % 7);
+            for (memory::dim i = 0; i < K * N; i++)
+                B_[b][i] = static_cast<int8_t>((i * 5 + b) % 9 - 4);
+        }
+    }
+
+    // Returns C = sum_b A_b * B_b with plain A_b of M x K and B_b of K x N.
+    std::vector<int32_t> ref() const {
+        std::vector<int32_t> C(M * N, 0);
+        for (memory::dim b = 0; b < batch_size; b++)
+            for (memory::dim m = 0; m < M; m++)
+                for (memory::dim n = 0; n < N; n++)
+                    for (memory::dim k = 0; k < K; k++)
+                        C[m * N + n] += A_[b][m * K + k] * B_[b][k * N + n];
+        return C;
+    }
+
+    brgemm make_brgemm() const {
+        brgemm brg(M, N, K, batch_size, /* lda = */ K, /* ldb = */ N,
+                /* ldc = */ N, dt::u8, dt::s8, dt::s32);
+        brg.set_add_C(false);
+        return brg;
+    }
+
+    std::vector<const void *> A_ptrs() const {
+        std::vector<const void *> ptrs;
+        for (const auto &A : A_)
+            ptrs.push_back(A.data());
+        return ptrs;
+    }
+
+    pack_type pack_ = pack_type::undef;
+    std::vector<std::vector<uint8_t>> A_;
+    std::vector<std::vector<int8_t>> B_;
+};
+
+TEST_F(ukernel_brgemm_test_t, PointerArrays) {
+    if (pack_ == pack_type::undef) return;
+
+    auto brg = make_brgemm();
+    ASSERT_TRUE(brg.finalize());
+    brg.generate();
+    std::vector<uint8_t> scratchpad(brg.get_scratchpad_size());
+
+    // Blocks of B come from unrelated allocations, which can't be described
+    // with offsets from a common base.
+    std::vector<std::vector<int8_t>> B_packed(batch_size);
+    std::vector<const void *> B_ptrs;
+    transform pack_B(K, N, pack_type::no_trans, /* in_ld = */ N,
+            /* out_ld = */ N, dt::s8, dt::s8);
+    if (pack_ != pack_type::no_trans) pack_B.generate();
+    for (memory::dim b = 0; b < batch_size; b++) {
+        if (pack_ == pack_type::no_trans) {
+            B_ptrs.push_back(B_[b].data());
+            continue;
+        }
+        B_packed[b].resize(K * N);
+        pack_B.execute(B_[b].data(), B_packed[b].data());
+        B_ptrs.push_back(B_packed[b].data());
+    }
+
+    std::vector<int32_t> C(M * N, -1);
+    brg.set_hw_context();
+    brg.execute(A_ptrs(), B_ptrs, C.data(), scratchpad.data());
+    brgemm::release_hw_context();
+
+    ASSERT_EQ(C, ref());
+}
+
+TEST_F(ukernel_brgemm_test_t, PackBOnExecution) {
+    if (pack_ == pack_type::undef || pack_ == pack_type::no_trans) return;
+
+    auto brg = make_brgemm();
+    brg.set_pack_B(pack_type::no_trans, /* in_ld = */ N);
+    ASSERT_TRUE(brg.finalize());
+    brg.generate();
+    std::vector<uint8_t> scratchpad(brg.get_scratchpad_size());
+
+    std::vector<const void *> B_ptrs;
+    for (const auto &B : B_)
+        B_ptrs.push_back(B.data());
+
+    const auto C_ref = ref();
+    std::vector<int32_t> C(M * N, -1);
+    brg.set_hw_context();
+    brg.execute(A_ptrs(), B_ptrs, C.data(), scratchpad.data());
+    ASSERT_EQ(C, C_ref);
+
+    // Blocks are packed on first use and the copies are reused by later calls
+    // on the thread, so an update of B isn't seen until the context is
+    // released.
+    for (auto &v : B_[0])
+        v = static_cast<int8_t>(-v);
+    std::fill(C.begin(), C.end(), -1);
+    brg.execute(A_ptrs(), B_ptrs, C.data(), scratchpad.data());
+    ASSERT_EQ(C, C_ref);
+
+    brgemm::release_hw_context();
+    brg.set_hw_context();
+    brg.execute(A_ptrs(), B_ptrs, C.data(), scratchpad.data());
+    brgemm::release_hw_context();
+    ASSERT_EQ(C, ref());
+    ASSERT_NE(C, C_ref);
+}
+
+TEST_F(ukernel_brgemm_test_t, PackBOnExecutionIsPerObject) {
+    if (pack_ == pack_type::undef || pack_ == pack_type::no_trans) return;
+
+    // The second object reads B with a different leading dimension, so it
+    // must not pick up packed copies made by the first one.
+    auto brg = make_brgemm();
+    brg.set_pack_B(pack_type::no_trans, /* in_ld = */ N);
+    ASSERT_TRUE(brg.finalize());
+    brg.generate();
+
+    const memory::dim N_half = N / 2;
+    brgemm brg_half(M, N_half, K, batch_size, /* lda = */ K, /* ldb = */ 16,
+            /* ldc = */ N_half, dt::u8, dt::s8, dt::s32);
+    brg_half.set_add_C(false);
+    brg_half.set_pack_B(pack_type::no_trans, /* in_ld = */ N);
+    ASSERT_TRUE(brg_half.finalize());
+    brg_half.generate();
+
+    std::vector<uint8_t> scratchpad(std::max(
+            brg.get_scratchpad_size(), brg_half.get_scratchpad_size()));
+    std::vector<const void *> B_ptrs;
+    for (const auto &B : B_)
+        B_ptrs.push_back(B.data());
+
+    std::vector<int32_t> C(M * N, -1), C_half(M * N_half, -1);
+    brg.set_hw_context();
+    brg.execute(A_ptrs(), B_ptrs, C.data(), scratchpad.data());
+    brg_half.set_hw_context();
+    brg_half.execute(A_ptrs(), B_ptrs, C_half.data(), scratchpad.data());
+    brgemm::release_hw_context();
+
+    const auto C_ref = ref();
+    ASSERT_EQ(C, C_ref);
+    for (memory::dim m = 0; m < M; m++)
+        for (memory::dim n = 0; n < N_half; n++)
+            ASSERT_EQ(C_half[m * N_half + n], C_ref[m * N + n]);
+}
+
+} // namespace dnnl